@@ -0,0 +1,293 @@
+#!/usr/bin/env python3
+"""
+Hidden tab benchmark for the BrowserOS hidden tab pool.
+
+Launches a built browser once with the BrowserOsHiddenTabPool feature (the
+default) and once without it, and in each creates hidden tabs over the
+BrowserOS CDP server (Browser.createTab with hidden=true), closing each one
+before creating the next. Every hidden tab created with a URL logs one line
+once its first navigation commits:
+
+    browseros: Hidden tab first navigation pooled=1 latency_ms=38
+
+The latency is measured from the tab being created. The same number is
+recorded as BrowserOS.HiddenTab.CreateToFirstNavigation.{Pooled,Fresh}.
+
+Tabs are created --interval seconds apart so the pool can refill in between,
+as it would between the steps of a scheduled agent. With the pool enabled,
+tabs that still had to be created from scratch are counted as misses.
+
+Requirements:
+- Python 3.12+
+- A BrowserOS build that includes the hidden tab pool
+
+Usage:
+    python hidden_tab_benchmark.py --binary out/Default/chrome [--runs 20]
+"""
+
+import argparse
+import base64
+import json
+import os
+import queue
+import re
+import shutil
+import socket
+import statistics
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import urllib.request
+from dataclasses import dataclass
+from pathlib import Path
+from urllib.parse import urlparse
+
+FEATURE = "BrowserOsHiddenTabPool"
+RESULT_RE = re.compile(
+    r"browseros: Hidden tab first navigation pooled=(\d) latency_ms=(\d+)"
+)
+MODES = {"pooled": True, "fresh": False}
+DEFAULT_URL = "data:text/html,<title>hidden tab benchmark</title>"
+
+
+@dataclass
+class Sample:
+    pooled: bool
+    latency_ms: int
+
+
+class CDPConnection:
+    """Just enough of a WebSocket client to send CDP commands."""
+
+    def __init__(self, ws_url: str, timeout: float):
+        url = urlparse(ws_url)
+        self._sock = socket.create_connection((url.hostname, url.port), timeout)
+        key = base64.b64encode(os.urandom(16)).decode()
+        self._sock.sendall(
+            (
+                f"GET {url.path} HTTP/1.1\r\n"
+                f"Host: {url.hostname}:{url.port}\r\n"
+                "Upgrade: websocket\r\n"
+                "Connection: Upgrade\r\n"
+                f"Sec-WebSocket-Key: {key}\r\n"
+                "Sec-WebSocket-Version: 13\r\n\r\n"
+            ).encode()
+        )
+        response = b""
+        while b"\r\n\r\n" not in response:
+            chunk = self._sock.recv(4096)
+            if not chunk:
+                raise ConnectionError("CDP server closed during handshake")
+            response += chunk
+        if b" 101 " not in response.split(b"\r\n", 1)[0]:
+            raise ConnectionError(f"WebSocket handshake failed: {response!r}")
+        self._buffer = response.split(b"\r\n\r\n", 1)[1]
+        self._next_id = 1
+
+    def close(self) -> None:
+        self._sock.close()
+
+    def send(self, method: str, params: dict) -> dict:
+        """Send a command and return its result, skipping any events."""
+        command_id = self._next_id
+        self._next_id += 1
+        self._write(json.dumps({"id": command_id, "method": method, "params": params}))
+        while True:
+            message = json.loads(self._read())
+            if message.get("id") != command_id:
+                continue
+            if "error" in message:
+                raise RuntimeError(f"{method} failed: {message['error']}")
+            return message["result"]
+
+    def _write(self, text: str) -> None:
+        payload = text.encode()
+        header = bytes([0x81])
+        if len(payload) < 126:
+            header += bytes([0x80 | len(payload)])
+        elif len(payload) < 1 << 16:
+            header += bytes([0x80 | 126]) + struct.pack("!H", len(payload))
+        else:
+            header += bytes([0x80 | 127]) + struct.pack("!Q", len(payload))
+        mask = os.urandom(4)
+        masked = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+        self._sock.sendall(header + mask + masked)
+
+    def _read_exact(self, size: int) -> bytes:
+        while len(self._buffer) < size:
+            chunk = self._sock.recv(65536)
+            if not chunk:
+                raise ConnectionError("CDP server closed the connection")
+            self._buffer += chunk
+        data, self._buffer = self._buffer[:size], self._buffer[size:]
+        return data
+
+    def _read(self) -> str:
+        message = b""
+        while True:
+            first, second = self._read_exact(2)
+            size = second & 0x7F
+            if size == 126:
+                (size,) = struct.unpack("!H", self._read_exact(2))
+            elif size == 127:
+                (size,) = struct.unpack("!Q", self._read_exact(8))
+            message += self._read_exact(size)
+            # The server never masks or sends control frames mid-message.
+            if first & 0x80:
+                return message.decode()
+
+
+def wait_for_cdp(port: int, timeout: float) -> str:
+    """Return the browser WebSocket URL once the CDP server answers."""
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        try:
+            with urllib.request.urlopen(
+                f"http://127.0.0.1:{port}/json/version", timeout=2
+            ) as response:
+                return json.load(response)["webSocketDebuggerUrl"]
+        except OSError:
+            time.sleep(0.5)
+    raise TimeoutError(f"CDP server did not start on port {port}")
+
+
+def run_mode(
+    binary: Path,
+    user_data_dir: Path,
+    pooled: bool,
+    args: argparse.Namespace,
+) -> list[Sample]:
+    """Launch the browser once and measure args.runs hidden tabs."""
+    feature_flag = "--enable-features" if pooled else "--disable-features"
+    proc = subprocess.Popen(
+        [
+            str(binary),
+            f"--user-data-dir={user_data_dir}",
+            f"--browseros-cdp-port={args.port}",
+            f"{feature_flag}={FEATURE}",
+            "--enable-logging=stderr",
+            "--no-first-run",
+            "--no-default-browser-check",
+            *args.extra,
+        ],
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.PIPE,
+        text=True,
+    )
+
+    results: queue.Queue[Sample] = queue.Queue()
+
+    def read_log() -> None:
+        assert proc.stderr is not None
+        for line in proc.stderr:
+            match = RESULT_RE.search(line)
+            if match:
+                results.put(Sample(bool(int(match.group(1))), int(match.group(2))))
+
+    threading.Thread(target=read_log, daemon=True).start()
+
+    samples: list[Sample] = []
+    connection = None
+    try:
+        connection = CDPConnection(
+            wait_for_cdp(args.port, args.timeout), args.timeout
+        )
+        # Let the pool warm up after the session starts.
+        time.sleep(args.interval)
+        for run in range(args.runs):
+            tab = connection.send(
+                "Browser.createTab", {"url": args.url, "hidden": True}
+            )["tab"]
+            try:
+                sample = results.get(timeout=args.timeout)
+            except queue.Empty:
+                print(f"✗ Tab {run + 1}: no first navigation within timeout")
+                sample = None
+            connection.send("Browser.closeTab", {"tabId": tab["tabId"]})
+            if sample is not None:
+                samples.append(sample)
+                source = "pooled" if sample.pooled else "fresh"
+                print(f"✓ Tab {run + 1}: {sample.latency_ms}ms ({source})")
+            time.sleep(args.interval)
+    finally:
+        if connection is not None:
+            connection.close()
+        proc.terminate()
+        try:
+            proc.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            proc.kill()
+            proc.wait()
+    return samples
+
+
+def percentile(values: list[int], pct: float) -> int:
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, round(pct / 100 * (len(ordered) - 1)))
+    return ordered[index]
+
+
+def summarize(name: str, samples: list[Sample]) -> None:
+    values = [sample.latency_ms for sample in samples]
+    misses = sum(1 for sample in samples if not sample.pooled)
+    line = (
+        f"  {name:<7} create_to_nav_ms "
+        f"median={statistics.median(values):>7.0f}  "
+        f"p90={percentile(values, 90):>6}  "
+        f"min={min(values):>6}  max={max(values):>6}"
+    )
+    if MODES[name]:
+        line += f"  pool_misses={misses}/{len(samples)}"
+    print(line)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--binary", type=Path, required=True)
+    parser.add_argument("--runs", type=int, default=20, help="hidden tabs per mode")
+    parser.add_argument("--port", type=int, default=9333, help="CDP port to use")
+    parser.add_argument("--url", default=DEFAULT_URL, help="URL for hidden tabs")
+    parser.add_argument(
+        "--interval",
+        type=float,
+        default=2.0,
+        help="seconds between closing a tab and creating the next",
+    )
+    parser.add_argument("--timeout", type=float, default=60.0)
+    parser.add_argument(
+        "extra", nargs="*", help="extra browser switches (after --)", default=[]
+    )
+    args = parser.parse_args()
+
+    if not args.binary.exists():
+        print(f"✗ Error: Binary not found: {args.binary}")
+        return 1
+
+    root = Path(tempfile.mkdtemp(prefix="browseros_hidden_tab_"))
+    samples: dict[str, list[Sample]] = {}
+    try:
+        for mode, pooled in MODES.items():
+            print(f"Measuring {mode} hidden tabs...")
+            try:
+                samples[mode] = run_mode(args.binary, root / mode, pooled, args)
+            except (OSError, RuntimeError, TimeoutError) as error:
+                print(f"✗ Error ({mode}): {error}")
+                samples[mode] = []
+    finally:
+        shutil.rmtree(root, ignore_errors=True)
+
+    if not all(samples.values()):
+        print("✗ Error: A mode produced no samples")
+        return 1
+
+    print("\nResults:")
+    for mode in MODES:
+        summarize(mode, samples[mode])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
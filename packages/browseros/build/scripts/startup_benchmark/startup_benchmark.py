@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+Startup benchmark for BrowserOS background work scheduling.
+
+Launches a built browser repeatedly, alternating between deferred startup
+(the BrowserOsDeferredStartup feature, the default) and running all BrowserOS
+background work immediately. Each launch logs one line once both browser
+startup is complete (AfterStartupTaskUtils) and the first healthy BrowserOS
+server have been seen:
+
+    browseros: Startup benchmark deferred=1 startup_complete_ms=812 agent_ready_ms=1490
+
+Both times are measured from browser process creation. The same numbers are
+recorded as BrowserOS.Startup.TimeToStartupComplete.{Deferred,Immediate} and
+BrowserOS.Startup.TimeToAgentReady.{Deferred,Immediate}.
+
+Each mode uses its own profile, warmed by one discarded launch, so the
+numbers describe a returning user (cached extension config, installed
+extensions). Pass --cold to use a fresh profile for every launch instead.
+
+Requirements:
+- Python 3.12+
+- A BrowserOS build that includes the startup scheduler
+
+Usage:
+    python startup_benchmark.py --binary out/Default/chrome [--runs 10]
+"""
+
+import argparse
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import threading
+from dataclasses import dataclass
+from pathlib import Path
+
+FEATURE = "BrowserOsDeferredStartup"
+RESULT_RE = re.compile(
+    r"browseros: Startup benchmark deferred=(\d) "
+    r"startup_complete_ms=(\d+) agent_ready_ms=(\d+)"
+)
+MODES = {"deferred": True, "immediate": False}
+
+
+@dataclass
+class Sample:
+    startup_complete_ms: int
+    agent_ready_ms: int
+
+
+def launch(
+    binary: Path, user_data_dir: Path, deferred: bool, timeout: float, extra: list[str]
+) -> Sample | None:
+    """Launch the browser once and return its startup sample."""
+    feature_flag = "--enable-features" if deferred else "--disable-features"
+    args = [
+        str(binary),
+        f"--user-data-dir={user_data_dir}",
+        f"{feature_flag}={FEATURE}",
+        "--enable-logging=stderr",
+        "--no-first-run",
+        "--no-default-browser-check",
+        *extra,
+    ]
+    proc = subprocess.Popen(
+        args, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True
+    )
+    # Killing the browser closes stderr, which ends the read loop below.
+    watchdog = threading.Timer(timeout, proc.kill)
+    watchdog.start()
+    sample = None
+    try:
+        assert proc.stderr is not None
+        for line in proc.stderr:
+            match = RESULT_RE.search(line)
+            if match:
+                if bool(int(match.group(1))) != deferred:
+                    print(f"✗ Feature state mismatch in: {line.strip()}")
+                    break
+                sample = Sample(int(match.group(2)), int(match.group(3)))
+                break
+    finally:
+        watchdog.cancel()
+        proc.terminate()
+        try:
+            proc.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            proc.kill()
+            proc.wait()
+    return sample
+
+
+def percentile(values: list[int], pct: float) -> int:
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, round(pct / 100 * (len(ordered) - 1)))
+    return ordered[index]
+
+
+def summarize(name: str, samples: list[Sample]) -> None:
+    for metric in ("startup_complete_ms", "agent_ready_ms"):
+        values = [getattr(sample, metric) for sample in samples]
+        print(
+            f"  {name:<10} {metric:<19} "
+            f"median={statistics.median(values):>7.0f}  "
+            f"p90={percentile(values, 90):>6}  "
+            f"min={min(values):>6}  max={max(values):>6}"
+        )
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--binary", type=Path, required=True)
+    parser.add_argument("--runs", type=int, default=10, help="launches per mode")
+    parser.add_argument("--timeout", type=float, default=120.0)
+    parser.add_argument(
+        "--cold", action="store_true", help="use a fresh profile for every launch"
+    )
+    parser.add_argument(
+        "extra", nargs="*", help="extra browser switches (after --)", default=[]
+    )
+    args = parser.parse_args()
+
+    if not args.binary.exists():
+        print(f"✗ Error: Binary not found: {args.binary}")
+        return 1
+
+    root = Path(tempfile.mkdtemp(prefix="browseros_startup_"))
+    samples: dict[str, list[Sample]] = {mode: [] for mode in MODES}
+    try:
+        if not args.cold:
+            for mode, deferred in MODES.items():
+                print(f"Warming {mode} profile...")
+                launch(args.binary, root / mode, deferred, args.timeout, args.extra)
+
+        # Interleave modes so machine-wide drift affects both equally.
+        for run in range(args.runs):
+            for mode, deferred in MODES.items():
+                profile = root / (f"{mode}-{run}" if args.cold else mode)
+                sample = launch(
+                    args.binary, profile, deferred, args.timeout, args.extra
+                )
+                if sample is None:
+                    print(f"✗ Run {run + 1} ({mode}): no result within timeout")
+                    continue
+                samples[mode].append(sample)
+                print(
+                    f"✓ Run {run + 1} ({mode}): "
+                    f"startup_complete={sample.startup_complete_ms}ms"
+                    f" agent_ready={sample.agent_ready_ms}ms"
+                )
+    finally:
+        shutil.rmtree(root, ignore_errors=True)
+
+    if not all(samples.values()):
+        print("✗ Error: A mode produced no samples")
+        return 1
+
+    print("\nResults:")
+    for mode in MODES:
+        summarize(mode, samples[mode])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
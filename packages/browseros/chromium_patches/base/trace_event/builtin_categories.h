@@ -0,0 +1,14 @@
+diff --git a/base/trace_event/builtin_categories.h b/base/trace_event/builtin_categories.h
+index 3e1f0d7a52c84..9b7c40a1e0d63 100644
+--- a/base/trace_event/builtin_categories.h
++++ b/base/trace_event/builtin_categories.h
+@@ -61,6 +61,9 @@ PERFETTO_DEFINE_CATEGORIES_IN_NAMESPACE_WITH_ATTRS(
+     perfetto::Category("blink_style"),
+     perfetto::Category("Blob"),
+     perfetto::Category("browser"),
++    perfetto::Category("browseros")
++        .SetDescription("BrowserOS agent stack: MCP proxy, browserOS.* "
++                        "functions, snapshots, actions and imports."),
+     perfetto::Category("browsing_data"),
+     perfetto::Category("CacheStorage"),
+     perfetto::Category("camera"),
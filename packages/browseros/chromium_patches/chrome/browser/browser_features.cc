@@ -2,7 +2,7 @@ diff --git a/chrome/browser/browser_features.cc b/chrome/browser/browser_feature
 index ed397bd22e079..a765f2c515516 100644
 --- a/chrome/browser/browser_features.cc
 +++ b/chrome/browser/browser_features.cc
-@@ -41,6 +41,16 @@ BASE_FEATURE(kBookmarkTriggerForPreconnect, base::FEATURE_DISABLED_BY_DEFAULT);
+@@ -41,6 +41,33 @@ BASE_FEATURE(kBookmarkTriggerForPreconnect, base::FEATURE_DISABLED_BY_DEFAULT);
  // crbug.com/413259638 for more details of Bookmark triggered prefetching.
  BASE_FEATURE(kBookmarkTriggerForPrefetch, base::FEATURE_DISABLED_BY_DEFAULT);
  
@@ -12,6 +12,23 @@ index ed397bd22e079..a765f2c515516 100644
 +// Enables Clawdbot Browser Relay extension.
 +BASE_FEATURE(kBrowserOsClawdbot, base::FEATURE_DISABLED_BY_DEFAULT);
 +
++// Defers BrowserOS background startup work (extension installs, maintenance,
++// server updates) until browser startup is complete. Disable to
++// benchmark against running it all immediately.
++BASE_FEATURE(kBrowserOsDeferredStartup, base::FEATURE_ENABLED_BY_DEFAULT);
++
++// Enforces per-profile budgets on hidden tabs (count and memory) and freezes
++// or discards idle ones. Params: "max_tabs" (default 20), "max_memory_mb"
++// (default 2048), "freeze_after_seconds" (default 120) and
++// "discard_after_seconds" (default 900).
++BASE_FEATURE(kBrowserOsHiddenTabBudget, base::FEATURE_ENABLED_BY_DEFAULT);
++
++// Keeps pre-initialized hidden tabs with spare renderers ready for the
++// Browser CDP domain. Params: "pool_size" (default 2) and "max_memory_mb"
++// (default 512). Disable to benchmark against creating every hidden tab
++// from scratch.
++BASE_FEATURE(kBrowserOsHiddenTabPool, base::FEATURE_ENABLED_BY_DEFAULT);
++
 +// Enables BrowserOS keyboard shortcuts (Option+K, Option+L, Option+A, etc.).
 +// Disable this on keyboards where Option+letter produces special characters.
 +BASE_FEATURE(kBrowserOsKeyboardShortcuts, base::FEATURE_ENABLED_BY_DEFAULT);
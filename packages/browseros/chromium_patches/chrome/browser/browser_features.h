@@ -2,12 +2,15 @@ diff --git a/chrome/browser/browser_features.h b/chrome/browser/browser_features
 index 5737721a47154..5ad629ba0ea88 100644
 --- a/chrome/browser/browser_features.h
 +++ b/chrome/browser/browser_features.h
-@@ -35,6 +35,9 @@ BASE_DECLARE_FEATURE(kAllowUnmutedAutoplayForTWA);
+@@ -35,6 +35,12 @@ BASE_DECLARE_FEATURE(kAllowUnmutedAutoplayForTWA);
  BASE_DECLARE_FEATURE(kAutocompleteActionPredictorConfidenceCutoff);
  BASE_DECLARE_FEATURE(kBookmarksTreeView);
  BASE_DECLARE_FEATURE(kBookmarkTriggerForPrerender2KillSwitch);
 +BASE_DECLARE_FEATURE(kBrowserOsAlphaFeatures);
 +BASE_DECLARE_FEATURE(kBrowserOsClawdbot);
++BASE_DECLARE_FEATURE(kBrowserOsDeferredStartup);
++BASE_DECLARE_FEATURE(kBrowserOsHiddenTabBudget);
++BASE_DECLARE_FEATURE(kBrowserOsHiddenTabPool);
 +BASE_DECLARE_FEATURE(kBrowserOsKeyboardShortcuts);
  BASE_DECLARE_FEATURE(kBookmarkTriggerForPreconnect);
  BASE_DECLARE_FEATURE(kBookmarkTriggerForPrefetch);
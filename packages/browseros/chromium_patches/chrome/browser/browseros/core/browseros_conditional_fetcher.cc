@@ -0,0 +1,259 @@
+diff --git a/chrome/browser/browseros/core/browseros_conditional_fetcher.cc b/chrome/browser/browseros/core/browseros_conditional_fetcher.cc
+new file mode 100644
+index 0000000000000..1866e9e93247d
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_conditional_fetcher.cc
+@@ -0,0 +1,253 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_conditional_fetcher.h"
++
++#include <utility>
++
++#include "base/files/file_util.h"
++#include "base/files/important_file_writer.h"
++#include "base/functional/bind.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/rand_util.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "base/values.h"
++#include "net/base/load_flags.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
++#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++
++namespace browseros {
++
++struct BrowserOSConditionalFetcher::Entry {
++  Entry();
++  Entry(const Entry&);
++  Entry& operator=(const Entry&);
++  ~Entry();
++
++  std::string etag;
++  std::string last_modified;
++  std::string body;
++};
++
++BrowserOSConditionalFetcher::Entry::Entry() = default;
++BrowserOSConditionalFetcher::Entry::Entry(const Entry&) = default;
++BrowserOSConditionalFetcher::Entry&
++BrowserOSConditionalFetcher::Entry::operator=(const Entry&) = default;
++BrowserOSConditionalFetcher::Entry::~Entry() = default;
++
++base::TimeDelta GetJitteredDelay(base::TimeDelta delay, double fraction) {
++  return delay * (1.0 - fraction + 2.0 * fraction * base::RandDouble());
++}
++
++// static
++std::optional<BrowserOSConditionalFetcher::Entry>
++BrowserOSConditionalFetcher::ReadCache(const base::FilePath& path,
++                                       const GURL& url) {
++  std::string contents;
++  if (!base::ReadFileToString(path, &contents)) {
++    return std::nullopt;
++  }
++  std::optional<base::Value::Dict> dict =
++      base::JSONReader::ReadDict(contents, base::JSON_PARSE_RFC);
++  if (!dict) {
++    return std::nullopt;
++  }
++  // A cache written for another URL (e.g. before switching to the alpha
++  // channel) must not be used to validate this one.
++  const std::string* cached_url = dict->FindString("url");
++  const std::string* body = dict->FindString("body");
++  if (!cached_url || *cached_url != url.spec() || !body) {
++    return std::nullopt;
++  }
++  Entry entry;
++  entry.body = *body;
++  if (const std::string* etag = dict->FindString("etag")) {
++    entry.etag = *etag;
++  }
++  if (const std::string* last_modified = dict->FindString("last_modified")) {
++    entry.last_modified = *last_modified;
++  }
++  return entry;
++}
++
++// static
++void BrowserOSConditionalFetcher::WriteCache(const base::FilePath& path,
++                                             const GURL& url,
++                                             const Entry& entry) {
++  std::optional<std::string> json =
++      base::WriteJson(base::Value::Dict()
++                          .Set("url", url.spec())
++                          .Set("etag", entry.etag)
++                          .Set("last_modified", entry.last_modified)
++                          .Set("body", entry.body));
++  if (!json || !base::CreateDirectory(path.DirName()) ||
++      !base::ImportantFileWriter::WriteFileAtomically(path, *json)) {
++    LOG(WARNING) << "browseros: Failed to cache " << url.spec();
++  }
++}
++
++BrowserOSConditionalFetcher::BrowserOSConditionalFetcher(
++    const GURL& url,
++    const base::FilePath& cache_path,
++    size_t max_body_size,
++    const net::NetworkTrafficAnnotationTag& annotation)
++    : url_(url),
++      cache_path_(cache_path),
++      max_body_size_(max_body_size),
++      annotation_(annotation),
++      task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
++           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
++  task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE, base::BindOnce(&ReadCache, cache_path_, url_),
++      base::BindOnce(&BrowserOSConditionalFetcher::OnCacheLoaded,
++                     weak_factory_.GetWeakPtr()));
++}
++
++BrowserOSConditionalFetcher::~BrowserOSConditionalFetcher() = default;
++
++void BrowserOSConditionalFetcher::SetTimeout(base::TimeDelta timeout) {
++  timeout_ = timeout;
++}
++
++void BrowserOSConditionalFetcher::LoadCached(CachedCallback callback) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  WhenCacheLoaded(base::BindOnce(&BrowserOSConditionalFetcher::RunLoadCached,
++                                 weak_factory_.GetWeakPtr(),
++                                 std::move(callback)));
++}
++
++void BrowserOSConditionalFetcher::Fetch(
++    scoped_refptr<network::SharedURLLoaderFactory> factory,
++    FetchCallback callback) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  Cancel();
++  WhenCacheLoaded(base::BindOnce(&BrowserOSConditionalFetcher::StartFetch,
++                                 weak_factory_.GetWeakPtr(),
++                                 std::move(factory), std::move(callback)));
++}
++
++void BrowserOSConditionalFetcher::Cancel() {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  loader_.reset();
++  callback_.Reset();
++}
++
++void BrowserOSConditionalFetcher::WhenCacheLoaded(base::OnceClosure task) {
++  if (cache_loaded_) {
++    std::move(task).Run();
++    return;
++  }
++  pending_tasks_.push_back(std::move(task));
++}
++
++void BrowserOSConditionalFetcher::OnCacheLoaded(std::optional<Entry> entry) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  if (entry) {
++    cached_ = std::make_unique<Entry>(std::move(*entry));
++  }
++  cache_loaded_ = true;
++  std::vector<base::OnceClosure> tasks = std::move(pending_tasks_);
++  for (base::OnceClosure& task : tasks) {
++    std::move(task).Run();
++  }
++}
++
++void BrowserOSConditionalFetcher::RunLoadCached(CachedCallback callback) {
++  std::move(callback).Run(cached_ ? std::optional<std::string>(cached_->body)
++                                  : std::nullopt);
++}
++
++void BrowserOSConditionalFetcher::StartFetch(
++    scoped_refptr<network::SharedURLLoaderFactory> factory,
++    FetchCallback callback) {
++  callback_ = std::move(callback);
++
++  auto request = std::make_unique<network::ResourceRequest>();
++  request->url = url_;
++  request->method = "GET";
++  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++  // The HTTP cache would answer our own validators; we want the origin's.
++  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
++  if (cached_) {
++    if (!cached_->etag.empty()) {
++      request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
++                                 cached_->etag);
++    }
++    if (!cached_->last_modified.empty()) {
++      request->headers.SetHeader(net::HttpRequestHeaders::kIfModifiedSince,
++                                 cached_->last_modified);
++    }
++  }
++
++  loader_ = network::SimpleURLLoader::Create(std::move(request), annotation_);
++  loader_->SetAllowHttpErrorResults(true);
++  if (!timeout_.is_zero()) {
++    loader_->SetTimeoutDuration(timeout_);
++  }
++  loader_->DownloadToString(
++      factory.get(),
++      base::BindOnce(&BrowserOSConditionalFetcher::OnFetched,
++                     weak_factory_.GetWeakPtr()),
++      max_body_size_);
++}
++
++void BrowserOSConditionalFetcher::OnFetched(std::optional<std::string> body) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  std::unique_ptr<network::SimpleURLLoader> loader = std::move(loader_);
++  FetchCallback callback = std::move(callback_);
++
++  Result result;
++  const net::HttpResponseHeaders* headers =
++      loader->ResponseInfo() ? loader->ResponseInfo()->headers.get() : nullptr;
++  int response_code = headers ? headers->response_code() : 0;
++
++  if (response_code == net::HTTP_NOT_MODIFIED && cached_) {
++    result.status = Result::Status::kNotModified;
++    result.body = cached_->body;
++    std::move(callback).Run(std::move(result));
++    return;
++  }
++
++  if (!body || response_code != net::HTTP_OK) {
++    result.net_error = loader->NetError() != net::OK
++                           ? loader->NetError()
++                           : net::ERR_HTTP_RESPONSE_CODE_FAILURE;
++    LOG(WARNING) << "browseros: Fetch of " << url_.spec() << " failed: "
++                 << net::ErrorToString(result.net_error)
++                 << " (HTTP " << response_code << ")";
++    std::move(callback).Run(std::move(result));
++    return;
++  }
++
++  Entry entry;
++  entry.etag = headers->GetNormalizedHeader("ETag").value_or(std::string());
++  entry.last_modified =
++      headers->GetNormalizedHeader("Last-Modified").value_or(std::string());
++  entry.body = std::move(*body);
++
++  bool changed = !cached_ || cached_->body != entry.body;
++  if (changed || cached_->etag != entry.etag ||
++      cached_->last_modified != entry.last_modified) {
++    task_runner_->PostTask(FROM_HERE, base::BindOnce(&WriteCache, cache_path_,
++                                                     url_, entry));
++  }
++  cached_ = std::make_unique<Entry>(std::move(entry));
++
++  result.status = changed ? Result::Status::kModified
++                          : Result::Status::kNotModified;
++  result.body = cached_->body;
++  std::move(callback).Run(std::move(result));
++}
++
++}  // namespace browseros
@@ -0,0 +1,138 @@
+diff --git a/chrome/browser/browseros/core/browseros_conditional_fetcher.h b/chrome/browser/browseros/core/browseros_conditional_fetcher.h
+new file mode 100644
+index 0000000000000..767697a963f98
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_conditional_fetcher.h
+@@ -0,0 +1,132 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_CONDITIONAL_FETCHER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_CONDITIONAL_FETCHER_H_
++
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/sequence_checker.h"
++#include "base/time/time.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++#include "url/gurl.h"
++
++namespace base {
++class SequencedTaskRunner;
++}
++
++namespace network {
++class SharedURLLoaderFactory;
++class SimpleURLLoader;
++}  // namespace network
++
++namespace browseros {
++
++// Returns |delay| scaled by a random factor in [1 - |fraction|, 1 + |fraction|]
++// so that installs started together do not poll a server in lockstep.
++base::TimeDelta GetJitteredDelay(base::TimeDelta delay, double fraction);
++
++// Polls a small document (remote config, appcast) with HTTP validators.
++//
++// The last good body is kept in |cache_path| with its ETag and Last-Modified,
++// which later fetches send as If-None-Match / If-Modified-Since. A 304, or a
++// 200 with an identical body, is reported as kNotModified with the cached
++// body, so callers can skip reparsing. The cache survives restarts: it is
++// available through LoadCached() before any network request, and the first
++// fetch of a session already revalidates it.
++//
++// Threading: UI thread; the cache file is read and written on a blocking
++// sequence.
++class BrowserOSConditionalFetcher {
++ public:
++  struct Result {
++    enum class Status {
++      kModified,
++      kNotModified,
++      kFailed,
++    };
++
++    Status status = Status::kFailed;
++    // The current document for kModified and kNotModified.
++    std::string body;
++    // net::OK unless kFailed.
++    int net_error = 0;
++  };
++  using FetchCallback = base::OnceCallback<void(Result result)>;
++  using CachedCallback =
++      base::OnceCallback<void(std::optional<std::string> body)>;
++
++  BrowserOSConditionalFetcher(
++      const GURL& url,
++      const base::FilePath& cache_path,
++      size_t max_body_size,
++      const net::NetworkTrafficAnnotationTag& annotation);
++  ~BrowserOSConditionalFetcher();
++
++  BrowserOSConditionalFetcher(const BrowserOSConditionalFetcher&) = delete;
++  BrowserOSConditionalFetcher& operator=(const BrowserOSConditionalFetcher&) =
++      delete;
++
++  const GURL& url() const { return url_; }
++
++  void SetTimeout(base::TimeDelta timeout);
++
++  // Runs |callback| with the body cached by a previous fetch of url(), or
++  // nullopt if there is none. Does not touch the network.
++  void LoadCached(CachedCallback callback);
++
++  // Fetches url(), conditionally when a cached body exists. Starting a
++  // fetch cancels one in progress without running its callback.
++  void Fetch(scoped_refptr<network::SharedURLLoaderFactory> factory,
++             FetchCallback callback);
++
++  void Cancel();
++
++ private:
++  struct Entry;
++
++  // Blocking; run on |task_runner_|.
++  static std::optional<Entry> ReadCache(const base::FilePath& path,
++                                        const GURL& url);
++  static void WriteCache(const base::FilePath& path,
++                         const GURL& url,
++                         const Entry& entry);
++
++  // Runs |task| once the cache file has been read.
++  void WhenCacheLoaded(base::OnceClosure task);
++  void OnCacheLoaded(std::optional<Entry> entry);
++  void RunLoadCached(CachedCallback callback);
++  void StartFetch(scoped_refptr<network::SharedURLLoaderFactory> factory,
++                  FetchCallback callback);
++  void OnFetched(std::optional<std::string> body);
++
++  const GURL url_;
++  const base::FilePath cache_path_;
++  const size_t max_body_size_;
++  const net::NetworkTrafficAnnotationTag annotation_;
++  base::TimeDelta timeout_;
++  scoped_refptr<base::SequencedTaskRunner> task_runner_;
++
++  bool cache_loaded_ = false;
++  std::vector<base::OnceClosure> pending_tasks_;
++  std::unique_ptr<Entry> cached_;
++
++  std::unique_ptr<network::SimpleURLLoader> loader_;
++  FetchCallback callback_;
++
++  SEQUENCE_CHECKER(sequence_checker_);
++
++  base::WeakPtrFactory<BrowserOSConditionalFetcher> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_CONDITIONAL_FETCHER_H_
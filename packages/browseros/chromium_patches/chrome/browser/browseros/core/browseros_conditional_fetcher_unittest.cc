@@ -0,0 +1,221 @@
+diff --git a/chrome/browser/browseros/core/browseros_conditional_fetcher_unittest.cc b/chrome/browser/browseros/core/browseros_conditional_fetcher_unittest.cc
+new file mode 100644
+index 0000000000000..9996701f0a5d9
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_conditional_fetcher_unittest.cc
+@@ -0,0 +1,215 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_conditional_fetcher.h"
++
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/functional/bind.h"
++#include "base/memory/raw_ptr.h"
++#include "base/test/task_environment.h"
++#include "base/test/test_future.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_status_code.h"
++#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/url_loader_completion_status.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++#include "services/network/test/test_url_loader_factory.h"
++#include "services/network/test/test_utils.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++using Status = BrowserOSConditionalFetcher::Result::Status;
++
++constexpr char kUrl[] = "https://cdn.example.com/config.json";
++constexpr char kLastModified[] = "Mon, 01 Sep 2025 00:00:00 GMT";
++constexpr size_t kMaxSize = 64 * 1024;
++
++// Stands in for the config server: answers 304 when If-None-Match matches
++// the current ETag, otherwise the full document.
++class ConfigServer {
++ public:
++  explicit ConfigServer(network::TestURLLoaderFactory* factory)
++      : factory_(factory) {
++    factory_->SetInterceptor(base::BindRepeating(
++        &ConfigServer::OnRequest, base::Unretained(this)));
++  }
++
++  void SetDocument(std::string body, std::string etag) {
++    body_ = std::move(body);
++    etag_ = std::move(etag);
++  }
++
++  void SetStatus(net::HttpStatusCode status) { status_ = status; }
++
++  const std::vector<network::ResourceRequest>& requests() const {
++    return requests_;
++  }
++
++ private:
++  void OnRequest(const network::ResourceRequest& request) {
++    requests_.push_back(request);
++
++    net::HttpStatusCode code = status_;
++    if (code == net::HTTP_OK &&
++        request.headers.GetHeader("If-None-Match") == etag_) {
++      code = net::HTTP_NOT_MODIFIED;
++    }
++    auto head = network::CreateURLResponseHead(code);
++    head->headers->SetHeader("ETag", etag_);
++    head->headers->SetHeader("Last-Modified", kLastModified);
++    std::string content = code == net::HTTP_OK ? body_ : std::string();
++    network::URLLoaderCompletionStatus status(net::OK);
++    status.decoded_body_length = content.size();
++
++    factory_->ClearResponses();
++    factory_->AddResponse(GURL(kUrl), std::move(head), content, status);
++  }
++
++  raw_ptr<network::TestURLLoaderFactory> factory_;
++  net::HttpStatusCode status_ = net::HTTP_OK;
++  std::string body_;
++  std::string etag_;
++  std::vector<network::ResourceRequest> requests_;
++};
++
++class BrowserOSConditionalFetcherTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    cache_path_ = temp_dir_.GetPath().AppendASCII("config_cache.json");
++  }
++
++  std::unique_ptr<BrowserOSConditionalFetcher> CreateFetcher() {
++    return std::make_unique<BrowserOSConditionalFetcher>(
++        GURL(kUrl), cache_path_, kMaxSize, TRAFFIC_ANNOTATION_FOR_TESTS);
++  }
++
++  BrowserOSConditionalFetcher::Result Fetch(
++      BrowserOSConditionalFetcher& fetcher) {
++    base::test::TestFuture<BrowserOSConditionalFetcher::Result> future;
++    fetcher.Fetch(factory_.GetSafeWeakWrapper(), future.GetCallback());
++    BrowserOSConditionalFetcher::Result result = future.Take();
++    // Let the cache write land before the next fetcher reads it.
++    task_environment_.RunUntilIdle();
++    return result;
++  }
++
++  base::test::TaskEnvironment task_environment_;
++  base::ScopedTempDir temp_dir_;
++  base::FilePath cache_path_;
++  network::TestURLLoaderFactory factory_;
++  ConfigServer server_{&factory_};
++};
++
++TEST_F(BrowserOSConditionalFetcherTest, FirstFetchIsUnconditional) {
++  server_.SetDocument("{\"v\":1}", "\"v1\"");
++
++  std::unique_ptr<BrowserOSConditionalFetcher> fetcher = CreateFetcher();
++  BrowserOSConditionalFetcher::Result result = Fetch(*fetcher);
++  EXPECT_EQ(Status::kModified, result.status);
++  EXPECT_EQ("{\"v\":1}", result.body);
++
++  ASSERT_EQ(1u, server_.requests().size());
++  EXPECT_FALSE(server_.requests()[0].headers.HasHeader("If-None-Match"));
++  EXPECT_FALSE(server_.requests()[0].headers.HasHeader("If-Modified-Since"));
++  EXPECT_TRUE(base::PathExists(cache_path_));
++}
++
++TEST_F(BrowserOSConditionalFetcherTest, RevalidatesWithValidators) {
++  server_.SetDocument("{\"v\":1}", "\"v1\"");
++
++  std::unique_ptr<BrowserOSConditionalFetcher> fetcher = CreateFetcher();
++  Fetch(*fetcher);
++  BrowserOSConditionalFetcher::Result result = Fetch(*fetcher);
++  EXPECT_EQ(Status::kNotModified, result.status);
++  EXPECT_EQ("{\"v\":1}", result.body);
++
++  ASSERT_EQ(2u, server_.requests().size());
++  EXPECT_EQ("\"v1\"", server_.requests()[1].headers.GetHeader("If-None-Match"));
++  EXPECT_EQ(kLastModified,
++            server_.requests()[1].headers.GetHeader("If-Modified-Since"));
++}
++
++TEST_F(BrowserOSConditionalFetcherTest, ReportsChangedDocument) {
++  server_.SetDocument("{\"v\":1}", "\"v1\"");
++  std::unique_ptr<BrowserOSConditionalFetcher> fetcher = CreateFetcher();
++  Fetch(*fetcher);
++
++  server_.SetDocument("{\"v\":2}", "\"v2\"");
++  BrowserOSConditionalFetcher::Result result = Fetch(*fetcher);
++  EXPECT_EQ(Status::kModified, result.status);
++  EXPECT_EQ("{\"v\":2}", result.body);
++}
++
++TEST_F(BrowserOSConditionalFetcherTest, IdenticalBodyIsNotModified) {
++  // Servers without validator support still let callers skip reparsing.
++  server_.SetDocument("{\"v\":1}", "\"v1\"");
++  std::unique_ptr<BrowserOSConditionalFetcher> fetcher = CreateFetcher();
++  Fetch(*fetcher);
++
++  server_.SetDocument("{\"v\":1}", "\"v1-regenerated\"");
++  EXPECT_EQ(Status::kNotModified, Fetch(*fetcher).status);
++}
++
++TEST_F(BrowserOSConditionalFetcherTest, CacheSurvivesRestart) {
++  server_.SetDocument("{\"v\":1}", "\"v1\"");
++  Fetch(*CreateFetcher());
++
++  std::unique_ptr<BrowserOSConditionalFetcher> fetcher = CreateFetcher();
++  base::test::TestFuture<std::optional<std::string>> cached;
++  fetcher->LoadCached(cached.GetCallback());
++  EXPECT_EQ("{\"v\":1}", cached.Get());
++  EXPECT_EQ(1u, server_.requests().size());
++
++  EXPECT_EQ(Status::kNotModified, Fetch(*fetcher).status);
++  EXPECT_EQ("\"v1\"",
++            server_.requests().back().headers.GetHeader("If-None-Match"));
++}
++
++TEST_F(BrowserOSConditionalFetcherTest, IgnoresCacheForOtherUrl) {
++  server_.SetDocument("{\"v\":1}", "\"v1\"");
++  Fetch(*CreateFetcher());
++
++  BrowserOSConditionalFetcher other(GURL("https://cdn.example.com/alpha.json"),
++                                    cache_path_, kMaxSize,
++                                    TRAFFIC_ANNOTATION_FOR_TESTS);
++  base::test::TestFuture<std::optional<std::string>> cached;
++  other.LoadCached(cached.GetCallback());
++  EXPECT_FALSE(cached.Get().has_value());
++}
++
++TEST_F(BrowserOSConditionalFetcherTest, FailureKeepsCache) {
++  server_.SetDocument("{\"v\":1}", "\"v1\"");
++  std::unique_ptr<BrowserOSConditionalFetcher> fetcher = CreateFetcher();
++  Fetch(*fetcher);
++
++  server_.SetStatus(net::HTTP_SERVICE_UNAVAILABLE);
++  BrowserOSConditionalFetcher::Result result = Fetch(*fetcher);
++  EXPECT_EQ(Status::kFailed, result.status);
++  EXPECT_EQ(net::ERR_HTTP_RESPONSE_CODE_FAILURE, result.net_error);
++
++  base::test::TestFuture<std::optional<std::string>> cached;
++  fetcher->LoadCached(cached.GetCallback());
++  EXPECT_EQ("{\"v\":1}", cached.Get());
++}
++
++TEST(BrowserOSJitterTest, StaysWithinFraction) {
++  const base::TimeDelta delay = base::Minutes(15);
++  for (int i = 0; i < 100; ++i) {
++    base::TimeDelta jittered = GetJitteredDelay(delay, 0.25);
++    EXPECT_GE(jittered, delay * 0.75);
++    EXPECT_LE(jittered, delay * 1.25);
++  }
++}
++
++}  // namespace
++}  // namespace browseros
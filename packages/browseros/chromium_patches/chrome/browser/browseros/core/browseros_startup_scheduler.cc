@@ -0,0 +1,140 @@
+diff --git a/chrome/browser/browseros/core/browseros_startup_scheduler.cc b/chrome/browser/browseros/core/browseros_startup_scheduler.cc
+new file mode 100644
+index 0000000000000..cba23ae118e6d
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_startup_scheduler.cc
+@@ -0,0 +1,134 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_startup_scheduler.h"
++
++#include <string>
++#include <utility>
++
++#include "base/feature_list.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/metrics/histogram_functions.h"
++#include "base/process/process.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/trace_event/trace_event.h"
++#include "chrome/browser/after_startup_task_utils.h"
++#include "chrome/browser/browser_features.h"
++#include "content/public/browser/browser_task_traits.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace browseros {
++
++namespace {
++
++scoped_refptr<base::SequencedTaskRunner> GetTaskRunner(StartupPhase phase) {
++  switch (phase) {
++    case StartupPhase::kCritical:
++      return content::GetUIThreadTaskRunner(
++          {base::TaskPriority::USER_BLOCKING});
++    case StartupPhase::kAfterStartup:
++      return content::GetUIThreadTaskRunner({});
++    case StartupPhase::kIdle:
++      return content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT});
++  }
++}
++
++// Process creation is the closest available stand-in for "user launched the
++// browser" that both phases can be measured against.
++base::TimeDelta TimeSinceProcessCreation() {
++  base::Time created = base::Process::Current().CreationTime();
++  return created.is_null() ? base::TimeDelta() : base::Time::Now() - created;
++}
++
++}  // namespace
++
++// static
++BrowserOSStartupScheduler* BrowserOSStartupScheduler::GetInstance() {
++  static base::NoDestructor<BrowserOSStartupScheduler> instance;
++  return instance.get();
++}
++
++BrowserOSStartupScheduler::BrowserOSStartupScheduler()
++    : deferred_(
++          base::FeatureList::IsEnabled(features::kBrowserOsDeferredStartup)) {
++  AfterStartupTaskUtils::PostTask(
++      FROM_HERE, content::GetUIThreadTaskRunner({}),
++      base::BindOnce(&BrowserOSStartupScheduler::OnStartupComplete,
++                     weak_factory_.GetWeakPtr()));
++}
++
++BrowserOSStartupScheduler::~BrowserOSStartupScheduler() = default;
++
++void BrowserOSStartupScheduler::PostTask(StartupPhase phase,
++                                         const base::Location& from_here,
++                                         base::OnceClosure task) {
++  PostDelayedTask(phase, from_here, std::move(task), base::TimeDelta());
++}
++
++void BrowserOSStartupScheduler::PostDelayedTask(
++    StartupPhase phase,
++    const base::Location& from_here,
++    base::OnceClosure task,
++    base::TimeDelta delay) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  scoped_refptr<base::SequencedTaskRunner> task_runner = GetTaskRunner(phase);
++
++  if (!deferred_ || phase == StartupPhase::kCritical) {
++    task_runner->PostDelayedTask(from_here, std::move(task), delay);
++    return;
++  }
++
++  if (!delay.is_zero()) {
++    task = base::BindOnce(
++        [](scoped_refptr<base::SequencedTaskRunner> task_runner,
++           const base::Location& from_here, base::OnceClosure task,
++           base::TimeDelta delay) {
++          task_runner->PostDelayedTask(from_here, std::move(task), delay);
++        },
++        task_runner, from_here, std::move(task), delay);
++  }
++  AfterStartupTaskUtils::PostTask(from_here, task_runner, std::move(task));
++}
++
++void BrowserOSStartupScheduler::OnStartupComplete() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  time_to_startup_complete_ = TimeSinceProcessCreation();
++  TRACE_EVENT_INSTANT("browseros", "BrowserOSStartup::StartupComplete",
++                      "time_ms", time_to_startup_complete_->InMilliseconds());
++  MaybeReport();
++}
++
++void BrowserOSStartupScheduler::OnAgentReady() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  if (time_to_agent_ready_) {
++    return;
++  }
++  time_to_agent_ready_ = TimeSinceProcessCreation();
++  TRACE_EVENT_INSTANT("browseros", "BrowserOSStartup::AgentReady",
++                      "time_ms", time_to_agent_ready_->InMilliseconds());
++  MaybeReport();
++}
++
++void BrowserOSStartupScheduler::MaybeReport() {
++  if (reported_ || !time_to_startup_complete_ || !time_to_agent_ready_) {
++    return;
++  }
++  reported_ = true;
++
++  const std::string suffix = deferred_ ? ".Deferred" : ".Immediate";
++  base::UmaHistogramMediumTimes(
++      "BrowserOS.Startup.TimeToStartupComplete" + suffix,
++      *time_to_startup_complete_);
++  base::UmaHistogramMediumTimes("BrowserOS.Startup.TimeToAgentReady" + suffix,
++                                *time_to_agent_ready_);
++
++  // Parsed by build/scripts/startup_benchmark; keep the format stable.
++  LOG(INFO) << "browseros: Startup benchmark deferred=" << deferred_
++            << " startup_complete_ms="
++            << time_to_startup_complete_->InMilliseconds()
++            << " agent_ready_ms=" << time_to_agent_ready_->InMilliseconds();
++}
++
++}  // namespace browseros
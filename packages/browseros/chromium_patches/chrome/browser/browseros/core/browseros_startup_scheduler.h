@@ -0,0 +1,94 @@
+diff --git a/chrome/browser/browseros/core/browseros_startup_scheduler.h b/chrome/browser/browseros/core/browseros_startup_scheduler.h
+new file mode 100644
+index 0000000000000..2269ab25019ec
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_startup_scheduler.h
+@@ -0,0 +1,88 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STARTUP_SCHEDULER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STARTUP_SCHEDULER_H_
++
++#include <optional>
++
++#include "base/functional/callback.h"
++#include "base/location.h"
++#include "base/memory/weak_ptr.h"
++#include "base/no_destructor.h"
++#include "base/time/time.h"
++
++namespace browseros {
++
++// When BrowserOS background work may run during browser startup.
++enum class StartupPhase {
++  // Needed for the agent to come up (the server launch); runs right away.
++  kCritical,
++  // Once browser startup is complete, e.g. installing extensions the user is
++  // waiting for.
++  kAfterStartup,
++  // After startup is complete, at best-effort priority, e.g. extension
++  // maintenance and server update checks.
++  kIdle,
++};
++
++// Keeps BrowserOS background work off the startup critical path.
++//
++// "Startup complete" is AfterStartupTaskUtils' notion of it: the first web
++// contents painted, or startup was abandoned. With the
++// BrowserOsDeferredStartup feature disabled every phase runs right away,
++// which is how startup behaved before the scheduler existed.
++//
++// The scheduler also reports time to startup complete and time to agent
++// ready (first healthy server), both from process creation, as
++// BrowserOS.Startup.* histograms and one log line per launch for
++// benchmarking.
++//
++// Threading: UI thread only.
++class BrowserOSStartupScheduler {
++ public:
++  static BrowserOSStartupScheduler* GetInstance();
++
++  BrowserOSStartupScheduler(const BrowserOSStartupScheduler&) = delete;
++  BrowserOSStartupScheduler& operator=(const BrowserOSStartupScheduler&) =
++      delete;
++
++  bool is_deferred() const { return deferred_; }
++
++  // Runs |task| on the UI thread once |phase| is reached.
++  void PostTask(StartupPhase phase,
++                const base::Location& from_here,
++                base::OnceClosure task);
++
++  // Runs |task| on the UI thread |delay| after |phase| is reached.
++  void PostDelayedTask(StartupPhase phase,
++                       const base::Location& from_here,
++                       base::OnceClosure task,
++                       base::TimeDelta delay);
++
++  // Called when the BrowserOS server first reports healthy. Only the first
++  // call per browser process is recorded.
++  void OnAgentReady();
++
++ private:
++  friend class base::NoDestructor<BrowserOSStartupScheduler>;
++  friend class BrowserOSStartupSchedulerTest;
++
++  BrowserOSStartupScheduler();
++  ~BrowserOSStartupScheduler();
++
++  void OnStartupComplete();
++  void MaybeReport();
++
++  const bool deferred_;
++  std::optional<base::TimeDelta> time_to_startup_complete_;
++  std::optional<base::TimeDelta> time_to_agent_ready_;
++  bool reported_ = false;
++
++  base::WeakPtrFactory<BrowserOSStartupScheduler> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STARTUP_SCHEDULER_H_
@@ -0,0 +1,129 @@
+diff --git a/chrome/browser/browseros/core/browseros_startup_scheduler_unittest.cc b/chrome/browser/browseros/core/browseros_startup_scheduler_unittest.cc
+new file mode 100644
+index 0000000000000..ea37086403dcf
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_startup_scheduler_unittest.cc
+@@ -0,0 +1,123 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_startup_scheduler.h"
++
++#include <string>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/memory/raw_ptr.h"
++#include "base/test/metrics/histogram_tester.h"
++#include "base/test/scoped_feature_list.h"
++#include "chrome/browser/after_startup_task_utils.h"
++#include "chrome/browser/browser_features.h"
++#include "content/public/test/browser_task_environment.h"
++#include "testing/gmock/include/gmock/gmock.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++
++class BrowserOSStartupSchedulerTest : public testing::Test {
++ protected:
++  // AfterStartupTaskUtils spreads queued tasks over up to 10 seconds.
++  static constexpr base::TimeDelta kAfterStartupSpread = base::Seconds(10);
++
++  void SetUp() override { AfterStartupTaskUtils::UnsafeResetForTesting(); }
++
++  void TearDown() override {
++    delete scheduler_.ExtractAsDangling();
++    AfterStartupTaskUtils::UnsafeResetForTesting();
++  }
++
++  // Creates the scheduler with BrowserOsDeferredStartup |deferred|.
++  BrowserOSStartupScheduler* CreateScheduler(bool deferred) {
++    feature_list_.InitWithFeatureState(features::kBrowserOsDeferredStartup,
++                                       deferred);
++    scheduler_ = new BrowserOSStartupScheduler();
++    return scheduler_;
++  }
++
++  void Post(StartupPhase phase,
++            const std::string& name,
++            base::TimeDelta delay = base::TimeDelta()) {
++    scheduler_->PostDelayedTask(
++        phase, FROM_HERE,
++        base::BindOnce([](std::vector<std::string>* ran,
++                          const std::string& name) { ran->push_back(name); },
++                       base::Unretained(&ran_), name),
++        delay);
++  }
++
++  void CompleteStartup() {
++    AfterStartupTaskUtils::SetBrowserStartupIsCompleteForTesting();
++  }
++
++  base::test::ScopedFeatureList feature_list_;
++  content::BrowserTaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  std::vector<std::string> ran_;
++
++ private:
++  raw_ptr<BrowserOSStartupScheduler> scheduler_ = nullptr;
++};
++
++TEST_F(BrowserOSStartupSchedulerTest, DeferredPhasesWaitForStartupComplete) {
++  CreateScheduler(/*deferred=*/true);
++  Post(StartupPhase::kIdle, "idle");
++  Post(StartupPhase::kAfterStartup, "after_startup");
++  Post(StartupPhase::kCritical, "critical");
++
++  task_environment_.FastForwardBy(base::Minutes(1));
++  EXPECT_THAT(ran_, testing::ElementsAre("critical"));
++
++  CompleteStartup();
++  task_environment_.FastForwardBy(kAfterStartupSpread);
++  EXPECT_THAT(ran_, testing::UnorderedElementsAre("critical", "after_startup",
++                                                  "idle"));
++}
++
++TEST_F(BrowserOSStartupSchedulerTest, DelayCountsFromStartupComplete) {
++  CreateScheduler(/*deferred=*/true);
++  Post(StartupPhase::kAfterStartup, "delayed", base::Seconds(30));
++
++  task_environment_.FastForwardBy(base::Minutes(1));
++  EXPECT_TRUE(ran_.empty());
++
++  CompleteStartup();
++  task_environment_.FastForwardBy(base::Seconds(29));
++  EXPECT_TRUE(ran_.empty());
++  task_environment_.FastForwardBy(kAfterStartupSpread + base::Seconds(1));
++  EXPECT_THAT(ran_, testing::ElementsAre("delayed"));
++}
++
++TEST_F(BrowserOSStartupSchedulerTest, RunsImmediatelyWithFeatureDisabled) {
++  BrowserOSStartupScheduler* scheduler = CreateScheduler(/*deferred=*/false);
++  EXPECT_FALSE(scheduler->is_deferred());
++
++  Post(StartupPhase::kIdle, "idle");
++  Post(StartupPhase::kAfterStartup, "after_startup");
++  Post(StartupPhase::kCritical, "critical");
++  task_environment_.RunUntilIdle();
++
++  EXPECT_FALSE(AfterStartupTaskUtils::IsBrowserStartupComplete());
++  EXPECT_THAT(ran_, testing::UnorderedElementsAre("critical", "after_startup",
++                                                  "idle"));
++}
++
++TEST_F(BrowserOSStartupSchedulerTest, ReportsOnceBothTimesAreKnown) {
++  base::HistogramTester histograms;
++  BrowserOSStartupScheduler* scheduler = CreateScheduler(/*deferred=*/true);
++
++  scheduler->OnAgentReady();
++  histograms.ExpectTotalCount("BrowserOS.Startup.TimeToAgentReady.Deferred", 0);
++
++  CompleteStartup();
++  task_environment_.FastForwardBy(kAfterStartupSpread);
++  histograms.ExpectTotalCount(
++      "BrowserOS.Startup.TimeToStartupComplete.Deferred", 1);
++  histograms.ExpectTotalCount("BrowserOS.Startup.TimeToAgentReady.Deferred", 1);
++}
++
++}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_switches.h b/chrome/browser/browseros/core/browseros_switches.h
 new file mode 100644
-index 0000000000000..dcd8b3ae307f2
+index 0000000000000..cd006027f65b1
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_switches.h
-@@ -0,0 +1,86 @@
+@@ -0,0 +1,97 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -39,6 +39,17 @@ index 0000000000000..dcd8b3ae307f2
 +// Overrides the stable MCP proxy port (what external clients connect to).
 +inline constexpr char kProxyPort[] = "browseros-proxy-port";
 +
++// Overrides the listen backlog of the MCP proxy socket.
++inline constexpr char kProxyBacklog[] = "browseros-proxy-backlog";
++
++// Overrides how many MCP requests the proxy forwards to the server at once.
++inline constexpr char kProxyMaxConcurrency[] =
++    "browseros-proxy-max-concurrency";
++
++// Also connects the browser, MCP proxy and server over Unix domain sockets
++// in the execution directory (Linux only).
++inline constexpr char kServerUnixSockets[] = "browseros-server-unix-sockets";
++
 +// Overrides the sidecar backend server port.
 +inline constexpr char kServerPort[] = "browseros-server-port";
 +
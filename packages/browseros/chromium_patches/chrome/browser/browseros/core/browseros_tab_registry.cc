@@ -0,0 +1,223 @@
+diff --git a/chrome/browser/browseros/core/browseros_tab_registry.cc b/chrome/browser/browseros/core/browseros_tab_registry.cc
+new file mode 100644
+index 0000000000000..f3e9e784e5960
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_tab_registry.cc
+@@ -0,0 +1,217 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_tab_registry.h"
++
++#include <utility>
++
++#include "base/memory/raw_ptr.h"
++#include "chrome/browser/ui/browser.h"
++#include "chrome/browser/ui/browser_list.h"
++#include "chrome/browser/ui/browser_window/public/browser_window_interface.h"
++#include "chrome/browser/ui/browser_window/public/browser_window_interface_iterator.h"
++#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "components/sessions/content/session_tab_helper.h"
++#include "content/public/browser/browser_thread.h"
++#include "content/public/browser/devtools_agent_host.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_observer.h"
++
++namespace browseros {
++
++namespace {
++
++int GetTabId(content::WebContents* web_contents) {
++  SessionID id = sessions::SessionTabHelper::IdForTab(web_contents);
++  return id.is_valid() ? id.id() : -1;
++}
++
++}  // namespace
++
++// One registered tab. Watches its WebContents so the entry never outlives
++// it, whoever destroys it.
++class BrowserOSTabRegistry::Entry : public content::WebContentsObserver {
++ public:
++  Entry(BrowserOSTabRegistry* registry,
++        content::WebContents* web_contents,
++        int tab_id,
++        std::string target_id)
++      : content::WebContentsObserver(web_contents),
++        registry_(registry),
++        tab_id_(tab_id),
++        target_id_(std::move(target_id)) {}
++
++  const std::string& target_id() const { return target_id_; }
++
++  BrowserWindowInterface* window() const { return window_; }
++  bool hidden() const { return hidden_; }
++
++  void SetLocation(BrowserWindowInterface* window, bool hidden) {
++    window_ = window;
++    hidden_ = hidden;
++  }
++
++  // content::WebContentsObserver:
++  void WebContentsDestroyed() override {
++    // Deletes |this|.
++    registry_->Unregister(tab_id_, web_contents());
++  }
++
++ private:
++  raw_ptr<BrowserOSTabRegistry> registry_;
++  const int tab_id_;
++  const std::string target_id_;
++  raw_ptr<BrowserWindowInterface> window_ = nullptr;
++  bool hidden_ = false;
++};
++
++// static
++BrowserOSTabRegistry* BrowserOSTabRegistry::GetInstance() {
++  static base::NoDestructor<BrowserOSTabRegistry> instance;
++  return instance.get();
++}
++
++BrowserOSTabRegistry::BrowserOSTabRegistry() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  BrowserList::AddObserver(this);
++  ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
++      [this](BrowserWindowInterface* window) {
++        ObserveWindow(window);
++        return true;
++      });
++}
++
++BrowserOSTabRegistry::~BrowserOSTabRegistry() {
++  BrowserList::RemoveObserver(this);
++  for (const auto& [tab_strip_model, window] : windows_) {
++    tab_strip_model->RemoveObserver(this);
++  }
++}
++
++content::WebContents* BrowserOSTabRegistry::FindByTabId(int tab_id) const {
++  auto it = tabs_.find(tab_id);
++  return it == tabs_.end() ? nullptr : it->second->web_contents();
++}
++
++content::WebContents* BrowserOSTabRegistry::FindByTargetId(
++    const std::string& target_id) const {
++  auto it = target_ids_.find(target_id);
++  return it == target_ids_.end() ? nullptr : FindByTabId(it->second);
++}
++
++BrowserWindowInterface* BrowserOSTabRegistry::GetWindowForTab(
++    int tab_id) const {
++  auto it = tabs_.find(tab_id);
++  return it == tabs_.end() ? nullptr : it->second->window();
++}
++
++bool BrowserOSTabRegistry::IsHidden(int tab_id) const {
++  auto it = tabs_.find(tab_id);
++  return it != tabs_.end() && it->second->hidden();
++}
++
++void BrowserOSTabRegistry::AddHiddenTab(content::WebContents* web_contents) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  Register(web_contents, nullptr, /*hidden=*/true);
++}
++
++void BrowserOSTabRegistry::OnBrowserAdded(Browser* browser) {
++  ObserveWindow(browser);
++}
++
++void BrowserOSTabRegistry::OnBrowserRemoved(Browser* browser) {
++  TabStripModel* tab_strip_model = browser->tab_strip_model();
++  if (windows_.erase(tab_strip_model)) {
++    tab_strip_model->RemoveObserver(this);
++  }
++}
++
++void BrowserOSTabRegistry::OnTabStripModelChanged(
++    TabStripModel* tab_strip_model,
++    const TabStripModelChange& change,
++    const TabStripSelectionChange& selection) {
++  auto it = windows_.find(tab_strip_model);
++  if (it == windows_.end()) {
++    return;
++  }
++  BrowserWindowInterface* window = it->second;
++
++  switch (change.type()) {
++    case TabStripModelChange::kInserted:
++      for (const auto& inserted : change.GetInsert()->contents) {
++        Register(inserted.contents, window, /*hidden=*/false);
++      }
++      break;
++    case TabStripModelChange::kRemoved:
++      for (const auto& removed : change.GetRemove()->contents) {
++        if (removed.remove_reason ==
++            TabStripModelChange::RemoveReason::kInsertedIntoOtherTabStrip) {
++          // Moving to another window or becoming hidden; keep the ids.
++          Register(removed.contents, nullptr, /*hidden=*/false);
++        } else {
++          Unregister(GetTabId(removed.contents), removed.contents);
++        }
++      }
++      break;
++    case TabStripModelChange::kReplaced: {
++      const TabStripModelChange::Replace* replace = change.GetReplace();
++      Unregister(GetTabId(replace->old_contents), replace->old_contents);
++      Register(replace->new_contents, window, /*hidden=*/false);
++      break;
++    }
++    case TabStripModelChange::kMoved:
++    case TabStripModelChange::kSelectionOnly:
++      break;
++  }
++}
++
++void BrowserOSTabRegistry::OnTabStripModelDestroyed(
++    TabStripModel* tab_strip_model) {
++  windows_.erase(tab_strip_model);
++}
++
++void BrowserOSTabRegistry::ObserveWindow(BrowserWindowInterface* window) {
++  TabStripModel* tab_strip_model = window->GetTabStripModel();
++  if (!windows_.emplace(tab_strip_model, window).second) {
++    return;
++  }
++  tab_strip_model->AddObserver(this);
++  for (int i = 0; i < tab_strip_model->count(); ++i) {
++    Register(tab_strip_model->GetWebContentsAt(i), window, /*hidden=*/false);
++  }
++}
++
++void BrowserOSTabRegistry::Register(content::WebContents* web_contents,
++                                    BrowserWindowInterface* window,
++                                    bool hidden) {
++  int tab_id = GetTabId(web_contents);
++  if (tab_id < 0) {
++    return;
++  }
++
++  std::unique_ptr<Entry>& entry = tabs_[tab_id];
++  if (!entry || entry->web_contents() != web_contents) {
++    if (entry) {
++      target_ids_.erase(entry->target_id());
++    }
++    std::string target_id =
++        content::DevToolsAgentHost::GetOrCreateFor(web_contents)->GetId();
++    target_ids_[target_id] = tab_id;
++    entry = std::make_unique<Entry>(this, web_contents, tab_id,
++                                    std::move(target_id));
++  }
++  entry->SetLocation(window, hidden);
++}
++
++void BrowserOSTabRegistry::Unregister(int tab_id,
++                                      content::WebContents* web_contents) {
++  auto it = tabs_.find(tab_id);
++  if (it == tabs_.end() || it->second->web_contents() != web_contents) {
++    return;
++  }
++  target_ids_.erase(it->second->target_id());
++  tabs_.erase(it);
++}
++
++}  // namespace browseros
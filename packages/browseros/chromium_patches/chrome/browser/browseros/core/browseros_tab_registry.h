@@ -0,0 +1,103 @@
+diff --git a/chrome/browser/browseros/core/browseros_tab_registry.h b/chrome/browser/browseros/core/browseros_tab_registry.h
+new file mode 100644
+index 0000000000000..a3c57ff164523
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_tab_registry.h
+@@ -0,0 +1,97 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_TAB_REGISTRY_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_TAB_REGISTRY_H_
++
++#include <memory>
++#include <string>
++#include <unordered_map>
++
++#include "base/containers/flat_map.h"
++#include "base/no_destructor.h"
++#include "chrome/browser/ui/browser_list_observer.h"
++#include "chrome/browser/ui/tabs/tab_strip_model_observer.h"
++
++class Browser;
++class BrowserWindowInterface;
++class TabStripModel;
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace browseros {
++
++// Browser-wide index of tabs by tab id (SessionID) and DevTools target id,
++// so agent actions resolve their tab in O(1) instead of scanning every
++// window and tab.
++//
++// Visible tabs are tracked from the tab strips of all browser windows.
++// Hidden tabs (WebContents kept outside any window by the Browser CDP
++// domain) are registered by their owner with AddHiddenTab(). Entries go away
++// when the tab leaves its tab strip for good or its WebContents is
++// destroyed. A tab keeps its entry, and ids, when moved between windows,
++// hidden or shown.
++//
++// Threading: UI thread only.
++class BrowserOSTabRegistry : public BrowserListObserver,
++                             public TabStripModelObserver {
++ public:
++  static BrowserOSTabRegistry* GetInstance();
++
++  BrowserOSTabRegistry(const BrowserOSTabRegistry&) = delete;
++  BrowserOSTabRegistry& operator=(const BrowserOSTabRegistry&) = delete;
++
++  // Returns null for unknown ids.
++  content::WebContents* FindByTabId(int tab_id) const;
++  content::WebContents* FindByTargetId(const std::string& target_id) const;
++
++  // The window showing the tab; null for hidden or unknown tabs.
++  BrowserWindowInterface* GetWindowForTab(int tab_id) const;
++
++  bool IsHidden(int tab_id) const;
++
++  // Registers a WebContents that lives outside any tab strip.
++  void AddHiddenTab(content::WebContents* web_contents);
++
++  // BrowserListObserver:
++  void OnBrowserAdded(Browser* browser) override;
++  void OnBrowserRemoved(Browser* browser) override;
++
++  // TabStripModelObserver:
++  void OnTabStripModelChanged(
++      TabStripModel* tab_strip_model,
++      const TabStripModelChange& change,
++      const TabStripSelectionChange& selection) override;
++  void OnTabStripModelDestroyed(TabStripModel* tab_strip_model) override;
++
++ private:
++  friend class base::NoDestructor<BrowserOSTabRegistry>;
++  friend class BrowserOSTabRegistryTest;
++
++  class Entry;
++
++  BrowserOSTabRegistry();
++  ~BrowserOSTabRegistry() override;
++
++  void ObserveWindow(BrowserWindowInterface* window);
++
++  // Adds or updates the entry for |web_contents|; |window| is null for
++  // hidden and detached tabs.
++  void Register(content::WebContents* web_contents,
++                BrowserWindowInterface* window,
++                bool hidden);
++  // No-op unless |tab_id| is registered to |web_contents|.
++  void Unregister(int tab_id, content::WebContents* web_contents);
++
++  base::flat_map<TabStripModel*, BrowserWindowInterface*> windows_;
++  // Hash maps: these hold every open tab and are hit on every agent action.
++  std::unordered_map<int, std::unique_ptr<Entry>> tabs_;
++  std::unordered_map<std::string, int> target_ids_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_TAB_REGISTRY_H_
@@ -0,0 +1,112 @@
+diff --git a/chrome/browser/browseros/core/browseros_tab_registry_unittest.cc b/chrome/browser/browseros/core/browseros_tab_registry_unittest.cc
+new file mode 100644
+index 0000000000000..663a91728063c
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_tab_registry_unittest.cc
+@@ -0,0 +1,106 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_tab_registry.h"
++
++#include <memory>
++#include <string>
++
++#include "base/memory/raw_ptr.h"
++#include "chrome/browser/ui/browser.h"
++#include "chrome/browser/ui/tabs/tab_enums.h"
++#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "chrome/test/base/browser_with_test_window_test.h"
++#include "components/sessions/content/session_tab_helper.h"
++#include "content/public/browser/devtools_agent_host.h"
++#include "content/public/browser/web_contents.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "url/gurl.h"
++
++namespace browseros {
++
++class BrowserOSTabRegistryTest : public BrowserWithTestWindowTest {
++ protected:
++  void SetUp() override {
++    BrowserWithTestWindowTest::SetUp();
++    AddTab(browser(), GURL("about:blank"));
++    registry_ = new BrowserOSTabRegistry();
++  }
++
++  void TearDown() override {
++    delete registry_.ExtractAsDangling();
++    BrowserWithTestWindowTest::TearDown();
++  }
++
++  BrowserOSTabRegistry* registry() { return registry_; }
++
++  TabStripModel* tab_strip() { return browser()->tab_strip_model(); }
++
++  static int GetTabId(content::WebContents* web_contents) {
++    return sessions::SessionTabHelper::IdForTab(web_contents).id();
++  }
++
++  static std::string GetTargetId(content::WebContents* web_contents) {
++    return content::DevToolsAgentHost::GetOrCreateFor(web_contents)->GetId();
++  }
++
++ private:
++  raw_ptr<BrowserOSTabRegistry> registry_ = nullptr;
++};
++
++TEST_F(BrowserOSTabRegistryTest, IndexesExistingTabs) {
++  content::WebContents* contents = tab_strip()->GetWebContentsAt(0);
++  int tab_id = GetTabId(contents);
++
++  EXPECT_EQ(contents, registry()->FindByTabId(tab_id));
++  EXPECT_EQ(contents, registry()->FindByTargetId(GetTargetId(contents)));
++  EXPECT_EQ(browser(), registry()->GetWindowForTab(tab_id));
++  EXPECT_FALSE(registry()->IsHidden(tab_id));
++}
++
++TEST_F(BrowserOSTabRegistryTest, TracksOpenedAndClosedTabs) {
++  AddTab(browser(), GURL("about:blank"));
++  content::WebContents* contents = tab_strip()->GetWebContentsAt(0);
++  int tab_id = GetTabId(contents);
++  std::string target_id = GetTargetId(contents);
++  EXPECT_EQ(contents, registry()->FindByTabId(tab_id));
++
++  tab_strip()->CloseWebContentsAt(0, TabCloseTypes::CLOSE_NONE);
++  EXPECT_EQ(nullptr, registry()->FindByTabId(tab_id));
++  EXPECT_EQ(nullptr, registry()->FindByTargetId(target_id));
++}
++
++TEST_F(BrowserOSTabRegistryTest, KeepsIdsWhileHidden) {
++  content::WebContents* contents = tab_strip()->GetWebContentsAt(0);
++  int tab_id = GetTabId(contents);
++  std::string target_id = GetTargetId(contents);
++
++  std::unique_ptr<content::WebContents> hidden =
++      tab_strip()->DetachWebContentsAtForInsertion(0);
++  registry()->AddHiddenTab(hidden.get());
++  EXPECT_TRUE(registry()->IsHidden(tab_id));
++  EXPECT_EQ(nullptr, registry()->GetWindowForTab(tab_id));
++  EXPECT_EQ(contents, registry()->FindByTargetId(target_id));
++
++  tab_strip()->InsertWebContentsAt(0, std::move(hidden),
++                                   AddTabTypes::ADD_ACTIVE);
++  EXPECT_FALSE(registry()->IsHidden(tab_id));
++  EXPECT_EQ(browser(), registry()->GetWindowForTab(tab_id));
++  EXPECT_EQ(contents, registry()->FindByTabId(tab_id));
++}
++
++TEST_F(BrowserOSTabRegistryTest, ForgetsDestroyedHiddenTabs) {
++  std::unique_ptr<content::WebContents> hidden =
++      tab_strip()->DetachWebContentsAtForInsertion(0);
++  int tab_id = GetTabId(hidden.get());
++  std::string target_id = GetTargetId(hidden.get());
++  registry()->AddHiddenTab(hidden.get());
++
++  hidden.reset();
++  EXPECT_EQ(nullptr, registry()->FindByTabId(tab_id));
++  EXPECT_EQ(nullptr, registry()->FindByTargetId(target_id));
++  EXPECT_FALSE(registry()->IsHidden(tab_id));
++}
++
++}  // namespace browseros
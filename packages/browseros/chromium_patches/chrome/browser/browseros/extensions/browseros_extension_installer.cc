@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_installer.cc b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
 new file mode 100644
-index 0000000000000..27fadedbd37ef
+index 0000000000000..4541146a2fa39
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
-@@ -0,0 +1,341 @@
+@@ -0,0 +1,352 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -25,42 +25,20 @@ index 0000000000000..27fadedbd37ef
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/common/chrome_paths.h"
 +#include "content/public/browser/storage_partition.h"
-+#include "net/base/load_flags.h"
-+#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
++#include "net/base/net_errors.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
 +
 +namespace browseros {
 +
-+namespace {
-+
-+constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
-+    net::DefineNetworkTrafficAnnotation("browseros_extension_install", R"(
-+        semantics {
-+          sender: "BrowserOS Extension Installer"
-+          description:
-+            "Fetches JSON configuration specifying which extensions should "
-+            "be installed for BrowserOS users."
-+          trigger: "Browser startup when no bundled extensions available."
-+          data: "No user data. GET request only."
-+          destination: OTHER
-+          destination_other: "BrowserOS configuration server."
-+        }
-+        policy {
-+          cookies_allowed: NO
-+          setting: "Controlled via command-line flags or enterprise policies."
-+          policy_exception_justification: "BrowserOS feature."
-+        })");
-+
-+}  // namespace
-+
 +InstallResult::InstallResult() = default;
 +InstallResult::~InstallResult() = default;
 +InstallResult::InstallResult(InstallResult&&) = default;
 +InstallResult& InstallResult::operator=(InstallResult&&) = default;
 +
-+BrowserOSExtensionInstaller::BrowserOSExtensionInstaller(Profile* profile)
-+    : profile_(profile) {
++BrowserOSExtensionInstaller::BrowserOSExtensionInstaller(
++    Profile* profile,
++    BrowserOSConditionalFetcher* config_fetcher)
++    : profile_(profile), config_fetcher_(config_fetcher) {
 +  for (const std::string& id : GetBrowserOSExtensionIds()) {
 +    extension_ids_.insert(id);
 +  }
@@ -69,9 +47,7 @@ index 0000000000000..27fadedbd37ef
 +BrowserOSExtensionInstaller::~BrowserOSExtensionInstaller() = default;
 +
 +void BrowserOSExtensionInstaller::StartInstallation(
-+    const GURL& config_url,
 +    InstallCompleteCallback callback) {
-+  config_url_ = config_url;
 +  callback_ = std::move(callback);
 +
 +  LOG(INFO) << "browseros: Starting extension installation";
@@ -95,20 +71,14 @@ index 0000000000000..27fadedbd37ef
 +    return false;
 +  }
 +
-+  base::FilePath manifest_path =
-+      bundled_path.Append(FILE_PATH_LITERAL("bundled_extensions.json"));
-+
-+  if (!base::PathExists(manifest_path)) {
-+    LOG(INFO) << "browseros: No bundled manifest at " << manifest_path.value();
-+    return false;
-+  }
-+
 +  LOG(INFO) << "browseros: Loading from bundled at " << bundled_path.value();
 +
++  // The manifest check, parse and CRX checks all touch the disk; none of it
++  // may run on the UI thread while the first window is being painted.
 +  base::ThreadPool::PostTaskAndReplyWithResult(
-+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
 +      base::BindOnce(&BrowserOSExtensionInstaller::ReadBundledManifest,
-+                     manifest_path, bundled_path),
++                     bundled_path),
 +      base::BindOnce(&BrowserOSExtensionInstaller::OnBundledLoadComplete,
 +                     weak_ptr_factory_.GetWeakPtr(), bundled_path));
 +
@@ -117,8 +87,15 @@ index 0000000000000..27fadedbd37ef
 +
 +// static
 +base::Value::Dict BrowserOSExtensionInstaller::ReadBundledManifest(
-+    const base::FilePath& manifest_path,
 +    const base::FilePath& bundled_path) {
++  base::FilePath manifest_path =
++      bundled_path.Append(FILE_PATH_LITERAL("bundled_extensions.json"));
++
++  if (!base::PathExists(manifest_path)) {
++    LOG(INFO) << "browseros: No bundled manifest at " << manifest_path.value();
++    return base::Value::Dict();
++  }
++
 +  std::string json_content;
 +  if (!base::ReadFileToString(manifest_path, &json_content)) {
 +    LOG(ERROR) << "browseros: Failed to read bundled manifest";
@@ -208,46 +185,79 @@ index 0000000000000..27fadedbd37ef
 +}
 +
 +void BrowserOSExtensionInstaller::FetchFromRemote() {
-+  if (!config_url_.is_valid()) {
++  if (!config_fetcher_) {
 +    LOG(ERROR) << "browseros: Invalid config URL";
 +    Complete(InstallResult());
 +    return;
 +  }
 +
-+  LOG(INFO) << "browseros: Fetching config from " << config_url_.spec();
++  config_fetcher_->LoadCached(
++      base::BindOnce(&BrowserOSExtensionInstaller::OnCachedConfigLoaded,
++                     weak_ptr_factory_.GetWeakPtr()));
++}
 +
-+  if (!url_loader_factory_) {
-+    url_loader_factory_ = profile_->GetDefaultStoragePartition()
-+                              ->GetURLLoaderFactoryForBrowserProcess();
++void BrowserOSExtensionInstaller::OnCachedConfigLoaded(
++    std::optional<std::string> cached_body) {
++  if (cached_body.has_value()) {
++    BuildResultInBackground(
++        std::move(*cached_body),
++        base::BindOnce(&BrowserOSExtensionInstaller::OnCachedResultBuilt,
++                       weak_ptr_factory_.GetWeakPtr()));
++    return;
 +  }
 +
-+  auto request = std::make_unique<network::ResourceRequest>();
-+  request->url = config_url_;
-+  request->method = "GET";
-+  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
++  OnCachedResultBuilt(InstallResult());
++}
 +
-+  url_loader_ =
-+      network::SimpleURLLoader::Create(std::move(request), kTrafficAnnotation);
++void BrowserOSExtensionInstaller::OnCachedResultBuilt(InstallResult result) {
++  if (!result.extension_ids.empty()) {
++    LOG(INFO) << "browseros: Using cached config";
++    Complete(std::move(result));
++    return;
++  }
 +
-+  url_loader_->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
-+      url_loader_factory_.get(),
++  LOG(INFO) << "browseros: Fetching config from "
++            << config_fetcher_->url().spec();
++
++  config_fetcher_->Fetch(
++      profile_->GetDefaultStoragePartition()
++          ->GetURLLoaderFactoryForBrowserProcess(),
 +      base::BindOnce(&BrowserOSExtensionInstaller::OnRemoteFetchComplete,
 +                     weak_ptr_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSExtensionInstaller::OnRemoteFetchComplete(
-+    std::optional<std::string> response_body) {
-+  if (!response_body.has_value()) {
-+    LOG(ERROR) << "browseros: Failed to fetch config";
++    BrowserOSConditionalFetcher::Result result) {
++  if (result.status == BrowserOSConditionalFetcher::Result::Status::kFailed) {
++    LOG(ERROR) << "browseros: Failed to fetch config: "
++               << net::ErrorToString(result.net_error);
 +    Complete(InstallResult());
 +    return;
 +  }
 +
-+  base::Value::Dict extensions_config = ParseConfigJson(*response_body);
++  BuildResultInBackground(
++      std::move(result.body),
++      base::BindOnce(&BrowserOSExtensionInstaller::Complete,
++                     weak_ptr_factory_.GetWeakPtr()));
++}
++
++void BrowserOSExtensionInstaller::BuildResultInBackground(
++    std::string json_content,
++    base::OnceCallback<void(InstallResult)> callback) {
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(&BrowserOSExtensionInstaller::BuildResultFromConfig,
++                     std::move(json_content)),
++      std::move(callback));
++}
++
++// static
++InstallResult BrowserOSExtensionInstaller::BuildResultFromConfig(
++    const std::string& json_content) {
++  base::Value::Dict extensions_config = ParseConfigJson(json_content);
 +
 +  if (extensions_config.empty()) {
-+    Complete(InstallResult());
-+    return;
++    return InstallResult();
 +  }
 +
 +  InstallResult result;
@@ -314,9 +324,10 @@ index 0000000000000..27fadedbd37ef
 +    LOG(INFO) << "browseros: Added Clawdbot via feature flag";
 +  }
 +
-+  Complete(std::move(result));
++  return result;
 +}
 +
++// static
 +base::Value::Dict BrowserOSExtensionInstaller::ParseConfigJson(
 +    const std::string& json_content) {
 +  std::optional<base::Value> parsed =
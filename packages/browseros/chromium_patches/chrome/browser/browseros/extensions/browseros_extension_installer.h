@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_installer.h b/chrome/browser/browseros/extensions/browseros_extension_installer.h
 new file mode 100644
-index 0000000000000..9a3c2000ed05a
+index 0000000000000..9a87f3af7ce55
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_installer.h
-@@ -0,0 +1,100 @@
+@@ -0,0 +1,111 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -22,12 +22,7 @@ index 0000000000000..9a3c2000ed05a
 +#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/values.h"
-+#include "url/gurl.h"
-+
-+namespace network {
-+class SharedURLLoaderFactory;
-+class SimpleURLLoader;
-+}  // namespace network
++#include "chrome/browser/browseros/core/browseros_conditional_fetcher.h"
 +
 +class Profile;
 +
@@ -48,13 +43,19 @@ index 0000000000000..9a3c2000ed05a
 +};
 +
 +// Handles one-time initial installation of BrowserOS extensions.
-+// Tries bundled CRX files first, falls back to remote config.
++// Tries bundled CRX files first, falls back to remote config. A config
++// cached by an earlier session is used without waiting for the network;
++// the maintainer revalidates it shortly after startup. Manifests and configs
++// are read and parsed on the thread pool, off the startup critical path.
 +class BrowserOSExtensionInstaller {
 + public:
 +  using InstallCompleteCallback =
 +      base::OnceCallback<void(InstallResult result)>;
 +
-+  explicit BrowserOSExtensionInstaller(Profile* profile);
++  // |config_fetcher| may be null when there is no config URL; it must
++  // outlive the installer.
++  BrowserOSExtensionInstaller(Profile* profile,
++                              BrowserOSConditionalFetcher* config_fetcher);
 +  ~BrowserOSExtensionInstaller();
 +
 +  BrowserOSExtensionInstaller(const BrowserOSExtensionInstaller&) = delete;
@@ -62,42 +63,52 @@ index 0000000000000..9a3c2000ed05a
 +      delete;
 +
 +  // Starts the installation process. Calls |callback| when complete.
-+  void StartInstallation(const GURL& config_url,
-+                         InstallCompleteCallback callback);
++  void StartInstallation(InstallCompleteCallback callback);
 +
 + private:
 +  // Attempts to load from bundled CRX files. Returns true if attempting.
 +  bool TryLoadFromBundled();
 +
-+  // Reads bundled manifest on FILE thread.
++  // Reads bundled manifest and checks its CRX files on the thread pool.
++  // Returns empty prefs if there is no usable manifest.
 +  static base::Value::Dict ReadBundledManifest(
-+      const base::FilePath& manifest_path,
 +      const base::FilePath& bundled_path);
 +
 +  // Called when bundled manifest read completes.
 +  void OnBundledLoadComplete(const base::FilePath& bundled_path,
 +                             base::Value::Dict prefs);
 +
-+  // Fetches config from remote URL.
++  // Uses the cached config if there is one, otherwise fetches it.
 +  void FetchFromRemote();
 +
++  // Called when the cached config has been read.
++  void OnCachedConfigLoaded(std::optional<std::string> cached_body);
++
 +  // Called when remote fetch completes.
-+  void OnRemoteFetchComplete(std::optional<std::string> response_body);
++  void OnRemoteFetchComplete(BrowserOSConditionalFetcher::Result result);
++
++  // Posts BuildResultFromConfig() to the thread pool.
++  void BuildResultInBackground(
++      std::string json_content,
++      base::OnceCallback<void(InstallResult)> callback);
++
++  // Builds the install result for a config JSON document. Thread-safe.
++  static InstallResult BuildResultFromConfig(const std::string& json_content);
++
++  // Called with the result built from the cached config.
++  void OnCachedResultBuilt(InstallResult result);
 +
 +  // Parses config JSON and returns extensions dict.
-+  base::Value::Dict ParseConfigJson(const std::string& json_content);
++  static base::Value::Dict ParseConfigJson(const std::string& json_content);
 +
 +  // Completes the installation with the given result.
 +  void Complete(InstallResult result);
 +
 +  raw_ptr<Profile> profile_;
-+  GURL config_url_;
++  raw_ptr<BrowserOSConditionalFetcher> config_fetcher_;
 +  InstallCompleteCallback callback_;
 +  std::set<std::string> extension_ids_;
 +
-+  std::unique_ptr<network::SimpleURLLoader> url_loader_;
-+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
-+
 +  base::WeakPtrFactory<BrowserOSExtensionInstaller> weak_ptr_factory_{this};
 +};
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.cc b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
 new file mode 100644
-index 0000000000000..52703e88e7478
+index 0000000000000..e3464a2aec842
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
-@@ -0,0 +1,212 @@
+@@ -0,0 +1,244 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,9 +14,9 @@ index 0000000000000..52703e88e7478
 +
 +#include "base/feature_list.h"
 +#include "base/logging.h"
-+#include "base/task/single_thread_task_runner.h"
 +#include "chrome/browser/browser_features.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "chrome/browser/browseros/core/browseros_startup_scheduler.h"
 +#include "chrome/browser/extensions/external_provider_impl.h"
 +#include "chrome/browser/extensions/updater/extension_updater.h"
 +#include "chrome/browser/profiles/profile.h"
@@ -24,6 +24,7 @@ index 0000000000000..52703e88e7478
 +#include "extensions/browser/pending_extension_manager.h"
 +#include "extensions/common/extension.h"
 +#include "extensions/common/mojom/manifest.mojom-shared.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
 +
 +namespace browseros {
 +
@@ -31,6 +32,31 @@ index 0000000000000..52703e88e7478
 +
 +constexpr base::TimeDelta kImmediateInstallDelay = base::Seconds(2);
 +
++constexpr size_t kMaxConfigSize = 1024 * 1024;
++constexpr base::FilePath::CharType kConfigCacheFileName[] =
++    FILE_PATH_LITERAL("BrowserOS Extension Config");
++
++constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
++    net::DefineNetworkTrafficAnnotation("browseros_extension_config", R"(
++        semantics {
++          sender: "BrowserOS Extension Loader"
++          description:
++            "Fetches JSON configuration specifying which extensions should "
++            "be installed and maintained for BrowserOS users. Requests are "
++            "conditional on the last fetched version."
++          trigger:
++            "Browser startup when no config is cached, then a periodic "
++            "maintenance cycle (about every 15 minutes)."
++          data: "No user data. GET request only."
++          destination: OTHER
++          destination_other: "BrowserOS configuration server."
++        }
++        policy {
++          cookies_allowed: NO
++          setting: "Controlled via command-line flags or enterprise policies."
++          policy_exception_justification: "BrowserOS feature."
++        })");
++
 +}  // namespace
 +
 +BrowserOSExtensionLoader::BrowserOSExtensionLoader(Profile* profile)
@@ -63,11 +89,17 @@ index 0000000000000..52703e88e7478
 +void BrowserOSExtensionLoader::StartLoading() {
 +  LOG(INFO) << "browseros: Extension loader starting";
 +
-+  installer_ = std::make_unique<BrowserOSExtensionInstaller>(profile_);
-+  maintainer_ = std::make_unique<BrowserOSExtensionMaintainer>(profile_);
++  if (config_url_.is_valid()) {
++    config_fetcher_ = std::make_unique<BrowserOSConditionalFetcher>(
++        config_url_, profile_->GetPath().Append(kConfigCacheFileName),
++        kMaxConfigSize, kTrafficAnnotation);
++  }
++  installer_ = std::make_unique<BrowserOSExtensionInstaller>(
++      profile_, config_fetcher_.get());
++  maintainer_ = std::make_unique<BrowserOSExtensionMaintainer>(
++      profile_, config_fetcher_.get());
 +
 +  installer_->StartInstallation(
-+      config_url_,
 +      base::BindOnce(&BrowserOSExtensionLoader::OnInstallComplete,
 +                     weak_ptr_factory_.GetWeakPtr()));
 +}
@@ -102,15 +134,15 @@ index 0000000000000..52703e88e7478
 +
 +  if (!from_bundled) {
 +    // Pass config clone directly - clearer ownership than relying on member state
-+    base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
-+        FROM_HERE,
++    BrowserOSStartupScheduler::GetInstance()->PostDelayedTask(
++        StartupPhase::kAfterStartup, FROM_HERE,
 +        base::BindOnce(&BrowserOSExtensionLoader::TriggerImmediateInstallation,
 +                       weak_ptr_factory_.GetWeakPtr(), last_config_.Clone()),
 +        kImmediateInstallDelay);
 +  }
 +
 +  // Maintainer owns the config now
-+  maintainer_->Start(config_url_, extension_ids_, std::move(last_config_));
++  maintainer_->Start(extension_ids_, std::move(last_config_));
 +}
 +
 +void BrowserOSExtensionLoader::TriggerImmediateInstallation(
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.h b/chrome/browser/browseros/extensions/browseros_extension_loader.h
 new file mode 100644
-index 0000000000000..c0b26b369ad07
+index 0000000000000..9aa99b63c0043
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.h
-@@ -0,0 +1,81 @@
+@@ -0,0 +1,85 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -17,6 +17,7 @@ index 0000000000000..c0b26b369ad07
 +
 +#include "base/files/file_path.h"
 +#include "base/memory/weak_ptr.h"
++#include "chrome/browser/browseros/core/browseros_conditional_fetcher.h"
 +#include "chrome/browser/browseros/extensions/browseros_extension_installer.h"
 +#include "chrome/browser/browseros/extensions/browseros_extension_maintainer.h"
 +#include "chrome/browser/extensions/external_loader.h"
@@ -76,6 +77,9 @@ index 0000000000000..c0b26b369ad07
 +  std::set<std::string> extension_ids_;
 +  base::Value::Dict last_config_;
 +
++  // Shared by the installer and maintainer; keeps the last good config
++  // across restarts.
++  std::unique_ptr<BrowserOSConditionalFetcher> config_fetcher_;
 +  std::unique_ptr<BrowserOSExtensionInstaller> installer_;
 +  std::unique_ptr<BrowserOSExtensionMaintainer> maintainer_;
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
 new file mode 100644
-index 0000000000000..404fb31de4e55
+index 0000000000000..4f1570dbb7e4b
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
-@@ -0,0 +1,383 @@
+@@ -0,0 +1,372 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -16,7 +16,9 @@ index 0000000000000..404fb31de4e55
 +#include "base/json/json_reader.h"
 +#include "base/logging.h"
 +#include "base/task/single_thread_task_runner.h"
++#include "base/time/time.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "chrome/browser/browseros/core/browseros_startup_scheduler.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +#include "chrome/browser/extensions/extension_service.h"
 +#include "chrome/browser/extensions/external_provider_impl.h"
@@ -31,10 +33,8 @@ index 0000000000000..404fb31de4e55
 +#include "extensions/browser/uninstall_reason.h"
 +#include "extensions/common/extension.h"
 +#include "extensions/common/mojom/manifest.mojom-shared.h"
-+#include "net/base/load_flags.h"
-+#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
++#include "net/base/net_errors.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
 +
 +namespace browseros {
 +
@@ -42,46 +42,33 @@ index 0000000000000..404fb31de4e55
 +
 +constexpr base::TimeDelta kMaintenanceInterval = base::Minutes(15);
 +constexpr base::TimeDelta kInitialMaintenanceDelay = base::Seconds(60);
-+
-+constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
-+    net::DefineNetworkTrafficAnnotation("browseros_extension_maintenance", R"(
-+        semantics {
-+          sender: "BrowserOS Extension Maintainer"
-+          description:
-+            "Fetches JSON configuration for BrowserOS extension maintenance."
-+          trigger: "Periodic maintenance cycle (every 15 minutes)."
-+          data: "No user data. GET request only."
-+          destination: OTHER
-+          destination_other: "BrowserOS configuration server."
-+        }
-+        policy {
-+          cookies_allowed: NO
-+          setting: "Controlled via command-line flags or enterprise policies."
-+          policy_exception_justification: "BrowserOS feature."
-+        })");
++// Delays are spread over +/- this fraction of their nominal value.
++constexpr double kMaintenanceJitter = 0.25;
 +
 +}  // namespace
 +
-+BrowserOSExtensionMaintainer::BrowserOSExtensionMaintainer(Profile* profile)
-+    : profile_(profile) {}
++BrowserOSExtensionMaintainer::BrowserOSExtensionMaintainer(
++    Profile* profile,
++    BrowserOSConditionalFetcher* config_fetcher)
++    : profile_(profile), config_fetcher_(config_fetcher) {}
 +
 +BrowserOSExtensionMaintainer::~BrowserOSExtensionMaintainer() = default;
 +
-+void BrowserOSExtensionMaintainer::Start(const GURL& config_url,
-+                                         std::set<std::string> extension_ids,
++void BrowserOSExtensionMaintainer::Start(std::set<std::string> extension_ids,
 +                                         base::Value::Dict initial_config) {
-+  config_url_ = config_url;
 +  extension_ids_ = std::move(extension_ids);
 +  last_config_ = std::move(initial_config);
 +
-+  LOG(INFO) << "browseros: Scheduling maintenance in "
-+            << kInitialMaintenanceDelay.InSeconds() << " seconds";
++  base::TimeDelta delay =
++      GetJitteredDelay(kInitialMaintenanceDelay, kMaintenanceJitter);
++  LOG(INFO) << "browseros: Scheduling maintenance " << delay.InSeconds()
++            << " seconds after startup";
 +
-+  base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
-+      FROM_HERE,
++  BrowserOSStartupScheduler::GetInstance()->PostDelayedTask(
++      StartupPhase::kIdle, FROM_HERE,
 +      base::BindOnce(&BrowserOSExtensionMaintainer::RunMaintenanceCycle,
 +                     weak_ptr_factory_.GetWeakPtr()),
-+      kInitialMaintenanceDelay);
++      delay);
 +}
 +
 +void BrowserOSExtensionMaintainer::UpdateExtensionIds(
@@ -97,7 +84,7 @@ index 0000000000000..404fb31de4e55
 +    return;
 +  }
 +
-+  if (!config_url_.is_valid()) {
++  if (!config_fetcher_) {
 +    ExecuteMaintenanceTasks();
 +    ScheduleNextMaintenance();
 +    return;
@@ -108,27 +95,20 @@ index 0000000000000..404fb31de4e55
 +                              ->GetURLLoaderFactoryForBrowserProcess();
 +  }
 +
-+  auto request = std::make_unique<network::ResourceRequest>();
-+  request->url = config_url_;
-+  request->method = "GET";
-+  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
-+
-+  auto loader =
-+      network::SimpleURLLoader::Create(std::move(request), kTrafficAnnotation);
-+
-+  auto* loader_ptr = loader.get();
-+  loader_ptr->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
-+      url_loader_factory_.get(),
++  config_fetcher_->Fetch(
++      url_loader_factory_,
 +      base::BindOnce(&BrowserOSExtensionMaintainer::OnConfigFetched,
-+                     weak_ptr_factory_.GetWeakPtr(), std::move(loader)));
++                     weak_ptr_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSExtensionMaintainer::OnConfigFetched(
-+    std::unique_ptr<network::SimpleURLLoader> loader,
-+    std::optional<std::string> response_body) {
-+  if (response_body.has_value()) {
-+    base::Value::Dict config = ParseConfigJson(*response_body);
-+    if (!config.empty()) {
++    BrowserOSConditionalFetcher::Result result) {
++  switch (result.status) {
++    case BrowserOSConditionalFetcher::Result::Status::kModified: {
++      base::Value::Dict config = ParseConfigJson(result.body);
++      if (config.empty()) {
++        break;
++      }
 +      last_config_ = std::move(config);
 +
 +      for (const auto [id, _] : last_config_) {
@@ -137,9 +117,16 @@ index 0000000000000..404fb31de4e55
 +
 +      LOG(INFO) << "browseros: Updated config with " << last_config_.size()
 +                << " extensions";
++      break;
 +    }
-+  } else {
-+    LOG(WARNING) << "browseros: Failed to fetch maintenance config";
++    case BrowserOSConditionalFetcher::Result::Status::kNotModified:
++      // |last_config_| already reflects this body.
++      LOG(INFO) << "browseros: Maintenance config unchanged";
++      break;
++    case BrowserOSConditionalFetcher::Result::Status::kFailed:
++      LOG(WARNING) << "browseros: Failed to fetch maintenance config: "
++                   << net::ErrorToString(result.net_error);
++      break;
 +  }
 +
 +  ExecuteMaintenanceTasks();
@@ -178,14 +165,16 @@ index 0000000000000..404fb31de4e55
 +}
 +
 +void BrowserOSExtensionMaintainer::ScheduleNextMaintenance() {
++  base::TimeDelta delay =
++      GetJitteredDelay(kMaintenanceInterval, kMaintenanceJitter);
 +  LOG(INFO) << "browseros: Scheduling next maintenance in "
-+            << kMaintenanceInterval.InMinutes() << " minutes";
++            << delay.InSeconds() << " seconds";
 +
 +  base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
 +      FROM_HERE,
 +      base::BindOnce(&BrowserOSExtensionMaintainer::RunMaintenanceCycle,
 +                     weak_ptr_factory_.GetWeakPtr()),
-+      kMaintenanceInterval);
++      delay);
 +}
 +
 +void BrowserOSExtensionMaintainer::UninstallDeprecatedExtensions() {
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.h b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
 new file mode 100644
-index 0000000000000..eb68969a4163f
+index 0000000000000..d4fc2ff6fcc37
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
-@@ -0,0 +1,84 @@
+@@ -0,0 +1,88 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -20,11 +20,10 @@ index 0000000000000..eb68969a4163f
 +#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/values.h"
-+#include "url/gurl.h"
++#include "chrome/browser/browseros/core/browseros_conditional_fetcher.h"
 +
 +namespace network {
 +class SharedURLLoaderFactory;
-+class SimpleURLLoader;
 +}  // namespace network
 +
 +class Profile;
@@ -34,9 +33,16 @@ index 0000000000000..eb68969a4163f
 +// Handles periodic maintenance of BrowserOS extensions.
 +// Tasks: uninstall deprecated, reinstall missing, re-enable disabled,
 +// force update check, log health metrics.
++//
++// The config is revalidated through |config_fetcher| each cycle and only
++// reparsed when the server reports a change. Cycles are jittered so that
++// browsers started together do not poll the config server in lockstep.
 +class BrowserOSExtensionMaintainer {
 + public:
-+  explicit BrowserOSExtensionMaintainer(Profile* profile);
++  // |config_fetcher| may be null when there is no config URL; it must
++  // outlive the maintainer.
++  BrowserOSExtensionMaintainer(Profile* profile,
++                               BrowserOSConditionalFetcher* config_fetcher);
 +  ~BrowserOSExtensionMaintainer();
 +
 +  BrowserOSExtensionMaintainer(const BrowserOSExtensionMaintainer&) = delete;
@@ -44,8 +50,7 @@ index 0000000000000..eb68969a4163f
 +      delete;
 +
 +  // Starts maintenance with an initial delay.
-+  void Start(const GURL& config_url,
-+             std::set<std::string> extension_ids,
++  void Start(std::set<std::string> extension_ids,
 +             base::Value::Dict initial_config);
 +
 +  // Updates the set of tracked extension IDs.
@@ -56,8 +61,7 @@ index 0000000000000..eb68969a4163f
 +  void RunMaintenanceCycle();
 +
 +  // Called when config fetch completes.
-+  void OnConfigFetched(std::unique_ptr<network::SimpleURLLoader> loader,
-+                       std::optional<std::string> response_body);
++  void OnConfigFetched(BrowserOSConditionalFetcher::Result result);
 +
 +  // Parses config JSON and returns extensions dict.
 +  base::Value::Dict ParseConfigJson(const std::string& json_content);
@@ -76,7 +80,7 @@ index 0000000000000..eb68969a4163f
 +  void LogExtensionHealth(const std::string& context);
 +
 +  raw_ptr<Profile> profile_;
-+  GURL config_url_;
++  raw_ptr<BrowserOSConditionalFetcher> config_fetcher_;
 +  std::set<std::string> extension_ids_;
 +  base::Value::Dict last_config_;
 +
@@ -0,0 +1,287 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_event_queue.cc b/chrome/browser/browseros/metrics/browseros_metrics_event_queue.cc
+new file mode 100644
+index 0000000000000..3ec7551b0d1bb
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_event_queue.cc
+@@ -0,0 +1,281 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_metrics_event_queue.h"
++
++#include <algorithm>
++#include <cinttypes>
++#include <utility>
++#include <vector>
++
++#include "base/files/file_enumerator.h"
++#include "base/files/file_util.h"
++#include "base/functional/bind.h"
++#include "base/functional/callback_helpers.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/stringprintf.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "components/compression/compression_utils.h"
++#include "net/base/load_flags.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
++#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++
++namespace browseros_metrics {
++
++namespace {
++
++constexpr base::FilePath::CharType kSpoolPattern[] =
++    FILE_PATH_LITERAL("*.json.gz");
++constexpr size_t kMaxResponseSize = 64 * 1024;
++
++// Spooled batches, oldest first. Names start with a zero-padded timestamp.
++std::vector<base::FilePath> ListSpooledBatches(const base::FilePath& dir) {
++  std::vector<base::FilePath> files;
++  base::FileEnumerator enumerator(dir, false, base::FileEnumerator::FILES,
++                                  kSpoolPattern);
++  for (base::FilePath path = enumerator.Next(); !path.empty();
++       path = enumerator.Next()) {
++    files.push_back(path);
++  }
++  std::ranges::sort(files);
++  return files;
++}
++
++// Writes |events| as a gzipped PostHog batch payload.
++void SpoolBatch(const base::FilePath& dir,
++                const std::string& api_key,
++                base::Value::List events,
++                const std::string& file_name) {
++  size_t count = events.size();
++  std::optional<std::string> json = base::WriteJson(
++      base::Value::Dict().Set("api_key", api_key).Set("batch",
++                                                      std::move(events)));
++  std::string compressed;
++  if (!json || !compression::GzipCompress(*json, &compressed)) {
++    LOG(ERROR) << "browseros: Failed to serialize metrics batch";
++    return;
++  }
++  if (!base::CreateDirectory(dir) ||
++      !base::WriteFile(dir.AppendASCII(file_name), compressed)) {
++    LOG(WARNING) << "browseros: Failed to spool metrics batch, dropping "
++                 << count << " events";
++    return;
++  }
++
++  std::vector<base::FilePath> files = ListSpooledBatches(dir);
++  for (size_t i = 0;
++       i + BrowserOSMetricsEventQueue::kMaxSpooledBatches < files.size(); ++i) {
++    base::DeleteFile(files[i]);
++  }
++}
++
++}  // namespace
++
++// static
++const net::BackoffEntry::Policy BrowserOSMetricsEventQueue::kBackoffPolicy = {
++    // Number of initial errors to ignore before applying backoff.
++    0,
++    // Initial delay: 30 seconds.
++    30 * 1000,
++    // Multiply factor.
++    2.0,
++    // Jitter factor.
++    0.1,
++    // Maximum backoff: 1 hour.
++    60 * 60 * 1000,
++    // Never discard the entry.
++    -1,
++    // Don't use initial delay unless the last request was an error.
++    false,
++};
++
++BrowserOSMetricsEventQueue::BrowserOSMetricsEventQueue(
++    const base::FilePath& spool_dir,
++    const GURL& endpoint,
++    const std::string& api_key,
++    const net::NetworkTrafficAnnotationTag& annotation,
++    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
++    : spool_dir_(spool_dir),
++      endpoint_(endpoint),
++      api_key_(api_key),
++      annotation_(annotation),
++      url_loader_factory_(std::move(url_loader_factory)),
++      task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
++           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
++      backoff_(&kBackoffPolicy) {
++  // Replay batches a previous session could not deliver, once startup has
++  // settled. Uploads wait for this like they would for a backoff.
++  retry_timer_.Start(FROM_HERE, kReplayDelay,
++                     base::BindOnce(&BrowserOSMetricsEventQueue::MaybeUpload,
++                                    base::Unretained(this)));
++}
++
++BrowserOSMetricsEventQueue::~BrowserOSMetricsEventQueue() = default;
++
++void BrowserOSMetricsEventQueue::Enqueue(base::Value::Dict event) {
++  if (shut_down_) {
++    return;
++  }
++  events_.push_back(std::move(event));
++  if (events_.size() >= kMaxBatchSize) {
++    Flush();
++    return;
++  }
++  if (!flush_timer_.IsRunning()) {
++    flush_timer_.Start(FROM_HERE, kFlushInterval,
++                       base::BindOnce(&BrowserOSMetricsEventQueue::Flush,
++                                      base::Unretained(this)));
++  }
++}
++
++void BrowserOSMetricsEventQueue::Flush() {
++  flush_timer_.Stop();
++  while (!events_.empty()) {
++    base::Value::List batch;
++    while (!events_.empty() && batch.size() < kMaxBatchSize) {
++      batch.Append(std::move(events_.front()));
++      events_.pop_front();
++    }
++    task_runner_->PostTaskAndReply(
++        FROM_HERE,
++        base::BindOnce(&SpoolBatch, spool_dir_, api_key_, std::move(batch),
++                       NextBatchFileName()),
++        base::BindOnce(&BrowserOSMetricsEventQueue::OnBatchSpooled,
++                       weak_factory_.GetWeakPtr()));
++  }
++}
++
++void BrowserOSMetricsEventQueue::Shutdown() {
++  if (shut_down_) {
++    return;
++  }
++  // The spool task blocks shutdown, so these events reach the disk.
++  Flush();
++  shut_down_ = true;
++  retry_timer_.Stop();
++  loader_.reset();
++  weak_factory_.InvalidateWeakPtrs();
++}
++
++// static
++std::optional<BrowserOSMetricsEventQueue::SpooledBatch>
++BrowserOSMetricsEventQueue::LoadOldestBatch(const base::FilePath& dir) {
++  for (const base::FilePath& path : ListSpooledBatches(dir)) {
++    std::string data;
++    if (base::ReadFileToString(path, &data) && !data.empty()) {
++      return SpooledBatch{path, std::move(data)};
++    }
++    base::DeleteFile(path);
++  }
++  return std::nullopt;
++}
++
++void BrowserOSMetricsEventQueue::OnBatchSpooled() {
++  MaybeUpload();
++}
++
++void BrowserOSMetricsEventQueue::MaybeUpload() {
++  if (shut_down_ || uploading_ || retry_timer_.IsRunning()) {
++    return;
++  }
++  uploading_ = true;
++  task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSMetricsEventQueue::LoadOldestBatch, spool_dir_),
++      base::BindOnce(&BrowserOSMetricsEventQueue::OnOldestBatchLoaded,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSMetricsEventQueue::OnOldestBatchLoaded(
++    std::optional<SpooledBatch> batch) {
++  if (!batch) {
++    uploading_ = false;
++    return;
++  }
++
++  auto request = std::make_unique<network::ResourceRequest>();
++  request->url = endpoint_;
++  request->method = "POST";
++  request->load_flags = net::LOAD_DISABLE_CACHE;
++  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++  request->headers.SetHeader(net::HttpRequestHeaders::kContentEncoding,
++                             "gzip");
++
++  loader_ = network::SimpleURLLoader::Create(std::move(request), annotation_);
++  loader_->SetAllowHttpErrorResults(true);
++  loader_->AttachStringForUpload(std::move(batch->data), "application/json");
++  loader_->DownloadToString(
++      url_loader_factory_.get(),
++      base::BindOnce(&BrowserOSMetricsEventQueue::OnUploadComplete,
++                     weak_factory_.GetWeakPtr(), batch->path),
++      kMaxResponseSize);
++}
++
++void BrowserOSMetricsEventQueue::OnUploadComplete(
++    base::FilePath path,
++    std::optional<std::string> response_body) {
++  int response_code = 0;
++  if (loader_->ResponseInfo() && loader_->ResponseInfo()->headers) {
++    response_code = loader_->ResponseInfo()->headers->response_code();
++  }
++  int net_error = loader_->NetError();
++  loader_.reset();
++
++  bool delivered = response_code >= 200 && response_code < 300;
++  // Resending a batch the collector rejected as malformed would not help.
++  bool rejected = response_code >= 400 && response_code < 500 &&
++                  response_code != net::HTTP_TOO_MANY_REQUESTS;
++  if (!delivered && !rejected) {
++    LOG(WARNING) << "browseros: Failed to upload metrics batch: "
++                 << (response_code ? base::NumberToString(response_code)
++                                   : net::ErrorToString(net_error));
++    uploading_ = false;
++    backoff_.InformOfRequest(false);
++    ScheduleRetry();
++    return;
++  }
++
++  if (rejected) {
++    LOG(WARNING) << "browseros: Metrics batch rejected with response code "
++                 << response_code;
++  } else {
++    VLOG(2) << "browseros: Metrics batch sent successfully";
++  }
++  backoff_.InformOfRequest(true);
++  task_runner_->PostTaskAndReply(
++      FROM_HERE, base::BindOnce(base::IgnoreResult(&base::DeleteFile), path),
++      base::BindOnce(&BrowserOSMetricsEventQueue::OnUploadedBatchDeleted,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSMetricsEventQueue::OnUploadedBatchDeleted() {
++  uploading_ = false;
++  // Drain the rest of the spool.
++  MaybeUpload();
++}
++
++void BrowserOSMetricsEventQueue::ScheduleRetry() {
++  retry_timer_.Start(FROM_HERE, backoff_.GetTimeUntilRelease(),
++                     base::BindOnce(&BrowserOSMetricsEventQueue::MaybeUpload,
++                                    base::Unretained(this)));
++}
++
++std::string BrowserOSMetricsEventQueue::NextBatchFileName() {
++  return base::StringPrintf(
++      "%016" PRId64 "-%04d.json.gz",
++      base::Time::Now().InMillisecondsSinceUnixEpoch(),
++      next_batch_id_++ % 10000);
++}
++
++}  // namespace browseros_metrics
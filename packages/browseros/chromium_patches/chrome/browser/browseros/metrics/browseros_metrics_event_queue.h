@@ -0,0 +1,130 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_event_queue.h b/chrome/browser/browseros/metrics/browseros_metrics_event_queue.h
+new file mode 100644
+index 0000000000000..bce826280bd22
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_event_queue.h
+@@ -0,0 +1,124 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_EVENT_QUEUE_H_
++#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_EVENT_QUEUE_H_
++
++#include <cstddef>
++#include <deque>
++#include <memory>
++#include <optional>
++#include <string>
++
++#include "base/files/file_path.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++#include "net/base/backoff_entry.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++#include "url/gurl.h"
++
++namespace base {
++class SequencedTaskRunner;
++}  // namespace base
++
++namespace network {
++class SharedURLLoaderFactory;
++class SimpleURLLoader;
++}  // namespace network
++
++namespace browseros_metrics {
++
++// Batches analytics events and uploads them to a PostHog-style /batch/
++// endpoint.
++//
++// Events are buffered in memory and flushed when kMaxBatchSize are queued or
++// kFlushInterval after the first one. A flushed batch is serialized, gzipped
++// and written to |spool_dir| on a background sequence, then uploaded from
++// there. The file is deleted once the collector accepts it, so batches that
++// fail to upload (offline, collector errors) are retried with exponential
++// backoff and replayed on the next start. Shutdown() spools whatever is
++// still in memory.
++class BrowserOSMetricsEventQueue {
++ public:
++  static constexpr size_t kMaxBatchSize = 50;
++  // Oldest batches are dropped beyond this many on disk, bounding what is
++  // kept while offline.
++  static constexpr size_t kMaxSpooledBatches = 100;
++  static constexpr base::TimeDelta kFlushInterval = base::Seconds(30);
++  // Delay before batches spooled by a previous session are replayed.
++  static constexpr base::TimeDelta kReplayDelay = base::Seconds(10);
++
++  static const net::BackoffEntry::Policy kBackoffPolicy;
++
++  BrowserOSMetricsEventQueue(
++      const base::FilePath& spool_dir,
++      const GURL& endpoint,
++      const std::string& api_key,
++      const net::NetworkTrafficAnnotationTag& annotation,
++      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
++
++  BrowserOSMetricsEventQueue(const BrowserOSMetricsEventQueue&) = delete;
++  BrowserOSMetricsEventQueue& operator=(const BrowserOSMetricsEventQueue&) =
++      delete;
++
++  ~BrowserOSMetricsEventQueue();
++
++  // Queues one event: {"event", "distinct_id", "timestamp", "properties"}.
++  void Enqueue(base::Value::Dict event);
++
++  // Spools everything queued so far and starts uploading it.
++  void Flush();
++
++  // Spools queued events for the next session and stops uploading.
++  void Shutdown();
++
++  size_t queued_events_for_testing() const { return events_.size(); }
++
++ private:
++  struct SpooledBatch {
++    base::FilePath path;
++    std::string data;
++  };
++
++  // Reads the oldest spooled batch, deleting unreadable ones. Blocking.
++  static std::optional<SpooledBatch> LoadOldestBatch(
++      const base::FilePath& dir);
++
++  void OnBatchSpooled();
++  void MaybeUpload();
++  void OnOldestBatchLoaded(std::optional<SpooledBatch> batch);
++  void OnUploadComplete(base::FilePath path,
++                        std::optional<std::string> response_body);
++  void OnUploadedBatchDeleted();
++  void ScheduleRetry();
++  std::string NextBatchFileName();
++
++  const base::FilePath spool_dir_;
++  const GURL endpoint_;
++  const std::string api_key_;
++  const net::NetworkTrafficAnnotationTag annotation_;
++  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
++  // Serialization, compression and spool I/O run here.
++  scoped_refptr<base::SequencedTaskRunner> task_runner_;
++
++  std::deque<base::Value::Dict> events_;
++  base::OneShotTimer flush_timer_;
++  base::OneShotTimer retry_timer_;
++  net::BackoffEntry backoff_;
++
++  // True from loading a spooled batch until its upload completes.
++  bool uploading_ = false;
++  bool shut_down_ = false;
++  int next_batch_id_ = 0;
++  std::unique_ptr<network::SimpleURLLoader> loader_;
++
++  base::WeakPtrFactory<BrowserOSMetricsEventQueue> weak_factory_{this};
++};
++
++}  // namespace browseros_metrics
++
++#endif  // CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_EVENT_QUEUE_H_
@@ -0,0 +1,193 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_event_queue_unittest.cc b/chrome/browser/browseros/metrics/browseros_metrics_event_queue_unittest.cc
+new file mode 100644
+index 0000000000000..f53ae1026e059
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_event_queue_unittest.cc
+@@ -0,0 +1,187 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_metrics_event_queue.h"
++
++#include <memory>
++#include <optional>
++#include <string>
++
++#include "base/files/file_enumerator.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/json/json_reader.h"
++#include "base/test/task_environment.h"
++#include "components/compression/compression_utils.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_status_code.h"
++#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/test/test_url_loader_factory.h"
++#include "services/network/test/test_utils.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "url/gurl.h"
++
++namespace browseros_metrics {
++namespace {
++
++constexpr char kEndpoint[] = "https://collector.example.com/batch/";
++constexpr char kApiKey[] = "test-key";
++
++base::Value::Dict MakeEvent(int i) {
++  return base::Value::Dict().Set("event", "test").Set(
++      "properties", base::Value::Dict().Set("i", i));
++}
++
++class BrowserOSMetricsEventQueueTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    spool_dir_ = temp_dir_.GetPath().AppendASCII("spool");
++  }
++
++  std::unique_ptr<BrowserOSMetricsEventQueue> CreateQueue() {
++    return std::make_unique<BrowserOSMetricsEventQueue>(
++        spool_dir_, GURL(kEndpoint), kApiKey, TRAFFIC_ANNOTATION_FOR_TESTS,
++        test_url_loader_factory_.GetSafeWeakWrapper());
++  }
++
++  // Decodes the single in-flight upload.
++  std::optional<base::Value::Dict> PendingPayload() {
++    if (test_url_loader_factory_.NumPending() != 1) {
++      return std::nullopt;
++    }
++    const network::ResourceRequest& request =
++        (*test_url_loader_factory_.pending_requests())[0].request;
++    EXPECT_EQ("gzip", request.headers.GetHeader(
++                          net::HttpRequestHeaders::kContentEncoding));
++    std::string json;
++    if (!compression::GzipUncompress(network::GetUploadData(request),
++                                     &json)) {
++      return std::nullopt;
++    }
++    return base::JSONReader::ReadDict(json);
++  }
++
++  size_t PendingBatchSize() {
++    std::optional<base::Value::Dict> payload = PendingPayload();
++    if (!payload) {
++      return 0;
++    }
++    EXPECT_EQ(kApiKey, *payload->FindString("api_key"));
++    return payload->FindList("batch")->size();
++  }
++
++  void Respond(net::HttpStatusCode status) {
++    ASSERT_TRUE(
++        test_url_loader_factory_.SimulateResponseForPendingRequest(
++            kEndpoint, "", status));
++    task_environment_.RunUntilIdle();
++  }
++
++  int SpooledBatchCount() {
++    int count = 0;
++    base::FileEnumerator enumerator(spool_dir_, false,
++                                    base::FileEnumerator::FILES);
++    for (base::FilePath path = enumerator.Next(); !path.empty();
++         path = enumerator.Next()) {
++      ++count;
++    }
++    return count;
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  network::TestURLLoaderFactory test_url_loader_factory_;
++  base::ScopedTempDir temp_dir_;
++  base::FilePath spool_dir_;
++};
++
++TEST_F(BrowserOSMetricsEventQueueTest, FlushesFullBatch) {
++  auto queue = CreateQueue();
++  task_environment_.FastForwardBy(BrowserOSMetricsEventQueue::kReplayDelay);
++
++  for (int i = 0;
++       i < static_cast<int>(BrowserOSMetricsEventQueue::kMaxBatchSize); ++i) {
++    queue->Enqueue(MakeEvent(i));
++  }
++  EXPECT_EQ(0u, queue->queued_events_for_testing());
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(BrowserOSMetricsEventQueue::kMaxBatchSize, PendingBatchSize());
++
++  Respond(net::HTTP_OK);
++  EXPECT_EQ(0, test_url_loader_factory_.NumPending());
++  EXPECT_EQ(0, SpooledBatchCount());
++}
++
++TEST_F(BrowserOSMetricsEventQueueTest, FlushesOnTimer) {
++  auto queue = CreateQueue();
++  queue->Enqueue(MakeEvent(1));
++  queue->Enqueue(MakeEvent(2));
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(0, test_url_loader_factory_.NumPending());
++
++  task_environment_.FastForwardBy(BrowserOSMetricsEventQueue::kFlushInterval);
++  EXPECT_EQ(2u, PendingBatchSize());
++}
++
++TEST_F(BrowserOSMetricsEventQueueTest, BacksOffAfterFailure) {
++  auto queue = CreateQueue();
++  queue->Enqueue(MakeEvent(1));
++  queue->Flush();
++  task_environment_.FastForwardBy(BrowserOSMetricsEventQueue::kReplayDelay);
++  Respond(net::HTTP_SERVICE_UNAVAILABLE);
++  EXPECT_EQ(1, SpooledBatchCount());
++
++  // The initial delay is 30 seconds, less up to 10% jitter.
++  task_environment_.FastForwardBy(base::Seconds(26));
++  EXPECT_EQ(0, test_url_loader_factory_.NumPending());
++  task_environment_.FastForwardBy(base::Seconds(4));
++  EXPECT_EQ(1u, PendingBatchSize());
++
++  Respond(net::HTTP_OK);
++  EXPECT_EQ(0, SpooledBatchCount());
++}
++
++TEST_F(BrowserOSMetricsEventQueueTest, DropsRejectedBatch) {
++  auto queue = CreateQueue();
++  queue->Enqueue(MakeEvent(1));
++  queue->Flush();
++  task_environment_.FastForwardBy(BrowserOSMetricsEventQueue::kReplayDelay);
++  Respond(net::HTTP_BAD_REQUEST);
++
++  EXPECT_EQ(0, SpooledBatchCount());
++  task_environment_.FastForwardBy(base::Minutes(5));
++  EXPECT_EQ(0, test_url_loader_factory_.NumPending());
++}
++
++TEST_F(BrowserOSMetricsEventQueueTest, ReplaysSpoolAfterRestart) {
++  auto queue = CreateQueue();
++  queue->Enqueue(MakeEvent(1));
++  queue->Flush();
++  task_environment_.FastForwardBy(BrowserOSMetricsEventQueue::kReplayDelay);
++  Respond(net::HTTP_SERVICE_UNAVAILABLE);
++
++  // Still in memory at shutdown.
++  queue->Enqueue(MakeEvent(2));
++  queue->Enqueue(MakeEvent(3));
++  queue->Shutdown();
++  queue.reset();
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(2, SpooledBatchCount());
++
++  queue = CreateQueue();
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(0, test_url_loader_factory_.NumPending());
++
++  // Oldest batch first.
++  task_environment_.FastForwardBy(BrowserOSMetricsEventQueue::kReplayDelay);
++  EXPECT_EQ(1u, PendingBatchSize());
++  Respond(net::HTTP_OK);
++  EXPECT_EQ(2u, PendingBatchSize());
++  Respond(net::HTTP_OK);
++  EXPECT_EQ(0, SpooledBatchCount());
++}
++
++}  // namespace
++}  // namespace browseros_metrics
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.cc b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
 new file mode 100644
-index 0000000000000..cbc1f29e5d407
+index 0000000000000..8e2ae8da4f046
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
-@@ -0,0 +1,231 @@
+@@ -0,0 +1,178 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,21 +14,17 @@ index 0000000000000..cbc1f29e5d407
 +#include <string>
 +
 +#include "base/uuid.h"
-+#include "base/json/json_writer.h"
++#include "base/i18n/time_formatting.h"
 +#include "base/logging.h"
-+#include "base/strings/string_number_conversions.h"
 +#include "base/system/sys_info.h"
 +#include "base/time/time.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics_event_queue.h"
 +#include "chrome/common/pref_names.h"
 +#include "components/prefs/pref_service.h"
 +#include "components/version_info/version_info.h"
-+#include "net/base/load_flags.h"
-+#include "net/http/http_status_code.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
 +#include "services/network/public/cpp/shared_url_loader_factory.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
-+#include "services/network/public/mojom/url_response_head.mojom.h"
++#include "url/gurl.h"
 +
 +namespace browseros_metrics {
 +
@@ -41,8 +37,7 @@ index 0000000000000..cbc1f29e5d407
 +
 +// PostHog API configuration
 +constexpr char kPostHogApiKey[] = "phc_PRrpVnBMVJgUumvaXzUnwKZ1dDs3L8MSICLhTdnc8jC";
-+constexpr char kPostHogEndpoint[] = "https://us.i.posthog.com/i/v0/e/";
-+constexpr size_t kMaxUploadSize = 256 * 1024;  // 256KB max upload size
++constexpr char kPostHogEndpoint[] = "https://us.i.posthog.com/batch/";
 +
 +constexpr net::NetworkTrafficAnnotationTag kBrowserOSMetricsTrafficAnnotation =
 +    net::DefineNetworkTrafficAnnotation("browseros_metrics", R"(
@@ -54,7 +49,9 @@ index 0000000000000..cbc1f29e5d407
 +            "used. No personally identifiable information is collected."
 +          trigger:
 +            "Triggered when BrowserOS features are used, such as extension "
-+            "actions or settings changes."
++            "actions or settings changes. Events are sent in gzipped batches "
++            "every 30 seconds or 50 events, and batches that could not be "
++            "sent are retried later."
 +          data:
 +            "Event name, timestamp, anonymous client ID, browser version, "
 +            "OS information, and feature-specific properties without PII."
@@ -77,15 +74,18 @@ index 0000000000000..cbc1f29e5d407
 +BrowserOSMetricsService::BrowserOSMetricsService(
 +    PrefService* pref_service,
 +    PrefService* local_state_prefs,
-+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
++    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++    const base::FilePath& spool_dir)
 +    : pref_service_(pref_service),
-+      local_state_prefs_(local_state_prefs),
-+      url_loader_factory_(std::move(url_loader_factory)) {
++      local_state_prefs_(local_state_prefs) {
 +  CHECK(pref_service_);
 +  CHECK(local_state_prefs_);
-+  CHECK(url_loader_factory_);
++  CHECK(url_loader_factory);
 +  InitializeClientId();
 +  InitializeInstallId();
++  event_queue_ = std::make_unique<BrowserOSMetricsEventQueue>(
++      spool_dir, GURL(kPostHogEndpoint), kPostHogApiKey,
++      kBrowserOSMetricsTrafficAnnotation, std::move(url_loader_factory));
 +}
 +
 +BrowserOSMetricsService::~BrowserOSMetricsService() = default;
@@ -102,8 +102,13 @@ index 0000000000000..cbc1f29e5d407
 +  // Add default properties
 +  AddDefaultProperties(properties);
 +
-+  // Send to PostHog
-+  SendEventToPostHog(event_name, std::move(properties));
++  // Queue for the next batch upload
++  base::Value::Dict event;
++  event.Set("event", "browseros.native." + event_name);
++  event.Set("distinct_id", client_id_);
++  event.Set("timestamp", base::TimeFormatAsIso8601(base::Time::Now()));
++  event.Set("properties", std::move(properties));
++  event_queue_->Enqueue(std::move(event));
 +}
 +
 +std::string BrowserOSMetricsService::GetClientId() const {
@@ -115,8 +120,8 @@ index 0000000000000..cbc1f29e5d407
 +}
 +
 +void BrowserOSMetricsService::Shutdown() {
-+  // Cancel any pending network requests
-+  weak_factory_.InvalidateWeakPtrs();
++  // Spool unsent events for the next session and cancel pending uploads
++  event_queue_->Shutdown();
 +}
 +
 +void BrowserOSMetricsService::InitializeClientId() {
@@ -157,64 +162,6 @@ index 0000000000000..cbc1f29e5d407
 +  VLOG(1) << "browseros: Metrics install ID: " << install_id_;
 +}
 +
-+void BrowserOSMetricsService::SendEventToPostHog(
-+    const std::string& event_name,
-+    base::Value::Dict properties) {
-+  // Build the request payload
-+  base::Value::Dict payload;
-+  payload.Set("api_key", kPostHogApiKey);
-+  payload.Set("event", "browseros.native." + event_name);
-+  payload.Set("distinct_id", client_id_);
-+  payload.Set("properties", std::move(properties));
-+
-+  // Convert to JSON
-+  std::string json_payload;
-+  if (!base::JSONWriter::Write(payload, &json_payload)) {
-+    LOG(ERROR) << "browseros: Failed to serialize metrics payload";
-+    return;
-+  }
-+
-+  // Create the request
-+  auto resource_request = std::make_unique<network::ResourceRequest>();
-+  resource_request->url = GURL(kPostHogEndpoint);
-+  resource_request->method = "POST";
-+  resource_request->load_flags = net::LOAD_DISABLE_CACHE;
-+  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
-+
-+  // Create the URL loader
-+  auto url_loader = network::SimpleURLLoader::Create(
-+      std::move(resource_request), kBrowserOSMetricsTrafficAnnotation);
-+  url_loader->SetAllowHttpErrorResults(true);
-+  url_loader->AttachStringForUpload(json_payload, "application/json");
-+
-+  // Send the request
-+  network::SimpleURLLoader* loader_ptr = url_loader.get();
-+  loader_ptr->DownloadToString(
-+      url_loader_factory_.get(),
-+      base::BindOnce(&BrowserOSMetricsService::OnPostHogResponse,
-+                     weak_factory_.GetWeakPtr(), std::move(url_loader)),
-+      kMaxUploadSize);
-+}
-+
-+void BrowserOSMetricsService::OnPostHogResponse(
-+    std::unique_ptr<network::SimpleURLLoader> loader,
-+    std::optional<std::string> response_body) {
-+  int response_code = 0;
-+  if (loader->ResponseInfo() && loader->ResponseInfo()->headers) {
-+    response_code = loader->ResponseInfo()->headers->response_code();
-+  }
-+
-+  if (response_code == net::HTTP_OK) {
-+    VLOG(2) << "browseros: Metrics event sent successfully";
-+  } else {
-+    LOG(WARNING) << "browseros: Failed to send metrics event. Response code: "
-+                 << response_code;
-+    if (response_body.has_value() && !response_body->empty()) {
-+      LOG(WARNING) << "browseros: Error response: " << *response_body;
-+    }
-+  }
-+}
-+
 +void BrowserOSMetricsService::AddDefaultProperties(
 +    base::Value::Dict& properties) {
 +  // Add browser version
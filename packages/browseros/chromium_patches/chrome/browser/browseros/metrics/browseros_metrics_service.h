@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.h b/chrome/browser/browseros/metrics/browseros_metrics_service.h
 new file mode 100644
-index 0000000000000..beadbcfd183e0
+index 0000000000000..bd5bb7eb52c49
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.h
-@@ -0,0 +1,96 @@
+@@ -0,0 +1,87 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,15 +12,13 @@ index 0000000000000..beadbcfd183e0
 +#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_SERVICE_H_
 +
 +#include <memory>
-+#include <optional>
 +#include <string>
 +
-+#include "base/functional/callback.h"
-+#include "base/memory/weak_ptr.h"
++#include "base/files/file_path.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/values.h"
 +#include "components/keyed_service/core/keyed_service.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
-+#include "url/gurl.h"
 +
 +class PrefService;
 +
@@ -30,15 +28,19 @@ index 0000000000000..beadbcfd183e0
 +
 +namespace browseros_metrics {
 +
++class BrowserOSMetricsEventQueue;
++
 +// Service for capturing and sending analytics events to PostHog.
 +// This service manages a stable client ID (per-profile) and install ID
-+// (per-installation) and sends events to the PostHog API.
++// (per-installation) and sends events to the PostHog API in batches. Events
++// that cannot be sent are spooled to |spool_dir| and retried.
 +class BrowserOSMetricsService : public KeyedService {
 + public:
 +  explicit BrowserOSMetricsService(
 +      PrefService* pref_service,
 +      PrefService* local_state_prefs,
-+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
++      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++      const base::FilePath& spool_dir);
 +
 +  BrowserOSMetricsService(const BrowserOSMetricsService&) = delete;
 +  BrowserOSMetricsService& operator=(const BrowserOSMetricsService&) = delete;
@@ -67,14 +69,6 @@ index 0000000000000..beadbcfd183e0
 +  // Initializes or retrieves the stable install ID from local state.
 +  void InitializeInstallId();
 +
-+  // Sends the event to PostHog API.
-+  void SendEventToPostHog(const std::string& event_name,
-+                          base::Value::Dict properties);
-+
-+  // Handles the response from PostHog API.
-+  void OnPostHogResponse(std::unique_ptr<network::SimpleURLLoader> loader,
-+                         std::optional<std::string> response_body);
-+
 +  // Adds default properties to the event.
 +  void AddDefaultProperties(base::Value::Dict& properties);
 +
@@ -84,17 +78,14 @@ index 0000000000000..beadbcfd183e0
 +  // PrefService for storing the stable install ID (local state).
 +  raw_ptr<PrefService> local_state_prefs_;
 +
-+  // Factory for creating URL loaders.
-+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
-+
 +  // Stable client ID for this profile.
 +  std::string client_id_;
 +
 +  // Stable install ID for this browser installation.
 +  std::string install_id_;
 +
-+  // Weak pointer factory for callbacks.
-+  base::WeakPtrFactory<BrowserOSMetricsService> weak_factory_{this};
++  // Batches, spools and uploads captured events.
++  std::unique_ptr<BrowserOSMetricsEventQueue> event_queue_;
 +};
 +
 +}  // namespace browseros_metrics
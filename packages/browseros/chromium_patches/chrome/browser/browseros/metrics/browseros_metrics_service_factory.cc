@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service_factory.cc b/chrome/browser/browseros/metrics/browseros_metrics_service_factory.cc
 new file mode 100644
-index 0000000000000..794961e6e39aa
+index 0000000000000..ff848bbb9c4e0
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service_factory.cc
-@@ -0,0 +1,58 @@
+@@ -0,0 +1,59 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -58,7 +58,8 @@ index 0000000000000..794961e6e39aa
 +      profile->GetPrefs(),
 +      g_browser_process->local_state(),
 +      profile->GetDefaultStoragePartition()
-+          ->GetURLLoaderFactoryForBrowserProcess());
++          ->GetURLLoaderFactoryForBrowserProcess(),
++      profile->GetPath().Append(FILE_PATH_LITERAL("BrowserOSMetrics")));
 +}
 +
 +}  // namespace browseros_metrics
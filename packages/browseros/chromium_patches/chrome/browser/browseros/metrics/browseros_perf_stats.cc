@@ -0,0 +1,119 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_perf_stats.cc b/chrome/browser/browseros/metrics/browseros_perf_stats.cc
+new file mode 100644
+index 0000000000000..fb0ac4dc33b86
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_perf_stats.cc
+@@ -0,0 +1,113 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_perf_stats.h"
++
++#include <algorithm>
++
++#include "base/metrics/histogram_functions.h"
++#include "base/no_destructor.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_util.h"
++
++namespace browseros_metrics {
++
++namespace {
++
++constexpr char kExtensionFunctionPrefix[] = "browserOS.";
++
++std::string GetHistogramName(BrowserOSPerfStats::Surface surface,
++                             std::string_view name) {
++  switch (surface) {
++    case BrowserOSPerfStats::Surface::kExtensionFunction:
++      if (base::StartsWith(name, kExtensionFunctionPrefix)) {
++        name.remove_prefix(sizeof(kExtensionFunctionPrefix) - 1);
++      }
++      return base::StrCat({"BrowserOS.Perf.ExtensionFunction.", name});
++    case BrowserOSPerfStats::Surface::kCDP:
++      return base::StrCat({"BrowserOS.Perf.CDP.", name});
++  }
++}
++
++// Nearest-rank percentile of the sorted |latencies|.
++base::TimeDelta Percentile(const std::vector<base::TimeDelta>& latencies,
++                           int percentile) {
++  size_t rank = (latencies.size() * percentile + 99) / 100;
++  return latencies[std::max<size_t>(rank, 1) - 1];
++}
++
++}  // namespace
++
++BrowserOSPerfStats::Samples::Samples() = default;
++BrowserOSPerfStats::Samples::Samples(const Samples&) = default;
++BrowserOSPerfStats::Samples& BrowserOSPerfStats::Samples::operator=(
++    const Samples&) = default;
++BrowserOSPerfStats::Samples::~Samples() = default;
++
++// static
++BrowserOSPerfStats* BrowserOSPerfStats::GetInstance() {
++  static base::NoDestructor<BrowserOSPerfStats> instance;
++  return instance.get();
++}
++
++BrowserOSPerfStats::BrowserOSPerfStats() {
++  DETACH_FROM_SEQUENCE(sequence_checker_);
++}
++
++BrowserOSPerfStats::~BrowserOSPerfStats() = default;
++
++void BrowserOSPerfStats::Record(Surface surface,
++                                std::string_view name,
++                                base::TimeDelta latency) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  base::UmaHistogramMediumTimes(GetHistogramName(surface, name), latency);
++
++  auto it = calls_.find(name);
++  if (it == calls_.end()) {
++    if (calls_.size() >= kMaxCalls) {
++      return;
++    }
++    it = calls_.emplace(std::string(name), Samples()).first;
++  }
++  Samples& samples = it->second;
++  samples.count++;
++  if (samples.latencies.size() < kMaxSamples) {
++    samples.latencies.push_back(latency);
++    return;
++  }
++  samples.latencies[samples.next] = latency;
++  samples.next = (samples.next + 1) % kMaxSamples;
++}
++
++std::vector<BrowserOSPerfStats::CallStats> BrowserOSPerfStats::GetCallStats()
++    const {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  std::vector<CallStats> result;
++  result.reserve(calls_.size());
++  for (const auto& [name, samples] : calls_) {
++    std::vector<base::TimeDelta> sorted = samples.latencies;
++    std::ranges::sort(sorted);
++
++    CallStats stats;
++    stats.name = name;
++    stats.count = samples.count;
++    stats.p50 = Percentile(sorted, 50);
++    stats.p95 = Percentile(sorted, 95);
++    stats.p99 = Percentile(sorted, 99);
++    stats.max = sorted.back();
++    result.push_back(std::move(stats));
++  }
++  return result;
++}
++
++ScopedPerfTimer::ScopedPerfTimer(BrowserOSPerfStats::Surface surface,
++                                 std::string_view name)
++    : surface_(surface), name_(name) {}
++
++ScopedPerfTimer::~ScopedPerfTimer() {
++  BrowserOSPerfStats::GetInstance()->Record(
++      surface_, name_, base::TimeTicks::Now() - start_);
++}
++
++}  // namespace browseros_metrics
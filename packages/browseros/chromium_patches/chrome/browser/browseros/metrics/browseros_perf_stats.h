@@ -0,0 +1,108 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_perf_stats.h b/chrome/browser/browseros/metrics/browseros_perf_stats.h
+new file mode 100644
+index 0000000000000..4fc4389be1795
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_perf_stats.h
+@@ -0,0 +1,102 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_PERF_STATS_H_
++#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_PERF_STATS_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <functional>
++#include <map>
++#include <string>
++#include <string_view>
++#include <vector>
++
++#include "base/sequence_checker.h"
++#include "base/time/time.h"
++
++namespace browseros_metrics {
++
++// Latency of browserOS.* extension functions and BrowserOS CDP commands.
++//
++// Every call is recorded in a UMA histogram, BrowserOS.Perf.ExtensionFunction
++// .<Function> or BrowserOS.Perf.CDP.<Domain>.<command>, and in a local
++// reservoir of its most recent kMaxSamples latencies. Percentiles are
++// computed from the reservoir, so they are available (via
++// browserOS.getPerfStats) whether or not metrics reporting is enabled.
++//
++// Threading: UI thread only.
++class BrowserOSPerfStats {
++ public:
++  enum class Surface {
++    kExtensionFunction,
++    kCDP,
++  };
++
++  struct CallStats {
++    // "browserOS.click", "Bookmarks.getBookmarks", ...
++    std::string name;
++    // Calls recorded since startup, including those no longer sampled.
++    uint64_t count = 0;
++    base::TimeDelta p50;
++    base::TimeDelta p95;
++    base::TimeDelta p99;
++    base::TimeDelta max;
++  };
++
++  static constexpr size_t kMaxSamples = 512;
++  // Calls beyond this many distinct names only go to UMA.
++  static constexpr size_t kMaxCalls = 256;
++
++  static BrowserOSPerfStats* GetInstance();
++
++  BrowserOSPerfStats();
++  ~BrowserOSPerfStats();
++
++  BrowserOSPerfStats(const BrowserOSPerfStats&) = delete;
++  BrowserOSPerfStats& operator=(const BrowserOSPerfStats&) = delete;
++
++  void Record(Surface surface, std::string_view name, base::TimeDelta latency);
++
++  // Stats for every call seen so far, sorted by name.
++  std::vector<CallStats> GetCallStats() const;
++
++ private:
++  struct Samples {
++    Samples();
++    Samples(const Samples&);
++    Samples& operator=(const Samples&);
++    ~Samples();
++
++    uint64_t count = 0;
++    // Ring buffer; |next| is the slot the next sample overwrites once full.
++    std::vector<base::TimeDelta> latencies;
++    size_t next = 0;
++  };
++
++  std::map<std::string, Samples, std::less<>> calls_;
++
++  SEQUENCE_CHECKER(sequence_checker_);
++};
++
++// Records the time from construction to destruction as one call of |name|,
++// which must outlive the timer (pass a literal). For handlers that respond
++// synchronously.
++class ScopedPerfTimer {
++ public:
++  ScopedPerfTimer(BrowserOSPerfStats::Surface surface, std::string_view name);
++  ~ScopedPerfTimer();
++
++  ScopedPerfTimer(const ScopedPerfTimer&) = delete;
++  ScopedPerfTimer& operator=(const ScopedPerfTimer&) = delete;
++
++ private:
++  const BrowserOSPerfStats::Surface surface_;
++  const std::string_view name_;
++  const base::TimeTicks start_ = base::TimeTicks::Now();
++};
++
++}  // namespace browseros_metrics
++
++#endif  // CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_PERF_STATS_H_
@@ -0,0 +1,66 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_perf_stats_unittest.cc b/chrome/browser/browseros/metrics/browseros_perf_stats_unittest.cc
+new file mode 100644
+index 0000000000000..54931a0d4125a
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_perf_stats_unittest.cc
+@@ -0,0 +1,60 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_perf_stats.h"
++
++#include <vector>
++
++#include "base/test/metrics/histogram_tester.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros_metrics {
++namespace {
++
++using Surface = BrowserOSPerfStats::Surface;
++
++TEST(BrowserOSPerfStatsTest, ComputesPercentiles) {
++  base::HistogramTester histograms;
++  BrowserOSPerfStats stats;
++  // Recorded out of order; 1..100 ms.
++  for (int i = 100; i >= 1; --i) {
++    stats.Record(Surface::kExtensionFunction, "browserOS.click",
++                 base::Milliseconds(i));
++  }
++  stats.Record(Surface::kCDP, "Bookmarks.getBookmarks", base::Milliseconds(7));
++
++  std::vector<BrowserOSPerfStats::CallStats> calls = stats.GetCallStats();
++  ASSERT_EQ(2u, calls.size());
++  EXPECT_EQ("Bookmarks.getBookmarks", calls[0].name);
++  EXPECT_EQ(base::Milliseconds(7), calls[0].p99);
++
++  EXPECT_EQ("browserOS.click", calls[1].name);
++  EXPECT_EQ(100u, calls[1].count);
++  EXPECT_EQ(base::Milliseconds(50), calls[1].p50);
++  EXPECT_EQ(base::Milliseconds(95), calls[1].p95);
++  EXPECT_EQ(base::Milliseconds(99), calls[1].p99);
++  EXPECT_EQ(base::Milliseconds(100), calls[1].max);
++
++  histograms.ExpectTotalCount("BrowserOS.Perf.ExtensionFunction.click", 100);
++  histograms.ExpectTotalCount("BrowserOS.Perf.CDP.Bookmarks.getBookmarks", 1);
++}
++
++TEST(BrowserOSPerfStatsTest, KeepsMostRecentSamples) {
++  BrowserOSPerfStats stats;
++  for (size_t i = 0; i < BrowserOSPerfStats::kMaxSamples; ++i) {
++    stats.Record(Surface::kCDP, "History.search", base::Seconds(10));
++  }
++  // Displaces every earlier sample.
++  for (size_t i = 0; i < BrowserOSPerfStats::kMaxSamples; ++i) {
++    stats.Record(Surface::kCDP, "History.search", base::Milliseconds(1));
++  }
++
++  std::vector<BrowserOSPerfStats::CallStats> calls = stats.GetCallStats();
++  ASSERT_EQ(1u, calls.size());
++  EXPECT_EQ(2 * BrowserOSPerfStats::kMaxSamples, calls[0].count);
++  EXPECT_EQ(base::Milliseconds(1), calls[0].max);
++}
++
++}  // namespace
++}  // namespace browseros_metrics
@@ -0,0 +1,621 @@
+diff --git a/chrome/browser/browseros/server/backend_connection_pool.cc b/chrome/browser/browseros/server/backend_connection_pool.cc
+new file mode 100644
+index 0000000000000..a1e9ea6c74600
+--- /dev/null
++++ b/chrome/browser/browseros/server/backend_connection_pool.cc
+@@ -0,0 +1,615 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/backend_connection_pool.h"
++
++#include <algorithm>
++#include <string_view>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/timer/timer.h"
++#include "build/build_config.h"
++#include "net/base/address_list.h"
++#include "net/base/io_buffer.h"
++#include "net/base/ip_address.h"
++#include "net/base/ip_endpoint.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_util.h"
++#include "net/log/net_log_source.h"
++#include "net/socket/stream_socket.h"
++#include "net/socket/tcp_client_socket.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include "net/socket/unix_domain_client_socket_posix.h"
++#endif
++
++namespace browseros {
++
++namespace {
++
++constexpr int kReadBufferSize = 16 * 1024;
++constexpr size_t kMaxHeaderSize = 64 * 1024;
++constexpr size_t kMaxResponseBodySize = 5 * 1024 * 1024;  // 5 MB
++constexpr base::TimeDelta kRequestTimeout = base::Seconds(300);
++
++net::NetworkTrafficAnnotationTag GetBackendTrafficAnnotation() {
++  return net::DefineNetworkTrafficAnnotation("browseros_mcp_proxy_backend",
++                                             R"(
++    semantics {
++      sender: "BrowserOS MCP Proxy"
++      description:
++        "Forwards MCP requests from the stable proxy port to the sidecar's "
++        "ephemeral backend port over a persistent local connection."
++      trigger: "External MCP client sends a request to the proxy port."
++      data: "MCP JSON-RPC request body."
++      destination: LOCAL
++    }
++    policy {
++      cookies_allowed: NO
++      setting: "This feature cannot be disabled by settings."
++      policy_exception_justification:
++        "Internal proxy for BrowserOS MCP server functionality."
++    })");
++}
++
++std::string SerializeRequest(int port,
++                             const BackendConnectionPool::Request& request) {
++  std::string out = base::StrCat({request.method, " ", request.path,
++                                  " HTTP/1.1\r\nHost: 127.0.0.1:",
++                                  base::NumberToString(port),
++                                  "\r\nConnection: keep-alive\r\n"});
++  for (const auto& [name, value] : request.headers) {
++    base::StrAppend(&out, {name, ": ", value, "\r\n"});
++  }
++  if (!request.body.empty() || request.method == "POST" ||
++      request.method == "PUT" || request.method == "PATCH") {
++    base::StrAppend(&out, {"Content-Length: ",
++                           base::NumberToString(request.body.size()), "\r\n"});
++  }
++  base::StrAppend(&out, {"\r\n", request.body});
++  return out;
++}
++
++// Errors from a reused connection that the server closed while idle.
++bool IsStaleConnectionError(int error) {
++  return error == net::ERR_CONNECTION_RESET ||
++         error == net::ERR_CONNECTION_CLOSED ||
++         error == net::ERR_CONNECTION_ABORTED ||
++         error == net::ERR_SOCKET_NOT_CONNECTED ||
++         error == net::ERR_EMPTY_RESPONSE;
++}
++
++// Methods that can be sent twice without a second side effect (RFC 9110
++// 9.2.2). MCP calls are POSTs and are not among them.
++bool IsIdempotentMethod(std::string_view method) {
++  return method == "GET" || method == "HEAD" || method == "OPTIONS" ||
++         method == "PUT" || method == "DELETE";
++}
++
++}  // namespace
++
++struct BackendConnectionPool::Result {
++  int net_error = net::OK;
++  bool reusable = false;
++  bool may_retry = false;
++  // The Unix socket couldn't be connected; TCP may still work.
++  bool unix_connect_failed = false;
++  std::optional<Response> response;
++};
++
++// One keep-alive connection. Parses Content-Length, chunked and
++// read-until-close bodies.
++class BackendConnectionPool::Connection {
++ public:
++  using DoneCallback = base::OnceCallback<void(Result)>;
++
++  Connection(int port, base::FilePath unix_socket)
++      : port_(port), unix_socket_(std::move(unix_socket)) {}
++
++  Connection(const Connection&) = delete;
++  Connection& operator=(const Connection&) = delete;
++
++  ~Connection() = default;
++
++  int port() const { return port_; }
++
++  bool IsConnectedAndIdle() const {
++    return socket_ && socket_->IsConnectedAndIdle();
++  }
++
++  void Send(const std::string& serialized_request,
++            std::string_view method,
++            DoneCallback done) {
++    reused_ = socket_ != nullptr;
++    request_written_ = false;
++    is_head_ = method == "HEAD";
++    is_idempotent_ = IsIdempotentMethod(method);
++    done_ = std::move(done);
++    bytes_received_ = 0;
++    header_buffer_.clear();
++    headers_.reset();
++    body_.clear();
++    content_length_ = -1;
++    read_until_close_ = false;
++    chunked_ = false;
++    chunk_buffer_.clear();
++    chunk_state_ = ChunkState::kSize;
++    chunk_remaining_ = 0;
++
++    write_buffer_ = base::MakeRefCounted<net::DrainableIOBuffer>(
++        base::MakeRefCounted<net::StringIOBuffer>(serialized_request),
++        serialized_request.size());
++    timeout_timer_.Start(
++        FROM_HERE, kRequestTimeout,
++        base::BindOnce(&Connection::Fail, base::Unretained(this),
++                       net::ERR_TIMED_OUT));
++
++    if (socket_) {
++      DoWrite();
++      return;
++    }
++
++#if BUILDFLAG(IS_POSIX)
++    if (!unix_socket_.empty()) {
++      socket_ = std::make_unique<net::UnixDomainClientSocket>(
++          unix_socket_.value(), /*use_abstract_namespace=*/false);
++    }
++#endif
++    if (!socket_) {
++      socket_ = std::make_unique<net::TCPClientSocket>(
++          net::AddressList(
++              net::IPEndPoint(net::IPAddress::IPv4Localhost(), port_)),
++          nullptr, nullptr, nullptr, net::NetLogSource());
++    }
++    int rv = socket_->Connect(
++        base::BindOnce(&Connection::OnConnected, base::Unretained(this)));
++    if (rv != net::ERR_IO_PENDING) {
++      OnConnected(rv);
++    }
++  }
++
++ private:
++  enum class ChunkState { kSize, kData, kDataEnd, kTrailer, kDone };
++
++  void OnConnected(int rv) {
++    if (rv != net::OK) {
++      Fail(rv);
++      return;
++    }
++    connected_ = true;
++    DoWrite();
++  }
++
++  void DoWrite() {
++    while (write_buffer_->BytesRemaining() > 0) {
++      int rv = socket_->Write(
++          write_buffer_.get(), write_buffer_->BytesRemaining(),
++          base::BindOnce(&Connection::OnWriteComplete, base::Unretained(this)),
++          GetBackendTrafficAnnotation());
++      if (rv == net::ERR_IO_PENDING) {
++        return;
++      }
++      if (rv < 0) {
++        Fail(rv);
++        return;
++      }
++      write_buffer_->DidConsume(rv);
++    }
++    request_written_ = true;
++    read_buffer_ = base::MakeRefCounted<net::IOBufferWithSize>(kReadBufferSize);
++    DoRead();
++  }
++
++  void OnWriteComplete(int rv) {
++    if (rv < 0) {
++      Fail(rv);
++      return;
++    }
++    write_buffer_->DidConsume(rv);
++    DoWrite();
++  }
++
++  void DoRead() {
++    while (true) {
++      int rv = socket_->Read(
++          read_buffer_.get(), kReadBufferSize,
++          base::BindOnce(&Connection::OnReadComplete, base::Unretained(this)));
++      if (rv == net::ERR_IO_PENDING || !HandleRead(rv)) {
++        return;
++      }
++    }
++  }
++
++  void OnReadComplete(int rv) {
++    if (HandleRead(rv)) {
++      DoRead();
++    }
++  }
++
++  // Returns true if more data is needed. Must not touch |this| after
++  // finishing, since the pool may reuse or delete the connection.
++  bool HandleRead(int rv) {
++    if (rv < 0) {
++      Fail(rv);
++      return false;
++    }
++    if (rv == 0) {
++      if (headers_ && read_until_close_) {
++        Complete(/*reusable=*/false);
++      } else {
++        Fail(headers_ ? net::ERR_CONNECTION_CLOSED : net::ERR_EMPTY_RESPONSE);
++      }
++      return false;
++    }
++
++    bytes_received_ += rv;
++    const char* data = read_buffer_->data();
++    size_t size = static_cast<size_t>(rv);
++
++    if (!headers_) {
++      header_buffer_.append(data, size);
++      size_t end = header_buffer_.find("\r\n\r\n");
++      if (end == std::string::npos) {
++        if (header_buffer_.size() > kMaxHeaderSize) {
++          Fail(net::ERR_RESPONSE_HEADERS_TOO_BIG);
++          return false;
++        }
++        return true;
++      }
++      end += 4;
++      headers_ = base::MakeRefCounted<net::HttpResponseHeaders>(
++          net::HttpUtil::AssembleRawHeaders(
++              std::string_view(header_buffer_).substr(0, end)));
++      std::string rest = header_buffer_.substr(end);
++      header_buffer_.clear();
++      if (!StartBody()) {
++        return false;
++      }
++      return rest.empty() ? !IsBodyComplete() : AppendBody(rest);
++    }
++
++    return AppendBody(std::string_view(data, size));
++  }
++
++  // Decides body framing once headers are parsed. Returns false if done.
++  bool StartBody() {
++    int status = headers_->response_code();
++    if (status <= 0) {
++      Fail(net::ERR_INVALID_HTTP_RESPONSE);
++      return false;
++    }
++    if (is_head_ || status == 204 || status == 304 ||
++        (status >= 100 && status < 200)) {
++      content_length_ = 0;
++    } else if (headers_->IsChunkEncoded()) {
++      chunked_ = true;
++    } else {
++      content_length_ = headers_->GetContentLength();
++      read_until_close_ = content_length_ < 0;
++    }
++    if (content_length_ > static_cast<int64_t>(kMaxResponseBodySize)) {
++      Fail(net::ERR_FILE_TOO_BIG);
++      return false;
++    }
++    if (IsBodyComplete()) {
++      Complete(headers_->IsKeepAlive());
++      return false;
++    }
++    return true;
++  }
++
++  bool IsBodyComplete() const {
++    if (chunked_) {
++      return chunk_state_ == ChunkState::kDone;
++    }
++    return !read_until_close_ &&
++           static_cast<int64_t>(body_.size()) >= content_length_;
++  }
++
++  // Returns true if more data is needed.
++  bool AppendBody(std::string_view data) {
++    if (chunked_) {
++      if (!DecodeChunks(data)) {
++        Fail(net::ERR_INVALID_CHUNKED_ENCODING);
++        return false;
++      }
++    } else {
++      body_.append(data);
++    }
++
++    if (body_.size() > kMaxResponseBodySize) {
++      Fail(net::ERR_FILE_TOO_BIG);
++      return false;
++    }
++    if (!IsBodyComplete()) {
++      return true;
++    }
++    // Extra bytes mean the stream is out of sync; don't reuse it.
++    bool in_sync = chunked_ ? chunk_buffer_.empty()
++                            : static_cast<int64_t>(body_.size()) ==
++                                  content_length_;
++    if (!chunked_) {
++      body_.resize(static_cast<size_t>(content_length_));
++    }
++    Complete(in_sync && headers_->IsKeepAlive());
++    return false;
++  }
++
++  // Returns false on malformed chunked encoding.
++  bool DecodeChunks(std::string_view data) {
++    chunk_buffer_.append(data);
++    size_t offset = 0;
++    while (chunk_state_ != ChunkState::kDone) {
++      std::string_view pending =
++          std::string_view(chunk_buffer_).substr(offset);
++      if (chunk_state_ == ChunkState::kData) {
++        size_t take = std::min<uint64_t>(chunk_remaining_, pending.size());
++        body_.append(pending.substr(0, take));
++        offset += take;
++        chunk_remaining_ -= take;
++        if (chunk_remaining_ > 0) {
++          break;
++        }
++        chunk_state_ = ChunkState::kDataEnd;
++        continue;
++      }
++
++      size_t line_end = pending.find("\r\n");
++      if (line_end == std::string_view::npos) {
++        if (pending.size() > kMaxHeaderSize) {
++          return false;
++        }
++        break;
++      }
++      std::string_view line = pending.substr(0, line_end);
++      offset += line_end + 2;
++
++      if (chunk_state_ == ChunkState::kDataEnd) {
++        if (!line.empty()) {
++          return false;
++        }
++        chunk_state_ = ChunkState::kSize;
++      } else if (chunk_state_ == ChunkState::kSize) {
++        std::string_view size_field = line.substr(0, line.find(';'));
++        uint64_t chunk_size = 0;
++        if (!base::HexStringToUInt64(
++                base::TrimWhitespaceASCII(size_field, base::TRIM_ALL),
++                &chunk_size) ||
++            chunk_size > kMaxResponseBodySize) {
++          return false;
++        }
++        chunk_remaining_ = chunk_size;
++        chunk_state_ =
++            chunk_size == 0 ? ChunkState::kTrailer : ChunkState::kData;
++      } else if (chunk_state_ == ChunkState::kTrailer && line.empty()) {
++        chunk_state_ = ChunkState::kDone;
++      }
++    }
++    chunk_buffer_.erase(0, offset);
++    return true;
++  }
++
++  void Complete(bool reusable) {
++    timeout_timer_.Stop();
++
++    Result result;
++    result.reusable = reusable;
++    result.response.emplace();
++    result.response->status_code = headers_->response_code();
++    result.response->content_type =
++        headers_->GetNormalizedHeader("content-type").value_or(std::string());
++    result.response->session_id =
++        headers_->GetNormalizedHeader("mcp-session-id")
++            .value_or(std::string());
++    result.response->body = std::move(body_);
++    if (!reusable) {
++      socket_.reset();
++    }
++    std::move(done_).Run(std::move(result));
++  }
++
++  void Fail(int error) {
++    timeout_timer_.Stop();
++    socket_.reset();
++
++    // Once the whole request is written the server may have acted on it
++    // before closing, so only idempotent requests are resent then.
++    Result result;
++    result.net_error = error;
++    result.may_retry = reused_ && bytes_received_ == 0 &&
++                       IsStaleConnectionError(error) &&
++                       (!request_written_ || is_idempotent_);
++    result.unix_connect_failed = !unix_socket_.empty() && !connected_;
++    std::move(done_).Run(std::move(result));
++  }
++
++  const int port_;
++  const base::FilePath unix_socket_;
++  std::unique_ptr<net::StreamSocket> socket_;
++  scoped_refptr<net::DrainableIOBuffer> write_buffer_;
++  scoped_refptr<net::IOBufferWithSize> read_buffer_;
++  base::OneShotTimer timeout_timer_;
++  DoneCallback done_;
++
++  bool connected_ = false;
++  bool reused_ = false;
++  bool request_written_ = false;
++  bool is_head_ = false;
++  bool is_idempotent_ = false;
++  size_t bytes_received_ = 0;
++
++  std::string header_buffer_;
++  scoped_refptr<net::HttpResponseHeaders> headers_;
++  std::string body_;
++  int64_t content_length_ = -1;
++  bool read_until_close_ = false;
++
++  bool chunked_ = false;
++  std::string chunk_buffer_;
++  ChunkState chunk_state_ = ChunkState::kSize;
++  uint64_t chunk_remaining_ = 0;
++};
++
++BackendConnectionPool::Request::Request() = default;
++BackendConnectionPool::Request::Request(Request&&) = default;
++BackendConnectionPool::Request& BackendConnectionPool::Request::operator=(
++    Request&&) = default;
++BackendConnectionPool::Request::~Request() = default;
++
++BackendConnectionPool::Response::Response() = default;
++BackendConnectionPool::Response::Response(Response&&) = default;
++BackendConnectionPool::Response& BackendConnectionPool::Response::operator=(
++    Response&&) = default;
++BackendConnectionPool::Response::~Response() = default;
++
++BackendConnectionPool::BackendConnectionPool(size_t max_idle_connections)
++    : max_idle_connections_(max_idle_connections) {}
++
++BackendConnectionPool::~BackendConnectionPool() = default;
++
++void BackendConnectionPool::Send(int port,
++                                 Request request,
++                                 ResponseCallback callback) {
++  std::unique_ptr<Connection> connection = TakeIdleConnection(port);
++  if (!connection) {
++    connection = CreateConnection(port);
++  }
++  SendOnConnection(std::move(connection), SerializeRequest(port, request),
++                   std::move(request.method), std::move(callback));
++}
++
++void BackendConnectionPool::SetUnixSocket(int port,
++                                          const base::FilePath& path) {
++  unix_sockets_[port] = path;
++}
++
++void BackendConnectionPool::SetPreferredPort(int port) {
++  preferred_port_ = port;
++  std::erase_if(unix_sockets_,
++                [port](const auto& entry) { return entry.first != port; });
++  for (auto it = idle_.begin(); it != idle_.end();) {
++    it = it->first == port ? std::next(it) : idle_.erase(it);
++  }
++}
++
++size_t BackendConnectionPool::idle_connection_count() const {
++  size_t count = 0;
++  for (const auto& [port, connections] : idle_) {
++    count += connections.size();
++  }
++  return count;
++}
++
++void BackendConnectionPool::SendOnConnection(
++    std::unique_ptr<Connection> connection,
++    std::string serialized_request,
++    std::string method,
++    ResponseCallback callback) {
++  Connection* raw = connection.get();
++  active_[raw] = std::move(connection);
++  // Copies: the bound strings are kept for a possible resend.
++  std::string request_copy = serialized_request;
++  std::string method_copy = method;
++  raw->Send(request_copy, method_copy,
++            base::BindOnce(&BackendConnectionPool::OnConnectionDone,
++                           weak_factory_.GetWeakPtr(), raw,
++                           std::move(serialized_request), std::move(method),
++                           std::move(callback)));
++}
++
++void BackendConnectionPool::OnConnectionDone(Connection* connection,
++                                             std::string serialized_request,
++                                             std::string method,
++                                             ResponseCallback callback,
++                                             Result result) {
++  auto it = active_.find(connection);
++  CHECK(it != active_.end());
++  std::unique_ptr<Connection> owned = std::move(it->second);
++  active_.erase(it);
++
++  if (result.response) {
++    if (result.reusable) {
++      ReleaseConnection(std::move(owned));
++    } else {
++      base::SequencedTaskRunner::GetCurrentDefault()->DeleteSoon(
++          FROM_HERE, std::move(owned));
++    }
++    std::move(callback).Run(std::move(result.response));
++    return;
++  }
++
++  // Runs inside the connection's own callback; delete it later.
++  int port = owned->port();
++  base::SequencedTaskRunner::GetCurrentDefault()->DeleteSoon(FROM_HERE,
++                                                             std::move(owned));
++
++  if (result.unix_connect_failed) {
++    LOG(WARNING) << "browseros: Backend Unix socket for port " << port
++                 << " unavailable, using TCP";
++    unix_sockets_.erase(port);
++  }
++
++  if (result.may_retry || result.unix_connect_failed) {
++    VLOG(1) << "browseros: Resending backend request on a new connection";
++    SendOnConnection(CreateConnection(port),
++                     std::move(serialized_request), std::move(method),
++                     std::move(callback));
++    return;
++  }
++
++  LOG(WARNING) << "browseros: Backend request to port " << port
++               << " failed: " << net::ErrorToString(result.net_error);
++  std::move(callback).Run(std::nullopt);
++}
++
++std::unique_ptr<BackendConnectionPool::Connection>
++BackendConnectionPool::CreateConnection(int port) {
++  connections_opened_++;
++  auto it = unix_sockets_.find(port);
++  return std::make_unique<Connection>(
++      port, it != unix_sockets_.end() ? it->second : base::FilePath());
++}
++
++std::unique_ptr<BackendConnectionPool::Connection>
++BackendConnectionPool::TakeIdleConnection(int port) {
++  auto it = idle_.find(port);
++  if (it == idle_.end()) {
++    return nullptr;
++  }
++
++  std::unique_ptr<Connection> connection;
++  while (!it->second.empty() && !connection) {
++    std::unique_ptr<Connection> candidate = std::move(it->second.back());
++    it->second.pop_back();
++    if (candidate->IsConnectedAndIdle()) {
++      connection = std::move(candidate);
++    }
++  }
++  if (it->second.empty()) {
++    idle_.erase(it);
++  }
++  return connection;
++}
++
++void BackendConnectionPool::ReleaseConnection(
++    std::unique_ptr<Connection> connection) {
++  int port = connection->port();
++  if (port != preferred_port_ ||
++      (idle_.contains(port) && idle_[port].size() >= max_idle_connections_)) {
++    base::SequencedTaskRunner::GetCurrentDefault()->DeleteSoon(
++        FROM_HERE, std::move(connection));
++    return;
++  }
++  idle_[port].push_back(std::move(connection));
++}
++
++}  // namespace browseros
@@ -0,0 +1,122 @@
+diff --git a/chrome/browser/browseros/server/backend_connection_pool.h b/chrome/browser/browseros/server/backend_connection_pool.h
+new file mode 100644
+index 0000000000000..490a48d90224c
+--- /dev/null
++++ b/chrome/browser/browseros/server/backend_connection_pool.h
+@@ -0,0 +1,116 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BACKEND_CONNECTION_POOL_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BACKEND_CONNECTION_POOL_H_
++
++#include <stddef.h>
++
++#include <memory>
++#include <optional>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/containers/flat_map.h"
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++
++namespace browseros {
++
++// Minimal HTTP/1.1 client for the sidecar on 127.0.0.1 (or a Unix socket)
++// that keeps
++// connections alive between requests. Used by the MCP proxy instead of a
++// SimpleURLLoader per request, which routed every call through the network
++// service. Each connection carries one request at a time.
++//
++// Threading: IO thread only.
++class BackendConnectionPool {
++ public:
++  struct Request {
++    Request();
++    Request(Request&&);
++    Request& operator=(Request&&);
++    ~Request();
++
++    std::string method;
++    std::string path;
++    // Sent as-is; Host, Connection and Content-Length are added by the pool.
++    std::vector<std::pair<std::string, std::string>> headers;
++    std::string body;
++  };
++
++  struct Response {
++    Response();
++    Response(Response&&);
++    Response& operator=(Response&&);
++    ~Response();
++
++    int status_code = 0;
++    std::string content_type;
++    // Mcp-Session-Id the backend issued with this response, if any.
++    std::string session_id;
++    std::string body;
++  };
++
++  // |response| is nullopt if the backend could not be reached, timed out or
++  // sent a malformed or oversized response.
++  using ResponseCallback =
++      base::OnceCallback<void(std::optional<Response> response)>;
++
++  explicit BackendConnectionPool(size_t max_idle_connections);
++  ~BackendConnectionPool();
++
++  BackendConnectionPool(const BackendConnectionPool&) = delete;
++  BackendConnectionPool& operator=(const BackendConnectionPool&) = delete;
++
++  // Sends |request| to 127.0.0.1:|port|, reusing an idle connection to that
++  // port when one is available.
++  void Send(int port, Request request, ResponseCallback callback);
++
++  // Connects to |port| through the Unix socket at |path| instead of TCP.
++  // Falls back to TCP for good if the socket can't be connected, e.g. when
++  // the sidecar doesn't support Unix sockets.
++  void SetUnixSocket(int port, const base::FilePath& path);
++
++  // Keeps idle connections for |port| only; connections to other ports are
++  // closed now or as soon as their request completes.
++  void SetPreferredPort(int port);
++
++  size_t idle_connection_count() const;
++  size_t connections_opened() const { return connections_opened_; }
++
++ private:
++  class Connection;
++  struct Result;
++
++  void SendOnConnection(std::unique_ptr<Connection> connection,
++                        std::string serialized_request,
++                        std::string method,
++                        ResponseCallback callback);
++  void OnConnectionDone(Connection* connection,
++                        std::string serialized_request,
++                        std::string method,
++                        ResponseCallback callback,
++                        Result result);
++  std::unique_ptr<Connection> CreateConnection(int port);
++  std::unique_ptr<Connection> TakeIdleConnection(int port);
++  void ReleaseConnection(std::unique_ptr<Connection> connection);
++
++  const size_t max_idle_connections_;
++  int preferred_port_ = 0;
++  size_t connections_opened_ = 0;
++  base::flat_map<int, base::FilePath> unix_sockets_;
++
++  // Idle connections per port, most recently used last.
++  base::flat_map<int, std::vector<std::unique_ptr<Connection>>> idle_;
++  base::flat_map<Connection*, std::unique_ptr<Connection>> active_;
++
++  base::WeakPtrFactory<BackendConnectionPool> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BACKEND_CONNECTION_POOL_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.cc b/chrome/browser/browseros/server/browseros_appcast_parser.cc
 new file mode 100644
-index 0000000000000..dd30f75d414ec
+index 0000000000000..7798dfb288f05
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.cc
-@@ -0,0 +1,202 @@
+@@ -0,0 +1,240 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -100,11 +100,21 @@ index 0000000000000..dd30f75d414ec
 +    enclosure.signature = it->second;
 +  }
 +
++  it = attrs.find("browseros:edDigestSignature");
++  if (it != attrs.end()) {
++    enclosure.digest_signature = it->second;
++  }
++
 +  it = attrs.find("length");
 +  if (it != attrs.end()) {
 +    base::StringToInt64(it->second, &enclosure.length);
 +  }
 +
++  it = attrs.find("sparkle:deltaFrom");
++  if (it != attrs.end()) {
++    enclosure.delta_from = base::Version(it->second);
++  }
++
 +  return enclosure;
 +}
 +
@@ -123,6 +133,19 @@ index 0000000000000..dd30f75d414ec
 +  return nullptr;
 +}
 +
++const AppcastEnclosure* AppcastItem::GetDeltaForCurrentPlatform(
++    const base::Version& installed) const {
++  if (!installed.IsValid()) {
++    return nullptr;
++  }
++  for (const auto& delta : deltas) {
++    if (delta.MatchesCurrentPlatform() && delta.delta_from == installed) {
++      return &delta;
++    }
++  }
++  return nullptr;
++}
++
 +// static
 +std::optional<AppcastItem> BrowserOSAppcastParser::ParseLatestItem(
 +    const std::string& xml) {
@@ -147,6 +170,7 @@ index 0000000000000..dd30f75d414ec
 +  // State machine for parsing
 +  bool in_channel = false;
 +  bool in_item = false;
++  bool in_deltas = false;
 +  AppcastItem current_item;
 +  int item_depth = 0;
 +
@@ -173,11 +197,22 @@ index 0000000000000..dd30f75d414ec
 +          if (reader.ReadElementContent(&date_str)) {
 +            current_item.pub_date = ParseRFC2822Date(date_str);
 +          }
++        } else if (node_name == "sparkle:deltas") {
++          in_deltas = !reader.IsEmptyElement();
 +        } else if (node_name == "enclosure") {
 +          std::map<std::string, std::string> attrs;
 +          if (reader.GetAllNodeAttributes(&attrs)) {
 +            AppcastEnclosure enclosure = ParseEnclosureFromAttributes(attrs);
-+            if (!enclosure.url.empty()) {
++            if (enclosure.url.empty()) {
++              continue;
++            }
++            if (in_deltas) {
++              // A delta without a base version cannot be applied.
++              if (enclosure.is_delta()) {
++                current_item.deltas.push_back(std::move(enclosure));
++              }
++            } else {
++              enclosure.delta_from = base::Version();
 +              current_item.enclosures.push_back(std::move(enclosure));
 +            }
 +          }
@@ -187,8 +222,11 @@ index 0000000000000..dd30f75d414ec
 +      // Closing tag
 +      if (node_name == "channel") {
 +        in_channel = false;
++      } else if (node_name == "sparkle:deltas") {
++        in_deltas = false;
 +      } else if (node_name == "item" && in_item && depth == item_depth) {
 +        in_item = false;
++        in_deltas = false;
 +        if (current_item.version.IsValid() &&
 +            !current_item.enclosures.empty()) {
 +          items.push_back(std::move(current_item));
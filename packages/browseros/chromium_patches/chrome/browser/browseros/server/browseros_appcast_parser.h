@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.h b/chrome/browser/browseros/server/browseros_appcast_parser.h
 new file mode 100644
-index 0000000000000..bd996e8cb06d2
+index 0000000000000..e301a81b27789
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.h
-@@ -0,0 +1,88 @@
+@@ -0,0 +1,113 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -34,7 +34,15 @@ index 0000000000000..bd996e8cb06d2
 +  std::string os;         // "macos", "linux", "windows"
 +  std::string arch;       // "arm64", "x86_64"
 +  std::string signature;  // Ed25519 signature (base64)
++  // Ed25519 signature over the SHA-256 digest of the package (base64). Lets
++  // the package be verified in one streaming pass; preferred when present.
++  std::string digest_signature;
 +  int64_t length = 0;
++  // For delta packages only: the installed version the binary diff applies
++  // to. Invalid for full packages.
++  base::Version delta_from;
++
++  bool is_delta() const { return delta_from.IsValid(); }
 +
 +  // Returns true if this enclosure matches the current platform and arch.
 +  bool MatchesCurrentPlatform() const;
@@ -52,9 +60,16 @@ index 0000000000000..bd996e8cb06d2
 +  base::Version version;
 +  base::Time pub_date;
 +  std::vector<AppcastEnclosure> enclosures;
++  // Zucchini patches that turn an older version's package into this one's.
++  std::vector<AppcastEnclosure> deltas;
 +
 +  // Returns the enclosure matching the current platform, or nullptr if none.
 +  const AppcastEnclosure* GetEnclosureForCurrentPlatform() const;
++
++  // Returns the delta from |installed| for the current platform, or nullptr
++  // if the appcast has none.
++  const AppcastEnclosure* GetDeltaForCurrentPlatform(
++      const base::Version& installed) const;
 +};
 +
 +// Parses Sparkle-style appcast XML to extract version and download information.
@@ -70,8 +85,18 @@ index 0000000000000..bd996e8cb06d2
 +//         sparkle:os="macos"
 +//         sparkle:arch="arm64"
 +//         sparkle:edSignature="base64..."
++//         browseros:edDigestSignature="base64..."
 +//         length="12345678"
 +//         type="application/zip"/>
++//       <sparkle:deltas>
++//         <enclosure
++//           url="https://..."
++//           sparkle:deltaFrom="0.29.0"
++//           sparkle:os="macos"
++//           sparkle:arch="arm64"
++//           length="123456"
++//           type="application/octet-stream"/>
++//       </sparkle:deltas>
 +//     </item>
 +//   </channel>
 +// </rss>
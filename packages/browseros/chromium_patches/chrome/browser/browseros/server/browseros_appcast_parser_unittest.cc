@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc b/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc
 new file mode 100644
-index 0000000000000..ceb483dee35c6
+index 0000000000000..1ac9f37a52d71
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc
-@@ -0,0 +1,389 @@
+@@ -0,0 +1,478 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -323,6 +323,32 @@ index 0000000000000..ceb483dee35c6
 +  EXPECT_EQ(nullptr, match);
 +}
 +
++TEST(AppcastItemTest, GetDeltaForCurrentPlatform_MatchesInstalledVersion) {
++  AppcastItem item;
++  item.version = base::Version("1.0.0");
++
++  for (const char* os : {"macos", "linux", "windows"}) {
++    for (const char* arch : {"arm64", "x86_64"}) {
++      AppcastEnclosure delta;
++      delta.os = os;
++      delta.arch = arch;
++      delta.url = std::string("https://example.com/") + os + "-" + arch;
++      delta.delta_from = base::Version("0.9.0");
++      item.deltas.push_back(delta);
++    }
++  }
++
++  EXPECT_EQ(nullptr, item.GetDeltaForCurrentPlatform(base::Version("0.8.0")));
++  EXPECT_EQ(nullptr, item.GetDeltaForCurrentPlatform(base::Version()));
++
++#if BUILDFLAG(IS_MAC) || BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_WIN)
++  const AppcastEnclosure* match =
++      item.GetDeltaForCurrentPlatform(base::Version("0.9.0"));
++  ASSERT_NE(nullptr, match);
++  EXPECT_TRUE(match->MatchesCurrentPlatform());
++#endif
++}
++
 +// =============================================================================
 +// Edge Cases
 +// =============================================================================
@@ -389,6 +415,69 @@ index 0000000000000..ceb483dee35c6
 +  ASSERT_TRUE(item.has_value());
 +  ASSERT_EQ(1u, item->enclosures.size());
 +  EXPECT_TRUE(item->enclosures[0].signature.empty());
++  EXPECT_TRUE(item->enclosures[0].digest_signature.empty());
++}
++
++TEST(BrowserOSAppcastParserTest, ParsesDigestSignature) {
++  const char kDigestSigXml[] = R"(
++    <rss xmlns:sparkle="http://www.andymatuschak.org/xml-namespaces/sparkle"
++         xmlns:browseros="https://browseros.com/xml-namespaces/appcast">
++      <channel>
++        <item>
++          <sparkle:version>1.0.0</sparkle:version>
++          <enclosure url="https://example.com/download.zip"
++                     sparkle:os="macos" sparkle:arch="arm64"
++                     sparkle:edSignature="sig"
++                     browseros:edDigestSignature="digestsig=="
++                     length="100"/>
++        </item>
++      </channel>
++    </rss>
++  )";
++
++  auto item = BrowserOSAppcastParser::ParseLatestItem(kDigestSigXml);
++
++  ASSERT_TRUE(item.has_value());
++  ASSERT_EQ(1u, item->enclosures.size());
++  EXPECT_EQ("sig", item->enclosures[0].signature);
++  EXPECT_EQ("digestsig==", item->enclosures[0].digest_signature);
++}
++
++TEST(BrowserOSAppcastParserTest, ParsesDeltasSeparatelyFromFullPackages) {
++  const char kDeltaXml[] = R"(
++    <rss xmlns:sparkle="http://www.andymatuschak.org/xml-namespaces/sparkle">
++      <channel>
++        <item>
++          <sparkle:version>1.1.0</sparkle:version>
++          <enclosure url="https://example.com/full.zip"
++                     sparkle:os="macos" sparkle:arch="arm64"
++                     sparkle:edSignature="sig" length="1000"/>
++          <sparkle:deltas>
++            <enclosure url="https://example.com/from-1.0.0.zucchini"
++                       sparkle:deltaFrom="1.0.0"
++                       sparkle:os="macos" sparkle:arch="arm64"
++                       length="10"/>
++            <enclosure url="https://example.com/no-base.zucchini"
++                       sparkle:os="macos" sparkle:arch="arm64"
++                       length="10"/>
++          </sparkle:deltas>
++        </item>
++      </channel>
++    </rss>
++  )";
++
++  auto item = BrowserOSAppcastParser::ParseLatestItem(kDeltaXml);
++
++  ASSERT_TRUE(item.has_value());
++  ASSERT_EQ(1u, item->enclosures.size());
++  EXPECT_EQ("https://example.com/full.zip", item->enclosures[0].url);
++  EXPECT_FALSE(item->enclosures[0].is_delta());
++
++  // The delta without sparkle:deltaFrom is dropped.
++  ASSERT_EQ(1u, item->deltas.size());
++  EXPECT_EQ("https://example.com/from-1.0.0.zucchini", item->deltas[0].url);
++  EXPECT_EQ(base::Version("1.0.0"), item->deltas[0].delta_from);
++  EXPECT_EQ(10, item->deltas[0].length);
 +}
 +
 +}  // namespace
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_config.cc b/chrome/browser/browseros/server/browseros_server_config.cc
 new file mode 100644
-index 0000000000000..3e0c69cdf6442
+index 0000000000000..4427d1be32243
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_config.cc
-@@ -0,0 +1,81 @@
+@@ -0,0 +1,88 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -54,6 +54,11 @@ index 0000000000000..3e0c69cdf6442
 +      execution.AsUTF8Unsafe().c_str());
 +}
 +
++ServerSockets::ServerSockets() = default;
++ServerSockets::ServerSockets(const ServerSockets&) = default;
++ServerSockets& ServerSockets::operator=(const ServerSockets&) = default;
++ServerSockets::~ServerSockets() = default;
++
 +std::string ServerIdentity::DebugString() const {
 +  return base::StringPrintf(
 +      "ServerIdentity{\n"
@@ -76,11 +81,13 @@ index 0000000000000..3e0c69cdf6442
 +      "  %s\n"
 +      "  %s\n"
 +      "  %s\n"
++      "  server_socket=%s\n"
 +      "  allow_remote=%s\n"
 +      "}",
 +      ports.DebugString().c_str(),
 +      paths.DebugString().c_str(),
 +      identity.DebugString().c_str(),
++      sockets.server.AsUTF8Unsafe().c_str(),
 +      allow_remote_in_mcp ? "true" : "false");
 +}
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_config.h b/chrome/browser/browseros/server/browseros_server_config.h
 new file mode 100644
-index 0000000000000..3b121ed6f6635
+index 0000000000000..9bd162b9ff138
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_config.h
-@@ -0,0 +1,90 @@
+@@ -0,0 +1,126 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -66,6 +66,26 @@ index 0000000000000..3b121ed6f6635
 +  std::string DebugString() const;
 +};
 +
++// Unix domain sockets used alongside loopback TCP (Linux only, behind
++// --browseros-server-unix-sockets). All empty when disabled.
++struct ServerSockets {
++  ServerSockets();
++  ServerSockets(const ServerSockets&);
++  ServerSockets& operator=(const ServerSockets&);
++  ~ServerSockets();
++
++  // MCP proxy; also reachable on ports.proxy.
++  base::FilePath proxy;
++
++  // CDP; also reachable on ports.cdp.
++  base::FilePath cdp;
++
++  // Sidecar backend. Created by the sidecar if it supports Unix sockets.
++  base::FilePath server;
++
++  bool IsEnabled() const { return !server.empty(); }
++};
++
 +// Identity and versioning info written to the server config JSON.
 +struct ServerIdentity {
 +  std::string install_id;
@@ -76,14 +96,30 @@ index 0000000000000..3b121ed6f6635
 +  std::string DebugString() const;
 +};
 +
++// Descriptor numbers of the pre-bound listening sockets in the server
++// process.
++inline constexpr int kServerListenChildFd = 3;
++inline constexpr int kExtensionListenChildFd = 4;
++
++// Exit code of a server that could not adopt its pre-bound listening
++// sockets (EX_CONFIG). Advertised as "listen_fds.adopt_failed_exit_code".
++inline constexpr int kListenFdsAdoptFailedExitCode = 78;
++
 +// Complete configuration for a single server launch.
 +// Assembled fresh before each ProcessController::Launch() call.
 +struct ServerLaunchConfig {
 +  ServerPorts ports;
 +  ServerPaths paths;
 +  ServerIdentity identity;
++  ServerSockets sockets;
 +  bool allow_remote_in_mcp = false;
 +
++  // Listening sockets already bound to ports.server and ports.extension,
++  // mapped into the child as kServerListenChildFd/kExtensionListenChildFd,
++  // or -1 to let the server bind the port itself. Owned by the manager.
++  int server_listen_fd = -1;
++  int extension_listen_fd = -1;
++
 +  // Returns true if the config is valid for launching.
 +  bool IsValid() const;
 +
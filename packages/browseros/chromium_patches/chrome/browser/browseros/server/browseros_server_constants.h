@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_constants.h b/chrome/browser/browseros/server/browseros_server_constants.h
 new file mode 100644
-index 0000000000000..d2c8229f8c805
+index 0000000000000..3e12ec4c0cec4
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_constants.h
-@@ -0,0 +1,52 @@
+@@ -0,0 +1,60 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -21,8 +21,10 @@ index 0000000000000..d2c8229f8c805
 +inline constexpr char kAlphaAppcastUrl[] =
 +    "https://cdn.browseros.com/appcast-server.alpha.xml";
 +
-+// Interval between update checks
++// Interval between update checks, spread over +/- kUpdateCheckJitter of its
++// value so that a fleet does not hit the CDN at once.
 +inline constexpr base::TimeDelta kUpdateCheckInterval = base::Minutes(15);
++inline constexpr double kUpdateCheckJitter = 0.25;
 +
 +// Ed25519 public key for signature verification (base64-encoded)
 +// This key verifies the authenticity of downloaded server binaries.
@@ -49,9 +51,15 @@ index 0000000000000..d2c8229f8c805
 +
 +// Directory and file names
 +inline constexpr char kVersionsDirectoryName[] = "versions";
++inline constexpr char kStoreDirectoryName[] = "store";
 +inline constexpr char kCurrentVersionFileName[] = "current_version";
++// Last fetched appcast and its validators.
++inline constexpr char kAppcastCacheFileName[] = "appcast_cache.json";
 +inline constexpr char kPendingUpdateDirectoryName[] = "pending_update";
 +inline constexpr char kDownloadFileName[] = "download.zip";
++inline constexpr char kDeltaFileName[] = "download.zucchini";
++// Verified package kept in each version directory as the base for deltas.
++inline constexpr char kRetainedPackageFileName[] = "package.zip";
 +
 +}  // namespace browseros_server
 +
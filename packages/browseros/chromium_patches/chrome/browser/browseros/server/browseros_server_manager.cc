@@ -1,32 +1,39 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.cc b/chrome/browser/browseros/server/browseros_server_manager.cc
 new file mode 100644
-index 0000000000000..0070cd46351f6
+index 0000000000000..4c8645d82a298
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.cc
-@@ -0,0 +1,1066 @@
+@@ -0,0 +1,1713 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +
++#include <algorithm>
 +#include <optional>
 +#include <set>
++#include <string>
 +
 +#include "base/command_line.h"
 +#include "base/functional/callback_helpers.h"
 +#include "base/files/file_path.h"
++#include "base/feature_list.h"
 +#include "base/files/file_util.h"
++#include "base/json/json_writer.h"
 +#include "base/logging.h"
 +#include "base/path_service.h"
 +#include "base/rand_util.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/system/sys_info.h"
++#include "base/task/bind_post_task.h"
 +#include "base/task/thread_pool.h"
 +#include "content/public/browser/browser_thread.h"
 +#include "base/threading/thread_restrictions.h"
++#include "base/trace_event/trace_event.h"
 +#include "build/build_config.h"
 +#include "chrome/browser/browser_process.h"
++#include "chrome/browser/browseros/core/browseros_startup_scheduler.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service_factory.h"
@@ -37,13 +44,13 @@ index 0000000000000..0070cd46351f6
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +#include "chrome/browser/browseros/server/health_checker.h"
 +#include "chrome/browser/browseros/server/health_checker_impl.h"
++#include "chrome/browser/browseros/server/liveness_monitor.h"
++#include "chrome/browser/browseros/server/liveness_monitor_impl.h"
 +#include "chrome/browser/browseros/server/process_controller.h"
 +#include "chrome/browser/browseros/server/process_controller_impl.h"
 +#include "chrome/browser/browseros/server/server_state_store.h"
 +#include "chrome/browser/browseros/server/server_state_store_impl.h"
 +#include "chrome/browser/browseros/server/server_updater.h"
-+#include "chrome/browser/net/system_network_context_manager.h"
-+#include "services/network/public/cpp/shared_url_loader_factory.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/browser/profiles/profile_manager.h"
 +#include "chrome/common/chrome_paths.h"
@@ -62,6 +69,10 @@ index 0000000000000..0070cd46351f6
 +#include "net/socket/tcp_server_socket.h"
 +#include "net/socket/tcp_socket.h"
 +
++#if BUILDFLAG(IS_POSIX)
++#include "chrome/browser/browseros/server/unix_socket_transport.h"
++#endif
++
 +namespace {
 +
 +constexpr int kBackLog = 10;
@@ -69,8 +80,21 @@ index 0000000000000..0070cd46351f6
 +constexpr base::TimeDelta kHealthCheckInterval = base::Seconds(30);
 +constexpr base::TimeDelta kProcessCheckInterval = base::Seconds(5);
 +
++constexpr base::TimeDelta kStandbyHealthPollInterval = base::Milliseconds(250);
++constexpr base::TimeDelta kStandbyReadyTimeout = base::Seconds(30);
++constexpr base::TimeDelta kDrainTimeout = base::Seconds(10);
++
 +constexpr base::TimeDelta kStartupGracePeriod = base::Seconds(30);
++// Health poll used only until the first bring-up is healthy, so the
++// startup timeline ends when the server is ready rather than at the next
++// periodic health check.
++constexpr base::TimeDelta kStartupReadyPollInterval = base::Milliseconds(100);
 +constexpr int kMaxStartupFailures = 3;
++// Startup failures with pre-bound sockets after which a server that never
++// reported failing to adopt them gets to bind its ports itself. Below
++// kMaxStartupFailures, so the binary gets a launch without them before it
++// is given up on.
++constexpr int kMaxHandoffStartupFailures = 2;
 +
 +constexpr int kExitCodeSuccess = 0;
 +
@@ -110,7 +134,9 @@ index 0000000000000..0070cd46351f6
 +
 +class CDPServerSocketFactory : public content::DevToolsSocketFactory {
 + public:
-+  explicit CDPServerSocketFactory(uint16_t port) : port_(port) {}
++  // |unix_socket_path|, if set, is served in addition to the TCP port.
++  CDPServerSocketFactory(uint16_t port, base::FilePath unix_socket_path)
++      : port_(port), unix_socket_path_(std::move(unix_socket_path)) {}
 +
 +  CDPServerSocketFactory(const CDPServerSocketFactory&) = delete;
 +  CDPServerSocketFactory& operator=(const CDPServerSocketFactory&) = delete;
@@ -130,7 +156,19 @@ index 0000000000000..0070cd46351f6
 +  }
 +
 +  std::unique_ptr<net::ServerSocket> CreateForHttpServer() override {
-+    return CreateLocalHostServerSocket(port_);
++    std::unique_ptr<net::ServerSocket> socket =
++        CreateLocalHostServerSocket(port_);
++#if BUILDFLAG(IS_POSIX)
++    if (socket && !unix_socket_path_.empty()) {
++      std::unique_ptr<net::ServerSocket> unix_socket =
++          browseros::ListenOnUnixSocket(unix_socket_path_, kBackLog);
++      if (unix_socket) {
++        return std::make_unique<browseros::DualServerSocket>(
++            std::move(socket), std::move(unix_socket));
++      }
++    }
++#endif
++    return socket;
 +  }
 +
 +  std::unique_ptr<net::ServerSocket> CreateForTethering(
@@ -139,6 +177,7 @@ index 0000000000000..0070cd46351f6
 +  }
 +
 +  uint16_t port_;
++  base::FilePath unix_socket_path_;
 +};
 +
 +}  // namespace
@@ -155,6 +194,7 @@ index 0000000000000..0070cd46351f6
 +    : process_controller_(std::make_unique<ProcessControllerImpl>()),
 +      state_store_(std::make_unique<ServerStateStoreImpl>()),
 +      health_checker_(std::make_unique<HealthCheckerImpl>()),
++      liveness_monitor_(std::make_unique<LivenessMonitorImpl>()),
 +      local_state_(g_browser_process ? g_browser_process->local_state()
 +                                     : nullptr) {}
 +
@@ -162,11 +202,13 @@ index 0000000000000..0070cd46351f6
 +    std::unique_ptr<ProcessController> process_controller,
 +    std::unique_ptr<ServerStateStore> state_store,
 +    std::unique_ptr<HealthChecker> health_checker,
++    std::unique_ptr<LivenessMonitor> liveness_monitor,
 +    std::unique_ptr<ServerUpdater> updater,
 +    PrefService* local_state)
 +    : process_controller_(std::move(process_controller)),
 +      state_store_(std::move(state_store)),
 +      health_checker_(std::move(health_checker)),
++      liveness_monitor_(std::move(liveness_monitor)),
 +      local_state_(local_state),
 +      updater_(std::move(updater)) {}
 +
@@ -208,13 +250,14 @@ index 0000000000000..0070cd46351f6
 +  return true;
 +}
 +
-+bool BrowserOSServerManager::RecoverFromOrphan() {
++void BrowserOSServerManager::RecoverFromOrphan(base::OnceClosure done) {
 +  base::ScopedAllowBlocking allow_blocking;
 +
 +  std::optional<server_utils::ServerState> state = state_store_->Read();
 +  if (!state) {
 +    LOG(INFO) << "browseros: No orphan state file found";
-+    return false;
++    std::move(done).Run();
++    return;
 +  }
 +
 +  LOG(INFO) << "browseros: Found state file - PID: " << state->pid
@@ -223,7 +266,8 @@ index 0000000000000..0070cd46351f6
 +  if (!server_utils::ProcessExists(state->pid)) {
 +    LOG(INFO) << "browseros: Process " << state->pid << " no longer exists";
 +    state_store_->Delete();
-+    return false;
++    std::move(done).Run();
++    return;
 +  }
 +
 +  std::optional<int64_t> actual_creation_time =
@@ -232,7 +276,8 @@ index 0000000000000..0070cd46351f6
 +    LOG(WARNING) << "browseros: Could not get creation time for PID "
 +                 << state->pid;
 +    state_store_->Delete();
-+    return false;
++    std::move(done).Run();
++    return;
 +  }
 +
 +  if (*actual_creation_time != state->creation_time) {
@@ -240,21 +285,33 @@ index 0000000000000..0070cd46351f6
 +              << "(expected creation_time: " << state->creation_time
 +              << ", actual: " << *actual_creation_time << ")";
 +    state_store_->Delete();
-+    return false;
++    std::move(done).Run();
++    return;
 +  }
 +
 +  LOG(INFO) << "browseros: Killing orphan server (PID: " << state->pid << ")";
 +  constexpr base::TimeDelta kGracefulTimeout = base::Seconds(2);
-+  bool killed = server_utils::KillProcess(state->pid, kGracefulTimeout);
++  process_controller_->TerminateAsync(
++      base::Process::Open(state->pid), TerminationMode::kGraceful,
++      kGracefulTimeout,
++      base::BindOnce(&BrowserOSServerManager::OnOrphanTerminated,
++                     weak_factory_.GetWeakPtr(), std::move(done)));
++}
 +
-+  if (killed) {
++void BrowserOSServerManager::OnOrphanTerminated(base::OnceClosure done,
++                                                TerminationResult result) {
++  RecordTermination(result);
++  if (result.exited) {
 +    LOG(INFO) << "browseros: Orphan server killed successfully";
 +  } else {
 +    LOG(WARNING) << "browseros: Failed to kill orphan server, proceeding anyway";
 +  }
 +
-+  state_store_->Delete();
-+  return killed;
++  {
++    base::ScopedAllowBlocking allow_blocking;
++    state_store_->Delete();
++  }
++  std::move(done).Run();
 +}
 +
 +void BrowserOSServerManager::LoadPortsFromPrefs() {
@@ -326,9 +383,10 @@ index 0000000000000..0070cd46351f6
 +  // Skip FindAvailablePort for CLI-overridden ports — trust the developer.
 +  bool cdp_fixed = command_line->HasSwitch(browseros::kCDPPort);
 +  bool proxy_fixed = command_line->HasSwitch(browseros::kProxyPort);
-+  bool server_fixed = command_line->HasSwitch(browseros::kServerPort);
-+  bool extension_fixed = command_line->HasSwitch(browseros::kExtensionPort);
 +
++  // CDP and the MCP proxy are listened on by the browser itself, by code
++  // that binds a port number, and are never handed to the server; only they
++  // keep the probe when the server ports are handed off.
 +  if (cdp_fixed) {
 +    assigned_ports.insert(ports_.cdp);
 +  } else {
@@ -344,20 +402,7 @@ index 0000000000000..0070cd46351f6
 +    assigned_ports.insert(ports_.proxy);
 +  }
 +
-+  if (server_fixed) {
-+    assigned_ports.insert(ports_.server);
-+  } else {
-+    ports_.server = server_utils::FindAvailablePort(
-+        browseros_server::kDefaultServerPort, assigned_ports);
-+    assigned_ports.insert(ports_.server);
-+  }
-+
-+  if (extension_fixed) {
-+    assigned_ports.insert(ports_.extension);
-+  } else {
-+    ports_.extension = server_utils::FindAvailablePort(
-+        browseros_server::kDefaultExtensionPort, assigned_ports);
-+  }
++  AssignServerPorts(&ports_, std::move(assigned_ports));
 +
 +  LOG(INFO) << "browseros: Resolved ports for startup - " << ports_.DebugString();
 +}
@@ -416,13 +461,17 @@ index 0000000000000..0070cd46351f6
 +    return;
 +  }
 +
++  startup_timeline_.Begin();
++
 +  // Phase 1: Load user intent (prefs + CLI overrides).
 +  // Save stable port preferences so CLI overrides are persisted even when
 +  // the server is disabled or we lose the lock.
++  startup_timeline_.BeginPhase("prefs");
 +  LoadPortsFromPrefs();
 +  SetupPrefObservers();
 +  ApplyCommandLineOverrides();
 +  SavePortsToPrefs();
++  startup_timeline_.EndPhase("prefs");
 +
 +  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
 +  if (command_line->HasSwitch(browseros::kDisableServer)) {
@@ -430,24 +479,51 @@ index 0000000000000..0070cd46351f6
 +    return;
 +  }
 +
-+  if (!AcquireLock()) {
++  startup_timeline_.BeginPhase("lock");
++  bool locked = AcquireLock();
++  startup_timeline_.EndPhase("lock");
++  if (!locked) {
++    return;
++  }
++
++  // Phase 2: We hold the lock — we're the active instance. An orphan from a
++  // previous session may still hold our ports, so wait for it to go first.
++  start_pending_ = true;
++  startup_timeline_.BeginPhase("orphan_recovery");
++  RecoverFromOrphan(base::BindOnce(&BrowserOSServerManager::ContinueStartup,
++                                   weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::ContinueStartup() {
++  // Stop() was called while the orphan was exiting.
++  if (!start_pending_) {
 +    return;
 +  }
++  start_pending_ = false;
++  startup_timeline_.EndPhase("orphan_recovery");
 +
-+  // Phase 2: We hold the lock — we're the active instance.
 +  // Now resolve actual available ports and save the final values.
-+  RecoverFromOrphan();
++  startup_timeline_.BeginPhase("port_resolution");
 +  ResolvePortsForStartup();
 +  SavePortsToPrefs();
++  startup_timeline_.EndPhase("port_resolution");
 +
 +  LOG(INFO) << "browseros: Starting BrowserOS server";
 +
++  startup_timeline_.BeginPhase("cdp_server");
++  SetUpUnixSocketDir();
 +  StartCDPServer();
++  startup_timeline_.EndPhase("cdp_server");
++
++  startup_timeline_.BeginPhase("proxy");
 +  StartProxy();
++  startup_timeline_.EndPhase("proxy");
++
 +  LaunchBrowserOSProcess();
 +}
 +
 +void BrowserOSServerManager::Stop() {
++  start_pending_ = false;
 +  if (!is_running_) {
 +    return;
 +  }
@@ -455,8 +531,20 @@ index 0000000000000..0070cd46351f6
 +  is_running_ = false;
 +
 +  LOG(INFO) << "browseros: Stopping BrowserOS server";
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  StopLivenessMonitoring();
++
++  startup_ready_timer_.Stop();
++  restarting_with_standby_ = false;
++  standby_health_timer_.Stop();
++  if (standby_process_.IsValid()) {
++    process_controller_->Terminate(&standby_process_, /*wait=*/false);
++    standby_process_ = base::Process();
++  }
++  drain_timeout_timer_.Stop();
++  if (draining_process_.IsValid()) {
++    process_controller_->Terminate(&draining_process_, /*wait=*/false);
++    draining_process_ = base::Process();
++  }
 +
 +  if (updater_) {
 +    updater_->Stop();
@@ -464,6 +552,7 @@ index 0000000000000..0070cd46351f6
 +  }
 +
 +  StopProxy();
++  CleanUpUnixSocketDir();
 +
 +  TerminateBrowserOSProcess(base::DoNothing());
 +
@@ -495,7 +584,8 @@ index 0000000000000..0070cd46351f6
 +  content::DevToolsAgentHost::StopRemoteDebuggingServer();
 +
 +  content::DevToolsAgentHost::StartRemoteDebuggingServer(
-+      std::make_unique<CDPServerSocketFactory>(ports_.cdp),
++      std::make_unique<CDPServerSocketFactory>(
++          ports_.cdp, GetUnixSockets(ports_.server).cdp),
 +      base::FilePath(),
 +      base::FilePath());
 +
@@ -514,29 +604,38 @@ index 0000000000000..0070cd46351f6
 +}
 +
 +void BrowserOSServerManager::StartProxy() {
-+  server_proxy_ = std::make_unique<BrowserOSServerProxy>();
-+
-+  // Clone the factory on the UI thread so it can be bound on the IO thread.
-+  auto pending_factory =
-+      g_browser_process->system_network_context_manager()
-+          ->GetSharedURLLoaderFactory()
-+          ->Clone();
++  TRACE_EVENT("browseros", "BrowserOSServerManager::StartProxy");
++  BrowserOSServerProxy::Options options;
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  int value = 0;
++  if (base::StringToInt(
++          command_line->GetSwitchValueASCII(browseros::kProxyBacklog),
++          &value) &&
++      value > 0) {
++    options.backlog = value;
++  }
++  if (base::StringToInt(
++          command_line->GetSwitchValueASCII(browseros::kProxyMaxConcurrency),
++          &value) &&
++      value > 0) {
++    options.max_in_flight = static_cast<size_t>(value);
++    options.max_idle_connections = options.max_in_flight;
++  }
++  options.unix_socket_path = GetUnixSockets(ports_.server).proxy;
++  server_proxy_ = std::make_unique<BrowserOSServerProxy>(options);
 +
 +  content::GetIOThreadTaskRunner({})->PostTask(
 +      FROM_HERE,
 +      base::BindOnce(
-+          [](BrowserOSServerProxy* proxy, int port,
-+             std::unique_ptr<network::PendingSharedURLLoaderFactory> pending,
-+             bool allow_remote) {
-+            if (!proxy->Start(port, std::move(pending))) {
++          [](BrowserOSServerProxy* proxy, int port, bool allow_remote) {
++            if (!proxy->Start(port)) {
 +              LOG(ERROR) << "browseros: Failed to start MCP proxy on port "
 +                         << port;
 +              return;
 +            }
 +            proxy->SetAllowRemote(allow_remote);
 +          },
-+          server_proxy_.get(), ports_.proxy, std::move(pending_factory),
-+          allow_remote_in_mcp_));
++          server_proxy_.get(), ports_.proxy, allow_remote_in_mcp_));
 +}
 +
 +void BrowserOSServerManager::StopProxy() {
@@ -552,6 +651,162 @@ index 0000000000000..0070cd46351f6
 +  }
 +}
 +
++void BrowserOSServerManager::SetUpUnixSocketDir() {
++  unix_socket_dir_.clear();
++#if BUILDFLAG(IS_LINUX)
++  if (!base::CommandLine::ForCurrentProcess()->HasSwitch(
++          browseros::kServerUnixSockets)) {
++    return;
++  }
++
++  base::FilePath exec_dir = GetBrowserOSExecutionDir();
++  if (exec_dir.empty()) {
++    return;
++  }
++  base::FilePath dir = exec_dir.Append(FILE_PATH_LITERAL("sockets"));
++
++  // Longest name handed out by GetUnixSockets().
++  if (!IsUnixSocketPathUsable(
++          dir.Append(FILE_PATH_LITERAL("server-65535.sock")))) {
++    LOG(WARNING) << "browseros: Socket directory path too long, using TCP: "
++                 << dir;
++    return;
++  }
++
++  base::ScopedAllowBlocking allow_blocking;
++  // Sockets from a previous run are stale; the sidecar recreates its own.
++  base::DeletePathRecursively(dir);
++  if (!base::CreateDirectory(dir) ||
++      !base::SetPosixFilePermissions(dir, base::FILE_PERMISSION_USER_MASK)) {
++    LOG(WARNING) << "browseros: Failed to create socket directory " << dir;
++    return;
++  }
++
++  unix_socket_dir_ = dir;
++  LOG(INFO) << "browseros: Unix socket transport enabled in " << dir;
++#endif
++}
++
++void BrowserOSServerManager::CleanUpUnixSocketDir() {
++  if (unix_socket_dir_.empty()) {
++    return;
++  }
++  base::ThreadPool::PostTask(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::BEST_EFFORT},
++      base::GetDeletePathRecursivelyCallback(unix_socket_dir_));
++  unix_socket_dir_.clear();
++}
++
++ServerSockets BrowserOSServerManager::GetUnixSockets(int server_port) const {
++  ServerSockets sockets;
++  if (unix_socket_dir_.empty() || server_port <= 0) {
++    return sockets;
++  }
++  sockets.proxy = unix_socket_dir_.Append(FILE_PATH_LITERAL("proxy.sock"));
++  sockets.cdp = unix_socket_dir_.Append(FILE_PATH_LITERAL("cdp.sock"));
++  // Per port, so a standby server doesn't collide with the active one.
++  sockets.server = unix_socket_dir_.AppendASCII(
++      "server-" + base::NumberToString(server_port) + ".sock");
++  return sockets;
++}
++
++std::vector<base::ScopedFD> BrowserOSServerManager::ClaimServerPorts(
++    ServerLaunchConfig* config,
++    std::set<int> excluded) {
++  std::vector<base::ScopedFD> fds;
++  handoff_exe_.clear();
++#if BUILDFLAG(IS_POSIX)
++  if (!IsSocketHandoffSupported(config->paths.exe)) {
++    return fds;
++  }
++
++  // Pinned ports are left for the server to bind, as before.
++  base::CommandLine* cl = base::CommandLine::ForCurrentProcess();
++  std::set<int> assigned = std::move(excluded);
++  assigned.insert(config->ports.cdp);
++  assigned.insert(config->ports.proxy);
++
++  if (!cl->HasSwitch(browseros::kServerPort)) {
++    server_utils::BoundPort bound =
++        server_utils::BindAvailablePort(config->ports.server, assigned);
++    if (bound.fd.is_valid()) {
++      config->ports.server = bound.port;
++      config->server_listen_fd = bound.fd.get();
++      fds.push_back(std::move(bound.fd));
++    }
++  }
++  assigned.insert(config->ports.server);
++
++  if (!cl->HasSwitch(browseros::kExtensionPort)) {
++    server_utils::BoundPort bound =
++        server_utils::BindAvailablePort(config->ports.extension, assigned);
++    if (bound.fd.is_valid()) {
++      config->ports.extension = bound.port;
++      config->extension_listen_fd = bound.fd.get();
++      fds.push_back(std::move(bound.fd));
++    }
++  }
++
++  if (!fds.empty()) {
++    config->sockets = GetUnixSockets(config->ports.server);
++    handoff_exe_ = config->paths.exe;
++  }
++#endif
++  return fds;
++}
++
++bool BrowserOSServerManager::IsSocketHandoffSupported(
++    const base::FilePath& exe) const {
++  // Servers that can't adopt the sockets exit during startup, with
++  // kListenFdsAdoptFailedExitCode if they know about them;
++  // OnHandoffStartupFailure() then records the binary here.
++  return !local_state_ ||
++         local_state_->GetString(
++             browseros_server::kSocketHandoffUnsupportedExe) !=
++             exe.AsUTF8Unsafe();
++}
++
++bool BrowserOSServerManager::WillHandOffSockets() const {
++#if BUILDFLAG(IS_POSIX)
++  // Same binary BuildLaunchConfig() picks.
++  return IsSocketHandoffSupported(updater_
++                                      ? updater_->GetBestServerBinaryPath()
++                                      : GetBrowserOSServerExecutablePath());
++#else
++  return false;
++#endif
++}
++
++void BrowserOSServerManager::AssignServerPorts(ServerPorts* ports,
++                                               std::set<int> excluded) const {
++  base::CommandLine* cl = base::CommandLine::ForCurrentProcess();
++  bool server_fixed = cl->HasSwitch(browseros::kServerPort);
++  bool extension_fixed = cl->HasSwitch(browseros::kExtensionPort);
++
++  // A probe would only bind and close the port for ClaimServerPorts() to
++  // bind it again, leaving a window for another process to take it.
++  if (WillHandOffSockets()) {
++    if (!server_fixed) {
++      ports->server = browseros_server::kDefaultServerPort;
++    }
++    if (!extension_fixed) {
++      ports->extension = browseros_server::kDefaultExtensionPort;
++    }
++    return;
++  }
++
++  if (!server_fixed) {
++    ports->server = server_utils::FindAvailablePort(
++        browseros_server::kDefaultServerPort, excluded);
++  }
++  excluded.insert(ports->server);
++
++  if (!extension_fixed) {
++    ports->extension = server_utils::FindAvailablePort(
++        browseros_server::kDefaultExtensionPort, excluded);
++  }
++}
++
 +ServerLaunchConfig BrowserOSServerManager::BuildLaunchConfig() {
 +  ServerLaunchConfig config;
 +
@@ -568,6 +823,7 @@ index 0000000000000..0070cd46351f6
 +  }
 +
 +  config.ports = ports_;
++  config.sockets = GetUnixSockets(config.ports.server);
 +
 +  config.identity.browseros_version =
 +      std::string(version_info::GetBrowserOSVersionNumber());
@@ -593,6 +849,7 @@ index 0000000000000..0070cd46351f6
 +}
 +
 +void BrowserOSServerManager::LaunchBrowserOSProcess() {
++  TRACE_EVENT("browseros", "BrowserOSServerManager::LaunchBrowserOSProcess");
 +  ServerLaunchConfig config = BuildLaunchConfig();
 +
 +  if (config.paths.execution.empty()) {
@@ -600,29 +857,50 @@ index 0000000000000..0070cd46351f6
 +    return;
 +  }
 +
++  std::vector<base::ScopedFD> listen_fds = ClaimServerPorts(&config, {});
++  if (config.ports != ports_) {
++    ports_ = config.ports;
++    SavePortsToPrefs();
++  }
++
 +  LOG(INFO) << "browseros: Launching server - " << config.DebugString();
 +
 +  ProcessController* pc = process_controller_.get();
 +
++  startup_timeline_.BeginPhase("launch");
++
++  // The browser's copies of the listening sockets close once the child has
++  // its own.
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
 +      base::BindOnce(&ProcessController::Launch, base::Unretained(pc), config),
 +      base::BindOnce(&BrowserOSServerManager::OnProcessLaunched,
-+                     weak_factory_.GetWeakPtr()));
++                     weak_factory_.GetWeakPtr())
++          .Then(base::DoNothingWithBoundArgs(std::move(listen_fds))));
 +}
 +
 +void BrowserOSServerManager::OnProcessLaunched(LaunchResult result) {
-+  bool was_updating = is_updating_;
-+
 +  if (result.used_fallback && updater_) {
 +    updater_->InvalidateDownloadedVersion();
 +  }
 +
++  startup_timeline_.EndPhase("launch");
++  if (startup_timeline_.is_active() && !result.spawn_start.is_null()) {
++    startup_timeline_.AddPhase("write_config", result.config_write_start,
++                               result.spawn_start - result.config_write_start);
++    startup_timeline_.AddPhase("spawn", result.spawn_start,
++                               result.spawn_end - result.spawn_start);
++  }
++
 +  if (!result.process.IsValid()) {
 +    LOG(ERROR) << "browseros: Failed to launch BrowserOS server";
++    if (startup_timeline_.is_active()) {
++      PersistStartupTimeline();
++    }
++    liveness_monitor_->Stop();
 +    is_restarting_ = false;
 +
-+    if (was_updating) {
++    if (is_updating_) {
 +      is_updating_ = false;
 +      if (update_complete_callback_) {
 +        std::move(update_complete_callback_).Run(false);
@@ -631,7 +909,13 @@ index 0000000000000..0070cd46351f6
 +    return;
 +  }
 +
-+  process_ = std::move(result.process);
++  ActivateProcess(std::move(result.process));
++}
++
++void BrowserOSServerManager::ActivateProcess(base::Process process) {
++  bool was_updating = is_updating_;
++
++  process_ = std::move(process);
 +  is_running_ = true;
 +  last_launch_time_ = base::TimeTicks::Now();
 +
@@ -640,6 +924,14 @@ index 0000000000000..0070cd46351f6
 +
 +  // Point proxy at the new backend port (proxy lives on IO thread)
 +  if (server_proxy_) {
++    ServerSockets sockets = GetUnixSockets(ports_.server);
++    if (sockets.IsEnabled()) {
++      content::GetIOThreadTaskRunner({})->PostTask(
++          FROM_HERE,
++          base::BindOnce(&BrowserOSServerProxy::SetBackendSocket,
++                         base::Unretained(server_proxy_.get()), ports_.server,
++                         sockets.server));
++    }
 +    content::GetIOThreadTaskRunner({})->PostTask(
 +        FROM_HERE,
 +        base::BindOnce(&BrowserOSServerProxy::SetBackendPort,
@@ -663,10 +955,12 @@ index 0000000000000..0070cd46351f6
 +    }
 +  }
 +
-+  health_check_timer_.Start(FROM_HERE, kHealthCheckInterval, this,
-+                            &BrowserOSServerManager::CheckServerHealth);
-+  process_check_timer_.Start(FROM_HERE, kProcessCheckInterval, this,
-+                             &BrowserOSServerManager::CheckProcessStatus);
++  StartLivenessMonitoring();
++
++  if (startup_timeline_.is_active()) {
++    startup_timeline_.BeginPhase("health");
++    CheckStartupReadiness();
++  }
 +
 +  if (is_restarting_) {
 +    is_restarting_ = false;
@@ -691,7 +985,12 @@ index 0000000000000..0070cd46351f6
 +    } else {
 +      updater_ =
 +          std::make_unique<browseros_server::BrowserOSServerUpdater>(this);
-+      updater_->Start();
++      // The version probe and first appcast check are not needed for the
++      // agent to work; keep them until startup is complete.
++      BrowserOSStartupScheduler::GetInstance()->PostTask(
++          StartupPhase::kIdle, FROM_HERE,
++          base::BindOnce(&BrowserOSServerManager::StartUpdater,
++                         weak_factory_.GetWeakPtr()));
 +    }
 +  }
 +}
@@ -724,12 +1023,165 @@ index 0000000000000..0070cd46351f6
 +  std::move(callback).Run();
 +}
 +
++void BrowserOSServerManager::StartLivenessMonitoring() {
++  // Replaces the monitoring of a previous process, if any.
++  IgnoreLivenessSignals();
++
++  bool exit_is_pushed = liveness_monitor_->Start(
++      process_, base::BindOnce(&BrowserOSServerManager::OnProcessExitSignaled,
++                               liveness_weak_factory_.GetWeakPtr()));
++
++  health_check_timer_.Start(FROM_HERE, kHealthCheckInterval, this,
++                            &BrowserOSServerManager::CheckServerHealth);
++  if (!exit_is_pushed) {
++    process_check_timer_.Start(FROM_HERE, kProcessCheckInterval, this,
++                               &BrowserOSServerManager::CheckProcessStatus);
++  }
++}
++
++void BrowserOSServerManager::StopLivenessMonitoring() {
++  IgnoreLivenessSignals();
++  liveness_monitor_->Stop();
++}
++
++void BrowserOSServerManager::IgnoreLivenessSignals() {
++  health_check_timer_.Stop();
++  process_check_timer_.Stop();
++  // Signals about a process that is no longer monitored must not restart
++  // its replacement.
++  liveness_weak_factory_.InvalidateWeakPtrs();
++}
++
++void BrowserOSServerManager::CheckStartupReadiness() {
++  if (!is_running_ || !startup_timeline_.is_active()) {
++    return;
++  }
++
++  health_checker_->CheckHealth(
++      ports_.server,
++      base::BindOnce(&BrowserOSServerManager::OnStartupReadinessChecked,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnStartupReadinessChecked(bool healthy) {
++  if (!startup_timeline_.is_active()) {
++    return;
++  }
++
++  if (healthy) {
++    OnServerReady();
++    return;
++  }
++
++  if (base::TimeTicks::Now() - last_launch_time_ >= kStartupGracePeriod) {
++    LOG(WARNING) << "browseros: Server not healthy "
++                 << kStartupGracePeriod.InSeconds()
++                 << "s after launch, leaving startup timeline open";
++    PersistStartupTimeline();
++    return;
++  }
++
++  startup_ready_timer_.Start(FROM_HERE, kStartupReadyPollInterval, this,
++                             &BrowserOSServerManager::CheckStartupReadiness);
++}
++
++void BrowserOSServerManager::OnServerReady() {
++  startup_ready_timer_.Stop();
++  if (!startup_timeline_.is_active()) {
++    return;
++  }
++  startup_timeline_.Finish();
++  PersistStartupTimeline();
++  BrowserOSStartupScheduler::GetInstance()->OnAgentReady();
++}
++
++void BrowserOSServerManager::StartUpdater() {
++  if (updater_) {
++    updater_->Start();
++  }
++}
++
++void BrowserOSServerManager::RecordStartupPhase(const char* name,
++                                                base::TimeTicks start,
++                                                base::TimeDelta duration) {
++  startup_timeline_.AddPhase(name, start, duration);
++  if (startup_timeline_.is_finished()) {
++    PersistStartupTimeline();
++  }
++}
++
++base::Value::Dict BrowserOSServerManager::GetStartupTimeline() const {
++  return startup_timeline_.ToValue();
++}
++
++void BrowserOSServerManager::PersistStartupTimeline() {
++  std::optional<std::string> json = base::WriteJsonWithOptions(
++      startup_timeline_.ToValue(), base::JSONWriter::OPTIONS_PRETTY_PRINT);
++  if (!json) {
++    return;
++  }
++
++  base::ThreadPool::PostTask(
++      FROM_HERE,
++      {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(
++          [](std::string json) {
++            base::FilePath path = server_utils::GetStartupTimelinePath();
++            if (path.empty() || !base::WriteFile(path, json)) {
++              LOG(WARNING) << "browseros: Failed to write startup timeline";
++            }
++          },
++          std::move(*json)));
++}
++
++void BrowserOSServerManager::GetProxyMetrics(
++    base::OnceCallback<void(base::Value::Dict)> callback) {
++  if (!server_proxy_) {
++    std::move(callback).Run(base::Value::Dict());
++    return;
++  }
++  // The proxy is destroyed by a task posted to the IO thread after this one.
++  content::GetIOThreadTaskRunner({})->PostTaskAndReplyWithResult(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSServerProxy::GetMetricsSnapshot,
++                     base::Unretained(server_proxy_.get())),
++      std::move(callback));
++}
++
++void BrowserOSServerManager::OnProcessExitSignaled(int exit_code) {
++  // The process has exited, so this does not block. The reaped status is
++  // preferred over the monitor's peek; if neither could be read the exit
++  // stays kUnknownExitCode and is handled as a crash.
++  if (process_.IsValid()) {
++    int reaped_exit_code = kUnknownExitCode;
++    if (process_.WaitForExitWithTimeout(base::TimeDelta(),
++                                        &reaped_exit_code)) {
++      exit_code = reaped_exit_code;
++    }
++  }
++  OnProcessExited(exit_code);
++}
++
 +void BrowserOSServerManager::OnProcessExited(int exit_code) {
 +  LOG(INFO) << "browseros: BrowserOS server exited with code: " << exit_code;
++  TRACE_EVENT_INSTANT("browseros", "BrowserOSServerManager::ProcessExited",
++                      "exit_code", exit_code);
++
++  if (restarting_with_standby_) {
++    LOG(WARNING) << "browseros: Server exited while its standby starts, "
++                    "waiting for the standby";
++    IgnoreLivenessSignals();
++    process_ = base::Process();
++    return;
++  }
++
 +  is_running_ = false;
 +
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  StopLivenessMonitoring();
++
++  // Already reaped; keep later terminate/wait paths from touching the PID.
++  process_ = base::Process();
 +
 +  if (exit_code == kExitCodeSuccess) {
 +    LOG(INFO) << "browseros: Server exited cleanly (code 0), not restarting";
@@ -738,6 +1190,9 @@ index 0000000000000..0070cd46351f6
 +
 +  base::TimeDelta uptime = base::TimeTicks::Now() - last_launch_time_;
 +  if (uptime < kStartupGracePeriod) {
++    if (!handoff_exe_.empty()) {
++      OnHandoffStartupFailure(exit_code);
++    }
 +    consecutive_startup_failures_++;
 +    LOG(WARNING) << "browseros: Startup failure detected (uptime: "
 +                 << uptime.InSeconds() << "s, consecutive failures: "
@@ -754,6 +1209,7 @@ index 0000000000000..0070cd46351f6
 +    }
 +  } else {
 +    consecutive_startup_failures_ = 0;
++    handoff_startup_failures_ = 0;
 +  }
 +
 +  if (is_restarting_) {
@@ -766,6 +1222,28 @@ index 0000000000000..0070cd46351f6
 +  RestartBrowserOSProcess();
 +}
 +
++void BrowserOSServerManager::OnHandoffStartupFailure(int exit_code) {
++  // An early crash alone says nothing about the sockets; the server's own
++  // report, or crashing on every launch that is handed them, does.
++  handoff_startup_failures_++;
++  if (exit_code != kListenFdsAdoptFailedExitCode &&
++      handoff_startup_failures_ < kMaxHandoffStartupFailures) {
++    return;
++  }
++
++  LOG(WARNING) << "browseros: Server "
++               << (exit_code == kListenFdsAdoptFailedExitCode
++                       ? "could not adopt its pre-bound sockets"
++                       : "keeps exiting during startup with pre-bound sockets")
++               << ", letting it bind ports itself";
++  if (local_state_) {
++    local_state_->SetString(browseros_server::kSocketHandoffUnsupportedExe,
++                            handoff_exe_.AsUTF8Unsafe());
++  }
++  handoff_exe_.clear();
++  handoff_startup_failures_ = 0;
++}
++
 +void BrowserOSServerManager::CheckServerHealth() {
 +  if (!is_running_) {
 +    return;
@@ -778,7 +1256,7 @@ index 0000000000000..0070cd46351f6
 +}
 +
 +void BrowserOSServerManager::CheckProcessStatus() {
-+  if (!is_running_ || !process_.IsValid() || is_restarting_) {
++  if (!is_running_ || !process_.IsValid()) {
 +    return;
 +  }
 +
@@ -809,6 +1287,7 @@ index 0000000000000..0070cd46351f6
 +
 +void BrowserOSServerManager::RestartBrowserOSProcess() {
 +  LOG(INFO) << "browseros: Restarting BrowserOS server process";
++  TRACE_EVENT_INSTANT("browseros", "BrowserOSServerManager::Restart");
 +
 +  if (is_restarting_) {
 +    LOG(INFO) << "browseros: Restart already in progress, ignoring";
@@ -816,69 +1295,64 @@ index 0000000000000..0070cd46351f6
 +  }
 +  is_restarting_ = true;
 +
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  if (CanRestartWithStandby()) {
++    StartStandbyProcess();
++    return;
++  }
 +
++  StopLivenessMonitoring();
 +  TerminateBrowserOSProcess(
 +      base::BindOnce(&BrowserOSServerManager::ContinueRestartAfterTerminate,
 +                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSServerManager::ContinueRestartAfterTerminate() {
-+  base::ThreadPool::PostTaskAndReply(
-+      FROM_HERE,
-+      {base::MayBlock(), base::WithBaseSyncPrimitives(),
-+       base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(
-+          [](BrowserOSServerManager* manager) {
-+            constexpr base::TimeDelta kExitTimeout = base::Seconds(5);
-+            int exit_code = 0;
-+            bool exited = manager->process_controller_->WaitForExitWithTimeout(
-+                &manager->process_, kExitTimeout, &exit_code);
-+
-+            if (!exited) {
-+              LOG(WARNING) << "browseros: Process didn't exit in time, "
-+                           << "sending SIGKILL";
-+              manager->process_controller_->Terminate(&manager->process_,
-+                                                      /*wait=*/true);
-+            }
-+          },
-+          base::Unretained(this)),
-+      base::BindOnce(
-+          [](base::WeakPtr<BrowserOSServerManager> weak_manager) {
-+            if (!weak_manager) {
-+              return;
-+            }
-+            auto* manager = weak_manager.get();
-+
-+            // Pick new ephemeral ports for server and extension
-+            // (unless CLI-overridden)
-+            base::CommandLine* cl =
-+                base::CommandLine::ForCurrentProcess();
-+            std::set<int> assigned;
-+            assigned.insert(manager->ports_.cdp);
-+            assigned.insert(manager->ports_.proxy);
-+
-+            if (!cl->HasSwitch(browseros::kServerPort)) {
-+              manager->ports_.server =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultServerPort, assigned);
-+            }
-+            assigned.insert(manager->ports_.server);
++  if (!process_.IsValid()) {
++    RelaunchOnNewPorts();
++    return;
++  }
 +
-+            if (!cl->HasSwitch(browseros::kExtensionPort)) {
-+              manager->ports_.extension =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultExtensionPort, assigned);
-+            }
++  // The server has been asked to exit over HTTP (or SIGKILLed if that
++  // failed); give it a few seconds before forcing it.
++  constexpr base::TimeDelta kExitTimeout = base::Seconds(5);
++  process_controller_->TerminateAsync(
++      process_.Duplicate(), TerminationMode::kAwaitExit, kExitTimeout,
++      base::BindOnce(&BrowserOSServerManager::OnTerminatedForRestart,
++                     weak_factory_.GetWeakPtr()));
++}
 +
-+            LOG(INFO) << "browseros: New ephemeral ports - "
-+                      << manager->ports_.DebugString();
++void BrowserOSServerManager::OnTerminatedForRestart(TerminationResult result) {
++  RecordTermination(result);
++  RelaunchOnNewPorts();
++}
 +
-+            manager->SavePortsToPrefs();
-+            manager->LaunchBrowserOSProcess();
-+          },
-+          weak_factory_.GetWeakPtr()));
++void BrowserOSServerManager::RelaunchOnNewPorts() {
++  // Pick new ephemeral ports for server and extension
++  // (unless CLI-overridden)
++  AssignServerPorts(&ports_, {ports_.cdp, ports_.proxy});
++
++  LOG(INFO) << "browseros: New ephemeral ports - " << ports_.DebugString();
++
++  SavePortsToPrefs();
++  LaunchBrowserOSProcess();
++}
++
++void BrowserOSServerManager::RecordTermination(TerminationResult result) {
++  termination_stats_.count++;
++  if (result.killed) {
++    termination_stats_.killed++;
++  }
++  if (!result.exited) {
++    termination_stats_.failed++;
++  }
++  termination_stats_.last_latency = result.latency;
++  termination_stats_.max_latency =
++      std::max(termination_stats_.max_latency, result.latency);
++
++  LOG(INFO) << "browseros: Server process "
++            << (result.exited ? "exited" : "survived termination") << " after "
++            << result.latency.InMilliseconds() << "ms"
++            << (result.killed ? " (SIGKILL)" : "");
 +}
 +
 +void BrowserOSServerManager::RestartServerForUpdate(
@@ -895,64 +1369,237 @@ index 0000000000000..0070cd46351f6
 +  update_complete_callback_ = std::move(callback);
 +
 +  is_restarting_ = true;
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
 +
++  if (CanRestartWithStandby()) {
++    StartStandbyProcess();
++    return;
++  }
++
++  StopLivenessMonitoring();
++  TerminateBrowserOSProcess(
++      base::BindOnce(&BrowserOSServerManager::ContinueRestartAfterTerminate,
++                     weak_factory_.GetWeakPtr()));
++}
++
++bool BrowserOSServerManager::CanRestartWithStandby() const {
++  // Nothing is serving, so there is nothing to keep up during the restart.
++  if (!process_.IsValid()) {
++    return false;
++  }
++
++  // Pinned ports cannot be shared by two servers at once.
++  base::CommandLine* cl = base::CommandLine::ForCurrentProcess();
++  return !cl->HasSwitch(browseros::kServerPort) &&
++         !cl->HasSwitch(browseros::kExtensionPort);
++}
++
++void BrowserOSServerManager::StartStandbyProcess() {
++  restarting_with_standby_ = true;
++
++  // Fresh ports, away from the ones the current server keeps serving on.
++  ServerPorts ports = ports_;
++  AssignServerPorts(&ports, {ports_.cdp, ports_.proxy, ports_.server,
++                             ports_.extension});
++
++  ServerLaunchConfig config = BuildLaunchConfig();
++  if (config.paths.execution.empty()) {
++    LOG(ERROR) << "browseros: Failed to resolve execution directory";
++    AbortStandbyProcess();
++    return;
++  }
++  config.ports = ports;
++  config.sockets = GetUnixSockets(ports.server);
++  std::vector<base::ScopedFD> listen_fds =
++      ClaimServerPorts(&config, {ports_.server, ports_.extension});
++  ports = config.ports;
++
++  LOG(INFO) << "browseros: Launching standby server - " << config.DebugString();
++
++  ProcessController* pc = process_controller_.get();
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&ProcessController::Launch, base::Unretained(pc), config),
++      base::BindOnce(&BrowserOSServerManager::OnStandbyLaunched,
++                     weak_factory_.GetWeakPtr(), ports)
++          .Then(base::DoNothingWithBoundArgs(std::move(listen_fds))));
++}
++
++void BrowserOSServerManager::OnStandbyLaunched(ServerPorts ports,
++                                               LaunchResult result) {
++  if (result.used_fallback && updater_) {
++    updater_->InvalidateDownloadedVersion();
++  }
++
++  if (!is_running_ || !restarting_with_standby_) {
++    if (result.process.IsValid()) {
++      KillInBackground(std::move(result.process));
++    }
++    return;
++  }
++
++  if (!result.process.IsValid()) {
++    LOG(ERROR) << "browseros: Failed to launch standby server";
++    AbortStandbyProcess();
++    return;
++  }
++
++  standby_process_ = std::move(result.process);
++  standby_ports_ = ports;
++  standby_deadline_ = base::TimeTicks::Now() + kStandbyReadyTimeout;
++
++  LOG(INFO) << "browseros: Standby server started with PID: "
++            << standby_process_.Pid() << ", waiting for health";
++  CheckStandbyHealth();
++}
++
++void BrowserOSServerManager::CheckStandbyHealth() {
++  int exit_code = 0;
++  if (standby_process_.WaitForExitWithTimeout(base::TimeDelta(), &exit_code)) {
++    LOG(ERROR) << "browseros: Standby server exited with code " << exit_code;
++    standby_process_ = base::Process();
++    AbortStandbyProcess();
++    return;
++  }
++
++  health_checker_->CheckHealth(
++      standby_ports_.server,
++      base::BindOnce(&BrowserOSServerManager::OnStandbyHealthCheckComplete,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnStandbyHealthCheckComplete(bool success) {
++  if (!standby_process_.IsValid()) {
++    return;
++  }
++
++  if (success) {
++    PromoteStandbyProcess();
++    return;
++  }
++
++  if (base::TimeTicks::Now() >= standby_deadline_) {
++    LOG(ERROR) << "browseros: Standby server not healthy after "
++               << kStandbyReadyTimeout.InSeconds() << "s";
++    AbortStandbyProcess();
++    return;
++  }
++
++  standby_health_timer_.Start(FROM_HERE, kStandbyHealthPollInterval, this,
++                              &BrowserOSServerManager::CheckStandbyHealth);
++}
++
++void BrowserOSServerManager::PromoteStandbyProcess() {
++  TRACE_EVENT("browseros", "BrowserOSServerManager::PromoteStandbyProcess");
++  LOG(INFO) << "browseros: Standby server healthy, switching proxy from port "
++            << ports_.server << " to " << standby_ports_.server;
++
++  restarting_with_standby_ = false;
++  base::Process old_process = std::move(process_);
++  int old_port = ports_.server;
++
++  ports_ = standby_ports_;
++  SavePortsToPrefs();
++
++  // Flips the proxy backend and the liveness monitor; requests already in
++  // flight stay on the old server.
++  ActivateProcess(std::move(standby_process_));
++  if (old_process.IsValid()) {
++    DrainProcess(std::move(old_process), old_port);
++  }
++}
++
++void BrowserOSServerManager::AbortStandbyProcess() {
++  restarting_with_standby_ = false;
++  standby_health_timer_.Stop();
++  if (standby_process_.IsValid()) {
++    KillInBackground(std::move(standby_process_));
++  }
++
++  // Still monitored, so nothing to restart.
++  if (is_updating_ && process_.IsValid()) {
++    LOG(WARNING) << "browseros: Standby failed, keeping current server";
++    is_updating_ = false;
++    is_restarting_ = false;
++    if (update_complete_callback_) {
++      std::move(update_complete_callback_).Run(false);
++    }
++    return;
++  }
++
++  LOG(WARNING) << "browseros: Standby failed, restarting in place";
++  StopLivenessMonitoring();
 +  TerminateBrowserOSProcess(
-+      base::BindOnce(&BrowserOSServerManager::ContinueUpdateAfterTerminate,
++      base::BindOnce(&BrowserOSServerManager::ContinueRestartAfterTerminate,
 +                     weak_factory_.GetWeakPtr()));
 +}
 +
-+void BrowserOSServerManager::ContinueUpdateAfterTerminate() {
-+  base::ThreadPool::PostTaskAndReply(
++void BrowserOSServerManager::DrainProcess(base::Process process, int port) {
++  // Only one previous server drains at a time.
++  FinishDraining();
++
++  draining_process_ = std::move(process);
++  draining_port_ = port;
++  drain_timeout_timer_.Start(FROM_HERE, kDrainTimeout, this,
++                             &BrowserOSServerManager::FinishDraining);
++
++  if (!server_proxy_) {
++    FinishDraining();
++    return;
++  }
++
++  // Posted after the backend switch, so no new requests reach |port|.
++  content::GetIOThreadTaskRunner({})->PostTask(
 +      FROM_HERE,
-+      {base::MayBlock(), base::WithBaseSyncPrimitives(),
-+       base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(
-+          [](BrowserOSServerManager* manager) {
-+            constexpr base::TimeDelta kExitTimeout = base::Seconds(5);
-+            int exit_code = 0;
-+            bool exited = manager->process_controller_->WaitForExitWithTimeout(
-+                &manager->process_, kExitTimeout, &exit_code);
-+
-+            if (!exited) {
-+              LOG(WARNING) << "browseros: Process didn't exit for update, "
-+                           << "sending SIGKILL";
-+              manager->process_controller_->Terminate(&manager->process_,
-+                                                      /*wait=*/true);
-+            }
-+          },
-+          base::Unretained(this)),
 +      base::BindOnce(
-+          [](base::WeakPtr<BrowserOSServerManager> weak_manager) {
-+            if (!weak_manager) {
-+              return;
-+            }
-+            auto* manager = weak_manager.get();
-+
-+            base::CommandLine* cl =
-+                base::CommandLine::ForCurrentProcess();
-+            std::set<int> assigned;
-+            assigned.insert(manager->ports_.cdp);
-+            assigned.insert(manager->ports_.proxy);
-+
-+            if (!cl->HasSwitch(browseros::kServerPort)) {
-+              manager->ports_.server =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultServerPort, assigned);
-+            }
-+            assigned.insert(manager->ports_.server);
++          &BrowserOSServerProxy::NotifyWhenDrained,
++          base::Unretained(server_proxy_.get()), port,
++          base::BindPostTaskToCurrentDefault(
++              base::BindOnce(&BrowserOSServerManager::OnBackendDrained,
++                             weak_factory_.GetWeakPtr(), port))));
++}
 +
-+            if (!cl->HasSwitch(browseros::kExtensionPort)) {
-+              manager->ports_.extension =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultExtensionPort, assigned);
-+            }
++void BrowserOSServerManager::OnBackendDrained(int port) {
++  if (draining_port_ == port) {
++    FinishDraining();
++  }
++}
 +
-+            manager->SavePortsToPrefs();
-+            manager->LaunchBrowserOSProcess();
-+          },
-+          weak_factory_.GetWeakPtr()));
++void BrowserOSServerManager::FinishDraining() {
++  drain_timeout_timer_.Stop();
++  if (!draining_process_.IsValid()) {
++    return;
++  }
++
++  LOG(INFO) << "browseros: Stopping previous server (PID: "
++            << draining_process_.Pid() << ", port: " << draining_port_ << ")";
++  int port = draining_port_;
++  draining_port_ = 0;
++  health_checker_->RequestShutdown(
++      port, base::BindOnce(&BrowserOSServerManager::OnDrainedShutdownRequested,
++                           weak_factory_.GetWeakPtr(),
++                           std::move(draining_process_)));
++}
++
++void BrowserOSServerManager::OnDrainedShutdownRequested(base::Process process,
++                                                        bool http_success) {
++  constexpr base::TimeDelta kExitTimeout = base::Seconds(5);
++  if (!http_success) {
++    LOG(WARNING) << "browseros: Previous server didn't take the shutdown "
++                 << "request, sending SIGKILL";
++  }
++  process_controller_->TerminateAsync(
++      std::move(process), TerminationMode::kAwaitExit,
++      http_success ? kExitTimeout : base::TimeDelta(),
++      base::BindOnce(&BrowserOSServerManager::RecordTermination,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::KillInBackground(base::Process process) {
++  process_controller_->TerminateAsync(
++      std::move(process), TerminationMode::kGraceful, base::TimeDelta(),
++      base::BindOnce(&BrowserOSServerManager::RecordTermination,
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSServerManager::OnAllowRemoteInMCPChanged() {
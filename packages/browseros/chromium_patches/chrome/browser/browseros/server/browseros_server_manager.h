@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.h b/chrome/browser/browseros/server/browseros_server_manager.h
 new file mode 100644
-index 0000000000000..241343e436f94
+index 0000000000000..1fe189f11a4d9
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.h
-@@ -0,0 +1,158 @@
+@@ -0,0 +1,284 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,16 +13,21 @@ index 0000000000000..241343e436f94
 +
 +#include <memory>
 +#include <set>
++#include <vector>
 +
 +#include "base/files/file.h"
 +#include "base/files/file_path.h"
++#include "base/files/scoped_file.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/no_destructor.h"
 +#include "base/process/process.h"
 +#include "base/timer/timer.h"
++#include "base/values.h"
 +#include "chrome/browser/browseros/server/browseros_server_config.h"
++#include "chrome/browser/browseros/server/liveness_monitor.h"
 +#include "chrome/browser/browseros/server/process_controller.h"
++#include "chrome/browser/browseros/server/startup_timeline.h"
 +
 +class PrefChangeRegistrar;
 +class PrefService;
@@ -34,6 +39,7 @@ index 0000000000000..241343e436f94
 +namespace browseros {
 +class BrowserOSServerProxy;
 +class HealthChecker;
++class LivenessMonitor;
 +class ProcessController;
 +class ServerStateStore;
 +class ServerUpdater;
@@ -46,7 +52,12 @@ index 0000000000000..241343e436f94
 +// 1. Starts Chromium's CDP WebSocket server
 +// 2. Binds a stable MCP proxy port that forwards /mcp to the sidecar
 +// 3. Launches the bundled BrowserOS server binary with ephemeral backend ports
-+// 4. Monitors server health via HTTP /health endpoint and auto-restarts
++// 4. Watches the server for exit (pidfd, falling back to polling) and for
++//    hangs (periodic HTTP /health checks), and auto-restarts
++// 5. Restarts and updates blue/green: a standby server is launched on fresh
++//    ports and the proxy switches to it once healthy, then the old server
++//    is drained and stopped
++
 +class BrowserOSServerManager {
 + public:
 +  // Production singleton (uses real implementations)
@@ -56,6 +67,7 @@ index 0000000000000..241343e436f94
 +  BrowserOSServerManager(std::unique_ptr<ProcessController> process_controller,
 +                         std::unique_ptr<ServerStateStore> state_store,
 +                         std::unique_ptr<HealthChecker> health_checker,
++                         std::unique_ptr<LivenessMonitor> liveness_monitor,
 +                         std::unique_ptr<ServerUpdater> updater,
 +                         PrefService* local_state);
 +
@@ -83,6 +95,27 @@ index 0000000000000..241343e436f94
 +  // Health check result handler (public for testing)
 +  void OnHealthCheckComplete(bool success);
 +
++  // Phases of the most recent Start() up to the first healthy response; see
++  // StartupTimeline::ToValue(). Also persisted to startup_timeline.json in
++  // the execution directory.
++  base::Value::Dict GetStartupTimeline() const;
++  const StartupTimeline& startup_timeline() const { return startup_timeline_; }
++
++  // Adds a phase timed outside the manager, e.g. by the updater.
++  void RecordStartupPhase(const char* name,
++                          base::TimeTicks start,
++                          base::TimeDelta duration);
++
++  // Server, standby and orphan terminations since startup.
++  const TerminationStats& GetTerminationStats() const {
++    return termination_stats_;
++  }
++
++  // Reports the MCP proxy's per-method metrics (see
++  // BrowserOSServerProxy::GetMetricsSnapshot). Empty if the proxy isn't
++  // running.
++  void GetProxyMetrics(base::OnceCallback<void(base::Value::Dict)> callback);
++
 +  void SetRunningForTesting(bool running) { is_running_ = running; }
 +
 +  base::FilePath GetBrowserOSServerExecutablePath() const;
@@ -98,7 +131,9 @@ index 0000000000000..241343e436f94
 +  ~BrowserOSServerManager();
 +
 +  bool AcquireLock();
-+  bool RecoverFromOrphan();
++  void RecoverFromOrphan(base::OnceClosure done);
++  void OnOrphanTerminated(base::OnceClosure done, TerminationResult result);
++  void ContinueStartup();
 +
 +  void LoadPortsFromPrefs();
 +  void SetupPrefObservers();
@@ -112,8 +147,47 @@ index 0000000000000..241343e436f94
 +
 +  ServerLaunchConfig BuildLaunchConfig();
 +
++  // Unix socket transport. SetUpUnixSocketDir() leaves |unix_socket_dir_|
++  // empty when the transport is off or unusable.
++  void SetUpUnixSocketDir();
++  void CleanUpUnixSocketDir();
++  ServerSockets GetUnixSockets(int server_port) const;
++
++  // Binds the server and extension ports in the browser so nothing can take
++  // them before the server starts, skipping |excluded|; the returned fds
++  // must stay open until the launch completes. May move |config| to
++  // different ports.
++  std::vector<base::ScopedFD> ClaimServerPorts(ServerLaunchConfig* config,
++                                               std::set<int> excluded);
++  bool IsSocketHandoffSupported(const base::FilePath& exe) const;
++  // Whether the next launch is expected to be handed pre-bound sockets.
++  bool WillHandOffSockets() const;
++  // Picks server and extension ports for the next launch outside
++  // |excluded|, keeping pinned ones. Ports that will be handed off are set
++  // to the defaults unprobed; ClaimServerPorts() binds them at launch.
++  void AssignServerPorts(ServerPorts* ports, std::set<int> excluded) const;
++
 +  void LaunchBrowserOSProcess();
 +  void OnProcessLaunched(LaunchResult result);
++  void ActivateProcess(base::Process process);
++
++  // Blue/green restart. Falls back to stop-then-launch when no server is
++  // running or ports are pinned on the command line. The serving process
++  // stays monitored until the standby replaces it; if it exits or hangs
++  // meanwhile, the standby takes over as soon as it is healthy.
++  bool CanRestartWithStandby() const;
++  void StartStandbyProcess();
++  void OnStandbyLaunched(ServerPorts ports, LaunchResult result);
++  void CheckStandbyHealth();
++  void OnStandbyHealthCheckComplete(bool success);
++  void PromoteStandbyProcess();
++  void AbortStandbyProcess();
++
++  void DrainProcess(base::Process process, int port);
++  void OnBackendDrained(int port);
++  void FinishDraining();
++  void OnDrainedShutdownRequested(base::Process process, bool http_success);
++  void KillInBackground(base::Process process);
 +
 +  void TerminateBrowserOSProcess(base::OnceCallback<void()> callback);
 +  void OnTerminateHttpComplete(base::OnceCallback<void()> callback,
@@ -121,9 +195,29 @@ index 0000000000000..241343e436f94
 +
 +  void RestartBrowserOSProcess();
 +  void ContinueRestartAfterTerminate();
-+  void ContinueUpdateAfterTerminate();
-+
++  void OnTerminatedForRestart(TerminationResult result);
++  void RelaunchOnNewPorts();
++  void RecordTermination(TerminationResult result);
++
++  void StartLivenessMonitoring();
++  void StopLivenessMonitoring();
++  // Stops the periodic checks and drops pending liveness signals of the
++  // current process.
++  void IgnoreLivenessSignals();
++  void CheckStartupReadiness();
++  void OnStartupReadinessChecked(bool healthy);
++  void OnServerReady();
++  void PersistStartupTimeline();
++  // Deferred by BrowserOSStartupScheduler once the server is first healthy.
++  void StartUpdater();
++
++  // Reaps the process the monitor reported as exited, then handles the
++  // exit. The monitor never reaps, so |process_| stays the only waiter.
++  void OnProcessExitSignaled(int exit_code);
 +  void OnProcessExited(int exit_code);
++  // Disables socket handoff for |handoff_exe_| if the server reported that
++  // it could not adopt the sockets, or after repeated startup failures.
++  void OnHandoffStartupFailure(int exit_code);
 +  void CheckServerHealth();
 +  void OnAllowRemoteInMCPChanged();
 +  void OnRestartServerRequestedChanged();
@@ -134,6 +228,7 @@ index 0000000000000..241343e436f94
 +  std::unique_ptr<ProcessController> process_controller_;
 +  std::unique_ptr<ServerStateStore> state_store_;
 +  std::unique_ptr<HealthChecker> health_checker_;
++  std::unique_ptr<LivenessMonitor> liveness_monitor_;
 +  std::unique_ptr<BrowserOSServerProxy> server_proxy_;
 +
 +  raw_ptr<PrefService> local_state_ = nullptr;
@@ -141,21 +236,52 @@ index 0000000000000..241343e436f94
 +  base::File lock_file_;
 +  base::Process process_;
 +  ServerPorts ports_;
++  base::FilePath unix_socket_dir_;
 +  bool allow_remote_in_mcp_ = false;
 +  bool is_running_ = false;
++  // Set while startup waits for an orphaned server to exit.
++  bool start_pending_ = false;
 +  bool is_restarting_ = false;
 +  bool is_updating_ = false;
 +  UpdateCompleteCallback update_complete_callback_;
 +
++  // Server being brought up by a blue/green restart.
++  bool restarting_with_standby_ = false;
++  base::Process standby_process_;
++  ServerPorts standby_ports_;
++  base::TimeTicks standby_deadline_;
++  base::OneShotTimer standby_health_timer_;
++
++  // Previous server finishing in-flight requests after a switch.
++  base::Process draining_process_;
++  int draining_port_ = 0;
++  base::OneShotTimer drain_timeout_timer_;
++
++  // Binary of the last launch that was handed pre-bound sockets; empty if
++  // the last launch had none.
++  base::FilePath handoff_exe_;
++
++  TerminationStats termination_stats_;
++
++  StartupTimeline startup_timeline_;
++  base::OneShotTimer startup_ready_timer_;
++
 +  int consecutive_startup_failures_ = 0;
++  // Consecutive startup failures of launches with pre-bound sockets.
++  int handoff_startup_failures_ = 0;
 +  base::TimeTicks last_launch_time_;
 +
++  // The health check detects hangs; the process check runs only where exit
++  // cannot be pushed.
 +  base::RepeatingTimer health_check_timer_;
 +  base::RepeatingTimer process_check_timer_;
 +
 +  std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
 +  std::unique_ptr<ServerUpdater> updater_;
 +
++  // Binds the liveness callbacks of the monitored process; invalidated when
++  // monitoring stops.
++  base::WeakPtrFactory<BrowserOSServerManager> liveness_weak_factory_{this};
 +  base::WeakPtrFactory<BrowserOSServerManager> weak_factory_{this};
 +};
 +
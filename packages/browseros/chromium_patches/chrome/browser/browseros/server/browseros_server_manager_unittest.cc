@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager_unittest.cc b/chrome/browser/browseros/server/browseros_server_manager_unittest.cc
 new file mode 100644
-index 0000000000000..8f97e0b97467f
+index 0000000000000..72aa0ece6644e
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager_unittest.cc
-@@ -0,0 +1,497 @@
+@@ -0,0 +1,854 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,14 +11,18 @@ index 0000000000000..8f97e0b97467f
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +
 +#include <memory>
++#include <vector>
 +
 +#include "base/command_line.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/test/scoped_command_line.h"
 +#include "base/test/task_environment.h"
++#include "build/build_config.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/server/browseros_server_config.h"
 +#include "chrome/browser/browseros/server/browseros_server_prefs.h"
 +#include "chrome/browser/browseros/server/test/mock_health_checker.h"
++#include "chrome/browser/browseros/server/test/mock_liveness_monitor.h"
 +#include "chrome/browser/browseros/server/test/mock_process_controller.h"
 +#include "chrome/browser/browseros/server/test/mock_server_state_store.h"
 +#include "chrome/browser/browseros/server/test/mock_server_updater.h"
@@ -45,18 +49,29 @@ index 0000000000000..8f97e0b97467f
 +        std::make_unique<NiceMock<MockProcessController>>();
 +    auto state_store = std::make_unique<NiceMock<MockServerStateStore>>();
 +    auto health_checker = std::make_unique<NiceMock<MockHealthChecker>>();
++    auto liveness_monitor =
++        std::make_unique<NiceMock<MockLivenessMonitor>>();
 +    auto updater = std::make_unique<NiceMock<MockServerUpdater>>();
 +
 +    process_controller_ = process_controller.get();
 +    state_store_ = state_store.get();
 +    health_checker_ = health_checker.get();
++    liveness_monitor_ = liveness_monitor.get();
 +    updater_ = updater.get();
 +
 +    testing::Mock::AllowLeak(process_controller_);
 +    testing::Mock::AllowLeak(state_store_);
 +    testing::Mock::AllowLeak(health_checker_);
++    testing::Mock::AllowLeak(liveness_monitor_);
 +    testing::Mock::AllowLeak(updater_);
 +
++    ON_CALL(*process_controller_, TerminateAsync(_, _, _, _))
++        .WillByDefault([](base::Process, TerminationMode, base::TimeDelta,
++                          TerminationCallback callback) {
++          TerminationResult result;
++          result.exited = true;
++          std::move(callback).Run(result);
++        });
 +    ON_CALL(*updater_, GetBestServerBinaryPath())
 +        .WillByDefault(Return(base::FilePath("/fake/path/browseros_server")));
 +    ON_CALL(*updater_, GetBestServerResourcesPath())
@@ -64,7 +79,8 @@ index 0000000000000..8f97e0b97467f
 +
 +    manager_ = new BrowserOSServerManager(
 +        std::move(process_controller), std::move(state_store),
-+        std::move(health_checker), std::move(updater), &prefs_);
++        std::move(health_checker), std::move(liveness_monitor),
++        std::move(updater), &prefs_);
 +  }
 +
 +  void TearDown() override {
@@ -99,6 +115,7 @@ index 0000000000000..8f97e0b97467f
 +  raw_ptr<MockProcessController> process_controller_ = nullptr;
 +  raw_ptr<MockServerStateStore> state_store_ = nullptr;
 +  raw_ptr<MockHealthChecker> health_checker_ = nullptr;
++  raw_ptr<MockLivenessMonitor> liveness_monitor_ = nullptr;
 +  raw_ptr<MockServerUpdater> updater_ = nullptr;
 +
 +  raw_ptr<BrowserOSServerManager> manager_ = nullptr;
@@ -134,6 +151,337 @@ index 0000000000000..8f97e0b97467f
 +}
 +
 +// =============================================================================
++// Liveness Monitor Tests
++// =============================================================================
++
++TEST_F(BrowserOSServerManagerTest, PushedExit_TriggersRestart) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++
++  LivenessMonitor::ExitCallback on_exited;
++  EXPECT_CALL(*liveness_monitor_, Start(_, _))
++      .WillOnce([&on_exited](const base::Process&,
++                             LivenessMonitor::ExitCallback callback) {
++        on_exited = std::move(callback);
++        return true;
++      })
++      .WillRepeatedly(Return(true));
++
++  // Restart launches a process and starts the monitor
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(on_exited);
++
++  // A crash pushed by the monitor triggers one more launch
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(1);
++  std::move(on_exited).Run(1);
++  task_environment_.RunUntilIdle();
++}
++
++TEST_F(BrowserOSServerManagerTest, PushedUnknownExit_TriggersRestart) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++
++  LivenessMonitor::ExitCallback on_exited;
++  EXPECT_CALL(*liveness_monitor_, Start(_, _))
++      .WillOnce([&on_exited](const base::Process&,
++                             LivenessMonitor::ExitCallback callback) {
++        on_exited = std::move(callback);
++        return true;
++      })
++      .WillRepeatedly(Return(true));
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(on_exited);
++
++  // A lost exit status is a crash, not a clean exit
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(1);
++  std::move(on_exited).Run(kUnknownExitCode);
++  task_environment_.RunUntilIdle();
++}
++
++TEST_F(BrowserOSServerManagerTest, ReplacedProcessExit_IsIgnored) {
++  // A pinned port rules out blue/green, so a restart is one stop and one
++  // launch
++  base::test::ScopedCommandLine scoped_command_line;
++  scoped_command_line.GetProcessCommandLine()->AppendSwitchASCII(
++      browseros::kServerPort, "9250");
++
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*health_checker_, RequestShutdown(_, _))
++      .WillByDefault([](int port, base::OnceCallback<void(bool)> callback) {
++        std::move(callback).Run(true);
++      });
++
++  std::vector<LivenessMonitor::ExitCallback> monitored;
++  ON_CALL(*liveness_monitor_, Start(_, _))
++      .WillByDefault([&monitored](const base::Process&,
++                                  LivenessMonitor::ExitCallback callback) {
++        monitored.push_back(std::move(callback));
++        return true;
++      });
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_EQ(2u, monitored.size());
++
++  // The replaced process reporting its exit later leaves its successor alone
++  EXPECT_CALL(*process_controller_, TerminateAsync(_, _, _, _)).Times(0);
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(0);
++  std::move(monitored[0]).Run(1);
++  task_environment_.RunUntilIdle();
++  EXPECT_TRUE(manager_->IsRunning());
++}
++
++TEST_F(BrowserOSServerManagerTest, ColdRestart_RelaunchesOnceTerminated) {
++  base::test::ScopedCommandLine scoped_command_line;
++  scoped_command_line.GetProcessCommandLine()->AppendSwitchASCII(
++      browseros::kServerPort, "9250");
++
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*health_checker_, RequestShutdown(_, _))
++      .WillByDefault([](int port, base::OnceCallback<void(bool)> callback) {
++        std::move(callback).Run(true);
++      });
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(manager_->IsRunning());
++
++  // A pinned port rules out blue/green, so the server is stopped first
++  TerminationCallback terminated;
++  EXPECT_CALL(*process_controller_,
++              TerminateAsync(_, TerminationMode::kAwaitExit, _, _))
++      .WillOnce([&terminated](base::Process, TerminationMode,
++                              base::TimeDelta, TerminationCallback callback) {
++        terminated = std::move(callback);
++      });
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(0);
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(terminated);
++  testing::Mock::VerifyAndClearExpectations(process_controller_);
++
++  // Relaunch happens as soon as the exit is reported, not after a timeout
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(1);
++  TerminationResult result;
++  result.exited = true;
++  result.killed = true;
++  result.latency = base::Milliseconds(40);
++  std::move(terminated).Run(result);
++  task_environment_.RunUntilIdle();
++
++  EXPECT_EQ(1, manager_->GetTerminationStats().count);
++  EXPECT_EQ(1, manager_->GetTerminationStats().killed);
++  EXPECT_EQ(base::Milliseconds(40),
++            manager_->GetTerminationStats().last_latency);
++}
++
++// =============================================================================
++// Socket Handoff Tests
++// =============================================================================
++
++#if BUILDFLAG(IS_POSIX)
++class BrowserOSServerManagerHandoffTest : public BrowserOSServerManagerTest {
++ protected:
++  void SetUp() override {
++    BrowserOSServerManagerTest::SetUp();
++
++    ON_CALL(*process_controller_, Launch(_))
++        .WillByDefault([this](const ServerLaunchConfig& config) {
++          handed_sockets_.push_back(config.server_listen_fd >= 0);
++          LaunchResult result;
++          result.process = base::Process::Current();
++          return result;
++        });
++    ON_CALL(*liveness_monitor_, Start(_, _))
++        .WillByDefault(
++            [this](const base::Process&,
++                   LivenessMonitor::ExitCallback callback) {
++              monitored_ = std::move(callback);
++              return true;
++            });
++
++    manager_->SetRunningForTesting(true);
++    manager_->OnHealthCheckComplete(false);
++    task_environment_.RunUntilIdle();
++  }
++
++  // Reports an exit of the running server, as the monitor would, and lets
++  // the manager relaunch it.
++  void ExitDuringStartup(int exit_code) {
++    ASSERT_TRUE(monitored_);
++    std::move(monitored_).Run(exit_code);
++    task_environment_.RunUntilIdle();
++  }
++
++  bool IsHandoffDisabled() const {
++    return !prefs_.GetString(browseros_server::kSocketHandoffUnsupportedExe)
++                .empty();
++  }
++
++  std::vector<bool> handed_sockets_;
++  LivenessMonitor::ExitCallback monitored_;
++};
++
++TEST_F(BrowserOSServerManagerHandoffTest, PlainCrashKeepsSocketHandoff) {
++  ASSERT_EQ(std::vector<bool>({true}), handed_sockets_);
++
++  ExitDuringStartup(1);
++
++  EXPECT_FALSE(IsHandoffDisabled());
++  EXPECT_EQ(std::vector<bool>({true, true}), handed_sockets_);
++}
++
++TEST_F(BrowserOSServerManagerHandoffTest, AdoptFailureDisablesSocketHandoff) {
++  ExitDuringStartup(kListenFdsAdoptFailedExitCode);
++
++  EXPECT_EQ("/fake/path/browseros_server",
++            prefs_.GetString(browseros_server::kSocketHandoffUnsupportedExe));
++  EXPECT_EQ(std::vector<bool>({true, false}), handed_sockets_);
++}
++
++TEST_F(BrowserOSServerManagerHandoffTest, RepeatedCrashesDisableHandoff) {
++  ExitDuringStartup(1);
++  ASSERT_FALSE(IsHandoffDisabled());
++  ExitDuringStartup(1);
++
++  EXPECT_TRUE(IsHandoffDisabled());
++  EXPECT_EQ(std::vector<bool>({true, true, false}), handed_sockets_);
++}
++
++TEST_F(BrowserOSServerManagerHandoffTest, CrashAfterStartupIsNotCounted) {
++  ExitDuringStartup(1);
++  task_environment_.FastForwardBy(base::Minutes(1));
++  ExitDuringStartup(1);
++
++  EXPECT_FALSE(IsHandoffDisabled());
++}
++#endif  // BUILDFLAG(IS_POSIX)
++
++// =============================================================================
++// Blue/Green Restart Tests
++// =============================================================================
++
++TEST_F(BrowserOSServerManagerTest, BlueGreenRestart_SwitchesWhenHealthy) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++
++  // Nothing is serving yet, so the first restart launches in place
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(manager_->IsRunning());
++  const int old_port = manager_->GetServerPort();
++
++  base::OnceCallback<void(bool)> standby_health;
++  EXPECT_CALL(*health_checker_, CheckHealth(_, _))
++      .WillOnce([&](int port, base::OnceCallback<void(bool)> callback) {
++        EXPECT_NE(old_port, port);
++        standby_health = std::move(callback);
++      });
++  // The serving process is left alone until the standby is healthy
++  EXPECT_CALL(*process_controller_, Terminate(_, _)).Times(0);
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(standby_health);
++  EXPECT_EQ(old_port, manager_->GetServerPort());
++
++  std::move(standby_health).Run(true);
++  EXPECT_NE(old_port, manager_->GetServerPort());
++  EXPECT_EQ(manager_->GetServerPort(),
++            prefs_.GetInteger(browseros_server::kServerPort));
++  EXPECT_TRUE(manager_->IsRunning());
++}
++
++TEST_F(BrowserOSServerManagerTest, BlueGreenUpdate_KeepsServerOnFailure) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(manager_->IsRunning());
++  const int old_port = manager_->GetServerPort();
++
++  ON_CALL(*health_checker_, CheckHealth(_, _))
++      .WillByDefault([](int port, base::OnceCallback<void(bool)> callback) {
++        std::move(callback).Run(false);
++      });
++
++  // The current server stays monitored throughout
++  EXPECT_CALL(*liveness_monitor_, Stop()).Times(0);
++  EXPECT_CALL(*liveness_monitor_, Start(_, _)).Times(0);
++
++  bool callback_called = false;
++  bool callback_result = true;
++  manager_->RestartServerForUpdate(
++      base::BindOnce([](bool* called, bool* result, bool success) {
++        *called = true;
++        *result = success;
++      }, &callback_called, &callback_result));
++
++  task_environment_.FastForwardBy(base::Seconds(31));
++
++  EXPECT_TRUE(callback_called);
++  EXPECT_FALSE(callback_result);
++  EXPECT_EQ(old_port, manager_->GetServerPort());
++  EXPECT_TRUE(manager_->IsRunning());
++}
++
++TEST_F(BrowserOSServerManagerTest, BlueGreenUpdate_StandbyReplacesCrash) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++
++  std::vector<LivenessMonitor::ExitCallback> monitored;
++  ON_CALL(*liveness_monitor_, Start(_, _))
++      .WillByDefault([&monitored](const base::Process&,
++                                  LivenessMonitor::ExitCallback callback) {
++        monitored.push_back(std::move(callback));
++        return true;
++      });
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  ASSERT_EQ(1u, monitored.size());
++  const int old_port = manager_->GetServerPort();
++
++  base::OnceCallback<void(bool)> standby_health;
++  ON_CALL(*health_checker_, CheckHealth(_, _))
++      .WillByDefault([&](int port, base::OnceCallback<void(bool)> callback) {
++        if (port != old_port) {
++          standby_health = std::move(callback);
++        }
++      });
++
++  bool callback_result = false;
++  manager_->RestartServerForUpdate(base::BindOnce(
++      [](bool* result, bool success) { *result = success; },
++      &callback_result));
++  task_environment_.RunUntilIdle();
++  ASSERT_TRUE(standby_health);
++
++  // A crash of the serving process while the standby starts is still seen,
++  // and the standby replaces it rather than a second launch
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(0);
++  ASSERT_TRUE(monitored[0]);
++  std::move(monitored[0]).Run(1);
++  task_environment_.RunUntilIdle();
++  EXPECT_FALSE(manager_->IsRunning());
++
++  std::move(standby_health).Run(true);
++  EXPECT_TRUE(callback_result);
++  EXPECT_TRUE(manager_->IsRunning());
++  EXPECT_NE(old_port, manager_->GetServerPort());
++  EXPECT_EQ(2u, monitored.size());
++}
++
++// =============================================================================
 +// Updater Integration Tests
 +// =============================================================================
 +
@@ -166,11 +514,13 @@ index 0000000000000..8f97e0b97467f
 +      std::make_unique<NiceMock<MockProcessController>>();
 +  auto state_store = std::make_unique<NiceMock<MockServerStateStore>>();
 +  auto health_checker = std::make_unique<NiceMock<MockHealthChecker>>();
++  auto liveness_monitor = std::make_unique<NiceMock<MockLivenessMonitor>>();
 +  auto updater = std::make_unique<NiceMock<MockServerUpdater>>();
 +
 +  testing::Mock::AllowLeak(process_controller.get());
 +  testing::Mock::AllowLeak(state_store.get());
 +  testing::Mock::AllowLeak(health_checker.get());
++  testing::Mock::AllowLeak(liveness_monitor.get());
 +  testing::Mock::AllowLeak(updater.get());
 +
 +  ON_CALL(*updater, GetBestServerBinaryPath())
@@ -180,7 +530,8 @@ index 0000000000000..8f97e0b97467f
 +
 +  auto* manager = new BrowserOSServerManager(
 +      std::move(process_controller), std::move(state_store),
-+      std::move(health_checker), std::move(updater), &prefs_);
++      std::move(health_checker), std::move(liveness_monitor),
++      std::move(updater), &prefs_);
 +
 +  manager->Shutdown();
 +}
@@ -193,11 +544,13 @@ index 0000000000000..8f97e0b97467f
 +      std::make_unique<NiceMock<MockProcessController>>();
 +  auto state_store = std::make_unique<NiceMock<MockServerStateStore>>();
 +  auto health_checker = std::make_unique<NiceMock<MockHealthChecker>>();
++  auto liveness_monitor = std::make_unique<NiceMock<MockLivenessMonitor>>();
 +  auto updater = std::make_unique<NiceMock<MockServerUpdater>>();
 +
 +  testing::Mock::AllowLeak(process_controller.get());
 +  testing::Mock::AllowLeak(state_store.get());
 +  testing::Mock::AllowLeak(health_checker.get());
++  testing::Mock::AllowLeak(liveness_monitor.get());
 +  testing::Mock::AllowLeak(updater.get());
 +
 +  ON_CALL(*updater, GetBestServerBinaryPath())
@@ -207,7 +560,8 @@ index 0000000000000..8f97e0b97467f
 +
 +  auto* manager = new BrowserOSServerManager(
 +      std::move(process_controller), std::move(state_store),
-+      std::move(health_checker), std::move(updater), &prefs_);
++      std::move(health_checker), std::move(liveness_monitor),
++      std::move(updater), &prefs_);
 +  manager->Shutdown();
 +}
 +
@@ -225,11 +579,13 @@ index 0000000000000..8f97e0b97467f
 +      std::make_unique<NiceMock<MockProcessController>>();
 +  auto state_store = std::make_unique<NiceMock<MockServerStateStore>>();
 +  auto health_checker = std::make_unique<NiceMock<MockHealthChecker>>();
++  auto liveness_monitor = std::make_unique<NiceMock<MockLivenessMonitor>>();
 +  auto updater = std::make_unique<NiceMock<MockServerUpdater>>();
 +
 +  testing::Mock::AllowLeak(process_controller.get());
 +  testing::Mock::AllowLeak(state_store.get());
 +  testing::Mock::AllowLeak(health_checker.get());
++  testing::Mock::AllowLeak(liveness_monitor.get());
 +  testing::Mock::AllowLeak(updater.get());
 +
 +  ON_CALL(*updater, GetBestServerBinaryPath())
@@ -239,7 +595,8 @@ index 0000000000000..8f97e0b97467f
 +
 +  auto* manager = new BrowserOSServerManager(
 +      std::move(process_controller), std::move(state_store),
-+      std::move(health_checker), std::move(updater), &prefs_);
++      std::move(health_checker), std::move(liveness_monitor),
++      std::move(updater), &prefs_);
 +
 +  // Start triggers LoadPortsFromPrefs which migrates
 +  manager->Start();
@@ -260,11 +617,13 @@ index 0000000000000..8f97e0b97467f
 +      std::make_unique<NiceMock<MockProcessController>>();
 +  auto state_store = std::make_unique<NiceMock<MockServerStateStore>>();
 +  auto health_checker = std::make_unique<NiceMock<MockHealthChecker>>();
++  auto liveness_monitor = std::make_unique<NiceMock<MockLivenessMonitor>>();
 +  auto updater = std::make_unique<NiceMock<MockServerUpdater>>();
 +
 +  testing::Mock::AllowLeak(process_controller.get());
 +  testing::Mock::AllowLeak(state_store.get());
 +  testing::Mock::AllowLeak(health_checker.get());
++  testing::Mock::AllowLeak(liveness_monitor.get());
 +  testing::Mock::AllowLeak(updater.get());
 +
 +  ON_CALL(*updater, GetBestServerBinaryPath())
@@ -274,7 +633,8 @@ index 0000000000000..8f97e0b97467f
 +
 +  auto* manager = new BrowserOSServerManager(
 +      std::move(process_controller), std::move(state_store),
-+      std::move(health_checker), std::move(updater), &prefs_);
++      std::move(health_checker), std::move(liveness_monitor),
++      std::move(updater), &prefs_);
 +
 +  EXPECT_FALSE(manager->IsAllowRemoteInMCP());
 +  manager->Start();
@@ -291,11 +651,13 @@ index 0000000000000..8f97e0b97467f
 +      std::make_unique<NiceMock<MockProcessController>>();
 +  auto state_store = std::make_unique<NiceMock<MockServerStateStore>>();
 +  auto health_checker = std::make_unique<NiceMock<MockHealthChecker>>();
++  auto liveness_monitor = std::make_unique<NiceMock<MockLivenessMonitor>>();
 +  auto updater = std::make_unique<NiceMock<MockServerUpdater>>();
 +
 +  testing::Mock::AllowLeak(process_controller.get());
 +  testing::Mock::AllowLeak(state_store.get());
 +  testing::Mock::AllowLeak(health_checker.get());
++  testing::Mock::AllowLeak(liveness_monitor.get());
 +  testing::Mock::AllowLeak(updater.get());
 +
 +  ON_CALL(*updater, GetBestServerBinaryPath())
@@ -305,8 +667,8 @@ index 0000000000000..8f97e0b97467f
 +
 +  auto* manager = new BrowserOSServerManager(
 +      std::move(process_controller), std::move(state_store),
-+      std::move(health_checker), std::move(updater),
-+      nullptr);
++      std::move(health_checker), std::move(liveness_monitor),
++      std::move(updater), nullptr);
 +
 +  EXPECT_FALSE(manager->IsRunning());
 +  EXPECT_EQ(0, manager->GetCDPPort());
@@ -324,14 +686,16 @@ index 0000000000000..8f97e0b97467f
 +      std::make_unique<NiceMock<MockProcessController>>();
 +  auto state_store = std::make_unique<NiceMock<MockServerStateStore>>();
 +  auto health_checker = std::make_unique<NiceMock<MockHealthChecker>>();
++  auto liveness_monitor = std::make_unique<NiceMock<MockLivenessMonitor>>();
 +
 +  testing::Mock::AllowLeak(process_controller.get());
 +  testing::Mock::AllowLeak(state_store.get());
 +  testing::Mock::AllowLeak(health_checker.get());
++  testing::Mock::AllowLeak(liveness_monitor.get());
 +
 +  auto* manager = new BrowserOSServerManager(
 +      std::move(process_controller), std::move(state_store),
-+      std::move(health_checker),
++      std::move(health_checker), std::move(liveness_monitor),
 +      nullptr,
 +      &prefs_);
 +
@@ -450,10 +814,6 @@ index 0000000000000..8f97e0b97467f
 +  prefs_.SetInteger(browseros_server::kServerPort, 9200);
 +  prefs_.SetInteger(browseros_server::kExtensionServerPort, 9300);
 +
-+  // Mock WaitForExitWithTimeout (called on thread pool during restart)
-+  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
-+      .WillByDefault(Return(true));
-+
 +  // Trigger restart via health check failure
 +  manager_->OnHealthCheckComplete(false);
 +
@@ -478,9 +838,6 @@ index 0000000000000..8f97e0b97467f
 +  prefs_.SetInteger(browseros_server::kServerPort, 9200);
 +  prefs_.SetInteger(browseros_server::kExtensionServerPort, 9300);
 +
-+  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
-+      .WillByDefault(Return(true));
-+
 +  bool callback_called = false;
 +  bool callback_result = false;
 +  manager_->RestartServerForUpdate(
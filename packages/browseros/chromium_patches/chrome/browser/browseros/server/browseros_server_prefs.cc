@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_prefs.cc b/chrome/browser/browseros/server/browseros_server_prefs.cc
 new file mode 100644
-index 0000000000000..8c3a459477837
+index 0000000000000..bbb736b6d6957
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_prefs.cc
-@@ -0,0 +1,49 @@
+@@ -0,0 +1,54 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -35,6 +35,10 @@ index 0000000000000..8c3a459477837
 +// Current active browseros-server version (for observability)
 +const char kServerVersion[] = "browseros.server.version";
 +
++// Server binary that failed to start with pre-bound listening sockets
++const char kSocketHandoffUnsupportedExe[] =
++    "browseros.server.socket_handoff_unsupported_exe";
++
 +// DEPRECATED prefs (kept for migration)
 +const char kMCPServerPort[] = "browseros.server.mcp_port";
 +const char kMCPServerEnabled[] = "browseros.server.mcp_enabled";
@@ -47,6 +51,7 @@ index 0000000000000..8c3a459477837
 +  registry->RegisterBooleanPref(kAllowRemoteInMCP, false);
 +  registry->RegisterBooleanPref(kRestartServerRequested, false);
 +  registry->RegisterStringPref(kServerVersion, std::string());
++  registry->RegisterStringPref(kSocketHandoffUnsupportedExe, std::string());
 +
 +  // Deprecated prefs: register for migration reads
 +  registry->RegisterIntegerPref(kMCPServerPort, 0);
@@ -1,21 +1,29 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_proxy.cc b/chrome/browser/browseros/server/browseros_server_proxy.cc
 new file mode 100644
-index 0000000000000..17560c9a2c55a
+index 0000000000000..f557466ffe8b0
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_proxy.cc
-@@ -0,0 +1,225 @@
+@@ -0,0 +1,502 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_proxy.h"
 +
++#include <algorithm>
 +#include <optional>
++#include <string_view>
 +
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/trace_event/trace_event.h"
++#include "base/trace_event/trace_id_helper.h"
++#include "base/uuid.h"
++#include "build/build_config.h"
 +#include "net/base/ip_address.h"
++#include "net/base/ip_endpoint.h"
 +#include "net/base/net_errors.h"
 +#include "net/http/http_status_code.h"
 +#include "net/log/net_log_source.h"
@@ -23,18 +31,21 @@ index 0000000000000..17560c9a2c55a
 +#include "net/server/http_server_response_info.h"
 +#include "net/socket/tcp_server_socket.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
-+#include "services/network/public/cpp/shared_url_loader_factory.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
-+#include "services/network/public/mojom/url_response_head.mojom.h"
-+#include "url/gurl.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include "chrome/browser/browseros/server/unix_socket_transport.h"
++#endif
 +
 +namespace browseros {
 +
 +namespace {
 +
-+constexpr int kBackLog = 10;
-+constexpr size_t kMaxResponseBodySize = 5 * 1024 * 1024;  // 5 MB
++constexpr char kSessionIdHeader[] = "mcp-session-id";
++constexpr char kMetricsPath[] = "/metrics";
++
++// Issued session ids remembered for client identification. Older ones fall
++// back to per-connection limits.
++constexpr size_t kMaxIssuedSessions = 1024;
 +
 +net::NetworkTrafficAnnotationTag GetProxyTrafficAnnotation() {
 +  return net::DefineNetworkTrafficAnnotation("browseros_mcp_proxy", R"(
@@ -55,76 +66,196 @@ index 0000000000000..17560c9a2c55a
 +    })");
 +}
 +
-+void Send503(net::HttpServer* server, int connection_id) {
-+  net::HttpServerResponseInfo response(net::HTTP_SERVICE_UNAVAILABLE);
-+  response.SetBody("Service Unavailable", "text/plain");
-+  server->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++// Only token characters are accepted from clients, since the id ends up in
++// logs and response headers.
++bool IsValidRequestId(std::string_view id) {
++  if (id.empty() || id.size() > BrowserOSServerProxy::kMaxRequestIdLength) {
++    return false;
++  }
++  return std::ranges::all_of(id, [](char c) {
++    return base::IsAsciiAlphaNumeric(c) || c == '-' || c == '_' || c == '.' ||
++           c == ':';
++  });
++}
++
++std::string GetOrMintRequestId(const net::HttpServerRequestInfo& info) {
++  std::string id =
++      info.GetHeaderValue(BrowserOSServerProxy::kRequestIdHeader);
++  if (IsValidRequestId(id)) {
++    return id;
++  }
++  return base::Uuid::GenerateRandomV4().AsLowercaseString();
 +}
 +
 +}  // namespace
 +
-+BrowserOSServerProxy::BrowserOSServerProxy() = default;
++BrowserOSServerProxy::QueuedRequest::QueuedRequest() = default;
++BrowserOSServerProxy::QueuedRequest::QueuedRequest(QueuedRequest&&) = default;
++BrowserOSServerProxy::QueuedRequest&
++BrowserOSServerProxy::QueuedRequest::operator=(QueuedRequest&&) = default;
++BrowserOSServerProxy::QueuedRequest::~QueuedRequest() = default;
++
++BrowserOSServerProxy::ClientState::ClientState() = default;
++BrowserOSServerProxy::ClientState::ClientState(ClientState&&) = default;
++BrowserOSServerProxy::ClientState&
++BrowserOSServerProxy::ClientState::operator=(ClientState&&) = default;
++BrowserOSServerProxy::ClientState::~ClientState() = default;
++
++BrowserOSServerProxy::BrowserOSServerProxy()
++    : BrowserOSServerProxy(Options()) {}
++
++BrowserOSServerProxy::BrowserOSServerProxy(const Options& options)
++    : options_(options),
++      pool_(std::make_unique<BackendConnectionPool>(
++          options.max_idle_connections)),
++      issued_sessions_(kMaxIssuedSessions) {}
 +
 +BrowserOSServerProxy::~BrowserOSServerProxy() {
 +  Stop();
 +}
 +
-+bool BrowserOSServerProxy::Start(
-+    int port,
-+    std::unique_ptr<network::PendingSharedURLLoaderFactory> pending_factory) {
++bool BrowserOSServerProxy::Start(int port) {
 +  if (server_) {
 +    LOG(WARNING) << "browseros: Proxy already started on port " << bound_port_;
 +    return false;
 +  }
 +
-+  // Bind the cloned factory on this (IO) thread.
-+  url_loader_factory_ =
-+      network::SharedURLLoaderFactory::Create(std::move(pending_factory));
-+
 +  auto server_socket =
 +      std::make_unique<net::TCPServerSocket>(nullptr, net::NetLogSource());
 +  int result = server_socket->ListenWithAddressAndPort("0.0.0.0", port,
-+                                                        kBackLog);
++                                                        options_.backlog);
 +  if (result != net::OK) {
 +    LOG(ERROR) << "browseros: Proxy failed to bind 0.0.0.0:" << port
 +               << " - " << net::ErrorToString(result);
 +    return false;
 +  }
 +
-+  server_ = std::make_unique<net::HttpServer>(std::move(server_socket), this);
-+  bound_port_ = port;
++  net::IPEndPoint local_address;
++  if (server_socket->GetLocalAddress(&local_address) == net::OK) {
++    bound_port_ = local_address.port();
++  } else {
++    bound_port_ = port;
++  }
++
++  std::unique_ptr<net::ServerSocket> listener = std::move(server_socket);
++#if BUILDFLAG(IS_POSIX)
++  if (!options_.unix_socket_path.empty()) {
++    std::unique_ptr<net::ServerSocket> unix_socket =
++        ListenOnUnixSocket(options_.unix_socket_path, options_.backlog);
++    if (unix_socket) {
++      LOG(INFO) << "browseros: MCP proxy also listening on "
++                << options_.unix_socket_path;
++      listener = std::make_unique<DualServerSocket>(std::move(listener),
++                                                    std::move(unix_socket));
++    }
++  }
++#endif
++  server_ = std::make_unique<net::HttpServer>(std::move(listener), this);
 +
-+  LOG(INFO) << "browseros: MCP proxy listening on 0.0.0.0:" << bound_port_;
++  LOG(INFO) << "browseros: MCP proxy listening on 0.0.0.0:" << bound_port_
++            << " (backlog " << options_.backlog << ", max in flight "
++            << options_.max_in_flight << ")";
 +  return true;
 +}
 +
 +void BrowserOSServerProxy::Stop() {
-+  pending_loaders_.clear();
++  weak_factory_.InvalidateWeakPtrs();
++  clients_.clear();
++  ready_clients_.clear();
++  open_connections_.clear();
++  in_flight_ = 0;
++  in_flight_by_port_.clear();
++  drain_callbacks_.clear();
++  pool_ = std::make_unique<BackendConnectionPool>(
++      options_.max_idle_connections);
 +  if (server_) {
 +    LOG(INFO) << "browseros: Stopping MCP proxy on port " << bound_port_;
 +    server_.reset();
 +    bound_port_ = 0;
 +  }
-+  url_loader_factory_.reset();
 +}
 +
 +void BrowserOSServerProxy::SetBackendPort(int port) {
 +  backend_port_ = port;
++  pool_->SetPreferredPort(port);
 +  LOG(INFO) << "browseros: Proxy backend port set to " << port;
 +}
 +
++void BrowserOSServerProxy::SetBackendSocket(int port,
++                                            const base::FilePath& path) {
++  pool_->SetUnixSocket(port, path);
++}
++
++void BrowserOSServerProxy::NotifyWhenDrained(int port,
++                                             base::OnceClosure callback) {
++  drain_callbacks_.emplace_back(port, std::move(callback));
++  RunDrainCallbacks();
++}
++
++void BrowserOSServerProxy::RunDrainCallbacks() {
++  std::vector<base::OnceClosure> ready;
++  std::erase_if(drain_callbacks_, [&](auto& entry) {
++    if (in_flight_by_port_.contains(entry.first)) {
++      return false;
++    }
++    ready.push_back(std::move(entry.second));
++    return true;
++  });
++
++  for (auto& callback : ready) {
++    std::move(callback).Run();
++  }
++}
++
++base::Value::Dict BrowserOSServerProxy::GetMetricsSnapshot() const {
++  base::Value::Dict snapshot = metrics_.ToValue();
++  snapshot.Set("queued", static_cast<int>(QueuedRequestCount()));
++  snapshot.Set("in_flight", static_cast<int>(in_flight_));
++  snapshot.Set("peak_in_flight", static_cast<int>(peak_in_flight_));
++  snapshot.Set("max_in_flight", static_cast<int>(options_.max_in_flight));
++  snapshot.Set("backend_connections_opened",
++               static_cast<int>(pool_->connections_opened()));
++  snapshot.Set("backend_port", backend_port_);
++  return snapshot;
++}
++
++size_t BrowserOSServerProxy::GetQueuedRequestCountForTesting() const {
++  return QueuedRequestCount();
++}
++
++size_t BrowserOSServerProxy::QueuedRequestCount() const {
++  size_t count = 0;
++  for (const auto& [key, client] : clients_) {
++    count += client.queued.size();
++  }
++  return count;
++}
++
++void BrowserOSServerProxy::TraceQueueDepths() const {
++  // Counter values are only evaluated while the category is enabled.
++  TRACE_COUNTER("browseros", "BrowserOSServerProxy.InFlight", in_flight_);
++  TRACE_COUNTER("browseros", "BrowserOSServerProxy.Queued",
++                QueuedRequestCount());
++}
++
 +void BrowserOSServerProxy::SetAllowRemote(bool allow) {
 +  allow_remote_ = allow;
 +  LOG(INFO) << "browseros: Proxy allow_remote set to "
 +            << (allow ? "true" : "false");
 +}
 +
-+void BrowserOSServerProxy::OnConnect(int connection_id) {}
++void BrowserOSServerProxy::OnConnect(int connection_id) {
++  open_connections_.insert(connection_id);
++}
 +
 +void BrowserOSServerProxy::OnHttpRequest(
 +    int connection_id,
 +    const net::HttpServerRequestInfo& info) {
-+  if (!allow_remote_ && !info.peer.address().IsLoopback()) {
++  // Unix socket peers have no IP address and were checked for the same
++  // user on accept.
++  bool is_local =
++      info.peer.address().empty() || info.peer.address().IsLoopback();
++  if (!allow_remote_ && !is_local) {
 +    net::HttpServerResponseInfo response(net::HTTP_FORBIDDEN);
 +    response.SetBody("Remote connections not allowed", "text/plain");
 +    server_->SendResponse(connection_id, response,
@@ -133,7 +264,12 @@ index 0000000000000..17560c9a2c55a
 +    return;
 +  }
 +
-+  ForwardRequest(connection_id, info);
++  if (info.method == "GET" && info.path == kMetricsPath) {
++    ServeMetrics(connection_id);
++    return;
++  }
++
++  EnqueueRequest(connection_id, info);
 +}
 +
 +void BrowserOSServerProxy::OnWebSocketRequest(
@@ -148,84 +284,225 @@ index 0000000000000..17560c9a2c55a
 +}
 +
 +void BrowserOSServerProxy::OnClose(int connection_id) {
-+  pending_loaders_.erase(connection_id);
++  // Queued requests for this connection are dropped when they reach the
++  // front of their client's queue.
++  open_connections_.erase(connection_id);
 +}
 +
-+void BrowserOSServerProxy::ForwardRequest(
++std::string BrowserOSServerProxy::GetClientKey(
 +    int connection_id,
 +    const net::HttpServerRequestInfo& info) {
-+  if (backend_port_ <= 0 || !url_loader_factory_) {
-+    Send503(server_.get(), connection_id);
-+    return;
++  std::string session_id = info.GetHeaderValue(kSessionIdHeader);
++  if (!session_id.empty() &&
++      issued_sessions_.Get(session_id) != issued_sessions_.end()) {
++    return "session:" + session_id;
 +  }
++  return "connection:" + base::NumberToString(connection_id);
++}
 +
-+  GURL backend_url("http://127.0.0.1:" + base::NumberToString(backend_port_) +
-+                    info.path);
++void BrowserOSServerProxy::EnqueueRequest(
++    int connection_id,
++    const net::HttpServerRequestInfo& info) {
++  base::TimeTicks received = base::TimeTicks::Now();
++  std::string method_label = metrics_.OnRequestStarted(
++      ProxyMetricsRecorder::ExtractMethodLabel(info.method, info.data),
++      info.data.size());
++  std::string request_id = GetOrMintRequestId(info);
++
++  if (backend_port_ <= 0) {
++    SendProxyResponse(connection_id, method_label, request_id, received,
++                      net::HTTP_SERVICE_UNAVAILABLE, "Service Unavailable");
++    return;
++  }
 +
-+  auto resource_request = std::make_unique<network::ResourceRequest>();
-+  resource_request->url = backend_url;
-+  resource_request->method = info.method;
-+  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++  std::string client_key = GetClientKey(connection_id, info);
++  ClientState& client = clients_[client_key];
++  if (client.queued.size() >= options_.max_queued_per_client) {
++    LOG(WARNING) << "browseros: Proxy queue full for " << client_key
++                 << ", rejecting request " << request_id;
++    SendProxyResponse(connection_id, method_label, request_id, received,
++                      net::HTTP_TOO_MANY_REQUESTS, "Too Many Requests");
++    return;
++  }
 +
++  QueuedRequest queued;
++  queued.connection_id = connection_id;
++  queued.method_label = std::move(method_label);
++  queued.request_id = std::move(request_id);
++  queued.received = received;
++  queued.trace_id = base::trace_event::GetNextGlobalTraceId();
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN2(
++      "browseros", "BrowserOSServerProxy::Request",
++      TRACE_ID_LOCAL(queued.trace_id), "method", queued.method_label,
++      "request_id", queued.request_id);
++  queued.request.method = info.method;
++  queued.request.path = info.path;
++  queued.request.body = info.data;
 +  for (const auto& [name, value] : info.headers) {
-+    if (name == "content-type" || name == "accept" || name == "authorization") {
-+      resource_request->headers.SetHeader(name, value);
++    if (name == "content-type" || name == "accept" ||
++        name == "authorization" || name == kSessionIdHeader) {
++      queued.request.headers.emplace_back(name, value);
 +    }
 +  }
++  queued.request.headers.emplace_back(kRequestIdHeader, queued.request_id);
++  client.queued.push_back(std::move(queued));
 +
-+  auto loader = network::SimpleURLLoader::Create(std::move(resource_request),
-+                                                  GetProxyTrafficAnnotation());
-+
-+  if (!info.data.empty()) {
-+    loader->AttachStringForUpload(info.data);
-+  }
++  ScheduleClient(client_key);
++  DispatchRequests();
++  TraceQueueDepths();
++}
 +
-+  loader->SetTimeoutDuration(base::Seconds(300));
++void BrowserOSServerProxy::ServeMetrics(int connection_id) {
++  net::HttpServerResponseInfo response(net::HTTP_OK);
++  response.SetBody(metrics_.RenderPrometheus(),
++                   "text/plain; version=0.0.4; charset=utf-8");
++  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++}
 +
-+  auto* loader_ptr = loader.get();
-+  pending_loaders_[connection_id] = std::move(loader);
-+  loader_ptr->DownloadToString(
-+      url_loader_factory_.get(),
-+      base::BindOnce(&BrowserOSServerProxy::OnBackendResponse,
-+                     base::Unretained(this), connection_id),
-+      kMaxResponseBodySize);
++void BrowserOSServerProxy::SendProxyResponse(int connection_id,
++                                             const std::string& method_label,
++                                             const std::string& request_id,
++                                             base::TimeTicks received,
++                                             net::HttpStatusCode status,
++                                             std::string_view body) {
++  net::HttpServerResponseInfo response(status);
++  response.AddHeader(kRequestIdHeader, request_id);
++  response.SetBody(std::string(body), "text/plain");
++  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++  metrics_.OnRequestFinished(method_label, status, body.size(),
++                             base::TimeTicks::Now() - received);
 +}
 +
-+void BrowserOSServerProxy::OnBackendResponse(
-+    int connection_id,
-+    std::optional<std::string> response_body) {
-+  auto it = pending_loaders_.find(connection_id);
-+  if (it == pending_loaders_.end() || !server_) {
++void BrowserOSServerProxy::ScheduleClient(const std::string& client_key) {
++  ClientState& client = clients_[client_key];
++  if (client.scheduled || client.queued.empty() ||
++      client.in_flight >= options_.max_in_flight_per_client) {
 +    return;
 +  }
++  client.scheduled = true;
++  ready_clients_.push_back(client_key);
++}
++
++void BrowserOSServerProxy::DispatchRequests() {
++  while (in_flight_ < options_.max_in_flight && !ready_clients_.empty() &&
++         backend_port_ > 0) {
++    std::string client_key = std::move(ready_clients_.front());
++    ready_clients_.pop_front();
 +
-+  auto loader = std::move(it->second);
-+  pending_loaders_.erase(it);
++    auto it = clients_.find(client_key);
++    if (it == clients_.end()) {
++      continue;
++    }
++    ClientState& client = it->second;
++    client.scheduled = false;
++
++    // Skip requests whose client connection has gone away. They are
++    // recorded as 499, the client-closed-request status nginx uses.
++    while (!client.queued.empty() &&
++           !open_connections_.contains(client.queued.front().connection_id)) {
++      const QueuedRequest& dropped = client.queued.front();
++      metrics_.OnRequestFinished(dropped.method_label, 499, 0,
++                                 base::TimeTicks::Now() - dropped.received);
++      TRACE_EVENT_NESTABLE_ASYNC_END1(
++          "browseros", "BrowserOSServerProxy::Request",
++          TRACE_ID_LOCAL(dropped.trace_id), "status", 499);
++      client.queued.pop_front();
++    }
++    if (client.queued.empty()) {
++      if (client.in_flight == 0) {
++        clients_.erase(it);
++      }
++      continue;
++    }
 +
-+  int response_code = 0;
-+  auto* response_info = loader->ResponseInfo();
-+  if (response_info && response_info->headers) {
-+    response_code = response_info->headers->response_code();
++    QueuedRequest queued = std::move(client.queued.front());
++    client.queued.pop_front();
++    client.in_flight++;
++    in_flight_++;
++    peak_in_flight_ = std::max(peak_in_flight_, in_flight_);
++    in_flight_by_port_[backend_port_]++;
++
++    // Back of the line, so every waiting client gets a turn first.
++    ScheduleClient(client_key);
++
++    TRACE_EVENT_NESTABLE_ASYNC_INSTANT1(
++        "browseros", "Dispatched", TRACE_ID_LOCAL(queued.trace_id),
++        "backend_port", backend_port_);
++    pool_->Send(backend_port_, std::move(queued.request),
++                base::BindOnce(&BrowserOSServerProxy::OnBackendResponse,
++                               weak_factory_.GetWeakPtr(),
++                               queued.connection_id, client_key,
++                               backend_port_, std::move(queued.method_label),
++                               std::move(queued.request_id), queued.received,
++                               queued.trace_id));
 +  }
++}
 +
-+  if (!response_body.has_value() || response_code == 0) {
-+    Send503(server_.get(), connection_id);
-+    return;
++void BrowserOSServerProxy::OnBackendResponse(
++    int connection_id,
++    std::string client_key,
++    int backend_port,
++    std::string method_label,
++    std::string request_id,
++    base::TimeTicks received,
++    uint64_t trace_id,
++    std::optional<BackendConnectionPool::Response> response) {
++  TRACE_EVENT_NESTABLE_ASYNC_END1(
++      "browseros", "BrowserOSServerProxy::Request", TRACE_ID_LOCAL(trace_id),
++      "status", response ? response->status_code : 0);
++  in_flight_--;
++  auto port_it = in_flight_by_port_.find(backend_port);
++  if (port_it != in_flight_by_port_.end() && --port_it->second == 0) {
++    in_flight_by_port_.erase(port_it);
++  }
++  auto client_it = clients_.find(client_key);
++  if (client_it != clients_.end()) {
++    client_it->second.in_flight--;
++    if (client_it->second.in_flight == 0 &&
++        client_it->second.queued.empty()) {
++      clients_.erase(client_it);
++    } else {
++      ScheduleClient(client_key);
++    }
 +  }
 +
-+  std::string content_type = "application/json";
-+  if (response_info && response_info->headers) {
-+    std::optional<std::string> ct =
-+        response_info->headers->GetNormalizedHeader("content-type");
-+    if (ct.has_value()) {
-+      content_type = std::move(*ct);
++  bool connection_open = server_ && open_connections_.contains(connection_id);
++  if (!response || response->status_code <= 0) {
++    LOG(WARNING) << "browseros: Backend on port " << backend_port
++                 << " failed request " << request_id;
++    if (connection_open) {
++      SendProxyResponse(connection_id, method_label, request_id, received,
++                        net::HTTP_SERVICE_UNAVAILABLE, "Service Unavailable");
++    } else {
++      metrics_.OnRequestFinished(method_label, net::HTTP_SERVICE_UNAVAILABLE,
++                                 0, base::TimeTicks::Now() - received);
++    }
++  } else {
++    if (!response->session_id.empty()) {
++      issued_sessions_.Put(response->session_id);
 +    }
++    if (connection_open) {
++      std::string content_type = response->content_type.empty()
++                                     ? "application/json"
++                                     : std::move(response->content_type);
++      net::HttpServerResponseInfo server_response(
++          static_cast<net::HttpStatusCode>(response->status_code));
++      server_response.AddHeader(kRequestIdHeader, request_id);
++      if (!response->session_id.empty()) {
++        server_response.AddHeader("Mcp-Session-Id", response->session_id);
++      }
++      server_response.SetBody(response->body, content_type);
++      server_->SendResponse(connection_id, server_response,
++                            GetProxyTrafficAnnotation());
++    }
++    metrics_.OnRequestFinished(method_label, response->status_code,
++                               response->body.size(),
++                               base::TimeTicks::Now() - received);
 +  }
 +
-+  net::HttpServerResponseInfo response(
-+      static_cast<net::HttpStatusCode>(response_code));
-+  response.SetBody(*response_body, content_type);
-+  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++  RunDrainCallbacks();
++  DispatchRequests();
++  TraceQueueDepths();
 +}
 +
 +}  // namespace browseros
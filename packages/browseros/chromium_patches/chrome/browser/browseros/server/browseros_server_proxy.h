@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_proxy.h b/chrome/browser/browseros/server/browseros_server_proxy.h
 new file mode 100644
-index 0000000000000..586296d473849
+index 0000000000000..09a9138b87357
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_proxy.h
-@@ -0,0 +1,79 @@
+@@ -0,0 +1,204 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,52 +11,136 @@ index 0000000000000..586296d473849
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_PROXY_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_PROXY_H_
 +
++#include <stddef.h>
++#include <stdint.h>
++
 +#include <memory>
 +#include <optional>
 +#include <string>
++#include <string_view>
++#include <utility>
++#include <vector>
 +
++#include "base/containers/circular_deque.h"
 +#include "base/containers/flat_map.h"
-+#include "base/memory/scoped_refptr.h"
++#include "base/containers/flat_set.h"
++#include "base/containers/lru_cache.h"
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/server/backend_connection_pool.h"
++#include "chrome/browser/browseros/server/proxy_metrics.h"
++#include "net/http/http_status_code.h"
 +#include "net/server/http_server.h"
 +
-+namespace network {
-+class PendingSharedURLLoaderFactory;
-+class SharedURLLoaderFactory;
-+class SimpleURLLoader;
-+}  // namespace network
-+
 +namespace browseros {
 +
 +// HTTP proxy that binds a stable port and forwards all requests to the
 +// sidecar's ephemeral backend port. Returns 503 when no backend is configured.
 +//
-+// Threading: The entire proxy runs on the IO thread. The manager obtains a
-+// SharedURLLoaderFactory on the UI thread, calls Clone() to get a
-+// PendingSharedURLLoaderFactory, and passes it to Start() on the IO thread.
-+// Start() binds it into a new SharedURLLoaderFactory usable from IO.
-+// This keeps net::HttpServer and SimpleURLLoader on the same thread.
++// Requests are forwarded over a pool of keep-alive connections. At most
++// |max_in_flight| requests are outstanding at the backend; the rest wait in
++// per-client queues that are served round-robin, so one busy client cannot
++// starve the others. A client is identified by its MCP session id if the
++// backend issued it, and by its connection otherwise: local clients all
++// share one address, and session ids a client made up are not trusted.
++// The backend's Mcp-Session-Id is passed through in both directions.
++//
++// GET /metrics is answered by the proxy itself with per-method request
++// counts, latencies, payload sizes and status codes in Prometheus format.
++//
++// Every forwarded request carries a correlation id in |kRequestIdHeader|,
++// taken from the client when it sent a valid one and minted otherwise. The
++// sidecar passes it on to the browserOS.* calls the request makes, and the
++// proxy echoes it in the response, in its logs and in its trace events.
++//
++// Threading: The entire proxy runs on the IO thread.
 +class BrowserOSServerProxy : public net::HttpServer::Delegate {
 + public:
++  static constexpr char kRequestIdHeader[] = "x-browseros-request-id";
++  // Longer or non-token client ids are replaced with a minted one.
++  static constexpr size_t kMaxRequestIdLength = 64;
++
++  struct Options {
++    // Listen backlog of the proxy socket.
++    int backlog = 128;
++    // Requests outstanding at the backend across all clients.
++    size_t max_in_flight = 32;
++    // Requests outstanding at the backend for one client.
++    size_t max_in_flight_per_client = 8;
++    // Requests waiting per client before the proxy answers 429.
++    size_t max_queued_per_client = 256;
++    // Idle keep-alive connections kept to the backend.
++    size_t max_idle_connections = 32;
++    // If set, also listen on this Unix socket (POSIX only). Peers must run
++    // as the same user.
++    base::FilePath unix_socket_path;
++  };
++
 +  BrowserOSServerProxy();
++  explicit BrowserOSServerProxy(const Options& options);
 +  ~BrowserOSServerProxy() override;
 +
 +  BrowserOSServerProxy(const BrowserOSServerProxy&) = delete;
 +  BrowserOSServerProxy& operator=(const BrowserOSServerProxy&) = delete;
 +
-+  // Bind proxy on the given port. |pending_factory| is a cloned factory
-+  // that will be bound on the current (IO) thread. Returns true on success.
-+  bool Start(int port,
-+             std::unique_ptr<network::PendingSharedURLLoaderFactory>
-+                 pending_factory);
++  // Bind proxy on the given port; 0 picks an ephemeral port. Returns true on
++  // success.
++  bool Start(int port);
 +
 +  void Stop();
 +
++  // Switches new requests to |port|. Requests in flight keep their backend.
 +  void SetBackendPort(int port);
++  // Reaches the backend on |port| through the Unix socket at |path| when the
++  // sidecar has created it; TCP otherwise.
++  void SetBackendSocket(int port, const base::FilePath& path);
 +  void SetAllowRemote(bool allow);
 +
++  // Runs |callback| once no forwarded request is in flight to |port|.
++  void NotifyWhenDrained(int port, base::OnceClosure callback);
++
 +  int GetPort() const { return bound_port_; }
 +
++  // Per-method metrics plus queue state, for the chrome:// debug page.
++  base::Value::Dict GetMetricsSnapshot() const;
++
++  size_t GetPeakInFlightForTesting() const { return peak_in_flight_; }
++  size_t GetQueuedRequestCountForTesting() const;
++  size_t GetBackendConnectionsOpenedForTesting() const {
++    return pool_->connections_opened();
++  }
++
 + private:
++  struct QueuedRequest {
++    QueuedRequest();
++    QueuedRequest(QueuedRequest&&);
++    QueuedRequest& operator=(QueuedRequest&&);
++    ~QueuedRequest();
++
++    int connection_id = 0;
++    std::string method_label;
++    std::string request_id;
++    base::TimeTicks received;
++    // Id of the request's async slice in the "browseros" trace category.
++    uint64_t trace_id = 0;
++    BackendConnectionPool::Request request;
++  };
++
++  struct ClientState {
++    ClientState();
++    ClientState(ClientState&&);
++    ClientState& operator=(ClientState&&);
++    ~ClientState();
++
++    base::circular_deque<QueuedRequest> queued;
++    size_t in_flight = 0;
++    // True while the client is in |ready_clients_|.
++    bool scheduled = false;
++  };
++
 +  // net::HttpServer::Delegate
 +  void OnConnect(int connection_id) override;
 +  void OnHttpRequest(int connection_id,
@@ -66,18 +150,59 @@ index 0000000000000..586296d473849
 +  void OnWebSocketMessage(int connection_id, std::string data) override;
 +  void OnClose(int connection_id) override;
 +
-+  void ForwardRequest(int connection_id,
++  std::string GetClientKey(int connection_id,
++                           const net::HttpServerRequestInfo& info);
++  size_t QueuedRequestCount() const;
++  // Emits the in-flight and queued request counts as trace counters.
++  void TraceQueueDepths() const;
++  void EnqueueRequest(int connection_id,
 +                      const net::HttpServerRequestInfo& info);
++  void ServeMetrics(int connection_id);
++  // Sends a response generated by the proxy and records it under
++  // |method_label|.
++  void SendProxyResponse(int connection_id,
++                         const std::string& method_label,
++                         const std::string& request_id,
++                         base::TimeTicks received,
++                         net::HttpStatusCode status,
++                         std::string_view body);
++  void ScheduleClient(const std::string& client_key);
++  void DispatchRequests();
 +  void OnBackendResponse(int connection_id,
-+                         std::optional<std::string> response_body);
-+
++                         std::string client_key,
++                         int backend_port,
++                         std::string method_label,
++                         std::string request_id,
++                         base::TimeTicks received,
++                         uint64_t trace_id,
++                         std::optional<BackendConnectionPool::Response>
++                             response);
++  void RunDrainCallbacks();
++
++  const Options options_;
 +  std::unique_ptr<net::HttpServer> server_;
-+  base::flat_map<int, std::unique_ptr<network::SimpleURLLoader>>
-+      pending_loaders_;
-+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
++  std::unique_ptr<BackendConnectionPool> pool_;
++  ProxyMetricsRecorder metrics_;
++
++  // Connections that are still open and may receive a response.
++  base::flat_set<int> open_connections_;
++
++  // Session ids the backend issued, most recently used first.
++  base::HashingLRUCacheSet<std::string> issued_sessions_;
++  base::flat_map<std::string, ClientState> clients_;
++  // Clients with queued requests, served round-robin.
++  base::circular_deque<std::string> ready_clients_;
++
++  size_t in_flight_ = 0;
++  size_t peak_in_flight_ = 0;
++  base::flat_map<int, size_t> in_flight_by_port_;
++  std::vector<std::pair<int, base::OnceClosure>> drain_callbacks_;
++
 +  int backend_port_ = 0;
 +  int bound_port_ = 0;
 +  bool allow_remote_ = false;
++
++  base::WeakPtrFactory<BrowserOSServerProxy> weak_factory_{this};
 +};
 +
 +}  // namespace browseros
@@ -0,0 +1,481 @@
+diff --git a/chrome/browser/browseros/server/browseros_server_proxy_unittest.cc b/chrome/browser/browseros/server/browseros_server_proxy_unittest.cc
+new file mode 100644
+index 0000000000000..19bf236f2fe25
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_server_proxy_unittest.cc
+@@ -0,0 +1,475 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_server_proxy.h"
++
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/files/scoped_temp_dir.h"
++#include "base/functional/bind.h"
++#include "base/memory/raw_ptr.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/test/bind.h"
++#include "base/test/run_until.h"
++#include "base/test/task_environment.h"
++#include "base/uuid.h"
++#include "build/build_config.h"
++#include "chrome/browser/browseros/server/backend_connection_pool.h"
++#include "net/base/ip_endpoint.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_status_code.h"
++#include "net/log/net_log_source.h"
++#include "net/server/http_server.h"
++#include "net/server/http_server_request_info.h"
++#include "net/server/http_server_response_info.h"
++#include "net/socket/tcp_server_socket.h"
++#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++// Stands in for the sidecar: echoes request bodies, optionally holding
++// responses until released. Like an MCP server, it issues a session id to
++// requests that come without one.
++class StubBackend : public net::HttpServer::Delegate {
++ public:
++  StubBackend() {
++    auto socket =
++        std::make_unique<net::TCPServerSocket>(nullptr, net::NetLogSource());
++    EXPECT_EQ(net::OK,
++              socket->ListenWithAddressAndPort("127.0.0.1", 0, 128));
++    net::IPEndPoint address;
++    EXPECT_EQ(net::OK, socket->GetLocalAddress(&address));
++    port_ = address.port();
++    server_ = std::make_unique<net::HttpServer>(std::move(socket), this);
++  }
++
++  int port() const { return port_; }
++  int connections_accepted() const { return connections_accepted_; }
++  const std::string& last_request_id() const { return last_request_id_; }
++  size_t held_count() const { return held_.size(); }
++
++  void set_hold_responses(bool hold) { hold_responses_ = hold; }
++
++  void ReleaseHeld() {
++    hold_responses_ = false;
++    std::vector<std::pair<int, std::string>> held = std::move(held_);
++    for (const auto& [connection_id, body] : held) {
++      Respond(connection_id, body, std::string());
++    }
++  }
++
++  // net::HttpServer::Delegate
++  void OnConnect(int connection_id) override { connections_accepted_++; }
++  void OnHttpRequest(int connection_id,
++                     const net::HttpServerRequestInfo& info) override {
++    last_request_id_ =
++        info.GetHeaderValue(BrowserOSServerProxy::kRequestIdHeader);
++    if (hold_responses_) {
++      held_.emplace_back(connection_id, info.data);
++      return;
++    }
++    std::string session_id;
++    if (info.GetHeaderValue("mcp-session-id").empty()) {
++      session_id = "issued-" + base::NumberToString(++sessions_issued_);
++    }
++    Respond(connection_id, info.data, session_id);
++  }
++  void OnWebSocketRequest(int connection_id,
++                          const net::HttpServerRequestInfo& info) override {}
++  void OnWebSocketMessage(int connection_id, std::string data) override {}
++  void OnClose(int connection_id) override {}
++
++ private:
++  void Respond(int connection_id,
++               const std::string& body,
++               const std::string& session_id) {
++    net::HttpServerResponseInfo response(net::HTTP_OK);
++    if (!session_id.empty()) {
++      response.AddHeader("Mcp-Session-Id", session_id);
++    }
++    response.SetBody(body, "application/json");
++    server_->SendResponse(connection_id, response,
++                          TRAFFIC_ANNOTATION_FOR_TESTS);
++  }
++
++  std::unique_ptr<net::HttpServer> server_;
++  int port_ = 0;
++  int connections_accepted_ = 0;
++  int sessions_issued_ = 0;
++  bool hold_responses_ = false;
++  std::vector<std::pair<int, std::string>> held_;
++  std::string last_request_id_;
++};
++
++// An MCP client on its own keep-alive connection, sending |total| requests
++// one after another. Without a session id it adopts the first one the
++// backend issues.
++class LoadClient {
++ public:
++  LoadClient(int proxy_port, std::string session_id, int total)
++      : proxy_port_(proxy_port),
++        session_id_(std::move(session_id)),
++        remaining_(total),
++        pool_(1) {
++    pool_.SetPreferredPort(proxy_port);
++  }
++
++  void Start() { SendNext(); }
++
++  // Connects to the proxy through its Unix socket instead of TCP.
++  void UseUnixSocket(const base::FilePath& path) {
++    pool_.SetUnixSocket(proxy_port_, path);
++  }
++
++  // Numbers each finished request from |counter|, shared across clients.
++  void set_completion_counter(int* counter) { completion_counter_ = counter; }
++  int last_completion() const { return last_completion_; }
++
++  bool done() const { return remaining_ == 0 && !in_flight_; }
++  const std::string& session_id() const { return session_id_; }
++  int failures() const { return failures_; }
++  int successes() const { return successes_; }
++
++ private:
++  void SendNext() {
++    if (remaining_ == 0) {
++      return;
++    }
++    remaining_--;
++    in_flight_ = true;
++    expected_body_ = session_id_ + "/" + base::NumberToString(remaining_);
++
++    BackendConnectionPool::Request request;
++    request.method = "POST";
++    request.path = "/mcp";
++    request.headers.emplace_back("Content-Type", "application/json");
++    if (!session_id_.empty()) {
++      request.headers.emplace_back("Mcp-Session-Id", session_id_);
++    }
++    request.body = expected_body_;
++    pool_.Send(proxy_port_, std::move(request),
++               base::BindOnce(&LoadClient::OnResponse,
++                              base::Unretained(this)));
++  }
++
++  void OnResponse(std::optional<BackendConnectionPool::Response> response) {
++    in_flight_ = false;
++    if (completion_counter_) {
++      last_completion_ = (*completion_counter_)++;
++    }
++    if (response && session_id_.empty()) {
++      session_id_ = response->session_id;
++    }
++    if (response && response->status_code == 200 &&
++        response->body == expected_body_) {
++      successes_++;
++    } else {
++      failures_++;
++    }
++    SendNext();
++  }
++
++  const int proxy_port_;
++  std::string session_id_;
++  int remaining_;
++  bool in_flight_ = false;
++  std::string expected_body_;
++  int successes_ = 0;
++  int failures_ = 0;
++  raw_ptr<int> completion_counter_ = nullptr;
++  int last_completion_ = -1;
++  BackendConnectionPool pool_;
++};
++
++class BrowserOSServerProxyTest : public testing::Test {
++ protected:
++  void StartProxy(const BrowserOSServerProxy::Options& options) {
++    proxy_ = std::make_unique<BrowserOSServerProxy>(options);
++    ASSERT_TRUE(proxy_->Start(0));
++    ASSERT_GT(proxy_->GetPort(), 0);
++  }
++
++  // Returns a session id the backend issued through the proxy.
++  std::string StartSession() {
++    LoadClient client(proxy_->GetPort(), std::string(), 1);
++    client.Start();
++    EXPECT_TRUE(base::test::RunUntil([&] { return client.done(); }));
++    EXPECT_FALSE(client.session_id().empty());
++    return client.session_id();
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::MainThreadType::IO};
++  std::unique_ptr<BrowserOSServerProxy> proxy_;
++};
++
++TEST_F(BrowserOSServerProxyTest, ForwardsToBackend) {
++  StubBackend backend;
++  StartProxy(BrowserOSServerProxy::Options());
++  proxy_->SetBackendPort(backend.port());
++
++  LoadClient client(proxy_->GetPort(), "session", 3);
++  client.Start();
++  ASSERT_TRUE(base::test::RunUntil([&] { return client.done(); }));
++
++  EXPECT_EQ(3, client.successes());
++  EXPECT_EQ(0, client.failures());
++  // All three requests share one backend connection.
++  EXPECT_EQ(1, backend.connections_accepted());
++}
++
++TEST_F(BrowserOSServerProxyTest, NoBackend_Returns503) {
++  StartProxy(BrowserOSServerProxy::Options());
++
++  BackendConnectionPool pool(1);
++  std::optional<BackendConnectionPool::Response> result;
++  bool done = false;
++  BackendConnectionPool::Request request;
++  request.method = "POST";
++  request.path = "/mcp";
++  request.body = "{}";
++  pool.Send(proxy_->GetPort(), std::move(request),
++            base::BindLambdaForTesting(
++                [&](std::optional<BackendConnectionPool::Response> r) {
++                  result = std::move(r);
++                  done = true;
++                }));
++  ASSERT_TRUE(base::test::RunUntil([&] { return done; }));
++
++  ASSERT_TRUE(result.has_value());
++  EXPECT_EQ(503, result->status_code);
++}
++
++TEST_F(BrowserOSServerProxyTest, PropagatesRequestId) {
++  StubBackend backend;
++  StartProxy(BrowserOSServerProxy::Options());
++  proxy_->SetBackendPort(backend.port());
++
++  BackendConnectionPool pool(1);
++  auto send = [&](std::optional<std::string> request_id) {
++    BackendConnectionPool::Request request;
++    request.method = "POST";
++    request.path = "/mcp";
++    request.body = "{}";
++    if (request_id) {
++      request.headers.emplace_back("X-BrowserOS-Request-Id", *request_id);
++    }
++    bool done = false;
++    pool.Send(proxy_->GetPort(), std::move(request),
++              base::BindLambdaForTesting(
++                  [&](std::optional<BackendConnectionPool::Response> r) {
++                    EXPECT_TRUE(r.has_value());
++                    done = true;
++                  }));
++    EXPECT_TRUE(base::test::RunUntil([&] { return done; }));
++  };
++
++  send("tool-call-42");
++  EXPECT_EQ("tool-call-42", backend.last_request_id());
++
++  // Missing and malformed ids are replaced with a minted UUID.
++  send(std::nullopt);
++  EXPECT_TRUE(base::Uuid::ParseLowercase(backend.last_request_id()).is_valid());
++  std::string minted = backend.last_request_id();
++  send("not a token");
++  EXPECT_TRUE(base::Uuid::ParseLowercase(backend.last_request_id()).is_valid());
++  EXPECT_NE(minted, backend.last_request_id());
++}
++
++TEST_F(BrowserOSServerProxyTest, BusyClientDoesNotStarveOthers) {
++  StubBackend backend;
++  BrowserOSServerProxy::Options options;
++  options.max_in_flight = 1;
++  StartProxy(options);
++  proxy_->SetBackendPort(backend.port());
++
++  // The greedy client opens many connections at once in one session, all
++  // held at the backend behind a single in-flight slot.
++  const std::string greedy_session = StartSession();
++  const std::string polite_session = StartSession();
++  constexpr int kGreedyRequests = 40;
++  int completions = 0;
++  backend.set_hold_responses(true);
++  std::vector<std::unique_ptr<LoadClient>> greedy;
++  for (int i = 0; i < kGreedyRequests; ++i) {
++    greedy.push_back(
++        std::make_unique<LoadClient>(proxy_->GetPort(), greedy_session, 1));
++    greedy.back()->set_completion_counter(&completions);
++    greedy.back()->Start();
++  }
++  ASSERT_TRUE(base::test::RunUntil([&] {
++    return backend.held_count() == 1 &&
++           proxy_->GetQueuedRequestCountForTesting() == kGreedyRequests - 1;
++  }));
++
++  LoadClient polite(proxy_->GetPort(), polite_session, 1);
++  polite.set_completion_counter(&completions);
++  polite.Start();
++  ASSERT_TRUE(base::test::RunUntil([&] {
++    return proxy_->GetQueuedRequestCountForTesting() == kGreedyRequests;
++  }));
++
++  backend.ReleaseHeld();
++  ASSERT_TRUE(base::test::RunUntil([&] { return polite.done(); }));
++
++  EXPECT_EQ(1, polite.successes());
++  // Round-robin puts the polite request right behind the one in flight.
++  EXPECT_LT(polite.last_completion(), 5);
++  EXPECT_EQ(1u, proxy_->GetPeakInFlightForTesting());
++}
++
++TEST_F(BrowserOSServerProxyTest, UnissuedSessionsLimitedPerConnection) {
++  StubBackend backend;
++  BrowserOSServerProxy::Options options;
++  options.max_in_flight_per_client = 1;
++  StartProxy(options);
++  proxy_->SetBackendPort(backend.port());
++  const std::string session = StartSession();
++
++  // Two connections in one issued session share its single slot.
++  backend.set_hold_responses(true);
++  LoadClient first(proxy_->GetPort(), session, 1);
++  LoadClient second(proxy_->GetPort(), session, 1);
++  first.Start();
++  second.Start();
++  ASSERT_TRUE(base::test::RunUntil([&] {
++    return backend.held_count() == 1 &&
++           proxy_->GetQueuedRequestCountForTesting() == 1;
++  }));
++
++  // Local clients without a session header, or with one the backend never
++  // issued, all come from 127.0.0.1 but are limited per connection.
++  std::vector<std::unique_ptr<LoadClient>> others;
++  for (const char* session_id : {"", "", "made-up", "made-up"}) {
++    others.push_back(
++        std::make_unique<LoadClient>(proxy_->GetPort(), session_id, 1));
++    others.back()->Start();
++  }
++  ASSERT_TRUE(base::test::RunUntil([&] { return backend.held_count() == 5; }));
++  EXPECT_EQ(1u, proxy_->GetQueuedRequestCountForTesting());
++
++  backend.ReleaseHeld();
++  ASSERT_TRUE(base::test::RunUntil([&] {
++    for (const auto& client : others) {
++      if (!client->done()) {
++        return false;
++      }
++    }
++    return first.done() && second.done();
++  }));
++  EXPECT_EQ(1, first.successes());
++  EXPECT_EQ(1, second.successes());
++  for (const auto& client : others) {
++    EXPECT_EQ(1, client->successes());
++  }
++}
++
++TEST_F(BrowserOSServerProxyTest, MetricsEndpoint) {
++  StubBackend backend;
++  StartProxy(BrowserOSServerProxy::Options());
++  proxy_->SetBackendPort(backend.port());
++
++  LoadClient client(proxy_->GetPort(), "session", 2);
++  client.Start();
++  ASSERT_TRUE(base::test::RunUntil([&] { return client.done(); }));
++
++  BackendConnectionPool pool(1);
++  std::optional<BackendConnectionPool::Response> result;
++  bool done = false;
++  BackendConnectionPool::Request request;
++  request.method = "GET";
++  request.path = "/metrics";
++  pool.Send(proxy_->GetPort(), std::move(request),
++            base::BindLambdaForTesting(
++                [&](std::optional<BackendConnectionPool::Response> r) {
++                  result = std::move(r);
++                  done = true;
++                }));
++  ASSERT_TRUE(base::test::RunUntil([&] { return done; }));
++
++  ASSERT_TRUE(result.has_value());
++  EXPECT_EQ(200, result->status_code);
++  // LoadClient bodies aren't JSON-RPC, so they count under the HTTP method.
++  EXPECT_NE(std::string::npos,
++            result->body.find(
++                "browseros_mcp_responses_total{method=\"http:POST\","
++                "code=\"200\"} 2"));
++  // The backend never sees /metrics.
++  EXPECT_EQ(1, backend.connections_accepted());
++}
++
++#if BUILDFLAG(IS_POSIX)
++TEST_F(BrowserOSServerProxyTest, UnixSocketTransport) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateDirectory());
++  StubBackend backend;
++  BrowserOSServerProxy::Options options;
++  options.unix_socket_path = temp_dir.GetPath().AppendASCII("proxy.sock");
++  StartProxy(options);
++  proxy_->SetBackendPort(backend.port());
++  // The stub backend has no Unix socket; the proxy falls back to TCP.
++  proxy_->SetBackendSocket(backend.port(),
++                           temp_dir.GetPath().AppendASCII("server.sock"));
++
++  LoadClient unix_client(proxy_->GetPort(), "unix", 3);
++  unix_client.UseUnixSocket(options.unix_socket_path);
++  LoadClient tcp_client(proxy_->GetPort(), "tcp", 3);
++  unix_client.Start();
++  tcp_client.Start();
++  ASSERT_TRUE(base::test::RunUntil(
++      [&] { return unix_client.done() && tcp_client.done(); }));
++
++  EXPECT_EQ(3, unix_client.successes());
++  EXPECT_EQ(3, tcp_client.successes());
++}
++#endif  // BUILDFLAG(IS_POSIX)
++
++// Many concurrent clients: every request succeeds, the backend never sees
++// more than |max_in_flight| requests or connections.
++TEST_F(BrowserOSServerProxyTest, LoadTest_ManyConcurrentClients) {
++  StubBackend backend;
++  BrowserOSServerProxy::Options options;
++  options.max_in_flight = 16;
++  options.max_idle_connections = 16;
++  StartProxy(options);
++  proxy_->SetBackendPort(backend.port());
++
++  constexpr int kClients = 300;
++  constexpr int kRequestsPerClient = 5;
++  std::vector<std::unique_ptr<LoadClient>> clients;
++  for (int i = 0; i < kClients; ++i) {
++    clients.push_back(std::make_unique<LoadClient>(
++        proxy_->GetPort(), "client-" + base::NumberToString(i),
++        kRequestsPerClient));
++  }
++  for (auto& client : clients) {
++    client->Start();
++  }
++  ASSERT_TRUE(base::test::RunUntil([&] {
++    for (const auto& client : clients) {
++      if (!client->done()) {
++        return false;
++      }
++    }
++    return true;
++  }));
++
++  for (const auto& client : clients) {
++    EXPECT_EQ(kRequestsPerClient, client->successes());
++    EXPECT_EQ(0, client->failures());
++  }
++  EXPECT_LE(proxy_->GetPeakInFlightForTesting(), options.max_in_flight);
++  EXPECT_LE(proxy_->GetBackendConnectionsOpenedForTesting(),
++            options.max_in_flight);
++  EXPECT_LE(static_cast<size_t>(backend.connections_accepted()),
++            options.max_in_flight);
++}
++
++}  // namespace
++}  // namespace browseros
@@ -1,22 +1,28 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_updater.cc b/chrome/browser/browseros/server/browseros_server_updater.cc
 new file mode 100644
-index 0000000000000..9050130727fc8
+index 0000000000000..94dd6d08e098e
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_updater.cc
-@@ -0,0 +1,1078 @@
+@@ -0,0 +1,1345 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_updater.h"
 +
++#include <array>
++#include <memory>
 +#include <optional>
++#include <vector>
 +
 +#include "base/base64.h"
 +#include "base/command_line.h"
++#include "base/containers/span.h"
 +#include "base/feature_list.h"
++#include "base/files/file.h"
 +#include "base/files/file_enumerator.h"
 +#include "base/files/file_util.h"
++#include "base/files/memory_mapped_file.h"
 +#include "base/json/json_reader.h"
 +#include "base/logging.h"
 +#include "base/path_service.h"
@@ -31,16 +37,21 @@ index 0000000000000..9050130727fc8
 +#include "chrome/browser/browseros/server/browseros_server_constants.h"
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +#include "chrome/browser/browseros/server/browseros_server_prefs.h"
++#include "chrome/browser/browseros/server/resumable_download.h"
++#include "chrome/browser/browseros/server/version_store.h"
 +#include "chrome/browser/net/system_network_context_manager.h"
 +#include "chrome/common/chrome_paths.h"
 +#include "components/prefs/pref_service.h"
++#include "components/zucchini/zucchini.h"
++#include "components/zucchini/zucchini_integration.h"
++#include "crypto/secure_hash.h"
++#include "crypto/sha2.h"
 +#include "net/base/net_errors.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
 +#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
 +#include "services/network/public/cpp/simple_url_loader.h"
 +#include "third_party/boringssl/src/include/openssl/curve25519.h"
-+#include "third_party/zlib/google/zip.h"
-+#include "third_party/zlib/google/zip_reader.h"
 +#include "url/gurl.h"
 +
 +namespace browseros_server {
@@ -117,79 +128,114 @@ index 0000000000000..9050130727fc8
 +    })");
 +}
 +
-+// Verifies Ed25519 signature of file contents.
-+// Returns true if signature is valid.
-+bool VerifyEd25519Signature(const base::FilePath& file_path,
-+                            const std::string& signature_base64,
-+                            const std::string& public_key_base64) {
-+  // Decode public key
-+  std::string public_key_bytes;
-+  if (!base::Base64Decode(public_key_base64, &public_key_bytes)) {
-+    LOG(ERROR) << "browseros: Failed to decode public key from base64";
-+    return false;
++// Packages are read through a buffer of this size while hashing, so verifying
++// an update costs the same memory whatever the package size.
++constexpr size_t kVerifyChunkSize = 64 * 1024;
++
++// Decodes base64 |input| and checks it decodes to exactly |expected_len|
++// bytes. |what| names the value in log messages.
++std::optional<std::string> DecodeFixedLength(const std::string& input,
++                                             size_t expected_len,
++                                             const char* what) {
++  std::string bytes;
++  if (!base::Base64Decode(input, &bytes)) {
++    LOG(ERROR) << "browseros: Failed to decode " << what << " from base64";
++    return std::nullopt;
 +  }
-+  if (public_key_bytes.size() != ED25519_PUBLIC_KEY_LEN) {
-+    LOG(ERROR) << "browseros: Invalid public key length: "
-+               << public_key_bytes.size() << " (expected "
-+               << ED25519_PUBLIC_KEY_LEN << ")";
-+    return false;
++  if (bytes.size() != expected_len) {
++    LOG(ERROR) << "browseros: Invalid " << what << " length: " << bytes.size()
++               << " (expected " << expected_len << ")";
++    return std::nullopt;
 +  }
++  return bytes;
++}
 +
-+  // Decode signature
-+  std::string signature_bytes;
-+  if (!base::Base64Decode(signature_base64, &signature_bytes)) {
-+    LOG(ERROR) << "browseros: Failed to decode signature from base64";
-+    return false;
-+  }
-+  if (signature_bytes.size() != ED25519_SIGNATURE_LEN) {
-+    LOG(ERROR) << "browseros: Invalid signature length: "
-+               << signature_bytes.size() << " (expected "
-+               << ED25519_SIGNATURE_LEN << ")";
++bool VerifyEd25519(base::span<const uint8_t> message,
++                   const std::string& signature_base64,
++                   const std::string& public_key_base64) {
++  std::optional<std::string> public_key = DecodeFixedLength(
++      public_key_base64, ED25519_PUBLIC_KEY_LEN, "public key");
++  std::optional<std::string> signature =
++      DecodeFixedLength(signature_base64, ED25519_SIGNATURE_LEN, "signature");
++  if (!public_key || !signature) {
 +    return false;
 +  }
 +
-+  // Read file contents
-+  std::string file_contents;
-+  if (!base::ReadFileToString(file_path, &file_contents)) {
-+    LOG(ERROR) << "browseros: Failed to read file for signature verification: "
-+               << file_path;
++  int result = ED25519_verify(
++      message.data(), message.size(),
++      reinterpret_cast<const uint8_t*>(signature->data()),
++      reinterpret_cast<const uint8_t*>(public_key->data()));
++  if (result != 1) {
++    LOG(ERROR) << "browseros: Ed25519 signature verification failed";
 +    return false;
 +  }
++  return true;
++}
 +
-+  // Verify signature
-+  const uint8_t* message =
-+      reinterpret_cast<const uint8_t*>(file_contents.data());
-+  size_t message_len = file_contents.size();
-+  const uint8_t* sig = reinterpret_cast<const uint8_t*>(signature_bytes.data());
-+  const uint8_t* pub_key =
-+      reinterpret_cast<const uint8_t*>(public_key_bytes.data());
++// Computes the SHA-256 of |file| from its start, reading through a
++// fixed-size buffer.
++std::optional<std::array<uint8_t, crypto::kSHA256Length>> HashFile(
++    base::File& file) {
++  if (file.Seek(base::File::FROM_BEGIN, 0) != 0) {
++    return std::nullopt;
++  }
 +
-+  int result = ED25519_verify(message, message_len, sig, pub_key);
-+  if (result != 1) {
-+    LOG(ERROR) << "browseros: Ed25519 signature verification failed";
-+    return false;
++  std::unique_ptr<crypto::SecureHash> hash =
++      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
++  std::vector<uint8_t> buffer(kVerifyChunkSize);
++  while (true) {
++    std::optional<size_t> read = file.ReadAtCurrentPos(buffer);
++    if (!read) {
++      return std::nullopt;
++    }
++    if (*read == 0) {
++      break;
++    }
++    hash->Update(buffer.data(), *read);
 +  }
 +
-+  LOG(INFO) << "browseros: Ed25519 signature verified successfully";
-+  return true;
++  std::array<uint8_t, crypto::kSHA256Length> digest;
++  hash->Finish(digest.data(), digest.size());
++  return digest;
 +}
 +
-+// Extracts ZIP file to destination directory.
-+// Returns empty string on success, error message on failure.
-+std::string ExtractZipFile(const base::FilePath& zip_path,
-+                           const base::FilePath& dest_dir) {
-+  // Ensure destination directory exists
-+  if (!base::CreateDirectory(dest_dir)) {
-+    return "Failed to create destination directory: " + dest_dir.AsUTF8Unsafe();
++// Verifies |file| against the enclosure's signatures. The digest signature
++// signs the package's SHA-256, so the package is streamed through a fixed
++// buffer once. Plain Ed25519 needs the whole message in one span, so legacy
++// signatures are checked against a read-only mapping of the file instead of
++// a heap copy; its pages are file-backed and can be dropped under pressure.
++bool VerifyPackageSignature(base::File& file,
++                            const std::string& digest_signature,
++                            const std::string& signature) {
++  if (!digest_signature.empty()) {
++    std::optional<std::array<uint8_t, crypto::kSHA256Length>> digest =
++        HashFile(file);
++    if (!digest) {
++      LOG(ERROR) << "browseros: Failed to read package for verification";
++      return false;
++    }
++    if (!VerifyEd25519(*digest, digest_signature, kServerUpdatePublicKey)) {
++      return false;
++    }
++    LOG(INFO) << "browseros: Ed25519 digest signature verified successfully";
++    return true;
 +  }
 +
-+  // Use the zip::Unzip utility which handles the extraction properly
-+  if (!zip::Unzip(zip_path, dest_dir)) {
-+    return "Failed to extract ZIP file";
++  if (signature.empty()) {
++    LOG(ERROR) << "browseros: Update package is not signed";
++    return false;
 +  }
 +
-+  LOG(INFO) << "browseros: Extracted ZIP to " << dest_dir;
-+  return "";  // Success
++  base::MemoryMappedFile mapped;
++  if (!mapped.Initialize(file.Duplicate())) {
++    LOG(ERROR) << "browseros: Failed to map package for verification";
++    return false;
++  }
++  if (!VerifyEd25519(mapped.bytes(), signature, kServerUpdatePublicKey)) {
++    return false;
++  }
++  LOG(INFO) << "browseros: Ed25519 signature verified successfully";
++  return true;
 +}
 +
 +// Runs binary with --version and captures output.
@@ -228,12 +274,30 @@ index 0000000000000..9050130727fc8
 +
 +VerifyExtractResult DoVerifyAndExtract(const base::FilePath& zip_path,
 +                                       const std::string& signature,
-+                                       const base::FilePath& dest_dir) {
++                                       const std::string& digest_signature,
++                                       const base::FilePath& dest_dir,
++                                       const base::FilePath& store_dir) {
 +  VerifyExtractResult result;
 +
++  // The package is opened once and both verified and extracted through this
++  // handle.
++  base::File file(zip_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
++  if (!file.IsValid()) {
++    result.error = "Failed to open downloaded package";
++    base::DeleteFile(zip_path);
++    return result;
++  }
++  if (file.GetLength() > static_cast<int64_t>(kMaxUpdatePackageSize)) {
++    result.error = "Downloaded package exceeds maximum size";
++    file.Close();
++    base::DeleteFile(zip_path);
++    return result;
++  }
++
 +  // Step 1: Verify signature
-+  if (!VerifyEd25519Signature(zip_path, signature, kServerUpdatePublicKey)) {
++  if (!VerifyPackageSignature(file, digest_signature, signature)) {
 +    result.error = "Signature verification failed";
++    file.Close();
 +    base::DeleteFile(zip_path);
 +    return result;
 +  }
@@ -243,13 +307,19 @@ index 0000000000000..9050130727fc8
 +    LOG(WARNING) << "browseros: Cleaning stale version directory: " << dest_dir;
 +    if (!base::DeletePathRecursively(dest_dir)) {
 +      result.error = "Failed to clean stale version directory";
++      file.Close();
 +      base::DeleteFile(zip_path);
 +      return result;
 +    }
 +  }
 +
-+  // Step 3: Extract ZIP
-+  std::string extract_error = ExtractZipFile(zip_path, dest_dir);
++  // Step 3: Extract ZIP into the version store. Extracting from the verified
++  // handle means the bytes unpacked are the bytes that were checked, even if
++  // the file is replaced on disk meanwhile.
++  VersionStore::ExtractStats stats;
++  std::string extract_error =
++      VersionStore(store_dir).ExtractZip(file, dest_dir, &stats);
++  file.Close();
 +  if (!extract_error.empty()) {
 +    result.error = extract_error;
 +    // Cleanup partial extraction
@@ -258,17 +328,48 @@ index 0000000000000..9050130727fc8
 +    return result;
 +  }
 +
-+  // Success - delete the ZIP file (we have extracted contents)
-+  base::DeleteFile(zip_path);
++  // Success - keep the verified ZIP as the base for future deltas. It lives
++  // in the version directory so it is cleaned up along with it.
++  if (!base::Move(zip_path, dest_dir.AppendASCII(kRetainedPackageFileName))) {
++    base::DeleteFile(zip_path);
++  }
 +  result.success = true;
 +  return result;
 +}
 +
++// Background task: rebuild the new package from the installed version's
++// retained package and a zucchini patch. The patch records checksums of both
++// images, so a wrong base or a corrupt patch fails here rather than producing
++// a bad package. Returns empty string on success, error message on failure.
++std::string DoApplyDelta(const base::FilePath& base_package,
++                         const base::FilePath& patch_path,
++                         const base::FilePath& output_path) {
++  if (!base::PathExists(base_package)) {
++    base::DeleteFile(patch_path);
++    return "No retained package for the installed version";
++  }
++  // The output replaces any partial full download, so its resume state must
++  // not outlive it.
++  base::DeleteFile(ResumableDownload::GetStatePath(output_path));
++
++  zucchini::status::Code status =
++      zucchini::Apply(base_package, patch_path, output_path);
++  base::DeleteFile(patch_path);
++  if (status != zucchini::status::kStatusSuccess) {
++    base::DeleteFile(output_path);
++    return "Failed to apply delta (zucchini status " +
++           base::NumberToString(static_cast<int>(status)) + ")";
++  }
++  return "";
++}
++
 +}  // namespace
 +
 +BrowserOSServerUpdater::BrowserOSServerUpdater(
 +    browseros::BrowserOSServerManager* manager)
-+    : manager_(manager) {}
++    : manager_(manager),
++      store_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_BLOCKING})) {}
 +
 +BrowserOSServerUpdater::~BrowserOSServerUpdater() {
 +  Stop();
@@ -280,11 +381,12 @@ index 0000000000000..9050130727fc8
 +  // Load both version caches async, then start checking
 +  LoadVersionCachesAsync();
 +
-+  update_check_timer_.Start(FROM_HERE, kUpdateCheckInterval, this,
-+                            &BrowserOSServerUpdater::OnUpdateTimer);
++  ScheduleNextCheck();
 +}
 +
 +void BrowserOSServerUpdater::LoadVersionCachesAsync() {
++  version_caches_load_start_ = base::TimeTicks::Now();
++
 +  // Load downloaded version from file
 +  base::FilePath version_file =
 +      GetExecutionDir().AppendASCII(kCurrentVersionFileName);
@@ -365,6 +467,10 @@ index 0000000000000..9050130727fc8
 +    return;  // Wait for both to complete
 +  }
 +
++  manager_->RecordStartupPhase(
++      "updater_version_cache", version_caches_load_start_,
++      base::TimeTicks::Now() - version_caches_load_start_);
++
 +  // Sync version pref with current best version
 +  base::Version current = GetCurrentVersion();
 +  if (current.IsValid()) {
@@ -381,8 +487,8 @@ index 0000000000000..9050130727fc8
 +void BrowserOSServerUpdater::Stop() {
 +  LOG(INFO) << "browseros: Stopping server updater";
 +  update_check_timer_.Stop();
-+  appcast_loader_.reset();
-+  download_loader_.reset();
++  appcast_fetcher_.reset();
++  download_.reset();
 +  status_loader_.reset();
 +  ResetState();
 +}
@@ -407,6 +513,14 @@ index 0000000000000..9050130727fc8
 +
 +void BrowserOSServerUpdater::OnUpdateTimer() {
 +  CheckNow();
++  ScheduleNextCheck();
++}
++
++void BrowserOSServerUpdater::ScheduleNextCheck() {
++  update_check_timer_.Start(
++      FROM_HERE,
++      browseros::GetJitteredDelay(kUpdateCheckInterval, kUpdateCheckJitter),
++      this, &BrowserOSServerUpdater::OnUpdateTimer);
 +}
 +
 +void BrowserOSServerUpdater::FetchAppcast() {
@@ -434,39 +548,44 @@ index 0000000000000..9050130727fc8
 +
 +  LOG(INFO) << "browseros: Fetching appcast from " << url;
 +
-+  auto request = std::make_unique<network::ResourceRequest>();
-+  request->url = url;
-+  request->method = "GET";
-+  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
-+
-+  appcast_loader_ = network::SimpleURLLoader::Create(
-+      std::move(request), GetAppcastTrafficAnnotation());
-+  appcast_loader_->SetTimeoutDuration(kAppcastFetchTimeout);
-+
-+  auto* url_loader_factory = g_browser_process->system_network_context_manager()
-+                                 ->GetURLLoaderFactory();
++  // The fetcher outlives individual checks so it can revalidate the cached
++  // appcast; a different URL (e.g. alpha toggled) gets a fresh cache.
++  if (!appcast_fetcher_ || appcast_fetcher_->url() != url) {
++    appcast_fetcher_ = std::make_unique<browseros::BrowserOSConditionalFetcher>(
++        url, GetExecutionDir().AppendASCII(kAppcastCacheFileName),
++        kMaxAppcastSize, GetAppcastTrafficAnnotation());
++    appcast_fetcher_->SetTimeout(kAppcastFetchTimeout);
++    appcast_handled_ = false;
++  }
 +
-+  appcast_loader_->DownloadToString(
-+      url_loader_factory,
++  appcast_fetcher_->Fetch(
++      g_browser_process->system_network_context_manager()
++          ->GetSharedURLLoaderFactory(),
 +      base::BindOnce(&BrowserOSServerUpdater::OnAppcastFetched,
-+                     weak_factory_.GetWeakPtr()),
-+      kMaxAppcastSize);
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSServerUpdater::OnAppcastFetched(
-+    std::optional<std::string> response) {
-+  if (!response.has_value()) {
-+    int net_error = appcast_loader_->NetError();
++    browseros::BrowserOSConditionalFetcher::Result result) {
++  using Status = browseros::BrowserOSConditionalFetcher::Result::Status;
++  if (result.status == Status::kFailed) {
 +    OnError("check",
-+            "Failed to fetch appcast: " + net::ErrorToString(net_error));
++            "Failed to fetch appcast: " + net::ErrorToString(result.net_error));
++    return;
++  }
++
++  if (result.status == Status::kNotModified && appcast_handled_) {
++    LOG(INFO) << "browseros: Appcast unchanged";
++    ResetState();
 +    return;
 +  }
 +
-+  LOG(INFO) << "browseros: Received appcast (" << response->size() << " bytes)";
++  LOG(INFO) << "browseros: Received appcast (" << result.body.size()
++            << " bytes)";
 +
 +  // Parse the appcast
 +  std::optional<AppcastItem> item =
-+      BrowserOSAppcastParser::ParseLatestItem(*response);
++      BrowserOSAppcastParser::ParseLatestItem(result.body);
 +  if (!item) {
 +    OnError("check", "Failed to parse appcast XML");
 +    return;
@@ -493,6 +612,7 @@ index 0000000000000..9050130727fc8
 +  if (current.IsValid() && current >= item->version) {
 +    LOG(INFO) << "browseros: Already up to date";
 +    ResetState();
++    appcast_handled_ = true;
 +    return;
 +  }
 +
@@ -500,6 +620,7 @@ index 0000000000000..9050130727fc8
 +            << item->version.GetString();
 +  pending_item_ = *item;
 +  pending_signature_ = enclosure->signature;
++  pending_digest_signature_ = enclosure->digest_signature;
 +  CheckVersionAlreadyDownloaded(*enclosure, item->version);
 +}
 +
@@ -507,10 +628,21 @@ index 0000000000000..9050130727fc8
 +    const AppcastEnclosure& enclosure,
 +    const base::Version& version) {
 +  base::FilePath version_dir = GetVersionDir(version);
++  base::Version current = GetCurrentVersion();
++  base::FilePath base_package =
++      current.IsValid() ? GetRetainedPackagePath(current) : base::FilePath();
 +
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock()},
-+      base::BindOnce(&base::PathExists, version_dir),
++      base::BindOnce(
++          [](base::FilePath version_dir, base::FilePath base_package) {
++            LocalVersionState local;
++            local.downloaded = base::PathExists(version_dir);
++            local.has_delta_base =
++                !base_package.empty() && base::PathExists(base_package);
++            return local;
++          },
++          version_dir, base_package),
 +      base::BindOnce(&BrowserOSServerUpdater::OnVersionExistsCheck,
 +                     weak_factory_.GetWeakPtr(), enclosure, version));
 +}
@@ -518,20 +650,31 @@ index 0000000000000..9050130727fc8
 +void BrowserOSServerUpdater::OnVersionExistsCheck(
 +    const AppcastEnclosure& enclosure,
 +    const base::Version& version,
-+    bool exists) {
-+  if (exists) {
++    LocalVersionState local) {
++  if (local.downloaded) {
 +    LOG(INFO) << "browseros: Version " << version.GetString()
 +              << " already downloaded, skipping to test";
 +    TestBinary(version);
 +    return;
 +  }
 +
-+  StartDownload(enclosure, version);
++  // Without the installed version's package a delta can't be applied, so
++  // don't download one only to fall back to the full package.
++  const AppcastEnclosure* delta =
++      local.has_delta_base
++          ? pending_item_.GetDeltaForCurrentPlatform(GetCurrentVersion())
++          : nullptr;
++  if (delta) {
++    LOG(INFO) << "browseros: Using delta from "
++              << delta->delta_from.GetString();
++  }
++  StartDownload(delta ? *delta : enclosure, version);
 +}
 +
 +void BrowserOSServerUpdater::StartDownload(const AppcastEnclosure& enclosure,
 +                                           const base::Version& version) {
 +  state_ = State::kDownloading;
++  delta_base_version_ = enclosure.delta_from;
 +
 +  GURL url(enclosure.url);
 +  if (!url.is_valid()) {
@@ -541,21 +684,33 @@ index 0000000000000..9050130727fc8
 +
 +  // Prepare pending update directory
 +  base::FilePath pending_dir = GetPendingUpdateDir();
++  base::FilePath download_path = pending_dir.AppendASCII(
++      enclosure.is_delta() ? kDeltaFileName : kDownloadFileName);
 +
-+  // Clean up any previous pending update on background thread, then download
++  // Clean up any previous pending update on background thread, except a
++  // partial download of this file that ResumableDownload can pick up again.
 +  base::ThreadPool::PostTaskAndReply(
 +      FROM_HERE, {base::MayBlock()},
 +      base::BindOnce(
-+          [](base::FilePath dir) {
-+            if (base::PathExists(dir)) {
-+              base::DeletePathRecursively(dir);
++          [](base::FilePath dir, base::FilePath keep) {
++            base::FilePath keep_state = ResumableDownload::GetStatePath(keep);
++            base::FileEnumerator enumerator(
++                dir, false,
++                base::FileEnumerator::FILES |
++                    base::FileEnumerator::DIRECTORIES);
++            for (base::FilePath path = enumerator.Next(); !path.empty();
++                 path = enumerator.Next()) {
++              if (path != keep && path != keep_state) {
++                base::DeletePathRecursively(path);
++              }
 +            }
 +            base::CreateDirectory(dir);
 +          },
-+          pending_dir),
++          pending_dir, download_path),
 +      base::BindOnce(
 +          [](base::WeakPtr<BrowserOSServerUpdater> self,
-+             const AppcastEnclosure& enc, const base::Version& ver) {
++             const AppcastEnclosure& enc, const base::Version& ver,
++             const base::FilePath& path) {
 +            if (!self) {
 +              return;
 +            }
@@ -563,65 +718,124 @@ index 0000000000000..9050130727fc8
 +            GURL download_url(enc.url);
 +            LOG(INFO) << "browseros: Downloading " << download_url;
 +
-+            auto request = std::make_unique<network::ResourceRequest>();
-+            request->url = download_url;
-+            request->method = "GET";
-+            request->credentials_mode = network::mojom::CredentialsMode::kOmit;
-+
-+            self->download_loader_ = network::SimpleURLLoader::Create(
-+                std::move(request), GetDownloadTrafficAnnotation());
-+            self->download_loader_->SetTimeoutDuration(kDownloadTimeout);
++            self->download_ = std::make_unique<ResumableDownload>(
++                download_url, path, kMaxUpdatePackageSize,
++                GetDownloadTrafficAnnotation());
++            // Per attempt; an interrupted attempt resumes where it stopped.
++            self->download_->SetAttemptTimeout(kDownloadTimeout);
 +
 +            // Add progress logging (visible with --vmodule=*browseros*=1)
-+            self->download_loader_->SetOnDownloadProgressCallback(
-+                base::BindRepeating([](uint64_t current) {
++            self->download_->SetOnProgressCallback(
++                base::BindRepeating([](int64_t current) {
 +                  LOG(INFO) << "browseros: Download progress: "
 +                            << (current / 1024 / 1024) << " MB";
 +                }));
 +
-+            base::FilePath download_path =
-+                self->GetPendingUpdateDir().AppendASCII(kDownloadFileName);
-+
-+            auto* url_loader_factory =
++            self->download_->Start(
 +                g_browser_process->system_network_context_manager()
-+                    ->GetURLLoaderFactory();
-+
-+            self->download_loader_->DownloadToFile(
-+                url_loader_factory,
++                    ->GetSharedURLLoaderFactory(),
 +                base::BindOnce(&BrowserOSServerUpdater::OnDownloadComplete,
-+                               self, ver),
-+                download_path);
++                               self, ver));
 +          },
-+          weak_factory_.GetWeakPtr(), enclosure, version));
++          weak_factory_.GetWeakPtr(), enclosure, version, download_path));
 +}
 +
 +void BrowserOSServerUpdater::OnDownloadComplete(const base::Version& version,
 +                                                base::FilePath zip_path) {
 +  if (zip_path.empty()) {
-+    int net_error = download_loader_->NetError();
-+    OnError("download", "Download failed: " + net::ErrorToString(net_error));
++    int net_error = download_->net_error();
++    std::string error = "Download failed: " + net::ErrorToString(net_error);
++    if (delta_base_version_.IsValid()) {
++      FallBackToFullPackage("download", error);
++      return;
++    }
++    OnError("download", error);
 +    return;
 +  }
 +
 +  LOG(INFO) << "browseros: Download complete: " << zip_path;
 +
++  if (delta_base_version_.IsValid()) {
++    ApplyDelta(zip_path, version);
++    return;
++  }
++
 +  // Now verify and extract
-+  VerifyAndExtract(zip_path, pending_signature_, version);
++  VerifyAndExtract(zip_path, pending_signature_, pending_digest_signature_,
++                   version);
++}
++
++void BrowserOSServerUpdater::ApplyDelta(const base::FilePath& patch_path,
++                                        const base::Version& version) {
++  state_ = State::kApplyingDelta;
++
++  base::FilePath base_package = GetRetainedPackagePath(delta_base_version_);
++  base::FilePath zip_path =
++      GetPendingUpdateDir().AppendASCII(kDownloadFileName);
++
++  LOG(INFO) << "browseros: Applying delta to " << base_package;
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&DoApplyDelta, base_package, patch_path, zip_path),
++      base::BindOnce(&BrowserOSServerUpdater::OnDeltaApplied,
++                     weak_factory_.GetWeakPtr(), version, zip_path));
++}
++
++void BrowserOSServerUpdater::OnDeltaApplied(const base::Version& version,
++                                            const base::FilePath& zip_path,
++                                            const std::string& error) {
++  if (!error.empty()) {
++    FallBackToFullPackage("delta", error);
++    return;
++  }
++
++  LOG(INFO) << "browseros: Rebuilt package from delta";
++
++  // The rebuilt ZIP must match the full package's signature.
++  VerifyAndExtract(zip_path, pending_signature_, pending_digest_signature_,
++                   version);
++}
++
++void BrowserOSServerUpdater::FallBackToFullPackage(const std::string& stage,
++                                                   const std::string& error) {
++  LOG(WARNING) << "browseros: Delta update failed at " << stage << ": "
++               << error << ", falling back to full package";
++
++  base::Value::Dict props;
++  props.Set("stage", stage);
++  props.Set("error", error);
++  props.Set("from", delta_base_version_.GetString());
++  props.Set("version", pending_item_.version.GetString());
++  browseros_metrics::BrowserOSMetrics::Log("server.ota.delta_fallback",
++                                           std::move(props));
++
++  delta_base_version_ = base::Version();
++  const AppcastEnclosure* enclosure =
++      pending_item_.GetEnclosureForCurrentPlatform();
++  if (!enclosure) {
++    OnError(stage, error);
++    return;
++  }
++  StartDownload(*enclosure, pending_item_.version);
 +}
 +
-+void BrowserOSServerUpdater::VerifyAndExtract(const base::FilePath& zip_path,
-+                                              const std::string& signature,
-+                                              const base::Version& version) {
++void BrowserOSServerUpdater::VerifyAndExtract(
++    const base::FilePath& zip_path,
++    const std::string& signature,
++    const std::string& digest_signature,
++    const base::Version& version) {
 +  state_ = State::kVerifying;
 +
 +  base::FilePath dest_dir = GetVersionDir(version);
 +
 +  LOG(INFO) << "browseros: Verifying signature and extracting to " << dest_dir;
 +
-+  // Run verification and extraction on background thread
-+  base::ThreadPool::PostTaskAndReplyWithResult(
-+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(&DoVerifyAndExtract, zip_path, signature, dest_dir),
++  // Run verification and extraction on the store sequence
++  store_task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE,
++      base::BindOnce(&DoVerifyAndExtract, zip_path, signature,
++                     digest_signature, dest_dir, GetStoreDir()),
 +      base::BindOnce(
 +          [](base::WeakPtr<BrowserOSServerUpdater> self, base::Version version,
 +             VerifyExtractResult result) {
@@ -639,12 +853,24 @@ index 0000000000000..9050130727fc8
 +    bool success,
 +    const std::string& error) {
 +  if (!success) {
++    if (delta_base_version_.IsValid()) {
++      FallBackToFullPackage("verify", error);
++      return;
++    }
 +    OnError("verify", error);
 +    return;
 +  }
 +
 +  LOG(INFO) << "browseros: Verification and extraction successful";
 +
++  if (delta_base_version_.IsValid()) {
++    base::Value::Dict props;
++    props.Set("from", delta_base_version_.GetString());
++    props.Set("version", version.GetString());
++    browseros_metrics::BrowserOSMetrics::Log("server.ota.delta_applied",
++                                             std::move(props));
++  }
++
 +  // Test the binary
 +  TestBinary(version);
 +}
@@ -821,6 +1047,7 @@ index 0000000000000..9050130727fc8
 +                                           std::move(props));
 +
 +  ResetState();
++  appcast_handled_ = true;
 +}
 +
 +base::Version BrowserOSServerUpdater::GetCurrentVersion() {
@@ -888,21 +1115,25 @@ index 0000000000000..9050130727fc8
 +
 +  // Clear cache, pref, and current_version file via shared logic
 +  WriteCurrentVersionFile(base::Version());
++  // The cached appcast must be acted on again to re-download.
++  appcast_handled_ = false;
 +
-+  // Additionally nuke all version directories
++  // Additionally nuke all version directories, and the store contents they
++  // linked to.
 +  base::FilePath versions_dir = GetVersionsDir();
-+  base::ThreadPool::PostTask(
-+      FROM_HERE, {base::MayBlock()},
++  store_task_runner_->PostTask(
++      FROM_HERE,
 +      base::BindOnce(
-+          [](base::FilePath versions_dir) {
++          [](base::FilePath versions_dir, base::FilePath store_dir) {
 +            if (base::PathExists(versions_dir)) {
 +              if (!base::DeletePathRecursively(versions_dir)) {
 +                LOG(ERROR) << "browseros: Failed to delete versions directory: "
 +                           << versions_dir;
 +              }
 +            }
++            VersionStore(store_dir).CollectGarbage();
 +          },
-+          versions_dir));
++          versions_dir, GetStoreDir()));
 +}
 +
 +base::FilePath BrowserOSServerUpdater::GetExecutionDir() const {
@@ -922,6 +1153,10 @@ index 0000000000000..9050130727fc8
 +  return GetVersionsDir().AppendASCII(version.GetString());
 +}
 +
++base::FilePath BrowserOSServerUpdater::GetStoreDir() const {
++  return GetExecutionDir().AppendASCII(kStoreDirectoryName);
++}
++
 +base::FilePath BrowserOSServerUpdater::GetPendingUpdateDir() const {
 +  return GetExecutionDir().AppendASCII(kPendingUpdateDirectoryName);
 +}
@@ -952,6 +1187,11 @@ index 0000000000000..9050130727fc8
 +  return GetVersionDir(version).Append(FILE_PATH_LITERAL("resources"));
 +}
 +
++base::FilePath BrowserOSServerUpdater::GetRetainedPackagePath(
++    const base::Version& version) const {
++  return GetVersionDir(version).AppendASCII(kRetainedPackageFileName);
++}
++
 +base::FilePath BrowserOSServerUpdater::GetBestServerBinaryPath() {
 +  // Use cached versions to avoid blocking I/O
 +  base::Version downloaded = cached_downloaded_version_;
@@ -992,11 +1232,15 @@ index 0000000000000..9050130727fc8
 +
 +void BrowserOSServerUpdater::CleanupOldVersions() {
 +  base::FilePath versions_dir = GetVersionsDir();
++  base::FilePath store_dir = GetStoreDir();
 +
-+  base::ThreadPool::PostTask(
-+      FROM_HERE, {base::MayBlock()},
++  // On the store sequence, so no extraction is linking into the store while
++  // it is collected.
++  store_task_runner_->PostTask(
++      FROM_HERE,
 +      base::BindOnce(
-+          [](base::FilePath dir, int max_to_keep) {
++          [](base::FilePath dir, base::FilePath store_dir,
++             base::Version current, int max_to_keep) {
 +            if (!base::PathExists(dir)) {
 +              return;
 +            }
@@ -1027,14 +1271,29 @@ index 0000000000000..9050130727fc8
 +              deleted++;
 +            }
 +
-+            if (deleted > 0) {
++            // Deltas only ever apply to the current version, so the other
++            // packages would just take up a full download's worth of disk.
++            for (size_t i = 0;
++                 i < versions.size() && i < static_cast<size_t>(max_to_keep);
++                 ++i) {
++              if (versions[i].first != current) {
++                base::DeleteFile(
++                    versions[i].second.AppendASCII(kRetainedPackageFileName));
++              }
++            }
++
++            // Drop store contents only the deleted versions used.
++            int blobs_deleted = VersionStore(store_dir).CollectGarbage();
++
++            if (deleted > 0 || blobs_deleted > 0) {
 +              base::Value::Dict props;
 +              props.Set("deleted_count", deleted);
++              props.Set("blobs_deleted", blobs_deleted);
 +              browseros_metrics::BrowserOSMetrics::Log("server.ota.cleanup",
 +                                                       std::move(props));
 +            }
 +          },
-+          versions_dir, kMaxVersionsToKeep));
++          versions_dir, store_dir, GetCurrentVersion(), kMaxVersionsToKeep));
 +}
 +
 +void BrowserOSServerUpdater::OnError(const std::string& stage,
@@ -1067,18 +1326,26 @@ index 0000000000000..9050130727fc8
 +            version_dir));
 +  }
 +
-+  CleanupPendingUpdate();
++  // A failed download stays in place so the next attempt can resume it.
++  if (stage != "download") {
++    CleanupPendingUpdate();
++  }
++  appcast_handled_ = false;
 +  ResetState();
 +}
 +
 +void BrowserOSServerUpdater::ResetState() {
 +  state_ = State::kIdle;
 +  update_in_progress_ = false;
-+  appcast_loader_.reset();
-+  download_loader_.reset();
++  if (appcast_fetcher_) {
++    appcast_fetcher_->Cancel();
++  }
++  download_.reset();
 +  status_loader_.reset();
 +  pending_item_ = AppcastItem();
 +  pending_signature_.clear();
++  pending_digest_signature_.clear();
++  delta_base_version_ = base::Version();
 +}
 +
 +}  // namespace browseros_server
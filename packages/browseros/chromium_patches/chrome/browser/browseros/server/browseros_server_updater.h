@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_updater.h b/chrome/browser/browseros/server/browseros_server_updater.h
 new file mode 100644
-index 0000000000000..a7edcdd9d98ee
+index 0000000000000..64ceff6c9c5ce
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_updater.h
-@@ -0,0 +1,165 @@
+@@ -0,0 +1,208 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -17,9 +17,12 @@ index 0000000000000..a7edcdd9d98ee
 +
 +#include "base/files/file_path.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/task/sequenced_task_runner.h"
 +#include "base/timer/timer.h"
 +#include "base/version.h"
++#include "chrome/browser/browseros/core/browseros_conditional_fetcher.h"
 +#include "chrome/browser/browseros/server/browseros_appcast_parser.h"
 +#include "chrome/browser/browseros/server/server_updater.h"
 +
@@ -33,14 +36,19 @@ index 0000000000000..a7edcdd9d98ee
 +
 +namespace browseros_server {
 +
++class ResumableDownload;
++
 +// Manages automatic updates for the BrowserOS server binary.
 +//
 +// Update flow:
 +// 1. Fetch appcast XML from CDN
 +// 2. Parse and find matching platform enclosure
-+// 3. Download ZIP if newer version available
-+// 4. Verify Ed25519 signature
-+// 5. Extract to versions/{version}/
++// 3. Download ZIP if newer version available (resuming a partial download
++//    left by an earlier attempt), or a zucchini delta against
++//    the installed version's retained package and rebuild the ZIP from it
++// 4. Verify Ed25519 signature (falling back to the full ZIP for deltas)
++// 5. Extract to versions/{version}/ as hard links into the content-addressed
++//    store/, so files unchanged between versions are stored once
 +// 6. Test binary with --version
 +// 7. Update current_version file
 +// 8. Signal manager to use new binary on next restart
@@ -68,31 +76,50 @@ index 0000000000000..a7edcdd9d98ee
 +    kIdle,
 +    kFetchingAppcast,
 +    kDownloading,
++    kApplyingDelta,
 +    kVerifying,
 +    kExtracting,
 +    kTesting,
 +  };
 +
 +  void OnUpdateTimer();
++  void ScheduleNextCheck();
 +
 +  // Appcast flow
 +  void FetchAppcast();
-+  void OnAppcastFetched(std::optional<std::string> response);
++  void OnAppcastFetched(browseros::BrowserOSConditionalFetcher::Result result);
 +
 +  // Download flow
 +  void CheckVersionAlreadyDownloaded(const AppcastEnclosure& enclosure,
 +                                     const base::Version& version);
++  // What is on disk for an update, checked off the UI thread.
++  struct LocalVersionState {
++    bool downloaded = false;
++    // The installed version kept its package, so a delta can apply to it.
++    // Never true for the bundled version or ones installed without one.
++    bool has_delta_base = false;
++  };
 +  void OnVersionExistsCheck(const AppcastEnclosure& enclosure,
 +                            const base::Version& version,
-+                            bool exists);
++                            LocalVersionState local);
 +  void StartDownload(const AppcastEnclosure& enclosure,
 +                     const base::Version& version);
 +  void OnDownloadComplete(const base::Version& version,
 +                          base::FilePath zip_path);
 +
++  // Delta flow. Any failure falls back to the full package.
++  void ApplyDelta(const base::FilePath& patch_path,
++                  const base::Version& version);
++  void OnDeltaApplied(const base::Version& version,
++                      const base::FilePath& zip_path,
++                      const std::string& error);
++  void FallBackToFullPackage(const std::string& stage,
++                             const std::string& error);
++
 +  // Verification flow (runs on background thread)
 +  void VerifyAndExtract(const base::FilePath& zip_path,
 +                        const std::string& signature,
++                        const std::string& digest_signature,
 +                        const base::Version& version);
 +  void OnVerifyAndExtractComplete(const base::Version& version,
 +                                  bool success,
@@ -127,14 +154,18 @@ index 0000000000000..a7edcdd9d98ee
 +  base::FilePath GetExecutionDir() const;
 +  base::FilePath GetVersionsDir() const;
 +  base::FilePath GetVersionDir(const base::Version& version) const;
++  base::FilePath GetStoreDir() const;
 +  base::FilePath GetPendingUpdateDir() const;
 +  base::FilePath GetBundledBinaryPath() const;
 +  base::FilePath GetBundledResourcesPath() const;
 +  base::FilePath GetDownloadedBinaryPath(const base::Version& version) const;
 +  base::FilePath GetDownloadedResourcesPath(const base::Version& version) const;
++  base::FilePath GetRetainedPackagePath(const base::Version& version) const;
 +
 +  // Cleanup
 +  void CleanupPendingUpdate();
++  // Keeps the newest versions, and the retained package of the current
++  // one only.
 +  void CleanupOldVersions();
 +
 +  // Error handling
@@ -143,25 +174,37 @@ index 0000000000000..a7edcdd9d98ee
 +
 +  raw_ptr<browseros::BrowserOSServerManager> manager_;
 +
-+  base::RepeatingTimer update_check_timer_;
++  base::OneShotTimer update_check_timer_;
 +
 +  State state_ = State::kIdle;
 +  bool update_in_progress_ = false;
 +
 +  // Keep loaders alive during async operations
-+  std::unique_ptr<network::SimpleURLLoader> appcast_loader_;
-+  std::unique_ptr<network::SimpleURLLoader> download_loader_;
++  std::unique_ptr<browseros::BrowserOSConditionalFetcher> appcast_fetcher_;
++  std::unique_ptr<ResumableDownload> download_;
 +  std::unique_ptr<network::SimpleURLLoader> status_loader_;
 +
 +  // Pending update info
 +  AppcastItem pending_item_;
++  // True once the cached appcast has been acted on (up to date, or updated
++  // to its version), so an unchanged appcast can be skipped. Cleared on
++  // errors so that the next check retries.
++  bool appcast_handled_ = false;
 +  std::string pending_signature_;
++  std::string pending_digest_signature_;
++  // Version the in-flight delta applies to; invalid for full downloads.
++  base::Version delta_base_version_;
 +
 +  // Cached versions (loaded async at startup via --version)
 +  base::Version cached_bundled_version_;
 +  base::Version cached_downloaded_version_;
 +  bool bundled_version_loaded_ = false;
 +  bool downloaded_version_loaded_ = false;
++  base::TimeTicks version_caches_load_start_;
++
++  // Runs everything that writes to the version store: extraction and garbage
++  // collection must not overlap, or a blob not yet linked would be collected.
++  scoped_refptr<base::SequencedTaskRunner> store_task_runner_;
 +
 +  base::WeakPtrFactory<BrowserOSServerUpdater> weak_factory_{this};
 +};
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils.cc b/chrome/browser/browseros/server/browseros_server_utils.cc
 new file mode 100644
-index 0000000000000..8b3137bf24e8a
+index 0000000000000..236210642b493
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils.cc
-@@ -0,0 +1,518 @@
+@@ -0,0 +1,550 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -21,7 +21,6 @@ index 0000000000000..8b3137bf24e8a
 +#include "base/process/process.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/string_split.h"
-+#include "base/threading/platform_thread.h"
 +#include "build/build_config.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
 +#include "chrome/common/chrome_paths.h"
@@ -35,7 +34,9 @@ index 0000000000000..8b3137bf24e8a
 +#include "net/socket/tcp_socket.h"
 +
 +#if BUILDFLAG(IS_POSIX)
++#include <netinet/in.h>
 +#include <signal.h>
++#include <sys/socket.h>
 +#include <sys/types.h>
 +#endif
 +
@@ -50,6 +51,10 @@ index 0000000000000..8b3137bf24e8a
 +#include "base/files/file_path.h"
 +#endif
 +
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++#include <sys/syscall.h>
++#endif
++
 +#if BUILDFLAG(IS_WIN)
 +#include <windows.h>
 +
@@ -67,6 +72,8 @@ index 0000000000000..8b3137bf24e8a
 +    FILE_PATH_LITERAL("server.state");
 +constexpr base::FilePath::CharType kLockFileName[] =
 +    FILE_PATH_LITERAL("server.lock");
++constexpr base::FilePath::CharType kStartupTimelineFileName[] =
++    FILE_PATH_LITERAL("startup_timeline.json");
 +
 +}  // namespace
 +
@@ -166,6 +173,77 @@ index 0000000000000..8b3137bf24e8a
 +  return true;
 +}
 +
++#if BUILDFLAG(IS_POSIX)
++BoundPort::BoundPort() = default;
++BoundPort::BoundPort(BoundPort&&) = default;
++BoundPort& BoundPort::operator=(BoundPort&&) = default;
++BoundPort::~BoundPort() = default;
++
++namespace {
++
++// Same restrictions as IsPortAvailable().
++bool IsUsablePort(int port) {
++  return net::IsPortValid(port) && port != 0 && !net::IsWellKnownPort(port) &&
++         net::IsPortAllowedForScheme(port, "http");
++}
++
++base::ScopedFD BindLoopbackListener(int port) {
++  base::ScopedFD fd(socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0));
++  if (!fd.is_valid()) {
++    return base::ScopedFD();
++  }
++
++#if !BUILDFLAG(IS_APPLE)
++  // Lets the bind succeed over TIME_WAIT from a crashed server. On Linux
++  // this still fails if anything is listening on the port; macOS would let
++  // us shadow a wildcard listener, so don't set it there.
++  int reuse = 1;
++  setsockopt(fd.get(), SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
++#endif
++
++  sockaddr_in address = {};
++  address.sin_family = AF_INET;
++  address.sin_port = htons(static_cast<uint16_t>(port));
++  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
++  if (bind(fd.get(), reinterpret_cast<sockaddr*>(&address), sizeof(address)) !=
++          0 ||
++      listen(fd.get(), SOMAXCONN) != 0) {
++    return base::ScopedFD();
++  }
++  return fd;
++}
++
++}  // namespace
++
++BoundPort BindAvailablePort(int starting_port, const std::set<int>& excluded) {
++  BoundPort result;
++  for (int i = 0; i < kMaxPortAttempts; i++) {
++    int port_to_try = starting_port + i;
++    if (port_to_try > kMaxPort) {
++      break;
++    }
++    if (excluded.count(port_to_try) > 0 || !IsUsablePort(port_to_try)) {
++      continue;
++    }
++
++    result.fd = BindLoopbackListener(port_to_try);
++    if (result.fd.is_valid()) {
++      result.port = port_to_try;
++      if (port_to_try != starting_port) {
++        LOG(INFO) << "browseros: Port " << starting_port
++                  << " was in use or excluded, bound " << port_to_try
++                  << " instead";
++      }
++      return result;
++    }
++  }
++
++  LOG(WARNING) << "browseros: Could not bind a port after "
++               << kMaxPortAttempts << " attempts from " << starting_port;
++  return result;
++}
++#endif  // BUILDFLAG(IS_POSIX)
++
 +// =============================================================================
 +// Path Utilities
 +// =============================================================================
@@ -260,6 +338,14 @@ index 0000000000000..8b3137bf24e8a
 +  return exec_dir.Append(kStateFileName);
 +}
 +
++base::FilePath GetStartupTimelinePath() {
++  base::FilePath exec_dir = GetExecutionDir();
++  if (exec_dir.empty()) {
++    return base::FilePath();
++  }
++  return exec_dir.Append(kStartupTimelineFileName);
++}
++
 +// =============================================================================
 +// State File (Orphan Recovery)
 +// =============================================================================
@@ -454,71 +540,17 @@ index 0000000000000..8b3137bf24e8a
 +#endif
 +}
 +
-+bool KillProcess(base::ProcessId pid, base::TimeDelta graceful_timeout) {
 +#if BUILDFLAG(IS_POSIX)
-+  // First try SIGTERM for graceful shutdown
-+  if (kill(pid, SIGTERM) != 0) {
-+    if (errno == ESRCH) {
-+      return true;  // Process already gone
-+    }
-+    PLOG(WARNING) << "browseros: Failed to send SIGTERM to PID " << pid;
-+    return false;
-+  }
-+
-+  // Wait for graceful shutdown
-+  base::TimeTicks deadline = base::TimeTicks::Now() + graceful_timeout;
-+  while (base::TimeTicks::Now() < deadline) {
-+    if (!ProcessExists(pid)) {
-+      LOG(INFO) << "browseros: Process " << pid
-+                << " terminated gracefully after SIGTERM";
-+      return true;
-+    }
-+    base::PlatformThread::Sleep(base::Milliseconds(100));
-+  }
-+
-+  // Still running, send SIGKILL
-+  LOG(WARNING) << "browseros: Process " << pid
-+               << " did not terminate after SIGTERM, sending SIGKILL";
-+  if (kill(pid, SIGKILL) != 0) {
-+    if (errno == ESRCH) {
-+      return true;  // Gone between checks
-+    }
-+    PLOG(ERROR) << "browseros: Failed to send SIGKILL to PID " << pid;
-+    return false;
-+  }
-+
-+  // Wait briefly for SIGKILL to take effect
-+  base::PlatformThread::Sleep(base::Milliseconds(500));
-+  return !ProcessExists(pid);
-+
-+#elif BUILDFLAG(IS_WIN)
-+  base::win::ScopedHandle handle(OpenProcess(PROCESS_TERMINATE, FALSE, pid));
-+  if (!handle.is_valid()) {
-+    DWORD error = GetLastError();
-+    if (error == ERROR_INVALID_PARAMETER) {
-+      return true;  // Process doesn't exist
-+    }
-+    LOG(ERROR) << "browseros: Failed to open process " << pid
-+               << " for termination, error: " << error;
-+    return false;
++base::ScopedFD OpenPidFd(base::ProcessId pid) {
++#if (BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)) && defined(__NR_pidfd_open)
++  int fd = static_cast<int>(syscall(__NR_pidfd_open, pid, 0));
++  if (fd >= 0) {
++    return base::ScopedFD(fd);
 +  }
-+
-+  if (!TerminateProcess(handle.Get(), 1)) {
-+    DWORD error = GetLastError();
-+    LOG(ERROR) << "browseros: Failed to terminate process " << pid
-+               << ", error: " << error;
-+    return false;
-+  }
-+
-+  // Wait for process to exit
-+  DWORD wait_result =
-+      WaitForSingleObject(handle.Get(),
-+                          static_cast<DWORD>(graceful_timeout.InMilliseconds()));
-+  return wait_result == WAIT_OBJECT_0;
-+
-+#else
-+  return false;
++  PLOG(WARNING) << "browseros: pidfd_open failed, polling for exit";
 +#endif
++  return base::ScopedFD();
 +}
++#endif
 +
 +}  // namespace browseros::server_utils
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils.h b/chrome/browser/browseros/server/browseros_server_utils.h
 new file mode 100644
-index 0000000000000..6251f1274bcc6
+index 0000000000000..95891807acdab
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils.h
-@@ -0,0 +1,89 @@
+@@ -0,0 +1,119 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -18,6 +18,11 @@ index 0000000000000..6251f1274bcc6
 +#include "base/files/file_path.h"
 +#include "base/process/process_handle.h"
 +#include "base/time/time.h"
++#include "build/build_config.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include "base/files/scoped_file.h"
++#endif
 +
 +namespace browseros::server_utils {
 +
@@ -37,6 +42,24 @@ index 0000000000000..6251f1274bcc6
 +// When |allow_reuse| is true, uses SO_REUSEADDR for the probe.
 +bool IsPortAvailable(int port, bool allow_reuse = false);
 +
++#if BUILDFLAG(IS_POSIX)
++// A listening socket on 127.0.0.1 bound by the browser for the server.
++struct BoundPort {
++  BoundPort();
++  BoundPort(BoundPort&&);
++  BoundPort& operator=(BoundPort&&);
++  ~BoundPort();
++
++  int port = 0;
++  base::ScopedFD fd;
++};
++
++// Like FindAvailablePort(), but binds and listens instead of probing, so the
++// port stays claimed for as long as |fd| is open. Returns an invalid fd if
++// no port could be bound.
++BoundPort BindAvailablePort(int starting_port, const std::set<int>& excluded);
++#endif
++
 +// =============================================================================
 +// Path Utilities
 +// =============================================================================
@@ -57,6 +80,10 @@ index 0000000000000..6251f1274bcc6
 +// Returns path to the state file (execution_dir/server.state).
 +base::FilePath GetStateFilePath();
 +
++// Returns path to the last startup timeline
++// (execution_dir/startup_timeline.json).
++base::FilePath GetStartupTimelinePath();
++
 +// =============================================================================
 +// State File (Orphan Recovery)
 +// =============================================================================
@@ -86,9 +113,12 @@ index 0000000000000..6251f1274bcc6
 +// Returns true if a process with the given PID exists.
 +bool ProcessExists(base::ProcessId pid);
 +
-+// Kills a process. First sends SIGTERM, waits for graceful_timeout,
-+// then sends SIGKILL if still running.
-+bool KillProcess(base::ProcessId pid, base::TimeDelta graceful_timeout);
++#if BUILDFLAG(IS_POSIX)
++// Opens a descriptor that becomes readable when |pid| exits. Returns an
++// invalid fd where pidfd is unsupported (non-Linux, kernels before 5.3);
++// callers then have to poll.
++base::ScopedFD OpenPidFd(base::ProcessId pid);
++#endif
 +
 +}  // namespace browseros::server_utils
 +
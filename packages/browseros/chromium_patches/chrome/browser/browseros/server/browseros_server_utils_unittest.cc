@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils_unittest.cc b/chrome/browser/browseros/server/browseros_server_utils_unittest.cc
 new file mode 100644
-index 0000000000000..ad434d78b5e68
+index 0000000000000..94af32dcb359e
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils_unittest.cc
-@@ -0,0 +1,91 @@
+@@ -0,0 +1,109 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -15,6 +15,7 @@ index 0000000000000..ad434d78b5e68
 +#include "base/files/file_path.h"
 +#include "base/files/file_util.h"
 +#include "base/files/scoped_temp_dir.h"
++#include "build/build_config.h"
 +#include "testing/gtest/include/gtest/gtest.h"
 +
 +namespace browseros::server_utils {
@@ -71,6 +72,23 @@ index 0000000000000..ad434d78b5e68
 +  EXPECT_GE(found, 10000);
 +}
 +
++#if BUILDFLAG(IS_POSIX)
++TEST(ServerUtilsPortTest, BindAvailablePort_HoldsPortUntilClosed) {
++  BoundPort first = BindAvailablePort(10100, {});
++  ASSERT_TRUE(first.fd.is_valid());
++  EXPECT_GE(first.port, 10100);
++  EXPECT_FALSE(IsPortAvailable(first.port));
++
++  // A second claim starting at the same port must move past the held one.
++  BoundPort second = BindAvailablePort(first.port, {});
++  ASSERT_TRUE(second.fd.is_valid());
++  EXPECT_NE(second.port, first.port);
++
++  first.fd.reset();
++  EXPECT_TRUE(IsPortAvailable(first.port));
++}
++#endif
++
 +// =============================================================================
 +// Path Utility Tests
 +// =============================================================================
@@ -0,0 +1,48 @@
+diff --git a/chrome/browser/browseros/server/liveness_monitor.h b/chrome/browser/browseros/server/liveness_monitor.h
+new file mode 100644
+index 0000000000000..2c993b634ab90
+--- /dev/null
++++ b/chrome/browser/browseros/server/liveness_monitor.h
+@@ -0,0 +1,42 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_LIVENESS_MONITOR_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_LIVENESS_MONITOR_H_
++
++#include "base/functional/callback.h"
++#include "base/process/process.h"
++
++namespace browseros {
++
++// Exit code reported when the process was killed by a signal or its status
++// could not be read. Matches base::Process for signaled processes and is
++// never taken for a clean exit.
++inline constexpr int kUnknownExitCode = -1;
++
++// Interface for push-based exit signals from the server process.
++// Abstracted to enable unit testing without spawning real OS processes.
++//
++// Exit is reported as soon as the kernel signals it (pidfd on Linux). The
++// monitor only peeks at the exit status and never reaps the process; that
++// is left to whoever owns the base::Process. Hangs are not detected here:
++// BrowserOSServerManager keeps polling the server's HTTP /health endpoint.
++class LivenessMonitor {
++ public:
++  using ExitCallback = base::OnceCallback<void(int exit_code)>;
++
++  virtual ~LivenessMonitor() = default;
++
++  // Begins watching |process|. |on_exited| runs at most once, on the calling
++  // sequence. Returns true if exit is pushed via |on_exited|; if false the
++  // caller must keep polling the process for exit.
++  virtual bool Start(const base::Process& process, ExitCallback on_exited) = 0;
++
++  // Stops watching. |on_exited| does not run after this returns.
++  virtual void Stop() = 0;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_LIVENESS_MONITOR_H_
@@ -0,0 +1,126 @@
+diff --git a/chrome/browser/browseros/server/liveness_monitor_impl.cc b/chrome/browser/browseros/server/liveness_monitor_impl.cc
+new file mode 100644
+index 0000000000000..03c45106d9232
+--- /dev/null
++++ b/chrome/browser/browseros/server/liveness_monitor_impl.cc
+@@ -0,0 +1,120 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/liveness_monitor_impl.h"
++
++#include <memory>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/bind_post_task.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "build/build_config.h"
++#include "chrome/browser/browseros/server/browseros_server_utils.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include <sys/wait.h>
++
++#include "base/files/file_descriptor_watcher_posix.h"
++#include "base/files/scoped_file.h"
++#include "base/posix/eintr_wrapper.h"
++#endif
++
++namespace browseros {
++
++#if BUILDFLAG(IS_POSIX)
++
++class LivenessMonitorImpl::Core {
++ public:
++  Core(base::ProcessId pid, base::ScopedFD pidfd, ExitCallback on_exited)
++      : pid_(pid), pidfd_(std::move(pidfd)), on_exited_(std::move(on_exited)) {
++    exit_watcher_ = base::FileDescriptorWatcher::WatchReadable(
++        pidfd_.get(),
++        base::BindRepeating(&Core::OnExitSignaled, base::Unretained(this)));
++  }
++
++  Core(const Core&) = delete;
++  Core& operator=(const Core&) = delete;
++
++  ~Core() = default;
++
++ private:
++  void OnExitSignaled() {
++    exit_watcher_.reset();
++
++    // WNOWAIT leaves the zombie in place: the owner of the base::Process
++    // reaps it, so no other waiter can lose the status to this one.
++    siginfo_t info = {};
++    int exit_code = kUnknownExitCode;
++    if (HANDLE_EINTR(waitid(P_PID, static_cast<id_t>(pid_), &info,
++                            WEXITED | WNOHANG | WNOWAIT)) != 0) {
++      PLOG(WARNING) << "browseros: pidfd signaled but exit status unavailable";
++    } else if (info.si_pid == pid_ && info.si_code == CLD_EXITED) {
++      exit_code = info.si_status;
++    }
++
++    if (on_exited_) {
++      std::move(on_exited_).Run(exit_code);
++    }
++  }
++
++  const base::ProcessId pid_;
++  base::ScopedFD pidfd_;
++  std::unique_ptr<base::FileDescriptorWatcher::Controller> exit_watcher_;
++  ExitCallback on_exited_;
++};
++
++#else
++
++// Never instantiated; Start() returns before creating a Core.
++class LivenessMonitorImpl::Core {};
++
++#endif  // BUILDFLAG(IS_POSIX)
++
++LivenessMonitorImpl::LivenessMonitorImpl()
++    : task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
++           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {}
++
++LivenessMonitorImpl::~LivenessMonitorImpl() = default;
++
++bool LivenessMonitorImpl::Start(const base::Process& process,
++                                ExitCallback on_exited) {
++  Stop();
++
++#if BUILDFLAG(IS_POSIX)
++  base::ScopedFD pidfd = server_utils::OpenPidFd(process.Pid());
++  if (!pidfd.is_valid()) {
++    return false;
++  }
++
++  on_exited_ = std::move(on_exited);
++  core_ = base::SequenceBound<Core>(
++      task_runner_, process.Pid(), std::move(pidfd),
++      base::BindPostTaskToCurrentDefault(base::BindOnce(
++          &LivenessMonitorImpl::OnExited, weak_factory_.GetWeakPtr())));
++
++  LOG(INFO) << "browseros: Watching server PID " << process.Pid()
++            << " via pidfd";
++  return true;
++#else
++  return false;
++#endif
++}
++
++void LivenessMonitorImpl::Stop() {
++  core_.Reset();
++  weak_factory_.InvalidateWeakPtrs();
++  on_exited_.Reset();
++}
++
++void LivenessMonitorImpl::OnExited(int exit_code) {
++  if (on_exited_) {
++    std::move(on_exited_).Run(exit_code);
++  }
++}
++
++}  // namespace browseros
@@ -0,0 +1,56 @@
+diff --git a/chrome/browser/browseros/server/liveness_monitor_impl.h b/chrome/browser/browseros/server/liveness_monitor_impl.h
+new file mode 100644
+index 0000000000000..3020e03287f08
+--- /dev/null
++++ b/chrome/browser/browseros/server/liveness_monitor_impl.h
+@@ -0,0 +1,50 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_LIVENESS_MONITOR_IMPL_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_LIVENESS_MONITOR_IMPL_H_
++
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/threading/sequence_bound.h"
++#include "chrome/browser/browseros/server/liveness_monitor.h"
++
++namespace base {
++class SequencedTaskRunner;
++}
++
++namespace browseros {
++
++// Production implementation of LivenessMonitor.
++// Watches a pidfd (Linux) on a background sequence and posts the exit back
++// to the owning sequence. Where no pidfd can be opened Start() returns false
++// and the caller keeps polling.
++class LivenessMonitorImpl : public LivenessMonitor {
++ public:
++  LivenessMonitorImpl();
++  ~LivenessMonitorImpl() override;
++
++  LivenessMonitorImpl(const LivenessMonitorImpl&) = delete;
++  LivenessMonitorImpl& operator=(const LivenessMonitorImpl&) = delete;
++
++  // LivenessMonitor implementation:
++  bool Start(const base::Process& process, ExitCallback on_exited) override;
++  void Stop() override;
++
++ private:
++  // Lives on |task_runner_|; owns the pidfd and its watcher.
++  class Core;
++
++  void OnExited(int exit_code);
++
++  scoped_refptr<base::SequencedTaskRunner> task_runner_;
++  base::SequenceBound<Core> core_;
++  ExitCallback on_exited_;
++
++  base::WeakPtrFactory<LivenessMonitorImpl> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_LIVENESS_MONITOR_IMPL_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/process_controller.h b/chrome/browser/browseros/server/process_controller.h
 new file mode 100644
-index 0000000000000..08c04e406dac8
+index 0000000000000..78ab5f7d19a65
 --- /dev/null
 +++ b/chrome/browser/browseros/server/process_controller.h
-@@ -0,0 +1,60 @@
+@@ -0,0 +1,90 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -23,6 +23,39 @@ index 0000000000000..08c04e406dac8
 +struct LaunchResult {
 +  base::Process process;
 +  bool used_fallback = false;
++
++  // Where the blocking launch work spent its time, for the startup timeline.
++  base::TimeTicks config_write_start;
++  base::TimeTicks spawn_start;
++  base::TimeTicks spawn_end;
++};
++
++enum class TerminationMode {
++  // Send SIGTERM now and SIGKILL once the grace period expires.
++  kGraceful,
++  // The process was already asked to exit (e.g. over HTTP); only SIGKILL it
++  // if it is still running when the grace period expires.
++  kAwaitExit,
++};
++
++struct TerminationResult {
++  // False if the process was still running when termination gave up.
++  bool exited = false;
++  // True if SIGKILL had to be sent.
++  bool killed = false;
++  // From the start of termination to the observed exit.
++  base::TimeDelta latency;
++};
++
++using TerminationCallback = base::OnceCallback<void(TerminationResult)>;
++
++// Aggregate of TerminationResults.
++struct TerminationStats {
++  int count = 0;
++  int killed = 0;
++  int failed = 0;
++  base::TimeDelta last_latency;
++  base::TimeDelta max_latency;
 +};
 +
 +// Interface for process lifecycle operations.
@@ -41,12 +74,14 @@ index 0000000000000..08c04e406dac8
 +  // thread). If wait=false, just sends kill signal and returns immediately.
 +  virtual void Terminate(base::Process* process, bool wait) = 0;
 +
-+  // Wait for process to exit within timeout.
-+  // Returns true if process exited, false if timeout expired.
-+  // Must be called from a thread that allows blocking.
-+  virtual bool WaitForExitWithTimeout(base::Process* process,
-+                                      base::TimeDelta timeout,
-+                                      int* exit_code) = 0;
++  // Terminate |process| without blocking any thread. Escalates to SIGKILL
++  // after |grace_period| (immediately if zero) and replies on the calling
++  // sequence as soon as the exit is observed. |process| need not be a child,
++  // so this also works for orphans from a previous browser session.
++  virtual void TerminateAsync(base::Process process,
++                              TerminationMode mode,
++                              base::TimeDelta grace_period,
++                              TerminationCallback callback) = 0;
 +
 +  // Check if a process with the given PID exists.
 +  virtual bool Exists(base::ProcessId pid) = 0;
@@ -54,11 +89,6 @@ index 0000000000000..08c04e406dac8
 +  // Get process creation time in milliseconds since epoch.
 +  // Returns nullopt if process doesn't exist or time couldn't be retrieved.
 +  virtual std::optional<int64_t> GetCreationTime(base::ProcessId pid) = 0;
-+
-+  // Kill process with graceful timeout.
-+  // First sends SIGTERM, waits for graceful_timeout, then SIGKILL if needed.
-+  // Returns true if process was successfully killed (or already gone).
-+  virtual bool Kill(base::ProcessId pid, base::TimeDelta graceful_timeout) = 0;
 +};
 +
 +}  // namespace browseros
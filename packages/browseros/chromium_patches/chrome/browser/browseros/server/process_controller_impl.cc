@@ -1,28 +1,40 @@
 diff --git a/chrome/browser/browseros/server/process_controller_impl.cc b/chrome/browser/browseros/server/process_controller_impl.cc
 new file mode 100644
-index 0000000000000..a398856f672fd
+index 0000000000000..cc652a409a859
 --- /dev/null
 +++ b/chrome/browser/browseros/server/process_controller_impl.cc
-@@ -0,0 +1,210 @@
+@@ -0,0 +1,423 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/process_controller_impl.h"
 +
++#include <memory>
 +#include <optional>
++#include <utility>
 +
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +
 +#include "base/files/file_util.h"
++#include "base/functional/bind.h"
 +#include "base/json/json_writer.h"
 +#include "base/logging.h"
 +#include "base/process/launch.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/task/bind_post_task.h"
++#include "base/task/thread_pool.h"
++#include "base/timer/timer.h"
 +#include "build/build_config.h"
 +
 +#if BUILDFLAG(IS_POSIX)
++#include <errno.h>
 +#include <signal.h>
++#include <sys/wait.h>
++
++#include "base/files/file_descriptor_watcher_posix.h"
++#include "base/files/scoped_file.h"
++#include "base/posix/eintr_wrapper.h"
 +#endif
 +
 +namespace browseros {
@@ -67,6 +79,28 @@ index 0000000000000..a398856f672fd
 +  instance.Set("chromium_version", config.identity.chromium_version);
 +  root.Set("instance", std::move(instance));
 +
++  // sockets (the sidecar listens on "server" and may connect to "cdp")
++  if (config.sockets.IsEnabled()) {
++    base::Value::Dict sockets;
++    sockets.Set("server", config.sockets.server.AsUTF8Unsafe());
++    sockets.Set("cdp", config.sockets.cdp.AsUTF8Unsafe());
++    sockets.Set("proxy", config.sockets.proxy.AsUTF8Unsafe());
++    root.Set("sockets", std::move(sockets));
++  }
++
++  // listen_fds (already listening; adopt instead of binding the port)
++  if (config.server_listen_fd >= 0 || config.extension_listen_fd >= 0) {
++    base::Value::Dict listen_fds;
++    if (config.server_listen_fd >= 0) {
++      listen_fds.Set("server", kServerListenChildFd);
++    }
++    if (config.extension_listen_fd >= 0) {
++      listen_fds.Set("extension", kExtensionListenChildFd);
++    }
++    listen_fds.Set("adopt_failed_exit_code", kListenFdsAdoptFailedExitCode);
++    root.Set("listen_fds", std::move(listen_fds));
++  }
++
 +  std::optional<std::string> json_output = base::WriteJson(root);
 +  if (!json_output.has_value()) {
 +    LOG(ERROR) << "browseros: Failed to serialize config to JSON";
@@ -82,6 +116,175 @@ index 0000000000000..a398856f672fd
 +  return config_path;
 +}
 +
++// How often to check for exit where no pidfd is available.
++constexpr base::TimeDelta kExitPollInterval = base::Milliseconds(20);
++
++// How long to wait for the exit after SIGKILL before giving up.
++constexpr base::TimeDelta kKillTimeout = base::Seconds(2);
++
++// Drives one termination on a background sequence: exit is pushed by a pidfd
++// on Linux and polled elsewhere, escalation is timer-driven, and nothing
++// sleeps. Deletes itself after running the callback.
++class ProcessTerminator {
++ public:
++  ProcessTerminator(base::Process process,
++                    TerminationMode mode,
++                    base::TimeDelta grace_period,
++                    TerminationCallback callback)
++      : process_(std::move(process)),
++        mode_(mode),
++        grace_period_(grace_period),
++        callback_(std::move(callback)) {}
++
++  ProcessTerminator(const ProcessTerminator&) = delete;
++  ProcessTerminator& operator=(const ProcessTerminator&) = delete;
++
++  ~ProcessTerminator() = default;
++
++  void Start() {
++    start_time_ = base::TimeTicks::Now();
++    if (!process_.IsValid() || HasExited()) {
++      Finish(/*exited=*/true);
++      return;
++    }
++
++#if BUILDFLAG(IS_POSIX)
++    pidfd_ = server_utils::OpenPidFd(process_.Pid());
++    if (pidfd_.is_valid()) {
++      exit_watcher_ = base::FileDescriptorWatcher::WatchReadable(
++          pidfd_.get(), base::BindRepeating(&ProcessTerminator::OnExitSignaled,
++                                            base::Unretained(this)));
++    }
++    const bool exit_is_pushed = pidfd_.is_valid();
++    const bool can_ask_to_exit = true;
++#else
++    // Windows has no graceful signal; TerminateProcess is all there is.
++    const bool exit_is_pushed = false;
++    const bool can_ask_to_exit = false;
++#endif
++    if (!exit_is_pushed) {
++      poll_timer_.Start(FROM_HERE, kExitPollInterval, this,
++                        &ProcessTerminator::Poll);
++    }
++
++    if (grace_period_.is_zero() ||
++        (mode_ == TerminationMode::kGraceful && !can_ask_to_exit)) {
++      Kill();
++      return;
++    }
++
++#if BUILDFLAG(IS_POSIX)
++    if (mode_ == TerminationMode::kGraceful && !Signal(SIGTERM)) {
++      return;
++    }
++#endif
++    escalation_timer_.Start(FROM_HERE, grace_period_, this,
++                            &ProcessTerminator::OnGracePeriodExpired);
++  }
++
++ private:
++  bool HasExited() {
++#if BUILDFLAG(IS_POSIX)
++    // Reaps our own children. For anything else, e.g. an orphan adopted by
++    // init, waitpid fails with ECHILD and existence is all we can check.
++    int status = 0;
++    pid_t result = HANDLE_EINTR(waitpid(process_.Pid(), &status, WNOHANG));
++    if (result == process_.Pid()) {
++      return true;
++    }
++    if (result == 0) {
++      return false;
++    }
++    return !server_utils::ProcessExists(process_.Pid());
++#else
++    int exit_code = 0;
++    return process_.WaitForExitWithTimeout(base::TimeDelta(), &exit_code);
++#endif
++  }
++
++#if BUILDFLAG(IS_POSIX)
++  void OnExitSignaled() {
++    // The process is gone; this only reaps it if it is our child.
++    HasExited();
++    Finish(/*exited=*/true);
++  }
++#endif
++
++  void Poll() {
++    if (HasExited()) {
++      Finish(/*exited=*/true);
++    }
++  }
++
++  void OnGracePeriodExpired() {
++    LOG(WARNING) << "browseros: PID " << process_.Pid() << " still running "
++                 << grace_period_.InMilliseconds() << "ms after "
++                 << (mode_ == TerminationMode::kGraceful ? "SIGTERM"
++                                                         : "shutdown request")
++                 << ", sending SIGKILL";
++    Kill();
++  }
++
++  void Kill() {
++#if BUILDFLAG(IS_POSIX)
++    if (!Signal(SIGKILL)) {
++      return;
++    }
++#else
++    if (!process_.Terminate(1, /*wait=*/false)) {
++      Finish(HasExited());
++      return;
++    }
++#endif
++    result_.killed = true;
++    escalation_timer_.Start(FROM_HERE, kKillTimeout, this,
++                            &ProcessTerminator::OnKillTimeout);
++  }
++
++  void OnKillTimeout() {
++    LOG(ERROR) << "browseros: PID " << process_.Pid()
++               << " did not exit after SIGKILL";
++    Finish(/*exited=*/false);
++  }
++
++#if BUILDFLAG(IS_POSIX)
++  // Returns false, having finished, if the process can't be signaled.
++  bool Signal(int signal) {
++    if (kill(process_.Pid(), signal) == 0) {
++      return true;
++    }
++    if (errno == ESRCH) {
++      Finish(/*exited=*/true);
++    } else {
++      PLOG(WARNING) << "browseros: Failed to signal PID " << process_.Pid();
++      Finish(/*exited=*/false);
++    }
++    return false;
++  }
++#endif
++
++  void Finish(bool exited) {
++    result_.exited = exited;
++    result_.latency = base::TimeTicks::Now() - start_time_;
++    std::move(callback_).Run(result_);
++    delete this;
++  }
++
++  base::Process process_;
++  const TerminationMode mode_;
++  const base::TimeDelta grace_period_;
++  TerminationCallback callback_;
++
++  base::TimeTicks start_time_;
++  TerminationResult result_;
++#if BUILDFLAG(IS_POSIX)
++  base::ScopedFD pidfd_;
++  std::unique_ptr<base::FileDescriptorWatcher::Controller> exit_watcher_;
++#endif
++  base::RepeatingTimer poll_timer_;
++  base::OneShotTimer escalation_timer_;
++};
++
 +}  // namespace
 +
 +ProcessControllerImpl::ProcessControllerImpl() = default;
@@ -121,6 +324,7 @@ index 0000000000000..a398856f672fd
 +  }
 +
 +  // Write configuration to JSON file
++  result.config_write_start = base::TimeTicks::Now();
 +  base::FilePath config_path = WriteConfigJson(config, actual_resources_dir);
 +  if (config_path.empty()) {
 +    LOG(ERROR) << "browseros: Failed to write config file, aborting launch";
@@ -141,8 +345,22 @@ index 0000000000000..a398856f672fd
 +  options.start_hidden = true;
 +#endif
 +
++#if BUILDFLAG(IS_POSIX)
++  // Advertised via config JSON only; older servers reject unknown switches.
++  if (config.server_listen_fd >= 0) {
++    options.fds_to_remap.emplace_back(config.server_listen_fd,
++                                      kServerListenChildFd);
++  }
++  if (config.extension_listen_fd >= 0) {
++    options.fds_to_remap.emplace_back(config.extension_listen_fd,
++                                      kExtensionListenChildFd);
++  }
++#endif
++
 +  // Launch the process (blocking I/O)
++  result.spawn_start = base::TimeTicks::Now();
 +  result.process = base::LaunchProcess(cmd, options);
++  result.spawn_end = base::TimeTicks::Now();
 +  return result;
 +}
 +
@@ -180,23 +398,23 @@ index 0000000000000..a398856f672fd
 +#endif
 +}
 +
-+bool ProcessControllerImpl::WaitForExitWithTimeout(base::Process* process,
-+                                                   base::TimeDelta timeout,
-+                                                   int* exit_code) {
-+  if (!process || !process->IsValid()) {
-+    return true;  // No process to wait for
-+  }
-+
-+  LOG(INFO) << "browseros: Waiting for process exit (PID: " << process->Pid()
-+            << ", timeout: " << timeout.InSeconds() << "s)";
-+
-+  bool exited = process->WaitForExitWithTimeout(timeout, exit_code);
-+  if (exited) {
-+    LOG(INFO) << "browseros: Process exited with code " << *exit_code;
-+  } else {
-+    LOG(INFO) << "browseros: Process did not exit within timeout";
-+  }
-+  return exited;
++void ProcessControllerImpl::TerminateAsync(base::Process process,
++                                           TerminationMode mode,
++                                           base::TimeDelta grace_period,
++                                           TerminationCallback callback) {
++  auto terminator = std::make_unique<ProcessTerminator>(
++      std::move(process), mode, grace_period,
++      base::BindPostTaskToCurrentDefault(std::move(callback)));
++  base::ThreadPool::CreateSequencedTaskRunner(
++      {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})
++      ->PostTask(FROM_HERE,
++                 base::BindOnce(
++                     [](std::unique_ptr<ProcessTerminator> terminator) {
++                       // Owns itself until the process is gone.
++                       terminator.release()->Start();
++                     },
++                     std::move(terminator)));
 +}
 +
 +bool ProcessControllerImpl::Exists(base::ProcessId pid) {
@@ -208,9 +426,4 @@ index 0000000000000..a398856f672fd
 +  return server_utils::GetProcessCreationTime(pid);
 +}
 +
-+bool ProcessControllerImpl::Kill(base::ProcessId pid,
-+                                 base::TimeDelta graceful_timeout) {
-+  return server_utils::KillProcess(pid, graceful_timeout);
-+}
-+
 +}  // namespace browseros
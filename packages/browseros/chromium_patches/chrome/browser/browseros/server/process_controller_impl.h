@@ -1,6 +1,6 @@
 diff --git a/chrome/browser/browseros/server/process_controller_impl.h b/chrome/browser/browseros/server/process_controller_impl.h
 new file mode 100644
-index 0000000000000..46f7d9359dcd7
+index 0000000000000..4fe7070dc8938
 --- /dev/null
 +++ b/chrome/browser/browseros/server/process_controller_impl.h
 @@ -0,0 +1,35 @@
@@ -28,12 +28,12 @@ index 0000000000000..46f7d9359dcd7
 +  // ProcessController implementation:
 +  LaunchResult Launch(const ServerLaunchConfig& config) override;
 +  void Terminate(base::Process* process, bool wait) override;
-+  bool WaitForExitWithTimeout(base::Process* process,
-+                              base::TimeDelta timeout,
-+                              int* exit_code) override;
++  void TerminateAsync(base::Process process,
++                      TerminationMode mode,
++                      base::TimeDelta grace_period,
++                      TerminationCallback callback) override;
 +  bool Exists(base::ProcessId pid) override;
 +  std::optional<int64_t> GetCreationTime(base::ProcessId pid) override;
-+  bool Kill(base::ProcessId pid, base::TimeDelta graceful_timeout) override;
 +};
 +
 +}  // namespace browseros
@@ -0,0 +1,123 @@
+diff --git a/chrome/browser/browseros/server/process_controller_impl_unittest.cc b/chrome/browser/browseros/server/process_controller_impl_unittest.cc
+new file mode 100644
+index 0000000000000..faad13064590d
+--- /dev/null
++++ b/chrome/browser/browseros/server/process_controller_impl_unittest.cc
+@@ -0,0 +1,117 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/process_controller_impl.h"
++
++#include <string>
++#include <utility>
++
++#include "base/command_line.h"
++#include "base/process/launch.h"
++#include "base/test/task_environment.h"
++#include "base/test/test_future.h"
++#include "build/build_config.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include <signal.h>
++#include <unistd.h>
++
++#include "base/files/scoped_file.h"
++#include "base/posix/eintr_wrapper.h"
++#endif
++
++namespace browseros {
++namespace {
++
++class ProcessControllerImplTest : public testing::Test {
++ protected:
++  TerminationResult TerminateAndWait(base::Process process,
++                                     TerminationMode mode,
++                                     base::TimeDelta grace_period) {
++    base::test::TestFuture<TerminationResult> future;
++    controller_.TerminateAsync(std::move(process), mode, grace_period,
++                               future.GetCallback());
++    return future.Get();
++  }
++
++  base::test::TaskEnvironment task_environment_;
++  ProcessControllerImpl controller_;
++};
++
++TEST_F(ProcessControllerImplTest, TerminateAsync_InvalidProcessIsExited) {
++  TerminationResult result = TerminateAndWait(
++      base::Process(), TerminationMode::kGraceful, base::Seconds(5));
++  EXPECT_TRUE(result.exited);
++  EXPECT_FALSE(result.killed);
++}
++
++#if BUILDFLAG(IS_POSIX)
++// Runs |script| under /bin/sh and returns once it prints a line, so any
++// signal dispositions it sets up are in place.
++base::Process LaunchScript(const std::string& script) {
++  int fds[2];
++  if (pipe(fds) != 0) {
++    return base::Process();
++  }
++  base::ScopedFD read_end(fds[0]);
++  base::ScopedFD write_end(fds[1]);
++
++  base::LaunchOptions options;
++  options.fds_to_remap.emplace_back(write_end.get(), STDOUT_FILENO);
++  base::Process process = base::LaunchProcess(
++      base::CommandLine({"/bin/sh", "-c", script}), options);
++  write_end.reset();
++
++  char c = 0;
++  while (HANDLE_EINTR(read(read_end.get(), &c, 1)) == 1 && c != '\n') {
++  }
++  return process;
++}
++
++TEST_F(ProcessControllerImplTest, TerminateAsync_CompletesOnSigterm) {
++  base::Process process = LaunchScript("echo ready; exec sleep 60");
++  ASSERT_TRUE(process.IsValid());
++
++  // Finishes when the process exits, not when the grace period runs out.
++  TerminationResult result = TerminateAndWait(
++      std::move(process), TerminationMode::kGraceful, base::Seconds(30));
++  EXPECT_TRUE(result.exited);
++  EXPECT_FALSE(result.killed);
++  EXPECT_LT(result.latency, base::Seconds(30));
++}
++
++TEST_F(ProcessControllerImplTest, TerminateAsync_EscalatesToSigkill) {
++  // Ignored signals stay ignored across exec.
++  base::Process process =
++      LaunchScript("trap '' TERM; echo ready; exec sleep 60");
++  ASSERT_TRUE(process.IsValid());
++
++  const base::TimeDelta kGracePeriod = base::Milliseconds(200);
++  TerminationResult result = TerminateAndWait(
++      std::move(process), TerminationMode::kGraceful, kGracePeriod);
++  EXPECT_TRUE(result.exited);
++  EXPECT_TRUE(result.killed);
++  EXPECT_GE(result.latency, kGracePeriod);
++}
++
++TEST_F(ProcessControllerImplTest, TerminateAsync_AwaitExitReportsExit) {
++  base::Process process = LaunchScript("echo ready; exec sleep 60");
++  ASSERT_TRUE(process.IsValid());
++  base::ProcessId pid = process.Pid();
++
++  base::test::TestFuture<TerminationResult> future;
++  controller_.TerminateAsync(std::move(process), TerminationMode::kAwaitExit,
++                             base::Seconds(30), future.GetCallback());
++
++  // Stands in for the HTTP shutdown the caller already sent.
++  ASSERT_EQ(0, kill(pid, SIGTERM));
++  TerminationResult result = future.Get();
++  EXPECT_TRUE(result.exited);
++  EXPECT_FALSE(result.killed);
++}
++#endif  // BUILDFLAG(IS_POSIX)
++
++}  // namespace
++}  // namespace browseros
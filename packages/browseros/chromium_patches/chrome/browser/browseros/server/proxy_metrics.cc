@@ -0,0 +1,306 @@
+diff --git a/chrome/browser/browseros/server/proxy_metrics.cc b/chrome/browser/browseros/server/proxy_metrics.cc
+new file mode 100644
+index 0000000000000..efa5e73b3de12
+--- /dev/null
++++ b/chrome/browser/browseros/server/proxy_metrics.cc
+@@ -0,0 +1,300 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/proxy_metrics.h"
++
++#include <algorithm>
++#include <optional>
++
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kOtherMethod[] = "other";
++constexpr size_t kMaxLabelLength = 96;
++
++std::string_view TrimJsonWhitespace(std::string_view s) {
++  return base::TrimWhitespaceASCII(s, base::TRIM_LEADING);
++}
++
++// Returns the string value following the first "|key": in |json|, or
++// nullopt. Escaped strings are rejected rather than decoded; method and
++// tool names never need them.
++std::optional<std::string_view> FindStringField(std::string_view json,
++                                                std::string_view key) {
++  const std::string quoted_key = base::StrCat({"\"", key, "\""});
++  size_t pos = 0;
++  while ((pos = json.find(quoted_key, pos)) != std::string_view::npos) {
++    std::string_view rest =
++        TrimJsonWhitespace(json.substr(pos + quoted_key.size()));
++    pos += quoted_key.size();
++    if (rest.empty() || rest.front() != ':') {
++      continue;
++    }
++    rest = TrimJsonWhitespace(rest.substr(1));
++    if (rest.empty() || rest.front() != '"') {
++      return std::nullopt;
++    }
++    rest.remove_prefix(1);
++    size_t end = rest.find_first_of("\"\\");
++    if (end == std::string_view::npos || rest[end] != '"') {
++      return std::nullopt;
++    }
++    return rest.substr(0, end);
++  }
++  return std::nullopt;
++}
++
++std::string SanitizeLabel(std::string_view label) {
++  std::string out;
++  out.reserve(std::min(label.size(), kMaxLabelLength));
++  for (char c : label.substr(0, kMaxLabelLength)) {
++    out.push_back(base::IsAsciiAlphaNumeric(c) || c == '/' || c == ':' ||
++                          c == '_' || c == '-' || c == '.'
++                      ? c
++                      : '_');
++  }
++  return out;
++}
++
++std::string EscapeLabelValue(std::string_view value) {
++  std::string out;
++  for (char c : value) {
++    if (c == '\\' || c == '"') {
++      out.push_back('\\');
++    }
++    out.push_back(c == '\n' ? ' ' : c);
++  }
++  return out;
++}
++
++std::string FormatSeconds(base::TimeDelta delta) {
++  return base::NumberToString(delta.InSecondsF());
++}
++
++}  // namespace
++
++ProxyMetricsRecorder::MethodStats::MethodStats() = default;
++ProxyMetricsRecorder::MethodStats::MethodStats(const MethodStats&) = default;
++ProxyMetricsRecorder::MethodStats&
++ProxyMetricsRecorder::MethodStats::operator=(const MethodStats&) = default;
++ProxyMetricsRecorder::MethodStats::~MethodStats() = default;
++
++ProxyMetricsRecorder::ProxyMetricsRecorder() = default;
++ProxyMetricsRecorder::~ProxyMetricsRecorder() = default;
++
++// static
++std::string ProxyMetricsRecorder::ExtractMethodLabel(
++    std::string_view http_method,
++    std::string_view body) {
++  std::string_view trimmed = TrimJsonWhitespace(body);
++  if (trimmed.empty()) {
++    return SanitizeLabel(base::StrCat({"http:", http_method}));
++  }
++  if (trimmed.front() == '[') {
++    return "batch";
++  }
++
++  std::optional<std::string_view> method = FindStringField(trimmed, "method");
++  if (!method || method->empty()) {
++    return SanitizeLabel(base::StrCat({"http:", http_method}));
++  }
++  if (*method != "tools/call") {
++    return SanitizeLabel(*method);
++  }
++
++  // The tool name is "params.name"; search after "params" so a top-level
++  // "name" elsewhere doesn't match.
++  size_t params = trimmed.find("\"params\"");
++  std::optional<std::string_view> tool;
++  if (params != std::string_view::npos) {
++    tool = FindStringField(trimmed.substr(params), "name");
++  }
++  if (!tool || tool->empty()) {
++    return "tools/call";
++  }
++  return SanitizeLabel(base::StrCat({"tools/call:", *tool}));
++}
++
++std::string ProxyMetricsRecorder::OnRequestStarted(const std::string& method,
++                                                   size_t request_bytes) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  std::string label = method;
++  if (!methods_.contains(label) && methods_.size() >= kMaxMethods) {
++    label = kOtherMethod;
++  }
++  MethodStats& stats = methods_[label];
++  stats.requests++;
++  stats.in_flight++;
++  stats.request_bytes += request_bytes;
++  return label;
++}
++
++void ProxyMetricsRecorder::OnRequestFinished(const std::string& method,
++                                             int status_code,
++                                             size_t response_bytes,
++                                             base::TimeDelta latency) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  auto it = methods_.find(method);
++  if (it == methods_.end()) {
++    return;
++  }
++  MethodStats& stats = it->second;
++  stats.in_flight--;
++  stats.response_bytes += response_bytes;
++  stats.status_codes[status_code]++;
++  stats.latency_sum += latency;
++  stats.latency_max = std::max(stats.latency_max, latency);
++
++  size_t bucket = std::lower_bound(kLatencyBucketsMs.begin(),
++                                   kLatencyBucketsMs.end(),
++                                   latency.InMilliseconds()) -
++                  kLatencyBucketsMs.begin();
++  stats.latency_buckets[bucket]++;
++}
++
++std::string ProxyMetricsRecorder::RenderPrometheus() const {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  std::string out;
++
++  base::StrAppend(
++      &out, {"# HELP browseros_mcp_uptime_seconds Time since the proxy "
++             "started.\n# TYPE browseros_mcp_uptime_seconds gauge\n",
++             "browseros_mcp_uptime_seconds ",
++             FormatSeconds(base::TimeTicks::Now() - created_), "\n"});
++
++  base::StrAppend(&out, {"# HELP browseros_mcp_requests_total Requests "
++                         "received, by method.\n"
++                         "# TYPE browseros_mcp_requests_total counter\n"});
++  for (const auto& [method, stats] : methods_) {
++    base::StrAppend(&out, {"browseros_mcp_requests_total{method=\"",
++                           EscapeLabelValue(method), "\"} ",
++                           base::NumberToString(stats.requests), "\n"});
++  }
++
++  base::StrAppend(&out, {"# HELP browseros_mcp_requests_in_flight Requests "
++                         "queued or at the backend.\n"
++                         "# TYPE browseros_mcp_requests_in_flight gauge\n"});
++  for (const auto& [method, stats] : methods_) {
++    base::StrAppend(&out, {"browseros_mcp_requests_in_flight{method=\"",
++                           EscapeLabelValue(method), "\"} ",
++                           base::NumberToString(stats.in_flight), "\n"});
++  }
++
++  base::StrAppend(&out, {"# HELP browseros_mcp_responses_total Responses "
++                         "sent, by method and status code.\n"
++                         "# TYPE browseros_mcp_responses_total counter\n"});
++  for (const auto& [method, stats] : methods_) {
++    for (const auto& [code, count] : stats.status_codes) {
++      base::StrAppend(&out, {"browseros_mcp_responses_total{method=\"",
++                             EscapeLabelValue(method), "\",code=\"",
++                             base::NumberToString(code), "\"} ",
++                             base::NumberToString(count), "\n"});
++    }
++  }
++
++  base::StrAppend(&out,
++                  {"# HELP browseros_mcp_request_bytes_total Request body "
++                   "bytes received.\n"
++                   "# TYPE browseros_mcp_request_bytes_total counter\n"});
++  for (const auto& [method, stats] : methods_) {
++    base::StrAppend(&out, {"browseros_mcp_request_bytes_total{method=\"",
++                           EscapeLabelValue(method), "\"} ",
++                           base::NumberToString(stats.request_bytes), "\n"});
++  }
++
++  base::StrAppend(&out,
++                  {"# HELP browseros_mcp_response_bytes_total Response body "
++                   "bytes sent.\n"
++                   "# TYPE browseros_mcp_response_bytes_total counter\n"});
++  for (const auto& [method, stats] : methods_) {
++    base::StrAppend(&out, {"browseros_mcp_response_bytes_total{method=\"",
++                           EscapeLabelValue(method), "\"} ",
++                           base::NumberToString(stats.response_bytes), "\n"});
++  }
++
++  base::StrAppend(&out,
++                  {"# HELP browseros_mcp_request_duration_seconds Time from "
++                   "request received to response sent.\n"
++                   "# TYPE browseros_mcp_request_duration_seconds "
++                   "histogram\n"});
++  for (const auto& [method, stats] : methods_) {
++    const std::string label = EscapeLabelValue(method);
++    uint64_t cumulative = 0;
++    for (size_t i = 0; i < stats.latency_buckets.size(); ++i) {
++      cumulative += stats.latency_buckets[i];
++      std::string le =
++          i < kLatencyBucketsMs.size()
++              ? FormatSeconds(base::Milliseconds(kLatencyBucketsMs[i]))
++              : "+Inf";
++      base::StrAppend(&out,
++                      {"browseros_mcp_request_duration_seconds_bucket{method="
++                       "\"",
++                       label, "\",le=\"", le, "\"} ",
++                       base::NumberToString(cumulative), "\n"});
++    }
++    base::StrAppend(
++        &out, {"browseros_mcp_request_duration_seconds_sum{method=\"", label,
++               "\"} ", FormatSeconds(stats.latency_sum), "\n",
++               "browseros_mcp_request_duration_seconds_count{method=\"", label,
++               "\"} ", base::NumberToString(cumulative), "\n"});
++  }
++  return out;
++}
++
++base::Value::Dict ProxyMetricsRecorder::ToValue() const {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  base::Value::List methods;
++  for (const auto& [method, stats] : methods_) {
++    uint64_t completed = 0;
++    for (uint64_t count : stats.latency_buckets) {
++      completed += count;
++    }
++
++    base::Value::Dict status_codes;
++    uint64_t errors = 0;
++    for (const auto& [code, count] : stats.status_codes) {
++      status_codes.Set(base::NumberToString(code), static_cast<double>(count));
++      if (code >= 400) {
++        errors += count;
++      }
++    }
++
++    base::Value::List buckets;
++    for (uint64_t count : stats.latency_buckets) {
++      buckets.Append(static_cast<double>(count));
++    }
++
++    methods.Append(
++        base::Value::Dict()
++            .Set("method", method)
++            .Set("requests", static_cast<double>(stats.requests))
++            .Set("in_flight", static_cast<double>(stats.in_flight))
++            .Set("errors", static_cast<double>(errors))
++            .Set("request_bytes", static_cast<double>(stats.request_bytes))
++            .Set("response_bytes", static_cast<double>(stats.response_bytes))
++            .Set("mean_ms", completed ? stats.latency_sum.InMillisecondsF() /
++                                            completed
++                                      : 0.0)
++            .Set("max_ms", stats.latency_max.InMillisecondsF())
++            .Set("latency_buckets", std::move(buckets))
++            .Set("status_codes", std::move(status_codes)));
++  }
++
++  base::Value::List bucket_bounds;
++  for (int64_t bound : kLatencyBucketsMs) {
++    bucket_bounds.Append(static_cast<double>(bound));
++  }
++
++  return base::Value::Dict()
++      .Set("uptime_s", (base::TimeTicks::Now() - created_).InSecondsF())
++      .Set("latency_bucket_bounds_ms", std::move(bucket_bounds))
++      .Set("methods", std::move(methods));
++}
++
++}  // namespace browseros
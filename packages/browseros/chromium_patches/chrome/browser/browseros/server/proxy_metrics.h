@@ -0,0 +1,95 @@
+diff --git a/chrome/browser/browseros/server/proxy_metrics.h b/chrome/browser/browseros/server/proxy_metrics.h
+new file mode 100644
+index 0000000000000..18751cb84c30b
+--- /dev/null
++++ b/chrome/browser/browseros/server/proxy_metrics.h
+@@ -0,0 +1,89 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_PROXY_METRICS_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_PROXY_METRICS_H_
++
++#include <stddef.h>
++#include <stdint.h>
++
++#include <array>
++#include <map>
++#include <string>
++#include <string_view>
++
++#include "base/sequence_checker.h"
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace browseros {
++
++// Per-method counters for requests forwarded by the MCP proxy. A method is
++// the JSON-RPC method, with the tool name appended for tools/call
++// ("tools/call:browser_navigate").
++//
++// Threading: lives on the IO thread with the proxy; no locking.
++class ProxyMetricsRecorder {
++ public:
++  // Upper bounds of the latency buckets, in milliseconds. The last bucket
++  // (+Inf) is implicit.
++  static constexpr std::array<int64_t, 13> kLatencyBucketsMs = {
++      5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000, 60000};
++
++  // Methods beyond this many distinct labels are counted as "other".
++  static constexpr size_t kMaxMethods = 64;
++
++  ProxyMetricsRecorder();
++  ~ProxyMetricsRecorder();
++
++  ProxyMetricsRecorder(const ProxyMetricsRecorder&) = delete;
++  ProxyMetricsRecorder& operator=(const ProxyMetricsRecorder&) = delete;
++
++  // Returns the method label for a request. Scans |body| for the "method"
++  // and tool "name" fields without parsing the whole document.
++  static std::string ExtractMethodLabel(std::string_view http_method,
++                                        std::string_view body);
++
++  // Counts a request as in flight. Returns the label to pass to
++  // OnRequestFinished(), which may be "other" if there are too many methods.
++  std::string OnRequestStarted(const std::string& method,
++                               size_t request_bytes);
++  void OnRequestFinished(const std::string& method,
++                         int status_code,
++                         size_t response_bytes,
++                         base::TimeDelta latency);
++
++  // Prometheus text exposition format (version 0.0.4).
++  std::string RenderPrometheus() const;
++
++  // Same data for chrome://browseros-mcp-internals.
++  base::Value::Dict ToValue() const;
++
++ private:
++  struct MethodStats {
++    MethodStats();
++    MethodStats(const MethodStats&);
++    MethodStats& operator=(const MethodStats&);
++    ~MethodStats();
++
++    uint64_t requests = 0;
++    int64_t in_flight = 0;
++    uint64_t request_bytes = 0;
++    uint64_t response_bytes = 0;
++    // Non-cumulative counts; rendered cumulatively.
++    std::array<uint64_t, kLatencyBucketsMs.size() + 1> latency_buckets = {};
++    base::TimeDelta latency_sum;
++    base::TimeDelta latency_max;
++    std::map<int, uint64_t> status_codes;
++  };
++
++  std::map<std::string, MethodStats> methods_;
++  base::TimeTicks created_ = base::TimeTicks::Now();
++
++  SEQUENCE_CHECKER(sequence_checker_);
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_PROXY_METRICS_H_
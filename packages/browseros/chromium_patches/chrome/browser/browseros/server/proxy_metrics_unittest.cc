@@ -0,0 +1,86 @@
+diff --git a/chrome/browser/browseros/server/proxy_metrics_unittest.cc b/chrome/browser/browseros/server/proxy_metrics_unittest.cc
+new file mode 100644
+index 0000000000000..2efd325a76b88
+--- /dev/null
++++ b/chrome/browser/browseros/server/proxy_metrics_unittest.cc
+@@ -0,0 +1,80 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/proxy_metrics.h"
++
++#include <string>
++
++#include "base/strings/string_number_conversions.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++TEST(ProxyMetricsRecorderTest, ExtractMethodLabel) {
++  EXPECT_EQ("initialize",
++            ProxyMetricsRecorder::ExtractMethodLabel(
++                "POST", R"({"jsonrpc":"2.0","id":1,"method":"initialize"})"));
++  EXPECT_EQ("tools/call:browser_navigate",
++            ProxyMetricsRecorder::ExtractMethodLabel(
++                "POST",
++                R"({"jsonrpc": "2.0", "id": 2, "method" : "tools/call",
++                    "params": {"name": "browser_navigate",
++                               "arguments": {"url": "https://a.test"}}})"));
++  // A "name" before params must not be taken as the tool name.
++  EXPECT_EQ("tools/call:click",
++            ProxyMetricsRecorder::ExtractMethodLabel(
++                "POST",
++                R"({"name":"x","method":"tools/call","params":{"name":"click"}})"));
++  EXPECT_EQ("tools/call", ProxyMetricsRecorder::ExtractMethodLabel(
++                              "POST", R"({"method":"tools/call"})"));
++  EXPECT_EQ("batch", ProxyMetricsRecorder::ExtractMethodLabel(
++                         "POST", R"( [{"method":"ping"}])"));
++  EXPECT_EQ("http:GET", ProxyMetricsRecorder::ExtractMethodLabel("GET", ""));
++  EXPECT_EQ("http:POST",
++            ProxyMetricsRecorder::ExtractMethodLabel("POST", "not json"));
++  // Labels are restricted to a safe character set.
++  EXPECT_EQ("a_b_c", ProxyMetricsRecorder::ExtractMethodLabel(
++                         "POST", R"({"method":"a b{c"})"));
++}
++
++TEST(ProxyMetricsRecorderTest, RendersPrometheus) {
++  ProxyMetricsRecorder recorder;
++  std::string label = recorder.OnRequestStarted("tools/list", 10);
++  recorder.OnRequestFinished(label, 200, 100, base::Milliseconds(7));
++  label = recorder.OnRequestStarted("tools/list", 10);
++  recorder.OnRequestFinished(label, 503, 5, base::Milliseconds(200));
++  recorder.OnRequestStarted("tools/list", 10);
++
++  std::string text = recorder.RenderPrometheus();
++  EXPECT_NE(std::string::npos,
++            text.find("browseros_mcp_requests_total{method=\"tools/list\"} 3"));
++  EXPECT_NE(std::string::npos,
++            text.find(
++                "browseros_mcp_requests_in_flight{method=\"tools/list\"} 1"));
++  EXPECT_NE(std::string::npos,
++            text.find("browseros_mcp_responses_total{method=\"tools/list\","
++                      "code=\"503\"} 1"));
++  EXPECT_NE(std::string::npos,
++            text.find("browseros_mcp_request_bytes_total{method=\"tools/list\""
++                      "} 30"));
++  EXPECT_NE(std::string::npos,
++            text.find("browseros_mcp_request_duration_seconds_bucket{method="
++                      "\"tools/list\",le=\"0.01\"} 1"));
++  EXPECT_NE(std::string::npos,
++            text.find("browseros_mcp_request_duration_seconds_bucket{method="
++                      "\"tools/list\",le=\"+Inf\"} 2"));
++}
++
++TEST(ProxyMetricsRecorderTest, CapsDistinctMethods) {
++  ProxyMetricsRecorder recorder;
++  for (size_t i = 0; i < ProxyMetricsRecorder::kMaxMethods; ++i) {
++    recorder.OnRequestStarted("m" + base::NumberToString(i), 0);
++  }
++  EXPECT_EQ("other", recorder.OnRequestStarted("one-too-many", 0));
++  EXPECT_EQ("m0", recorder.OnRequestStarted("m0", 0));
++}
++
++}  // namespace
++}  // namespace browseros
@@ -0,0 +1,368 @@
+diff --git a/chrome/browser/browseros/server/resumable_download.cc b/chrome/browser/browseros/server/resumable_download.cc
+new file mode 100644
+index 0000000000000..73986c3707fb8
+--- /dev/null
++++ b/chrome/browser/browseros/server/resumable_download.cc
+@@ -0,0 +1,362 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/resumable_download.h"
++
++#include <optional>
++#include <utility>
++
++#include "base/containers/span.h"
++#include "base/files/file.h"
++#include "base/files/file_util.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/notreached.h"
++#include "base/strings/string_util.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "base/values.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_byte_range.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
++#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++
++namespace browseros_server {
++
++namespace {
++
++constexpr char kIfRangeHeader[] = "If-Range";
++
++// Only strong validators may be used with If-Range (RFC 9110 13.1.5).
++std::string GetValidator(const net::HttpResponseHeaders& headers) {
++  std::optional<std::string> etag = headers.GetNormalizedHeader("ETag");
++  if (etag && !etag->empty() && !base::StartsWith(*etag, "W/")) {
++    return *etag;
++  }
++  return headers.GetNormalizedHeader("Last-Modified").value_or(std::string());
++}
++
++}  // namespace
++
++struct ResumableDownload::ResumePoint {
++  int64_t offset = 0;
++  std::string validator;
++};
++
++class ResumableDownload::Writer {
++ public:
++  Writer(const base::FilePath& path, const GURL& url)
++      : path_(path), state_path_(GetStatePath(path)), url_(url) {}
++
++  Writer(const Writer&) = delete;
++  Writer& operator=(const Writer&) = delete;
++
++  // Opens the partial file. Its contents are kept only when the state file
++  // records a validator for the same URL; otherwise it is emptied.
++  ResumePoint Load() {
++    file_.Initialize(path_, base::File::FLAG_OPEN_ALWAYS |
++                                base::File::FLAG_READ |
++                                base::File::FLAG_WRITE);
++    if (!file_.IsValid()) {
++      LOG(ERROR) << "browseros: Failed to open download file " << path_ << ": "
++                 << base::File::ErrorToString(file_.error_details());
++      return {};
++    }
++
++    std::string validator = ReadValidator();
++    int64_t length = file_.GetLength();
++    if (validator.empty() || length <= 0 ||
++        file_.Seek(base::File::FROM_END, 0) != length) {
++      Truncate();
++      return {};
++    }
++    return {length, std::move(validator)};
++  }
++
++  // Empties the file for a fresh response and records its validator.
++  // Truncating first means a crash in between leaves an empty file rather
++  // than old bytes under the new validator.
++  bool Restart(const std::string& validator) {
++    if (!Truncate()) {
++      return false;
++    }
++    std::optional<std::string> json = base::WriteJson(
++        base::Value::Dict().Set("url", url_.spec()).Set("validator",
++                                                        validator));
++    return json && base::WriteFile(state_path_, *json);
++  }
++
++  bool Append(const std::string& data) {
++    return file_.IsValid() &&
++           file_.WriteAtCurrentPosAndCheck(base::as_byte_span(data));
++  }
++
++  // The file is complete; it no longer needs resume state.
++  void Finish() {
++    file_.Close();
++    base::DeleteFile(state_path_);
++  }
++
++ private:
++  std::string ReadValidator() {
++    std::string contents;
++    if (!base::ReadFileToString(state_path_, &contents)) {
++      return std::string();
++    }
++    std::optional<base::Value> parsed =
++        base::JSONReader::Read(contents, base::JSON_PARSE_RFC);
++    if (!parsed || !parsed->is_dict()) {
++      return std::string();
++    }
++    const std::string* url = parsed->GetDict().FindString("url");
++    const std::string* validator = parsed->GetDict().FindString("validator");
++    if (!url || *url != url_.spec() || !validator) {
++      return std::string();
++    }
++    return *validator;
++  }
++
++  bool Truncate() {
++    return file_.IsValid() && file_.SetLength(0) &&
++           file_.Seek(base::File::FROM_BEGIN, 0) == 0;
++  }
++
++  const base::FilePath path_;
++  const base::FilePath state_path_;
++  const GURL url_;
++  base::File file_;
++};
++
++ResumableDownload::ResumableDownload(
++    const GURL& url,
++    const base::FilePath& path,
++    int64_t max_size,
++    const net::NetworkTrafficAnnotationTag& annotation)
++    : url_(url), path_(path), max_size_(max_size), annotation_(annotation) {}
++
++ResumableDownload::~ResumableDownload() = default;
++
++// static
++base::FilePath ResumableDownload::GetStatePath(const base::FilePath& path) {
++  return path.AddExtensionASCII("state");
++}
++
++void ResumableDownload::SetAttemptTimeout(base::TimeDelta timeout) {
++  attempt_timeout_ = timeout;
++}
++
++void ResumableDownload::SetOnProgressCallback(ProgressCallback callback) {
++  progress_callback_ = std::move(callback);
++}
++
++void ResumableDownload::Start(
++    scoped_refptr<network::SharedURLLoaderFactory> factory,
++    CompletionCallback callback) {
++  factory_ = std::move(factory);
++  callback_ = std::move(callback);
++  writer_ = base::SequenceBound<Writer>(
++      base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
++           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}),
++      path_, url_);
++  writer_.AsyncCall(&Writer::Load)
++      .Then(base::BindOnce(&ResumableDownload::OnResumePointLoaded,
++                           weak_factory_.GetWeakPtr()));
++}
++
++void ResumableDownload::OnResumePointLoaded(ResumePoint resume_point) {
++  offset_ = resume_point.offset;
++  validator_ = std::move(resume_point.validator);
++  resumed_bytes_ = offset_;
++  if (offset_ > 0) {
++    LOG(INFO) << "browseros: Resuming download of " << url_ << " at "
++              << offset_ << " bytes";
++  }
++  StartAttempt();
++}
++
++void ResumableDownload::StartAttempt() {
++  attempt_start_offset_ = offset_;
++  attempt_error_ = net::OK;
++
++  auto request = std::make_unique<network::ResourceRequest>();
++  request->url = url_;
++  request->method = "GET";
++  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++  // Without a validator the bytes on disk cannot be matched to the current
++  // resource, so the whole body is fetched and replaces them.
++  if (offset_ > 0 && !validator_.empty()) {
++    request->headers.SetHeader(
++        net::HttpRequestHeaders::kRange,
++        net::HttpByteRange::RightUnbounded(offset_).GetHeaderValue());
++    request->headers.SetHeader(kIfRangeHeader, validator_);
++  }
++
++  loader_ = network::SimpleURLLoader::Create(std::move(request), annotation_);
++  if (!attempt_timeout_.is_zero()) {
++    loader_->SetTimeoutDuration(attempt_timeout_);
++  }
++  loader_->SetOnResponseStartedCallback(base::BindOnce(
++      &ResumableDownload::OnResponseStarted, weak_factory_.GetWeakPtr()));
++  loader_->DownloadAsStream(factory_.get(), this);
++}
++
++void ResumableDownload::OnResponseStarted(
++    const GURL& final_url,
++    const network::mojom::URLResponseHead& head) {
++  if (!head.headers) {
++    return;
++  }
++
++  int response_code = head.headers->response_code();
++  if (response_code == net::HTTP_PARTIAL_CONTENT) {
++    int64_t first = 0;
++    int64_t last = 0;
++    int64_t length = 0;
++    if (!head.headers->GetContentRangeFor206(&first, &last, &length) ||
++        first != offset_) {
++      LOG(WARNING) << "browseros: Unexpected Content-Range for offset "
++                   << offset_;
++      validator_.clear();
++      attempt_error_ = net::ERR_INVALID_RESPONSE;
++    } else if (length > max_size_) {
++      attempt_error_ = net::ERR_FILE_TOO_BIG;
++    }
++    return;
++  }
++
++  if (response_code == net::HTTP_OK) {
++    if (head.content_length > max_size_) {
++      attempt_error_ = net::ERR_FILE_TOO_BIG;
++      return;
++    }
++    // Either a fresh download or the resource changed under If-Range.
++    if (offset_ > 0) {
++      LOG(INFO) << "browseros: Server sent the full body, restarting download";
++    }
++    offset_ = 0;
++    attempt_start_offset_ = 0;
++    resumed_bytes_ = 0;
++    validator_ = GetValidator(*head.headers);
++    // Sequenced before the appends for this response.
++    writer_.AsyncCall(&Writer::Restart).WithArgs(validator_);
++  }
++}
++
++void ResumableDownload::OnDataReceived(std::string_view string_piece,
++                                       base::OnceClosure resume) {
++  if (attempt_error_ == net::OK &&
++      offset_ + static_cast<int64_t>(string_piece.size()) > max_size_) {
++    attempt_error_ = net::ERR_FILE_TOO_BIG;
++  }
++  if (attempt_error_ != net::OK) {
++    loader_.reset();
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE, base::BindOnce(&ResumableDownload::RetryOrFail,
++                                  weak_factory_.GetWeakPtr(), attempt_error_));
++    return;
++  }
++
++  size_t size = string_piece.size();
++  writer_.AsyncCall(&Writer::Append)
++      .WithArgs(std::string(string_piece))
++      .Then(base::BindOnce(&ResumableDownload::OnAppended,
++                           weak_factory_.GetWeakPtr(), std::move(resume),
++                           size));
++}
++
++void ResumableDownload::OnAppended(base::OnceClosure resume,
++                                   size_t size,
++                                   bool ok) {
++  if (!ok) {
++    loader_.reset();
++    Fail(net::ERR_FILE_NO_SPACE);
++    return;
++  }
++  offset_ += size;
++  if (progress_callback_) {
++    progress_callback_.Run(offset_);
++  }
++  std::move(resume).Run();
++}
++
++void ResumableDownload::OnComplete(bool success) {
++  int net_error = loader_->NetError();
++  int response_code = 0;
++  if (loader_->ResponseInfo() && loader_->ResponseInfo()->headers) {
++    response_code = loader_->ResponseInfo()->headers->response_code();
++  }
++  loader_.reset();
++
++  if (attempt_error_ != net::OK) {
++    RetryOrFail(attempt_error_);
++    return;
++  }
++
++  if (success) {
++    writer_.AsyncCall(&Writer::Finish)
++        .Then(base::BindOnce(&ResumableDownload::OnFinished,
++                             weak_factory_.GetWeakPtr()));
++    return;
++  }
++
++  if (response_code == net::HTTP_REQUESTED_RANGE_NOT_SATISFIABLE) {
++    // The bytes on disk no longer fit the resource; start over.
++    validator_.clear();
++  } else if (response_code >= 400 && response_code < 500) {
++    Fail(net_error);
++    return;
++  }
++  RetryOrFail(net_error);
++}
++
++void ResumableDownload::OnRetry(base::OnceClosure start_retry) {
++  // SimpleURLLoader retries are not enabled; attempts are restarted here so
++  // they can resume.
++  NOTREACHED();
++}
++
++void ResumableDownload::OnFinished() {
++  LOG(INFO) << "browseros: Downloaded " << offset_ << " bytes ("
++            << resumed_bytes_ << " resumed)";
++  net_error_ = net::OK;
++  std::move(callback_).Run(path_);
++}
++
++void ResumableDownload::RetryOrFail(int net_error) {
++  if (offset_ > attempt_start_offset_) {
++    attempts_without_progress_ = 0;
++  } else {
++    ++attempts_without_progress_;
++  }
++  if (attempts_without_progress_ >= kMaxAttemptsWithoutProgress) {
++    Fail(net_error);
++    return;
++  }
++
++  base::TimeDelta delay =
++      kInitialRetryDelay * (1 << attempts_without_progress_);
++  LOG(WARNING) << "browseros: Download interrupted at " << offset_
++               << " bytes (" << net::ErrorToString(net_error)
++               << "), retrying in " << delay;
++  retry_timer_.Start(FROM_HERE, delay,
++                     base::BindOnce(&ResumableDownload::StartAttempt,
++                                    base::Unretained(this)));
++}
++
++void ResumableDownload::Fail(int net_error) {
++  LOG(ERROR) << "browseros: Download failed at " << offset_ << " bytes: "
++             << net::ErrorToString(net_error);
++  net_error_ = net_error;
++  retry_timer_.Stop();
++  std::move(callback_).Run(base::FilePath());
++}
++
++}  // namespace browseros_server
@@ -0,0 +1,133 @@
+diff --git a/chrome/browser/browseros/server/resumable_download.h b/chrome/browser/browseros/server/resumable_download.h
+new file mode 100644
+index 0000000000000..6a55d7fa745b4
+--- /dev/null
++++ b/chrome/browser/browseros/server/resumable_download.h
+@@ -0,0 +1,127 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_RESUMABLE_DOWNLOAD_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_RESUMABLE_DOWNLOAD_H_
++
++#include <memory>
++#include <string>
++#include <string_view>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/threading/sequence_bound.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++#include "services/network/public/cpp/simple_url_loader_stream_consumer.h"
++#include "url/gurl.h"
++
++namespace network {
++class SharedURLLoaderFactory;
++class SimpleURLLoader;
++namespace mojom {
++class URLResponseHead;
++}
++}  // namespace network
++
++namespace browseros_server {
++
++// Downloads |url| to |path|, picking up where an interrupted download left
++// off. Bytes are appended to |path| as they arrive; the response's strong
++// ETag (or Last-Modified) is kept next to it in "<path>.state". A later
++// attempt, in this session or after a restart, asks for the remainder with
++// Range + If-Range; a server that answers 200 instead restarts the file.
++//
++// Dropped connections and timeouts are retried with backoff for as long as
++// attempts keep making progress. On final failure the partial file and its
++// state stay on disk for the next ResumableDownload of the same URL.
++class ResumableDownload : public network::SimpleURLLoaderStreamConsumer {
++ public:
++  // Receives |path| on success, or an empty path on failure (see
++  // net_error()).
++  using CompletionCallback = base::OnceCallback<void(base::FilePath path)>;
++  // Receives the number of bytes on disk, including any resumed prefix.
++  using ProgressCallback = base::RepeatingCallback<void(int64_t bytes)>;
++
++  // Consecutive attempts without progress before giving up.
++  static constexpr int kMaxAttemptsWithoutProgress = 3;
++  // Delay before the first retry; doubled for each attempt without progress.
++  static constexpr base::TimeDelta kInitialRetryDelay = base::Seconds(2);
++
++  ResumableDownload(const GURL& url,
++                    const base::FilePath& path,
++                    int64_t max_size,
++                    const net::NetworkTrafficAnnotationTag& annotation);
++  ~ResumableDownload() override;
++
++  ResumableDownload(const ResumableDownload&) = delete;
++  ResumableDownload& operator=(const ResumableDownload&) = delete;
++
++  // Each attempt is cancelled after |timeout|; progress made is kept.
++  void SetAttemptTimeout(base::TimeDelta timeout);
++  void SetOnProgressCallback(ProgressCallback callback);
++
++  void Start(scoped_refptr<network::SharedURLLoaderFactory> factory,
++             CompletionCallback callback);
++
++  // net::OK until the download fails.
++  int net_error() const { return net_error_; }
++  // Bytes carried over from a previous session's partial file.
++  int64_t resumed_bytes() const { return resumed_bytes_; }
++
++  static base::FilePath GetStatePath(const base::FilePath& path);
++
++ private:
++  // Lives on a blocking sequence; owns the partial file.
++  class Writer;
++  struct ResumePoint;
++
++  void OnResumePointLoaded(ResumePoint resume_point);
++  void StartAttempt();
++  void OnResponseStarted(const GURL& final_url,
++                         const network::mojom::URLResponseHead& head);
++  void OnAppended(base::OnceClosure resume, size_t size, bool ok);
++  void OnFinished();
++  void RetryOrFail(int net_error);
++  void Fail(int net_error);
++
++  // network::SimpleURLLoaderStreamConsumer:
++  void OnDataReceived(std::string_view string_piece,
++                      base::OnceClosure resume) override;
++  void OnComplete(bool success) override;
++  void OnRetry(base::OnceClosure start_retry) override;
++
++  const GURL url_;
++  const base::FilePath path_;
++  const int64_t max_size_;
++  const net::NetworkTrafficAnnotationTag annotation_;
++  base::TimeDelta attempt_timeout_;
++  ProgressCallback progress_callback_;
++
++  scoped_refptr<network::SharedURLLoaderFactory> factory_;
++  CompletionCallback callback_;
++  base::SequenceBound<Writer> writer_;
++  std::unique_ptr<network::SimpleURLLoader> loader_;
++  base::OneShotTimer retry_timer_;
++
++  // Bytes on disk and the validator they were fetched under.
++  int64_t offset_ = 0;
++  std::string validator_;
++  int64_t resumed_bytes_ = 0;
++  // Offset when the current attempt started, to detect progress.
++  int64_t attempt_start_offset_ = 0;
++  int attempts_without_progress_ = 0;
++  // Set when the response cannot be appended, e.g. a 206 for the wrong range.
++  int attempt_error_ = 0;
++  int net_error_ = 0;
++
++  base::WeakPtrFactory<ResumableDownload> weak_factory_{this};
++};
++
++}  // namespace browseros_server
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_RESUMABLE_DOWNLOAD_H_
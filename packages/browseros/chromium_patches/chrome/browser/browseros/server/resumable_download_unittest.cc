@@ -0,0 +1,220 @@
+diff --git a/chrome/browser/browseros/server/resumable_download_unittest.cc b/chrome/browser/browseros/server/resumable_download_unittest.cc
+new file mode 100644
+index 0000000000000..15d73492a9d22
+--- /dev/null
++++ b/chrome/browser/browseros/server/resumable_download_unittest.cc
+@@ -0,0 +1,214 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/resumable_download.h"
++
++#include <deque>
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/functional/bind.h"
++#include "base/functional/callback_helpers.h"
++#include "base/memory/raw_ptr.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/test/task_environment.h"
++#include "base/test/test_future.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_status_code.h"
++#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/url_loader_completion_status.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++#include "services/network/test/test_url_loader_factory.h"
++#include "services/network/test/test_utils.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros_server {
++namespace {
++
++constexpr char kUrl[] = "https://cdn.example.com/server.zip";
++constexpr int64_t kMaxSize = 1024 * 1024;
++
++// Stands in for the CDN: honours Range + If-Range against the current ETag,
++// and drops each connection after the number of bytes queued for it.
++class FlakyServer {
++ public:
++  static constexpr size_t kNoDrop = std::string::npos;
++
++  explicit FlakyServer(network::TestURLLoaderFactory* factory)
++      : factory_(factory) {
++    factory_->SetInterceptor(base::BindRepeating(
++        &FlakyServer::OnRequest, base::Unretained(this)));
++  }
++
++  void SetResource(std::string body, std::string etag) {
++    body_ = std::move(body);
++    etag_ = std::move(etag);
++  }
++
++  // The next response is cut after |bytes| of its body.
++  void DropAfter(size_t bytes) { drops_.push_back(bytes); }
++
++  const std::vector<network::ResourceRequest>& requests() const {
++    return requests_;
++  }
++
++ private:
++  void OnRequest(const network::ResourceRequest& request) {
++    requests_.push_back(request);
++
++    size_t start = 0;
++    std::optional<std::string> range = request.headers.GetHeader("Range");
++    std::optional<std::string> if_range = request.headers.GetHeader("If-Range");
++    if (range && if_range == etag_) {
++      base::StringToSizeT(range->substr(6, range->size() - 7), &start);
++    }
++
++    auto head = network::CreateURLResponseHead(
++        start > 0 ? net::HTTP_PARTIAL_CONTENT : net::HTTP_OK);
++    head->headers->SetHeader("ETag", etag_);
++    if (start > 0) {
++      head->headers->SetHeader(
++          "Content-Range", "bytes " + base::NumberToString(start) + "-" +
++                               base::NumberToString(body_.size() - 1) + "/" +
++                               base::NumberToString(body_.size()));
++    }
++    head->content_length = body_.size() - start;
++
++    size_t drop = kNoDrop;
++    if (!drops_.empty()) {
++      drop = drops_.front();
++      drops_.pop_front();
++    }
++    std::string content = body_.substr(start, drop);
++    network::URLLoaderCompletionStatus status(
++        drop == kNoDrop ? net::OK : net::ERR_CONNECTION_RESET);
++    status.decoded_body_length = content.size();
++
++    factory_->ClearResponses();
++    factory_->AddResponse(
++        GURL(kUrl), std::move(head), content, status,
++        network::TestURLLoaderFactory::Redirects(),
++        network::TestURLLoaderFactory::kSendHeadersOnNetworkError);
++  }
++
++  raw_ptr<network::TestURLLoaderFactory> factory_;
++  std::string body_;
++  std::string etag_;
++  std::deque<size_t> drops_;
++  std::vector<network::ResourceRequest> requests_;
++};
++
++class ResumableDownloadTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    path_ = temp_dir_.GetPath().AppendASCII("download.zip");
++  }
++
++  std::unique_ptr<ResumableDownload> CreateDownload() {
++    return std::make_unique<ResumableDownload>(GURL(kUrl), path_, kMaxSize,
++                                               TRAFFIC_ANNOTATION_FOR_TESTS);
++  }
++
++  base::FilePath Run(ResumableDownload& download) {
++    base::test::TestFuture<base::FilePath> future;
++    download.Start(factory_.GetSafeWeakWrapper(), future.GetCallback());
++    return future.Get();
++  }
++
++  std::string ReadDownload() {
++    std::string contents;
++    EXPECT_TRUE(base::ReadFileToString(path_, &contents));
++    return contents;
++  }
++
++  // Downloads until the first connection drops after |bytes|, then destroys
++  // the download as a browser shutdown would.
++  void DownloadPartially(size_t bytes) {
++    server_.DropAfter(bytes);
++    std::unique_ptr<ResumableDownload> download = CreateDownload();
++    base::test::TestFuture<int64_t> progress;
++    download->SetOnProgressCallback(progress.GetRepeatingCallback());
++    download->Start(factory_.GetSafeWeakWrapper(), base::DoNothing());
++    ASSERT_EQ(static_cast<int64_t>(bytes), progress.Get());
++    download.reset();
++    task_environment_.RunUntilIdle();
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  base::ScopedTempDir temp_dir_;
++  base::FilePath path_;
++  network::TestURLLoaderFactory factory_;
++  FlakyServer server_{&factory_};
++};
++
++TEST_F(ResumableDownloadTest, DownloadsAndClearsState) {
++  server_.SetResource(std::string(1000, 'a'), "\"v1\"");
++
++  std::unique_ptr<ResumableDownload> download = CreateDownload();
++  EXPECT_EQ(path_, Run(*download));
++  EXPECT_EQ(std::string(1000, 'a'), ReadDownload());
++  EXPECT_FALSE(base::PathExists(ResumableDownload::GetStatePath(path_)));
++  EXPECT_EQ(1u, server_.requests().size());
++}
++
++TEST_F(ResumableDownloadTest, ResumesAfterDisconnect) {
++  std::string body = std::string(400, 'a') + std::string(600, 'b');
++  server_.SetResource(body, "\"v1\"");
++  server_.DropAfter(400);
++
++  std::unique_ptr<ResumableDownload> download = CreateDownload();
++  EXPECT_EQ(path_, Run(*download));
++  EXPECT_EQ(body, ReadDownload());
++
++  ASSERT_EQ(2u, server_.requests().size());
++  EXPECT_EQ("bytes=400-", server_.requests()[1].headers.GetHeader("Range"));
++  EXPECT_EQ("\"v1\"", server_.requests()[1].headers.GetHeader("If-Range"));
++}
++
++TEST_F(ResumableDownloadTest, ResumesAcrossRestarts) {
++  std::string body = std::string(400, 'a') + std::string(600, 'b');
++  server_.SetResource(body, "\"v1\"");
++  DownloadPartially(400);
++  EXPECT_TRUE(base::PathExists(ResumableDownload::GetStatePath(path_)));
++
++  std::unique_ptr<ResumableDownload> download = CreateDownload();
++  EXPECT_EQ(path_, Run(*download));
++  EXPECT_EQ(body, ReadDownload());
++  EXPECT_EQ(400, download->resumed_bytes());
++  EXPECT_EQ("bytes=400-", server_.requests().back().headers.GetHeader("Range"));
++}
++
++TEST_F(ResumableDownloadTest, RestartsWhenResourceChanged) {
++  server_.SetResource(std::string(1000, 'a'), "\"v1\"");
++  DownloadPartially(400);
++
++  // If-Range no longer matches, so the server sends the whole new body.
++  server_.SetResource(std::string(800, 'c'), "\"v2\"");
++  std::unique_ptr<ResumableDownload> download = CreateDownload();
++  EXPECT_EQ(path_, Run(*download));
++  EXPECT_EQ(std::string(800, 'c'), ReadDownload());
++  EXPECT_EQ(0, download->resumed_bytes());
++}
++
++TEST_F(ResumableDownloadTest, GivesUpWithoutProgress) {
++  server_.SetResource(std::string(1000, 'a'), "\"v1\"");
++  for (int i = 0; i < ResumableDownload::kMaxAttemptsWithoutProgress; ++i) {
++    server_.DropAfter(0);
++  }
++
++  std::unique_ptr<ResumableDownload> download = CreateDownload();
++  EXPECT_TRUE(Run(*download).empty());
++  EXPECT_EQ(net::ERR_CONNECTION_RESET, download->net_error());
++  EXPECT_EQ(static_cast<size_t>(ResumableDownload::kMaxAttemptsWithoutProgress),
++            server_.requests().size());
++}
++
++}  // namespace
++}  // namespace browseros_server
@@ -0,0 +1,121 @@
+diff --git a/chrome/browser/browseros/server/startup_timeline.cc b/chrome/browser/browseros/server/startup_timeline.cc
+new file mode 100644
+index 0000000000000..a9c3e774f8ab4
+--- /dev/null
++++ b/chrome/browser/browseros/server/startup_timeline.cc
+@@ -0,0 +1,115 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/startup_timeline.h"
++
++#include <algorithm>
++#include <string_view>
++
++#include "base/logging.h"
++#include "base/trace_event/trace_event.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kStartupEventName[] = "BrowserOSServerStartup";
++
++}  // namespace
++
++StartupTimeline::StartupTimeline() = default;
++StartupTimeline::~StartupTimeline() = default;
++
++void StartupTimeline::Begin() {
++  if (is_active()) {
++    TRACE_EVENT_NESTABLE_ASYNC_END0("browseros", kStartupEventName,
++                                    TRACE_ID_LOCAL(this));
++  }
++  begin_time_ = base::TimeTicks::Now();
++  begin_wall_time_ = base::Time::Now();
++  total_.reset();
++  phases_.clear();
++  open_phases_.clear();
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN0("browseros", kStartupEventName,
++                                    TRACE_ID_LOCAL(this));
++}
++
++void StartupTimeline::BeginPhase(const char* name) {
++  if (!is_active()) {
++    return;
++  }
++  open_phases_.push_back({name, base::TimeTicks::Now()});
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN0("browseros", name, TRACE_ID_LOCAL(this));
++}
++
++void StartupTimeline::EndPhase(const char* name) {
++  auto it = std::ranges::find_if(open_phases_, [name](const OpenPhase& phase) {
++    return std::string_view(phase.name) == name;
++  });
++  if (it == open_phases_.end()) {
++    return;
++  }
++  base::TimeTicks now = base::TimeTicks::Now();
++  phases_.push_back({it->name, it->start - begin_time_, now - it->start});
++  open_phases_.erase(it);
++  TRACE_EVENT_NESTABLE_ASYNC_END0("browseros", name, TRACE_ID_LOCAL(this));
++}
++
++void StartupTimeline::AddPhase(const char* name,
++                               base::TimeTicks start,
++                               base::TimeDelta duration) {
++  if (begin_time_.is_null() || start < begin_time_) {
++    return;
++  }
++  phases_.push_back({name, start - begin_time_, duration});
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP0("browseros", name,
++                                                   TRACE_ID_LOCAL(this), start);
++  TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0(
++      "browseros", name, TRACE_ID_LOCAL(this), start + duration);
++}
++
++void StartupTimeline::Finish() {
++  if (!is_active()) {
++    return;
++  }
++  while (!open_phases_.empty()) {
++    EndPhase(open_phases_.back().name);
++  }
++  total_ = base::TimeTicks::Now() - begin_time_;
++  TRACE_EVENT_NESTABLE_ASYNC_END0("browseros", kStartupEventName,
++                                  TRACE_ID_LOCAL(this));
++
++  LOG(INFO) << "browseros: Server ready " << total_->InMilliseconds()
++            << "ms after startup began";
++}
++
++std::vector<StartupTimeline::Phase> StartupTimeline::GetSortedPhases() const {
++  std::vector<Phase> sorted = phases_;
++  std::ranges::stable_sort(sorted, {}, &Phase::start);
++  return sorted;
++}
++
++base::Value::Dict StartupTimeline::ToValue() const {
++  base::Value::Dict dict;
++  if (begin_time_.is_null()) {
++    return dict;
++  }
++
++  dict.Set("started_at", begin_wall_time_.InMillisecondsFSinceUnixEpoch());
++  if (total_) {
++    dict.Set("total_ms", total_->InMillisecondsF());
++  }
++
++  base::Value::List phases;
++  for (const Phase& phase : GetSortedPhases()) {
++    phases.Append(base::Value::Dict()
++                      .Set("name", phase.name)
++                      .Set("start_ms", phase.start.InMillisecondsF())
++                      .Set("duration_ms", phase.duration.InMillisecondsF()));
++  }
++  dict.Set("phases", std::move(phases));
++  return dict;
++}
++
++}  // namespace browseros
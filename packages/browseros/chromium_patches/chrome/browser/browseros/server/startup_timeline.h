@@ -0,0 +1,87 @@
+diff --git a/chrome/browser/browseros/server/startup_timeline.h b/chrome/browser/browseros/server/startup_timeline.h
+new file mode 100644
+index 0000000000000..8a8e86fc0f90b
+--- /dev/null
++++ b/chrome/browser/browseros/server/startup_timeline.h
+@@ -0,0 +1,81 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_STARTUP_TIMELINE_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_STARTUP_TIMELINE_H_
++
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace browseros {
++
++// Phases of a server bring-up, from BrowserOSServerManager::Start() to the
++// first successful health check. Each phase is also emitted as a nested
++// async trace event under one "BrowserOSServerStartup" event.
++class StartupTimeline {
++ public:
++  struct Phase {
++    std::string name;
++    // Relative to Begin().
++    base::TimeDelta start;
++    base::TimeDelta duration;
++  };
++
++  StartupTimeline();
++  ~StartupTimeline();
++
++  StartupTimeline(const StartupTimeline&) = delete;
++  StartupTimeline& operator=(const StartupTimeline&) = delete;
++
++  // Starts a new timeline, discarding the previous one.
++  void Begin();
++
++  // |name| must be a string literal; trace events keep the pointer.
++  void BeginPhase(const char* name);
++  void EndPhase(const char* name);
++
++  // Records a phase timed elsewhere, e.g. on a worker thread. Accepted until
++  // the next Begin(), so phases running alongside the health check (like
++  // the updater's version probe) are kept even if they end after Finish().
++  void AddPhase(const char* name,
++                base::TimeTicks start,
++                base::TimeDelta duration);
++
++  // Marks the server ready. Phases still open are closed at this point.
++  void Finish();
++
++  // True between Begin() and Finish().
++  bool is_active() const { return !begin_time_.is_null() && !total_; }
++  bool is_finished() const { return total_.has_value(); }
++
++  const std::vector<Phase>& phases() const { return phases_; }
++  // Phases ordered by start; external ones may have been added late.
++  std::vector<Phase> GetSortedPhases() const;
++  // Begin() to Finish(); nullopt until the server is ready.
++  std::optional<base::TimeDelta> total() const { return total_; }
++
++  // {"started_at": <ms since epoch>, "total_ms": <absent until ready>,
++  //  "phases": [{"name", "start_ms", "duration_ms"}, ...]}
++  base::Value::Dict ToValue() const;
++
++ private:
++  struct OpenPhase {
++    const char* name;
++    base::TimeTicks start;
++  };
++
++  base::TimeTicks begin_time_;
++  base::Time begin_wall_time_;
++  std::optional<base::TimeDelta> total_;
++  std::vector<Phase> phases_;
++  std::vector<OpenPhase> open_phases_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_STARTUP_TIMELINE_H_
@@ -0,0 +1,142 @@
+diff --git a/chrome/browser/browseros/server/startup_timeline_unittest.cc b/chrome/browser/browseros/server/startup_timeline_unittest.cc
+new file mode 100644
+index 0000000000000..ee68d6f9300ee
+--- /dev/null
++++ b/chrome/browser/browseros/server/startup_timeline_unittest.cc
+@@ -0,0 +1,136 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/startup_timeline.h"
++
++#include <string>
++#include <vector>
++
++#include "base/test/task_environment.h"
++#include "base/test/test_trace_processor.h"
++#include "base/test/trace_test_utils.h"
++#include "base/trace_event/trace_event.h"
++#include "testing/gmock/include/gmock/gmock.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++class StartupTimelineTest : public testing::Test {
++ protected:
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  StartupTimeline timeline_;
++};
++
++TEST_F(StartupTimelineTest, EmptyBeforeBegin) {
++  EXPECT_FALSE(timeline_.is_active());
++  EXPECT_TRUE(timeline_.ToValue().empty());
++
++  timeline_.BeginPhase("lock");
++  timeline_.EndPhase("lock");
++  EXPECT_TRUE(timeline_.phases().empty());
++}
++
++TEST_F(StartupTimelineTest, RecordsPhaseOffsetsAndDurations) {
++  timeline_.Begin();
++  task_environment_.FastForwardBy(base::Milliseconds(5));
++  timeline_.BeginPhase("lock");
++  task_environment_.FastForwardBy(base::Milliseconds(20));
++  timeline_.EndPhase("lock");
++  task_environment_.FastForwardBy(base::Milliseconds(75));
++  timeline_.Finish();
++
++  ASSERT_EQ(1u, timeline_.phases().size());
++  EXPECT_EQ("lock", timeline_.phases()[0].name);
++  EXPECT_EQ(base::Milliseconds(5), timeline_.phases()[0].start);
++  EXPECT_EQ(base::Milliseconds(20), timeline_.phases()[0].duration);
++
++  base::Value::Dict value = timeline_.ToValue();
++  EXPECT_EQ(100.0, value.FindDouble("total_ms"));
++  EXPECT_TRUE(value.FindDouble("started_at"));
++}
++
++TEST_F(StartupTimelineTest, FinishClosesOpenPhases) {
++  timeline_.Begin();
++  timeline_.BeginPhase("health");
++  task_environment_.FastForwardBy(base::Milliseconds(300));
++  timeline_.Finish();
++
++  EXPECT_TRUE(timeline_.is_finished());
++  ASSERT_EQ(1u, timeline_.phases().size());
++  EXPECT_EQ(base::Milliseconds(300), timeline_.phases()[0].duration);
++
++  // Nothing more is recorded once finished, except phases timed elsewhere.
++  timeline_.BeginPhase("late");
++  timeline_.EndPhase("late");
++  EXPECT_EQ(1u, timeline_.phases().size());
++}
++
++TEST_F(StartupTimelineTest, ExternalPhasesAreSortedByStart) {
++  timeline_.Begin();
++  base::TimeTicks begin = base::TimeTicks::Now();
++  task_environment_.FastForwardBy(base::Milliseconds(50));
++  timeline_.Finish();
++
++  timeline_.AddPhase("spawn", begin + base::Milliseconds(30),
++                     base::Milliseconds(10));
++  timeline_.AddPhase("write_config", begin + base::Milliseconds(20),
++                     base::Milliseconds(10));
++  // Predates this bring-up, so it belongs to a previous one.
++  timeline_.AddPhase("stale", begin - base::Milliseconds(1),
++                     base::Milliseconds(1));
++
++  base::Value::Dict value = timeline_.ToValue();
++  const base::Value::List* phases = value.FindList("phases");
++  ASSERT_TRUE(phases);
++  ASSERT_EQ(2u, phases->size());
++  EXPECT_EQ("write_config", *(*phases)[0].GetDict().FindString("name"));
++  EXPECT_EQ("spawn", *(*phases)[1].GetDict().FindString("name"));
++  EXPECT_EQ(30.0, (*phases)[1].GetDict().FindDouble("start_ms"));
++}
++
++TEST_F(StartupTimelineTest, BeginDiscardsPreviousTimeline) {
++  timeline_.Begin();
++  timeline_.BeginPhase("lock");
++  timeline_.EndPhase("lock");
++  timeline_.Finish();
++
++  timeline_.Begin();
++  EXPECT_TRUE(timeline_.is_active());
++  EXPECT_TRUE(timeline_.phases().empty());
++  EXPECT_FALSE(timeline_.ToValue().FindDouble("total_ms"));
++}
++
++// The "browseros" category is built in (an unregistered one would not
++// compile), and a trace enabling only it records the startup slices.
++TEST_F(StartupTimelineTest, EmitsBrowserOSTraceEvents) {
++  base::test::TracingEnvironment tracing_environment;
++  base::test::TestTraceProcessor trace_processor;
++  trace_processor.StartTrace("browseros");
++
++  bool enabled = false;
++  TRACE_EVENT_CATEGORY_GROUP_ENABLED("browseros", &enabled);
++  EXPECT_TRUE(enabled);
++
++  timeline_.Begin();
++  timeline_.BeginPhase("lock");
++  task_environment_.FastForwardBy(base::Milliseconds(20));
++  timeline_.EndPhase("lock");
++  timeline_.Finish();
++
++  absl::Status status = trace_processor.StopAndParseTrace();
++  ASSERT_TRUE(status.ok()) << status.message();
++  auto result = trace_processor.RunQuery(
++      "SELECT name FROM slice WHERE category = 'browseros' ORDER BY name");
++  ASSERT_TRUE(result.has_value()) << result.error();
++  EXPECT_THAT(result.value(),
++              ::testing::ElementsAre(
++                  std::vector<std::string>{"name"},
++                  std::vector<std::string>{"BrowserOSServerStartup"},
++                  std::vector<std::string>{"lock"}));
++}
++
++}  // namespace
++}  // namespace browseros
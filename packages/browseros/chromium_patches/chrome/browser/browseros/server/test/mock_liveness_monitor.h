@@ -0,0 +1,33 @@
+diff --git a/chrome/browser/browseros/server/test/mock_liveness_monitor.h b/chrome/browser/browseros/server/test/mock_liveness_monitor.h
+new file mode 100644
+index 0000000000000..44e77fef0e617
+--- /dev/null
++++ b/chrome/browser/browseros/server/test/mock_liveness_monitor.h
+@@ -0,0 +1,27 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_TEST_MOCK_LIVENESS_MONITOR_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_TEST_MOCK_LIVENESS_MONITOR_H_
++
++#include "chrome/browser/browseros/server/liveness_monitor.h"
++#include "testing/gmock/include/gmock/gmock.h"
++
++namespace browseros {
++
++class MockLivenessMonitor : public LivenessMonitor {
++ public:
++  MockLivenessMonitor();
++  ~MockLivenessMonitor() override;
++
++  MockLivenessMonitor(const MockLivenessMonitor&) = delete;
++  MockLivenessMonitor& operator=(const MockLivenessMonitor&) = delete;
++
++  MOCK_METHOD(bool, Start, (const base::Process&, ExitCallback), (override));
++  MOCK_METHOD(void, Stop, (), (override));
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_TEST_MOCK_LIVENESS_MONITOR_H_
@@ -1,6 +1,6 @@
 diff --git a/chrome/browser/browseros/server/test/mock_process_controller.h b/chrome/browser/browseros/server/test/mock_process_controller.h
 new file mode 100644
-index 0000000000000..97fdf04282691
+index 0000000000000..1820172bbc43a
 --- /dev/null
 +++ b/chrome/browser/browseros/server/test/mock_process_controller.h
 @@ -0,0 +1,38 @@
@@ -29,14 +29,14 @@ index 0000000000000..97fdf04282691
 +              (const ServerLaunchConfig&),
 +              (override));
 +  MOCK_METHOD(void, Terminate, (base::Process*, bool), (override));
-+  MOCK_METHOD(bool,
-+              WaitForExitWithTimeout,
-+              (base::Process*, base::TimeDelta, int*),
++  MOCK_METHOD(void,
++              TerminateAsync,
++              (base::Process, TerminationMode, base::TimeDelta,
++               TerminationCallback),
 +              (override));
 +  MOCK_METHOD(bool, Exists, (base::ProcessId), (override));
 +  MOCK_METHOD(std::optional<int64_t>, GetCreationTime, (base::ProcessId),
 +              (override));
-+  MOCK_METHOD(bool, Kill, (base::ProcessId, base::TimeDelta), (override));
 +};
 +
 +}  // namespace browseros
@@ -0,0 +1,157 @@
+diff --git a/chrome/browser/browseros/server/unix_socket_transport.cc b/chrome/browser/browseros/server/unix_socket_transport.cc
+new file mode 100644
+index 0000000000000..4ec5ecc3e609a
+--- /dev/null
++++ b/chrome/browser/browseros/server/unix_socket_transport.cc
+@@ -0,0 +1,151 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/unix_socket_transport.h"
++
++#include <sys/un.h>
++#include <unistd.h>
++
++#include <utility>
++
++#include "base/files/file_util.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/threading/thread_restrictions.h"
++#include "net/base/net_errors.h"
++#include "net/socket/stream_socket.h"
++#include "net/socket/unix_domain_server_socket_posix.h"
++
++namespace browseros {
++
++namespace {
++
++bool IsSameUser(const net::UnixDomainServerSocket::Credentials& credentials) {
++  return credentials.user_id == geteuid();
++}
++
++}  // namespace
++
++bool IsUnixSocketPathUsable(const base::FilePath& path) {
++  return !path.empty() && path.value().size() < sizeof(sockaddr_un::sun_path);
++}
++
++std::unique_ptr<net::ServerSocket> ListenOnUnixSocket(
++    const base::FilePath& path,
++    int backlog) {
++  if (!IsUnixSocketPathUsable(path)) {
++    LOG(WARNING) << "browseros: Unix socket path too long: " << path;
++    return nullptr;
++  }
++
++  {
++    // Unlinking a leftover socket file is a single metadata operation.
++    base::ScopedAllowBlocking allow_blocking;
++    base::DeleteFile(path);
++  }
++
++  auto socket = std::make_unique<net::UnixDomainServerSocket>(
++      base::BindRepeating(&IsSameUser), /*use_abstract_namespace=*/false);
++  int result = socket->BindAndListen(path.value(), backlog);
++  if (result != net::OK) {
++    LOG(WARNING) << "browseros: Failed to listen on " << path << " - "
++                 << net::ErrorToString(result);
++    return nullptr;
++  }
++  return socket;
++}
++
++DualServerSocket::Listener::Listener() = default;
++DualServerSocket::Listener::~Listener() = default;
++
++DualServerSocket::DualServerSocket(std::unique_ptr<net::ServerSocket> first,
++                                   std::unique_ptr<net::ServerSocket> second) {
++  listeners_[0].socket = std::move(first);
++  listeners_[1].socket = std::move(second);
++}
++
++DualServerSocket::~DualServerSocket() = default;
++
++int DualServerSocket::Listen(const net::IPEndPoint& address,
++                             int backlog,
++                             std::optional<bool> ipv6_only) {
++  // Both sockets are already listening.
++  return net::ERR_NOT_IMPLEMENTED;
++}
++
++int DualServerSocket::GetLocalAddress(net::IPEndPoint* address) const {
++  return listeners_[0].socket->GetLocalAddress(address);
++}
++
++int DualServerSocket::Accept(std::unique_ptr<net::StreamSocket>* socket,
++                             net::CompletionOnceCallback callback) {
++  DCHECK(!pending_callback_);
++  for (size_t i = 0; i < listeners_.size() && ready_.empty(); ++i) {
++    ArmListener(i);
++  }
++  if (!ready_.empty()) {
++    *socket = std::move(ready_.front());
++    ready_.pop_front();
++    return net::OK;
++  }
++  if (listeners_[0].failed && listeners_[1].failed) {
++    return net::ERR_FAILED;
++  }
++  pending_socket_ = socket;
++  pending_callback_ = std::move(callback);
++  return net::ERR_IO_PENDING;
++}
++
++void DualServerSocket::ArmListener(size_t index) {
++  Listener& listener = listeners_[index];
++  if (listener.accept_pending || listener.failed) {
++    return;
++  }
++  int rv = listener.socket->Accept(
++      &listener.accepted, base::BindOnce(&DualServerSocket::OnAccepted,
++                                         base::Unretained(this), index));
++  if (rv == net::ERR_IO_PENDING) {
++    listener.accept_pending = true;
++    return;
++  }
++  HandleAcceptResult(index, rv);
++}
++
++void DualServerSocket::OnAccepted(size_t index, int rv) {
++  listeners_[index].accept_pending = false;
++  HandleAcceptResult(index, rv);
++
++  if (!pending_callback_) {
++    return;
++  }
++  if (ready_.empty()) {
++    // Keep accepting on this socket while the caller waits.
++    ArmListener(index);
++  }
++  if (ready_.empty()) {
++    if (listeners_[0].failed && listeners_[1].failed) {
++      pending_socket_ = nullptr;
++      std::move(pending_callback_).Run(net::ERR_FAILED);
++    }
++    return;
++  }
++  *pending_socket_ = std::move(ready_.front());
++  ready_.pop_front();
++  pending_socket_ = nullptr;
++  std::move(pending_callback_).Run(net::OK);
++}
++
++void DualServerSocket::HandleAcceptResult(size_t index, int rv) {
++  Listener& listener = listeners_[index];
++  if (rv == net::OK) {
++    ready_.push_back(std::move(listener.accepted));
++    return;
++  }
++  // A failed listener stops; the other one keeps serving.
++  LOG(WARNING) << "browseros: Accept failed on listener " << index << " - "
++               << net::ErrorToString(rv);
++  listener.failed = true;
++}
++
++}  // namespace browseros
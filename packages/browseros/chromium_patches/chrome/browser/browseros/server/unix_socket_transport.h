@@ -0,0 +1,89 @@
+diff --git a/chrome/browser/browseros/server/unix_socket_transport.h b/chrome/browser/browseros/server/unix_socket_transport.h
+new file mode 100644
+index 0000000000000..68a111a7c1b6f
+--- /dev/null
++++ b/chrome/browser/browseros/server/unix_socket_transport.h
+@@ -0,0 +1,83 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_UNIX_SOCKET_TRANSPORT_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_UNIX_SOCKET_TRANSPORT_H_
++
++#include <array>
++#include <memory>
++#include <optional>
++
++#include "base/containers/circular_deque.h"
++#include "base/files/file_path.h"
++#include "base/memory/raw_ptr.h"
++#include "net/base/completion_once_callback.h"
++#include "net/socket/server_socket.h"
++
++namespace net {
++class StreamSocket;
++}  // namespace net
++
++namespace browseros {
++
++// Unix domain socket transport between the browser, the MCP proxy and the
++// sidecar. The sockets live in a 0700 directory under the execution dir and
++// only accept peers running as the same user.
++
++// Returns false if |path| is too long for sockaddr_un.
++bool IsUnixSocketPathUsable(const base::FilePath& path);
++
++// Binds and listens on |path|, replacing a stale socket file left by a
++// previous run. Returns nullptr on failure.
++std::unique_ptr<net::ServerSocket> ListenOnUnixSocket(
++    const base::FilePath& path,
++    int backlog);
++
++// Accepts connections from two listening sockets, so one net::HttpServer
++// (or DevTools handler) can serve a TCP port and a Unix socket at once.
++// GetLocalAddress() reports the first socket.
++class DualServerSocket : public net::ServerSocket {
++ public:
++  DualServerSocket(std::unique_ptr<net::ServerSocket> first,
++                   std::unique_ptr<net::ServerSocket> second);
++  ~DualServerSocket() override;
++
++  DualServerSocket(const DualServerSocket&) = delete;
++  DualServerSocket& operator=(const DualServerSocket&) = delete;
++
++  // net::ServerSocket:
++  int Listen(const net::IPEndPoint& address,
++             int backlog,
++             std::optional<bool> ipv6_only) override;
++  int GetLocalAddress(net::IPEndPoint* address) const override;
++  int Accept(std::unique_ptr<net::StreamSocket>* socket,
++             net::CompletionOnceCallback callback) override;
++
++ private:
++  struct Listener {
++    Listener();
++    ~Listener();
++
++    std::unique_ptr<net::ServerSocket> socket;
++    std::unique_ptr<net::StreamSocket> accepted;
++    bool accept_pending = false;
++    bool failed = false;
++  };
++
++  // Starts an accept on |index| unless one is pending.
++  void ArmListener(size_t index);
++  void OnAccepted(size_t index, int rv);
++  void HandleAcceptResult(size_t index, int rv);
++
++  std::array<Listener, 2> listeners_;
++  base::circular_deque<std::unique_ptr<net::StreamSocket>> ready_;
++
++  // Set while the caller waits for a connection.
++  raw_ptr<std::unique_ptr<net::StreamSocket>> pending_socket_ = nullptr;
++  net::CompletionOnceCallback pending_callback_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_UNIX_SOCKET_TRANSPORT_H_
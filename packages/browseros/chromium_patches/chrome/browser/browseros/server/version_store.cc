@@ -0,0 +1,241 @@
+diff --git a/chrome/browser/browseros/server/version_store.cc b/chrome/browser/browseros/server/version_store.cc
+new file mode 100644
+index 0000000000000..6a907422dcf30
+--- /dev/null
++++ b/chrome/browser/browseros/server/version_store.cc
+@@ -0,0 +1,235 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/version_store.h"
++
++#include <memory>
++#include <string_view>
++
++#include "base/containers/span.h"
++#include "base/files/file.h"
++#include "base/files/file_enumerator.h"
++#include "base/files/file_util.h"
++#include "base/logging.h"
++#include "base/memory/raw_ptr.h"
++#include "base/strings/string_number_conversions.h"
++#include "build/build_config.h"
++#include "crypto/secure_hash.h"
++#include "crypto/sha2.h"
++#include "third_party/zlib/google/zip_reader.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include <sys/stat.h>
++#include <unistd.h>
++#elif BUILDFLAG(IS_WIN)
++#include <windows.h>
++#endif
++
++namespace browseros_server {
++
++namespace {
++
++constexpr char kTempDirName[] = "tmp";
++constexpr char kExecutableSuffix[] = ".x";
++
++// Unpacks one ZIP entry to a file while hashing it.
++class HashingWriterDelegate : public zip::WriterDelegate {
++ public:
++  explicit HashingWriterDelegate(base::File* file)
++      : file_(file),
++        hash_(crypto::SecureHash::Create(crypto::SecureHash::SHA256)) {}
++
++  // zip::WriterDelegate:
++  bool PrepareOutput() override { return file_->IsValid(); }
++  bool WriteBytes(const char* data, int num_bytes) override {
++    if (!file_->WriteAtCurrentPosAndCheck(base::as_bytes(
++            base::span(data, static_cast<size_t>(num_bytes))))) {
++      return false;
++    }
++    hash_->Update(data, num_bytes);
++    size_ += num_bytes;
++    return true;
++  }
++  void SetPosixFilePermissions(int mode) override { mode_ = mode; }
++
++  std::string FinishHash() {
++    uint8_t digest[crypto::kSHA256Length];
++    hash_->Finish(digest, sizeof(digest));
++    return base::HexEncodeLower(digest);
++  }
++
++  bool executable() const { return (mode_ & 0111) != 0; }
++  int64_t size() const { return size_; }
++
++ private:
++  raw_ptr<base::File> file_;
++  std::unique_ptr<crypto::SecureHash> hash_;
++  int mode_ = 0;
++  int64_t size_ = 0;
++};
++
++// Returns the number of directory entries referring to |path|, or 0 if it
++// cannot be determined.
++int GetLinkCount(const base::FilePath& path) {
++#if BUILDFLAG(IS_POSIX)
++  struct stat info;
++  if (stat(path.value().c_str(), &info) != 0) {
++    return 0;
++  }
++  return static_cast<int>(info.st_nlink);
++#elif BUILDFLAG(IS_WIN)
++  base::File file(path, base::File::FLAG_OPEN |
++                            base::File::FLAG_WIN_SHARE_DELETE |
++                            base::File::FLAG_READ);
++  BY_HANDLE_FILE_INFORMATION info;
++  if (!file.IsValid() ||
++      !::GetFileInformationByHandle(file.GetPlatformFile(), &info)) {
++    return 0;
++  }
++  return static_cast<int>(info.nNumberOfLinks);
++#else
++  return 0;
++#endif
++}
++
++// Makes |link| refer to |blob|, copying when hard links are not supported
++// (e.g. FAT volumes).
++bool LinkOrCopy(const base::FilePath& blob, const base::FilePath& link) {
++#if BUILDFLAG(IS_POSIX)
++  if (::link(blob.value().c_str(), link.value().c_str()) == 0) {
++    return true;
++  }
++#elif BUILDFLAG(IS_WIN)
++  if (::CreateHardLinkW(link.value().c_str(), blob.value().c_str(),
++                        nullptr)) {
++    return true;
++  }
++#endif
++  return base::CopyFile(blob, link);
++}
++
++}  // namespace
++
++VersionStore::VersionStore(const base::FilePath& store_dir)
++    : store_dir_(store_dir) {}
++
++VersionStore::~VersionStore() = default;
++
++std::string VersionStore::ExtractZip(base::File& zip_file,
++                                     const base::FilePath& dest_dir,
++                                     ExtractStats* stats) {
++  if (!base::CreateDirectory(dest_dir) ||
++      !base::CreateDirectory(GetTempDir())) {
++    return "Failed to create destination directory: " + dest_dir.AsUTF8Unsafe();
++  }
++
++  zip::ZipReader reader;
++  if (zip_file.Seek(base::File::FROM_BEGIN, 0) != 0 ||
++      !reader.OpenFromPlatformFile(zip_file.GetPlatformFile())) {
++    return "Failed to open ZIP file";
++  }
++
++  while (const zip::ZipReader::Entry* entry = reader.Next()) {
++    if (entry->is_unsafe || entry->is_encrypted) {
++      return "Unsafe ZIP entry: " + entry->path.AsUTF8Unsafe();
++    }
++    base::FilePath dest_path = dest_dir.Append(entry->path);
++    if (entry->is_directory) {
++      if (!base::CreateDirectory(dest_path)) {
++        return "Failed to create directory: " + dest_path.AsUTF8Unsafe();
++      }
++      continue;
++    }
++
++    base::FilePath temp_path;
++    if (!base::CreateTemporaryFileInDir(GetTempDir(), &temp_path)) {
++      return "Failed to create temporary file in store";
++    }
++    base::File temp_file(
++        temp_path, base::File::FLAG_OPEN_TRUNCATED | base::File::FLAG_WRITE);
++    HashingWriterDelegate writer(&temp_file);
++    bool extracted = reader.ExtractCurrentEntry(&writer);
++    temp_file.Close();
++    if (!extracted) {
++      base::DeleteFile(temp_path);
++      return "Failed to extract " + entry->path.AsUTF8Unsafe();
++    }
++
++    bool reused = false;
++    base::FilePath blob =
++        Commit(temp_path, writer.FinishHash(), writer.executable(), &reused);
++    if (blob.empty() || !base::CreateDirectory(dest_path.DirName()) ||
++        !LinkOrCopy(blob, dest_path)) {
++      return "Failed to link " + entry->path.AsUTF8Unsafe();
++    }
++
++    ++stats->files;
++    if (reused) {
++      ++stats->reused;
++    } else {
++      stats->bytes_added += writer.size();
++    }
++  }
++
++  if (!reader.ok()) {
++    return "Failed to read ZIP file";
++  }
++
++  LOG(INFO) << "browseros: Extracted " << stats->files << " files to "
++            << dest_dir << " (" << stats->reused << " already in store, "
++            << stats->bytes_added << " new bytes)";
++  return "";
++}
++
++base::FilePath VersionStore::Commit(const base::FilePath& temp_file,
++                                    const std::string& hash,
++                                    bool executable,
++                                    bool* reused) {
++  base::FilePath blob = store_dir_.AppendASCII(hash.substr(0, 2))
++                            .AppendASCII(executable ? hash + kExecutableSuffix
++                                                    : hash);
++  if (base::PathExists(blob)) {
++    base::DeleteFile(temp_file);
++    *reused = true;
++    return blob;
++  }
++
++#if BUILDFLAG(IS_POSIX)
++  if (!base::SetPosixFilePermissions(temp_file, executable ? 0755 : 0644)) {
++    base::DeleteFile(temp_file);
++    return base::FilePath();
++  }
++#endif
++  if (!base::CreateDirectory(blob.DirName()) || !base::Move(temp_file, blob)) {
++    base::DeleteFile(temp_file);
++    return base::FilePath();
++  }
++  return blob;
++}
++
++int VersionStore::CollectGarbage() {
++  if (!base::PathExists(store_dir_)) {
++    return 0;
++  }
++
++  // Extraction runs on the same sequence, so temp files are leftovers.
++  base::DeletePathRecursively(GetTempDir());
++
++  int deleted = 0;
++  base::FileEnumerator enumerator(store_dir_, /*recursive=*/true,
++                                  base::FileEnumerator::FILES);
++  for (base::FilePath path = enumerator.Next(); !path.empty();
++       path = enumerator.Next()) {
++    if (GetLinkCount(path) == 1 && base::DeleteFile(path)) {
++      ++deleted;
++    }
++  }
++  return deleted;
++}
++
++base::FilePath VersionStore::GetTempDir() const {
++  return store_dir_.AppendASCII(kTempDirName);
++}
++
++}  // namespace browseros_server
@@ -0,0 +1,80 @@
+diff --git a/chrome/browser/browseros/server/version_store.h b/chrome/browser/browseros/server/version_store.h
+new file mode 100644
+index 0000000000000..4c7253d11f559
+--- /dev/null
++++ b/chrome/browser/browseros/server/version_store.h
+@@ -0,0 +1,74 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_VERSION_STORE_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_VERSION_STORE_H_
++
++#include <cstdint>
++#include <string>
++
++#include "base/files/file_path.h"
++
++namespace base {
++class File;
++}
++
++namespace browseros_server {
++
++// Content-addressed store of server files shared by the version directories.
++//
++// Each file is kept once as store/<aa>/<sha256>[.x], where ".x" marks an
++// executable. A version directory is a tree of hard links into the store, so
++// files unchanged between releases take disk space once. A blob no version
++// links to has a link count of one and is removed by CollectGarbage().
++//
++// Linked files must not be modified in place. Where hard links are not
++// supported, files are copied and the blob is collected on the next pass.
++//
++// All methods block and must run on a sequence that allows it. Extraction and
++// garbage collection in the same store must run on one sequence.
++class VersionStore {
++ public:
++  struct ExtractStats {
++    int files = 0;
++    // Files whose content was already in the store.
++    int reused = 0;
++    // Bytes of new content added to the store.
++    int64_t bytes_added = 0;
++  };
++
++  explicit VersionStore(const base::FilePath& store_dir);
++  ~VersionStore();
++
++  VersionStore(const VersionStore&) = delete;
++  VersionStore& operator=(const VersionStore&) = delete;
++
++  // Extracts the ZIP open in |zip_file| into |dest_dir|, which must not
++  // exist yet. Each entry is hashed as it is unpacked and linked to the blob
++  // with that content. Returns empty string on success, error message on
++  // failure.
++  std::string ExtractZip(base::File& zip_file,
++                         const base::FilePath& dest_dir,
++                         ExtractStats* stats);
++
++  // Deletes blobs that no version directory links to, and any leftovers of
++  // interrupted extractions. Returns the number of blobs deleted.
++  int CollectGarbage();
++
++ private:
++  // Moves the unpacked |temp_file| into the store unless a blob with the same
++  // content exists. Returns the blob path, or empty on failure.
++  base::FilePath Commit(const base::FilePath& temp_file,
++                        const std::string& hash,
++                        bool executable,
++                        bool* reused);
++
++  base::FilePath GetTempDir() const;
++
++  const base::FilePath store_dir_;
++};
++
++}  // namespace browseros_server
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_VERSION_STORE_H_
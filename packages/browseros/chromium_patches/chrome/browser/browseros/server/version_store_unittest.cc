@@ -0,0 +1,127 @@
+diff --git a/chrome/browser/browseros/server/version_store_unittest.cc b/chrome/browser/browseros/server/version_store_unittest.cc
+new file mode 100644
+index 0000000000000..c50a7ed8a52e4
+--- /dev/null
++++ b/chrome/browser/browseros/server/version_store_unittest.cc
+@@ -0,0 +1,121 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/version_store.h"
++
++#include <map>
++#include <string>
++
++#include "base/files/file.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "build/build_config.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "third_party/zlib/google/zip.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include <sys/stat.h>
++#endif
++
++namespace browseros_server {
++namespace {
++
++class VersionStoreTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    store_dir_ = temp_dir_.GetPath().AppendASCII("store");
++  }
++
++  // Zips |files| (relative path -> contents) and extracts the result into
++  // versions/<name> through the store.
++  VersionStore::ExtractStats Install(
++      const std::string& name,
++      const std::map<std::string, std::string>& files) {
++    base::FilePath src = temp_dir_.GetPath().AppendASCII("src-" + name);
++    for (const auto& [path, contents] : files) {
++      base::FilePath file = src.AppendASCII(path);
++      EXPECT_TRUE(base::CreateDirectory(file.DirName()));
++      EXPECT_TRUE(base::WriteFile(file, contents));
++    }
++    base::FilePath zip_path = temp_dir_.GetPath().AppendASCII(name + ".zip");
++    EXPECT_TRUE(zip::Zip(src, zip_path, /*include_hidden_files=*/true));
++
++    base::File zip_file(zip_path,
++                        base::File::FLAG_OPEN | base::File::FLAG_READ);
++    VersionStore::ExtractStats stats;
++    EXPECT_EQ("", VersionStore(store_dir_).ExtractZip(
++                      zip_file, GetVersionDir(name), &stats));
++    return stats;
++  }
++
++  base::FilePath GetVersionDir(const std::string& name) {
++    return temp_dir_.GetPath().AppendASCII("versions").AppendASCII(name);
++  }
++
++  std::string Read(const std::string& name, const std::string& path) {
++    std::string contents;
++    EXPECT_TRUE(base::ReadFileToString(
++        GetVersionDir(name).AppendASCII(path), &contents));
++    return contents;
++  }
++
++  base::ScopedTempDir temp_dir_;
++  base::FilePath store_dir_;
++};
++
++TEST_F(VersionStoreTest, SharesUnchangedFilesBetweenVersions) {
++  VersionStore::ExtractStats first =
++      Install("1.0.0", {{"bin/server", "binary-1"},
++                        {"resources/app.js", "shared"},
++                        {"resources/style.css", "also shared"}});
++  EXPECT_EQ(3, first.files);
++  EXPECT_EQ(0, first.reused);
++
++  VersionStore::ExtractStats second =
++      Install("1.1.0", {{"bin/server", "binary-2"},
++                        {"resources/app.js", "shared"},
++                        {"resources/style.css", "also shared"}});
++  EXPECT_EQ(3, second.files);
++  EXPECT_EQ(2, second.reused);
++  EXPECT_EQ(static_cast<int64_t>(sizeof("binary-2") - 1), second.bytes_added);
++
++  EXPECT_EQ("binary-1", Read("1.0.0", "bin/server"));
++  EXPECT_EQ("binary-2", Read("1.1.0", "bin/server"));
++  EXPECT_EQ("shared", Read("1.1.0", "resources/app.js"));
++
++#if BUILDFLAG(IS_POSIX)
++  // The store's blob plus one link per version.
++  struct stat info;
++  ASSERT_EQ(0, stat(GetVersionDir("1.1.0")
++                        .AppendASCII("resources/app.js")
++                        .value()
++                        .c_str(),
++                    &info));
++  EXPECT_EQ(3u, static_cast<unsigned>(info.st_nlink));
++#endif
++}
++
++TEST_F(VersionStoreTest, CollectGarbageKeepsReferencedBlobs) {
++  Install("1.0.0", {{"bin/server", "binary-1"}, {"app.js", "shared"}});
++  Install("1.1.0", {{"bin/server", "binary-2"}, {"app.js", "shared"}});
++
++  // Nothing is unreferenced yet.
++  EXPECT_EQ(0, VersionStore(store_dir_).CollectGarbage());
++
++  ASSERT_TRUE(base::DeletePathRecursively(GetVersionDir("1.0.0")));
++  // Only "binary-1" was used by 1.0.0 alone.
++  EXPECT_EQ(1, VersionStore(store_dir_).CollectGarbage());
++
++  EXPECT_EQ("binary-2", Read("1.1.0", "bin/server"));
++  EXPECT_EQ("shared", Read("1.1.0", "app.js"));
++
++  // The next version can still reuse what survived.
++  VersionStore::ExtractStats third =
++      Install("1.2.0", {{"bin/server", "binary-3"}, {"app.js", "shared"}});
++  EXPECT_EQ(1, third.reused);
++}
++
++}  // namespace
++}  // namespace browseros_server
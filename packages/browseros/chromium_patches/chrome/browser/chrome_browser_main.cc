@@ -2,15 +2,16 @@ diff --git a/chrome/browser/chrome_browser_main.cc b/chrome/browser/chrome_brows
 index 92a45baf84050..476d604b649fc 100644
 --- a/chrome/browser/chrome_browser_main.cc
 +++ b/chrome/browser/chrome_browser_main.cc
-@@ -10,6 +10,7 @@
+@@ -10,6 +10,8 @@
  #include <utility>
  
  #include "base/at_exit.h"
++#include "chrome/browser/browseros/core/browseros_startup_scheduler.h"
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
  #include "base/base_switches.h"
  #include "base/check.h"
  #include "base/command_line.h"
-@@ -1233,6 +1234,8 @@ int ChromeBrowserMainParts::PreCreateThreadsImpl() {
+@@ -1233,6 +1235,8 @@ int ChromeBrowserMainParts::PreCreateThreadsImpl() {
    if (first_run::IsChromeFirstRun()) {
      if (!base::CommandLine::ForCurrentProcess()->HasSwitch(switches::kApp) &&
          !base::CommandLine::ForCurrentProcess()->HasSwitch(switches::kAppId)) {
@@ -19,7 +20,7 @@ index 92a45baf84050..476d604b649fc 100644
        browser_creator_->AddFirstRunTabs(master_prefs_->new_tabs);
      }
    }
-@@ -1252,6 +1255,43 @@ int ChromeBrowserMainParts::PreCreateThreadsImpl() {
+@@ -1252,6 +1256,43 @@ int ChromeBrowserMainParts::PreCreateThreadsImpl() {
    }
  #endif
  
@@ -63,10 +64,14 @@ index 92a45baf84050..476d604b649fc 100644
  #if BUILDFLAG(IS_MAC)
  #if defined(ARCH_CPU_X86_64)
    // The use of Rosetta to run the x64 version of Chromium on Arm is neither
-@@ -1812,6 +1852,12 @@ int ChromeBrowserMainParts::PreMainMessageLoopRunImpl() {
+@@ -1812,6 +1853,16 @@ int ChromeBrowserMainParts::PreMainMessageLoopRunImpl() {
      g_browser_process->CreateDevToolsAutoOpener();
    }
  
++  // BrowserOS: Create the startup scheduler before anything posts to it so
++  // that it observes startup completing.
++  browseros::BrowserOSStartupScheduler::GetInstance();
++
 +  // BrowserOS: Start AFTER CreateDevToolsProtocolHandler so that BrowserOS's
 +  // CDP handler replaces Chromium's (StartRemoteDebuggingServer is a global
 +  // singleton — the last caller wins).
@@ -76,7 +81,7 @@ index 92a45baf84050..476d604b649fc 100644
    // Needs to be done before PostProfileInit, since the SODA Installer setup is
    // called inside PostProfileInit and depends on it.
    if (!base::CommandLine::ForCurrentProcess()->HasSwitch(
-@@ -2099,6 +2145,11 @@ void ChromeBrowserMainParts::PostMainMessageLoopRun() {
+@@ -2099,6 +2150,11 @@ void ChromeBrowserMainParts::PostMainMessageLoopRun() {
      chrome_extra_part->PostMainMessageLoopRun();
    }
  
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/devtools/protocol/bookmarks_handler.cc b/chrome/browser/devtools/protocol/bookmarks_handler.cc
 new file mode 100644
-index 0000000000000..ba94d3cf12c7e
+index 0000000000000..ad7b2ca9a8682
 --- /dev/null
 +++ b/chrome/browser/devtools/protocol/bookmarks_handler.cc
-@@ -0,0 +1,299 @@
+@@ -0,0 +1,309 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -16,6 +16,7 @@ index 0000000000000..ba94d3cf12c7e
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "chrome/browser/bookmarks/bookmark_model_factory.h"
++#include "chrome/browser/browseros/metrics/browseros_perf_stats.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "components/bookmarks/browser/bookmark_model.h"
 +#include "components/bookmarks/browser/bookmark_node.h"
@@ -27,9 +28,12 @@ index 0000000000000..ba94d3cf12c7e
 +using protocol::Response;
 +using bookmarks::BookmarkModel;
 +using bookmarks::BookmarkNode;
++using browseros_metrics::ScopedPerfTimer;
 +
 +namespace {
 +
++constexpr auto kCDP = browseros_metrics::BrowserOSPerfStats::Surface::kCDP;
++
 +std::unique_ptr<protocol::Bookmarks::BookmarkNode> BuildBookmarkNode(
 +    const BookmarkNode* node) {
 +  auto result = protocol::Bookmarks::BookmarkNode::Create()
@@ -111,6 +115,7 @@ index 0000000000000..ba94d3cf12c7e
 +    std::optional<std::string> folder_id,
 +    std::unique_ptr<protocol::Array<protocol::Bookmarks::BookmarkNode>>*
 +        out_nodes) {
++  ScopedPerfTimer perf_timer(kCDP, "Bookmarks.getBookmarks");
 +  BookmarkModel* model = GetBookmarkModel();
 +  if (!model || !model->loaded()) {
 +    return Response::ServerError("Bookmark model not loaded");
@@ -143,6 +148,7 @@ index 0000000000000..ba94d3cf12c7e
 +    std::optional<int> max_results,
 +    std::unique_ptr<protocol::Array<protocol::Bookmarks::BookmarkNode>>*
 +        out_results) {
++  ScopedPerfTimer perf_timer(kCDP, "Bookmarks.searchBookmarks");
 +  BookmarkModel* model = GetBookmarkModel();
 +  if (!model || !model->loaded()) {
 +    return Response::ServerError("Bookmark model not loaded");
@@ -175,6 +181,7 @@ index 0000000000000..ba94d3cf12c7e
 +    std::optional<std::string> parent_id,
 +    std::optional<int> index,
 +    std::unique_ptr<protocol::Bookmarks::BookmarkNode>* out_node) {
++  ScopedPerfTimer perf_timer(kCDP, "Bookmarks.createBookmark");
 +  BookmarkModel* model = GetBookmarkModel();
 +  if (!model || !model->loaded()) {
 +    return Response::ServerError("Bookmark model not loaded");
@@ -221,6 +228,7 @@ index 0000000000000..ba94d3cf12c7e
 +    std::optional<std::string> title,
 +    std::optional<std::string> url,
 +    std::unique_ptr<protocol::Bookmarks::BookmarkNode>* out_node) {
++  ScopedPerfTimer perf_timer(kCDP, "Bookmarks.updateBookmark");
 +  BookmarkModel* model = GetBookmarkModel();
 +  if (!model || !model->loaded()) {
 +    return Response::ServerError("Bookmark model not loaded");
@@ -257,6 +265,7 @@ index 0000000000000..ba94d3cf12c7e
 +    std::optional<std::string> parent_id,
 +    std::optional<int> index,
 +    std::unique_ptr<protocol::Bookmarks::BookmarkNode>* out_node) {
++  ScopedPerfTimer perf_timer(kCDP, "Bookmarks.moveBookmark");
 +  BookmarkModel* model = GetBookmarkModel();
 +  if (!model || !model->loaded()) {
 +    return Response::ServerError("Bookmark model not loaded");
@@ -289,6 +298,7 @@ index 0000000000000..ba94d3cf12c7e
 +}
 +
 +Response BookmarksHandler::RemoveBookmark(const std::string& id) {
++  ScopedPerfTimer perf_timer(kCDP, "Bookmarks.removeBookmark");
 +  BookmarkModel* model = GetBookmarkModel();
 +  if (!model || !model->loaded()) {
 +    return Response::ServerError("Bookmark model not loaded");
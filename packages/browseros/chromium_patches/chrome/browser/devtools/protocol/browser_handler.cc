@@ -2,7 +2,7 @@ diff --git a/chrome/browser/devtools/protocol/browser_handler.cc b/chrome/browse
 index 30bd52d09c3fc..053af0b50b3d7 100644
 --- a/chrome/browser/devtools/protocol/browser_handler.cc
 +++ b/chrome/browser/devtools/protocol/browser_handler.cc
-@@ -8,19 +8,32 @@
+@@ -8,19 +8,38 @@
  #include <vector>
  
  #include "base/functional/bind.h"
@@ -10,9 +10,15 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
  #include "base/memory/ref_counted_memory.h"
 +#include "base/strings/utf_string_conversions.h"
  #include "chrome/app/chrome_command_ids.h"
++#include "chrome/browser/browseros/core/browseros_tab_registry.h"
++#include "chrome/browser/browseros/metrics/browseros_perf_stats.h"
++#include "chrome/browser/browseros/server/browseros_server_manager.h"
  #include "chrome/browser/devtools/chrome_devtools_manager_delegate.h"
  #include "chrome/browser/devtools/devtools_dock_tile.h"
++#include "chrome/browser/devtools/protocol/hidden_tab_governor.h"
 +#include "chrome/browser/devtools/protocol/hidden_tab_manager.h"
++#include "chrome/browser/devtools/protocol/hidden_tab_pool.h"
++#include "chrome/browser/devtools/protocol/tab_event_stream.h"
  #include "chrome/browser/profiles/profile.h"
  #include "chrome/browser/profiles/profile_manager.h"
 +#include "chrome/browser/ui/browser.h"
@@ -35,10 +41,13 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
  #include "content/public/browser/browser_task_traits.h"
  #include "content/public/browser/browser_thread.h"
  #include "content/public/browser/devtools_agent_host.h"
-@@ -72,11 +85,403 @@ std::unique_ptr<protocol::Browser::Bounds> GetBrowserWindowBounds(
+@@ -72,11 +91,405 @@ std::unique_ptr<protocol::Browser::Bounds> GetBrowserWindowBounds(
        .Build();
  }
  
++using browseros_metrics::ScopedPerfTimer;
++constexpr auto kCDP = browseros_metrics::BrowserOSPerfStats::Surface::kCDP;
++
 +BrowserWindowInterface* GetBrowserWindowInterface(int window_id) {
 +  BrowserWindowInterface* result = nullptr;
 +  ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
@@ -129,6 +138,29 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +  return id.token().ToString();
 +}
 +
++std::string GetHiddenTabState(HiddenTabGovernor::State state) {
++  switch (state) {
++    case HiddenTabGovernor::State::kActive:
++      return "active";
++    case HiddenTabGovernor::State::kFrozen:
++      return "frozen";
++    case HiddenTabGovernor::State::kDiscarded:
++      return "discarded";
++  }
++}
++
++std::unique_ptr<protocol::Browser::TabResourceUsage> BuildTabResourceUsage(
++    const HiddenTabGovernor::Usage& usage) {
++  auto info = protocol::Browser::TabResourceUsage::Create()
++                  .SetState(GetHiddenTabState(usage.state))
++                  .SetIdleSeconds(usage.idle_time.InSecondsF())
++                  .Build();
++  if (usage.private_memory_kb) {
++    info->SetPrivateMemoryKb(static_cast<double>(*usage.private_memory_kb));
++  }
++  return info;
++}
++
 +std::unique_ptr<protocol::Browser::TabInfo> BuildTabInfo(
 +    content::WebContents* wc,
 +    BrowserWindowInterface* bwi,
@@ -174,6 +206,14 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    info->SetBrowserContextId(profile->GetDebugName());
 +  }
 +
++  if (is_hidden) {
++    std::optional<HiddenTabGovernor::Usage> usage =
++        HiddenTabGovernor::GetInstance()->GetUsage(wc);
++    if (usage) {
++      info->SetResourceUsage(BuildTabResourceUsage(*usage));
++    }
++  }
++
 +  return info;
 +}
 +
@@ -184,6 +224,27 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +  bool is_hidden = false;
 +};
 +
++// Finds a tab shown in a browser window through the BrowserOS tab registry,
++// without scanning every window.
++bool FindWindowTab(int tab_id,
++                   BrowserWindowInterface** out_bwi,
++                   int* out_index) {
++  browseros::BrowserOSTabRegistry* registry =
++      browseros::BrowserOSTabRegistry::GetInstance();
++  BrowserWindowInterface* bwi = registry->GetWindowForTab(tab_id);
++  if (!bwi) {
++    return false;
++  }
++  int index = bwi->GetTabStripModel()->GetIndexOfWebContents(
++      registry->FindByTabId(tab_id));
++  if (index == TabStripModel::kNoTab) {
++    return false;
++  }
++  *out_bwi = bwi;
++  *out_index = index;
++  return true;
++}
++
 +Response ResolveTabIdentifier(std::optional<std::string> target_id,
 +                              std::optional<int> tab_id,
 +                              HiddenTabManager* hidden_manager,
@@ -197,49 +258,21 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +        "Either targetId or tabId must be specified");
 +  }
 +
++  int tid = -1;
 +  if (target_id.has_value()) {
-+    auto host = content::DevToolsAgentHost::GetForId(target_id.value());
-+    if (!host)
-+      return Response::ServerError("No target with given id");
-+    content::WebContents* wc = host->GetWebContents();
-+    if (!wc)
-+      return Response::ServerError("No web contents in the target");
-+
-+    if (hidden_manager) {
-+      SessionID sid = sessions::SessionTabHelper::IdForTab(wc);
-+      if (sid.is_valid() && hidden_manager->IsHidden(sid.id())) {
-+        result->web_contents = wc;
-+        result->is_hidden = true;
-+        return Response::Success();
-+      }
-+    }
-+
-+    BrowserWindowInterface* found_bwi = nullptr;
-+    int found_index = -1;
-+    ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
-+        [wc, &found_bwi, &found_index](BrowserWindowInterface* bwi) {
-+          TabStripModel* tab_strip = bwi->GetTabStripModel();
-+          int idx = tab_strip->GetIndexOfWebContents(wc);
-+          if (idx != TabStripModel::kNoTab) {
-+            found_bwi = bwi;
-+            found_index = idx;
-+            return false;
-+          }
-+          return true;
-+        });
-+
-+    if (!found_bwi)
++    content::WebContents* wc =
++        browseros::BrowserOSTabRegistry::GetInstance()->FindByTargetId(
++            target_id.value());
++    if (!wc) {
++      if (!content::DevToolsAgentHost::GetForId(target_id.value()))
++        return Response::ServerError("No target with given id");
 +      return Response::ServerError("No tab with given id");
-+
-+    result->web_contents = wc;
-+    result->bwi = found_bwi;
-+    result->tab_index = found_index;
-+    return Response::Success();
++    }
++    tid = sessions::SessionTabHelper::IdForTab(wc).id();
++  } else {
++    tid = tab_id.value();
 +  }
 +
-+  // tab_id provided
-+  int tid = tab_id.value();
-+
 +  if (hidden_manager) {
 +    content::WebContents* hidden_wc = hidden_manager->FindByTabId(tid);
 +    if (hidden_wc) {
@@ -250,29 +283,12 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +  }
 +
 +  BrowserWindowInterface* found_bwi = nullptr;
-+  content::WebContents* found_wc = nullptr;
 +  int found_index = -1;
-+  ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
-+      [tid, &found_bwi, &found_wc,
-+       &found_index](BrowserWindowInterface* bwi) {
-+        TabStripModel* tab_strip = bwi->GetTabStripModel();
-+        for (int i = 0; i < tab_strip->count(); ++i) {
-+          content::WebContents* wc = tab_strip->GetWebContentsAt(i);
-+          SessionID sid = sessions::SessionTabHelper::IdForTab(wc);
-+          if (sid.is_valid() && sid.id() == tid) {
-+            found_bwi = bwi;
-+            found_wc = wc;
-+            found_index = i;
-+            return false;
-+          }
-+        }
-+        return true;
-+      });
-+
-+  if (!found_wc)
++  if (!FindWindowTab(tid, &found_bwi, &found_index))
 +    return Response::ServerError("No tab with given id");
 +
-+  result->web_contents = found_wc;
++  result->web_contents =
++      found_bwi->GetTabStripModel()->GetWebContentsAt(found_index);
 +  result->bwi = found_bwi;
 +  result->tab_index = found_index;
 +  return Response::Success();
@@ -398,23 +414,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +  for (int tid : tab_ids) {
 +    BrowserWindowInterface* found_bwi = nullptr;
 +    int found_index = -1;
-+
-+    ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
-+        [tid, &found_bwi, &found_index](BrowserWindowInterface* bwi) {
-+          TabStripModel* tab_strip = bwi->GetTabStripModel();
-+          for (int i = 0; i < tab_strip->count(); ++i) {
-+            content::WebContents* wc = tab_strip->GetWebContentsAt(i);
-+            SessionID sid = sessions::SessionTabHelper::IdForTab(wc);
-+            if (sid.is_valid() && sid.id() == tid) {
-+              found_bwi = bwi;
-+              found_index = i;
-+              return false;
-+            }
-+          }
-+          return true;
-+        });
-+
-+    if (!found_bwi) {
++    if (!FindWindowTab(tid, &found_bwi, &found_index)) {
 +      return Response::ServerError("No tab with given id");
 +    }
 +
@@ -438,9 +438,18 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    : target_id_(target_id),
 +      hidden_tab_manager_(std::make_unique<HiddenTabManager>()) {
    // Dispatcher can be null in tests.
-   if (dispatcher)
+-  if (dispatcher)
++  if (dispatcher) {
      protocol::Browser::Dispatcher::wire(dispatcher, this);
-@@ -120,6 +525,65 @@ Response BrowserHandler::GetWindowForTarget(
++    frontend_ =
++        std::make_unique<protocol::Browser::Frontend>(dispatcher->channel());
++    // Warm hidden tabs ahead of the first createTab(hidden) of this session.
++    if (BrowserWindowInterface* last_active =
++            GetLastActiveBrowserWindowInterfaceWithAnyProfile()) {
++      HiddenTabPool::GetInstance()->Prewarm(last_active->GetProfile());
++    }
++  }
+@@ -120,6 +533,54 @@ Response BrowserHandler::GetWindowForTarget(
    return Response::Success();
  }
  
@@ -448,6 +457,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<std::string> target_id,
 +    int* out_tab_id,
 +    int* out_window_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getTabForTarget");
 +  auto host =
 +      content::DevToolsAgentHost::GetForId(target_id.value_or(target_id_));
 +  if (!host)
@@ -472,26 +482,14 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    int tab_id,
 +    std::string* out_target_id,
 +    int* out_window_id) {
-+  content::WebContents* found_contents = nullptr;
-+  int found_window_id = -1;
-+  ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
-+      [tab_id, &found_contents,
-+       &found_window_id](BrowserWindowInterface* browser_window_interface) {
-+        TabStripModel* tab_strip = browser_window_interface->GetTabStripModel();
-+        for (int i = 0; i < tab_strip->count(); ++i) {
-+          content::WebContents* wc = tab_strip->GetWebContentsAt(i);
-+          SessionID sid = sessions::SessionTabHelper::IdForTab(wc);
-+          if (sid.is_valid() && sid.id() == tab_id) {
-+            found_contents = wc;
-+            found_window_id =
-+                browser_window_interface->GetSessionID().id();
-+            return false;
-+          }
-+        }
-+        return true;
-+      });
-+  if (!found_contents)
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getTargetForTab");
++  browseros::BrowserOSTabRegistry* registry =
++      browseros::BrowserOSTabRegistry::GetInstance();
++  BrowserWindowInterface* bwi = registry->GetWindowForTab(tab_id);
++  if (!bwi)
 +    return Response::ServerError("No tab with given id");
++  content::WebContents* found_contents = registry->FindByTabId(tab_id);
++  int found_window_id = bwi->GetSessionID().id();
 +
 +  scoped_refptr<content::DevToolsAgentHost> host =
 +      content::DevToolsAgentHost::GetOrCreateFor(found_contents);
@@ -506,7 +504,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
  Response BrowserHandler::GetWindowBounds(
      int window_id,
      std::unique_ptr<protocol::Browser::Bounds>* out_bounds) {
-@@ -297,3 +761,803 @@ protocol::Response BrowserHandler::AddPrivacySandboxEnrollmentOverride(
+@@ -297,3 +758,936 @@ protocol::Response BrowserHandler::AddPrivacySandboxEnrollmentOverride(
        net::SchemefulSite(url_to_add));
    return Response::Success();
  }
@@ -516,6 +514,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +Response BrowserHandler::GetWindows(
 +    std::unique_ptr<protocol::Array<protocol::Browser::WindowInfo>>*
 +        out_windows) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getWindows");
 +  auto windows =
 +      std::make_unique<protocol::Array<protocol::Browser::WindowInfo>>();
 +  ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
@@ -529,6 +528,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +
 +Response BrowserHandler::GetActiveWindow(
 +    std::unique_ptr<protocol::Browser::WindowInfo>* out_window) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getActiveWindow");
 +  BrowserWindowInterface* bwi =
 +      GetLastActiveBrowserWindowInterfaceWithAnyProfile();
 +  if (bwi) {
@@ -544,6 +544,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<bool> hidden,
 +    std::optional<std::string> browser_context_id,
 +    std::unique_ptr<protocol::Browser::WindowInfo>* out_window) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.createWindow");
 +  Profile* profile = nullptr;
 +  BrowserWindowInterface* last_active =
 +      GetLastActiveBrowserWindowInterfaceWithAnyProfile();
@@ -588,6 +589,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +}
 +
 +Response BrowserHandler::CloseWindow(int window_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.closeWindow");
 +  BrowserWindowInterface* bwi = GetBrowserWindowInterface(window_id);
 +  if (!bwi) {
 +    return Response::ServerError("Browser window not found");
@@ -598,6 +600,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +}
 +
 +Response BrowserHandler::ActivateWindow(int window_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.activateWindow");
 +  BrowserWindowInterface* bwi = GetBrowserWindowInterface(window_id);
 +  if (!bwi) {
 +    return Response::ServerError("Browser window not found");
@@ -607,6 +610,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +}
 +
 +Response BrowserHandler::ShowWindow(int window_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.showWindow");
 +  BrowserWindowInterface* bwi = GetBrowserWindowInterface(window_id);
 +  if (!bwi) {
 +    return Response::ServerError("Browser window not found");
@@ -616,6 +620,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +}
 +
 +Response BrowserHandler::HideWindow(int window_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.hideWindow");
 +  BrowserWindowInterface* bwi = GetBrowserWindowInterface(window_id);
 +  if (!bwi) {
 +    return Response::ServerError("Browser window not found");
@@ -629,7 +634,15 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +Response BrowserHandler::GetTabs(
 +    std::optional<int> window_id,
 +    std::optional<bool> include_hidden,
-+    std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs) {
++    std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs,
++    std::optional<int>* out_sequence) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getTabs");
++  if (tab_event_stream_) {
++    // Send pending events first so the snapshot matches the sequence.
++    tab_event_stream_->Flush();
++    *out_sequence = tab_event_sequence_;
++  }
++
 +  auto tabs =
 +      std::make_unique<protocol::Array<protocol::Browser::TabInfo>>();
 +
@@ -669,6 +682,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +Response BrowserHandler::GetActiveTab(
 +    std::optional<int> window_id,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getActiveTab");
 +  BrowserWindowInterface* bwi = nullptr;
 +  if (window_id.has_value()) {
 +    bwi = GetBrowserWindowInterface(window_id.value());
@@ -694,6 +708,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<std::string> target_id,
 +    std::optional<int> tab_id,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getTabInfo");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -714,6 +729,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<bool> hidden,
 +    std::optional<std::string> browser_context_id,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.createTab");
 +  bool is_hidden = hidden.value_or(false);
 +
 +  if (is_hidden) {
@@ -735,6 +751,12 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +      return Response::ServerError("No profile available");
 +    }
 +
++    std::string budget_error;
++    if (!HiddenTabGovernor::GetInstance()->HasBudgetFor(profile,
++                                                        &budget_error)) {
++      return Response::ServerError(budget_error);
++    }
++
 +    GURL navigate_url = url.has_value() ? GURL(url.value()) : GURL();
 +    int tab_id =
 +        hidden_tab_manager_->CreateHiddenTab(navigate_url, profile);
@@ -742,6 +764,9 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    if (!wc) {
 +      return Response::ServerError("Failed to create hidden tab");
 +    }
++    if (tab_event_stream_) {
++      tab_event_stream_->OnHiddenTabAdded(wc);
++    }
 +
 +    *out_tab = BuildTabInfo(wc, nullptr, -1, true);
 +    return Response::Success();
@@ -785,6 +810,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +
 +Response BrowserHandler::CloseTab(std::optional<std::string> target_id,
 +                                  std::optional<int> tab_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.closeTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -808,6 +834,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +
 +Response BrowserHandler::ActivateTab(std::optional<std::string> target_id,
 +                                     std::optional<int> tab_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.activateTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -830,6 +857,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<int> window_id,
 +    std::optional<int> index,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.moveTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -889,6 +917,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<std::string> target_id,
 +    std::optional<int> tab_id,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.duplicateTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -916,6 +945,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<std::string> target_id,
 +    std::optional<int> tab_id,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.pinTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -937,6 +967,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<std::string> target_id,
 +    std::optional<int> tab_id,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.unpinTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -961,6 +992,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<int> index,
 +    std::optional<bool> activate,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.showTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -1029,6 +1061,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<std::string> target_id,
 +    std::optional<int> tab_id,
 +    std::unique_ptr<protocol::Browser::TabInfo>* out_tab) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.hideTab");
 +  TabLookupResult lookup;
 +  Response response = ResolveTabIdentifier(target_id, tab_id,
 +                                           hidden_tab_manager_.get(), &lookup);
@@ -1039,12 +1072,21 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    return Response::InvalidParams("Tab is already hidden");
 +  }
 +
++  std::string budget_error;
++  if (!HiddenTabGovernor::GetInstance()->HasBudgetFor(
++          lookup.web_contents->GetBrowserContext(), &budget_error)) {
++    return Response::ServerError(budget_error);
++  }
++
 +  TabStripModel* tab_strip = lookup.bwi->GetTabStripModel();
 +  std::unique_ptr<content::WebContents> detached =
 +      tab_strip->DetachWebContentsAtForInsertion(lookup.tab_index);
 +
 +  content::WebContents* raw_wc = detached.get();
 +  hidden_tab_manager_->TakeWebContents(std::move(detached));
++  if (tab_event_stream_) {
++    tab_event_stream_->OnHiddenTabAdded(raw_wc);
++  }
 +
 +  *out_tab = BuildTabInfo(raw_wc, nullptr, -1, true);
 +  return Response::Success();
@@ -1056,6 +1098,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<int> window_id,
 +    std::unique_ptr<protocol::Array<protocol::Browser::TabGroupInfo>>*
 +        out_groups) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getTabGroups");
 +  auto groups =
 +      std::make_unique<protocol::Array<protocol::Browser::TabGroupInfo>>();
 +
@@ -1092,6 +1135,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::unique_ptr<protocol::Array<int>> tab_ids,
 +    std::optional<std::string> title,
 +    std::unique_ptr<protocol::Browser::TabGroupInfo>* out_group) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.createTabGroup");
 +  if (!tab_ids || tab_ids->empty()) {
 +    return Response::InvalidParams("tabIds must not be empty");
 +  }
@@ -1125,6 +1169,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<std::string> color,
 +    std::optional<bool> collapsed,
 +    std::unique_ptr<protocol::Browser::TabGroupInfo>* out_group) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.updateTabGroup");
 +  GroupLookupResult lookup;
 +  Response response = ResolveGroupId(group_id, &lookup);
 +  if (!response.IsSuccess()) {
@@ -1156,6 +1201,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +}
 +
 +Response BrowserHandler::CloseTabGroup(const std::string& group_id) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.closeTabGroup");
 +  GroupLookupResult lookup;
 +  Response response = ResolveGroupId(group_id, &lookup);
 +  if (!response.IsSuccess()) {
@@ -1170,6 +1216,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    const std::string& group_id,
 +    std::unique_ptr<protocol::Array<int>> tab_ids,
 +    std::unique_ptr<protocol::Browser::TabGroupInfo>* out_group) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.addTabsToGroup");
 +  if (!tab_ids || tab_ids->empty()) {
 +    return Response::InvalidParams("tabIds must not be empty");
 +  }
@@ -1201,6 +1248,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +
 +Response BrowserHandler::RemoveTabsFromGroup(
 +    std::unique_ptr<protocol::Array<int>> tab_ids) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.removeTabsFromGroup");
 +  if (!tab_ids || tab_ids->empty()) {
 +    return Response::InvalidParams("tabIds must not be empty");
 +  }
@@ -1208,23 +1256,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +  for (int tid : *tab_ids) {
 +    BrowserWindowInterface* found_bwi = nullptr;
 +    int found_index = -1;
-+
-+    ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
-+        [tid, &found_bwi, &found_index](BrowserWindowInterface* bwi) {
-+          TabStripModel* tab_strip = bwi->GetTabStripModel();
-+          for (int i = 0; i < tab_strip->count(); ++i) {
-+            content::WebContents* wc = tab_strip->GetWebContentsAt(i);
-+            SessionID sid = sessions::SessionTabHelper::IdForTab(wc);
-+            if (sid.is_valid() && sid.id() == tid) {
-+              found_bwi = bwi;
-+              found_index = i;
-+              return false;
-+            }
-+          }
-+          return true;
-+        });
-+
-+    if (!found_bwi) {
++    if (!FindWindowTab(tid, &found_bwi, &found_index)) {
 +      return Response::ServerError("No tab with given id");
 +    }
 +
@@ -1242,6 +1274,7 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +    std::optional<int> window_id,
 +    std::optional<int> index,
 +    std::unique_ptr<protocol::Browser::TabGroupInfo>* out_group) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.moveTabGroup");
 +  GroupLookupResult lookup;
 +  Response response = ResolveGroupId(group_id, &lookup);
 +  if (!response.IsSuccess()) {
@@ -1310,3 +1343,101 @@ index 30bd52d09c3fc..053af0b50b3d7 100644
 +  *out_group = BuildTabGroupInfo(target_bwi, new_gid);
 +  return Response::Success();
 +}
++
++Response BrowserHandler::GetServerStartupTimeline(
++    std::unique_ptr<protocol::Array<protocol::Browser::ServerStartupPhase>>*
++        out_phases,
++    std::optional<double>* out_total_ms) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.getServerStartupTimeline");
++  const browseros::StartupTimeline& timeline =
++      browseros::BrowserOSServerManager::GetInstance()->startup_timeline();
++
++  *out_phases = std::make_unique<
++      protocol::Array<protocol::Browser::ServerStartupPhase>>();
++  for (const auto& phase : timeline.GetSortedPhases()) {
++    (*out_phases)
++        ->push_back(protocol::Browser::ServerStartupPhase::Create()
++                        .SetName(phase.name)
++                        .SetStartMs(phase.start.InMillisecondsF())
++                        .SetDurationMs(phase.duration.InMillisecondsF())
++                        .Build());
++  }
++  if (timeline.total()) {
++    *out_total_ms = timeline.total()->InMillisecondsF();
++  }
++  return Response::Success();
++}
++
++// --- Tab Events ---
++
++Response BrowserHandler::EnableTabEvents(int* out_sequence) {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.enableTabEvents");
++  if (!tab_event_stream_) {
++    tab_event_stream_ = std::make_unique<TabEventStream>(base::BindRepeating(
++        &BrowserHandler::OnTabEvent, base::Unretained(this)));
++    for (const auto& wc : hidden_tab_manager_->hidden_tabs()) {
++      tab_event_stream_->ObserveHiddenTab(wc.get());
++    }
++  }
++  *out_sequence = tab_event_sequence_;
++  return Response::Success();
++}
++
++Response BrowserHandler::DisableTabEvents() {
++  ScopedPerfTimer perf_timer(kCDP, "Browser.disableTabEvents");
++  tab_event_stream_.reset();
++  return Response::Success();
++}
++
++void BrowserHandler::OnTabEvent(const TabEventStream::Event& event) {
++  switch (event.type) {
++    case TabEventStream::EventType::kTabCreated:
++    case TabEventStream::EventType::kTabUpdated: {
++      TabLookupResult lookup;
++      if (!ResolveTabIdentifier(std::nullopt, event.tab_id,
++                                hidden_tab_manager_.get(), &lookup)
++               .IsSuccess()) {
++        // Hidden tabs of other sessions are not reported. A known tab that
++        // another session hid is out of this client's reach, so it is
++        // reported removed, and created should it be shown again.
++        tab_event_stream_->ForgetTab(event.tab_id);
++        if (event.type == TabEventStream::EventType::kTabUpdated) {
++          std::optional<int> window_id;
++          if (event.window_id >= 0) {
++            window_id = event.window_id;
++          }
++          frontend_->TabRemoved(event.tab_id, window_id,
++                                ++tab_event_sequence_);
++        }
++        return;
++      }
++      auto tab = BuildTabInfo(lookup.web_contents, lookup.bwi,
++                              lookup.tab_index, lookup.is_hidden);
++      if (event.type == TabEventStream::EventType::kTabCreated) {
++        frontend_->TabCreated(std::move(tab), ++tab_event_sequence_);
++      } else {
++        frontend_->TabUpdated(std::move(tab), ++tab_event_sequence_);
++      }
++      return;
++    }
++    case TabEventStream::EventType::kTabRemoved: {
++      std::optional<int> window_id;
++      if (event.window_id >= 0) {
++        window_id = event.window_id;
++      }
++      frontend_->TabRemoved(event.tab_id, window_id, ++tab_event_sequence_);
++      return;
++    }
++    case TabEventStream::EventType::kTabActivated:
++      frontend_->TabActivated(event.tab_id, event.window_id,
++                              ++tab_event_sequence_);
++      return;
++    case TabEventStream::EventType::kWindowChanged: {
++      BrowserWindowInterface* bwi = GetBrowserWindowInterface(event.window_id);
++      frontend_->WindowChanged(event.window_id,
++                               bwi ? BuildWindowInfo(bwi) : nullptr,
++                               ++tab_event_sequence_);
++      return;
++    }
++  }
++}
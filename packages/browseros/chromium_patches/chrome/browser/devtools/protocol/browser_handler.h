@@ -2,7 +2,7 @@ diff --git a/chrome/browser/devtools/protocol/browser_handler.h b/chrome/browser
 index e1424aa52cbf6..947af3378ab68 100644
 --- a/chrome/browser/devtools/protocol/browser_handler.h
 +++ b/chrome/browser/devtools/protocol/browser_handler.h
-@@ -5,9 +5,13 @@
+@@ -5,9 +5,14 @@
  #ifndef CHROME_BROWSER_DEVTOOLS_PROTOCOL_BROWSER_HANDLER_H_
  #define CHROME_BROWSER_DEVTOOLS_PROTOCOL_BROWSER_HANDLER_H_
  
@@ -10,13 +10,14 @@ index e1424aa52cbf6..947af3378ab68 100644
 +
  #include "base/containers/flat_set.h"
  #include "chrome/browser/devtools/protocol/browser.h"
++#include "chrome/browser/devtools/protocol/tab_event_stream.h"
  
 +class HiddenTabManager;
 +
  class BrowserHandler : public protocol::Browser::Backend {
   public:
    BrowserHandler(protocol::UberDispatcher* dispatcher,
-@@ -23,6 +27,14 @@ class BrowserHandler : public protocol::Browser::Backend {
+@@ -23,6 +28,14 @@ class BrowserHandler : public protocol::Browser::Backend {
        std::optional<std::string> target_id,
        int* out_window_id,
        std::unique_ptr<protocol::Browser::Bounds>* out_bounds) override;
@@ -31,7 +32,7 @@ index e1424aa52cbf6..947af3378ab68 100644
    protocol::Response GetWindowBounds(
        int window_id,
        std::unique_ptr<protocol::Browser::Bounds>* out_bounds) override;
-@@ -41,9 +53,112 @@ class BrowserHandler : public protocol::Browser::Backend {
+@@ -41,9 +54,130 @@ class BrowserHandler : public protocol::Browser::Backend {
    protocol::Response AddPrivacySandboxEnrollmentOverride(
        const std::string& in_url) override;
  
@@ -57,8 +58,8 @@ index e1424aa52cbf6..947af3378ab68 100644
 +  protocol::Response GetTabs(
 +      std::optional<int> window_id,
 +      std::optional<bool> include_hidden,
-+      std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs)
-+      override;
++      std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs,
++      std::optional<int>* out_sequence) override;
 +  protocol::Response GetActiveTab(
 +      std::optional<int> window_id,
 +      std::unique_ptr<protocol::Browser::TabInfo>* out_tab) override;
@@ -136,11 +137,29 @@ index e1424aa52cbf6..947af3378ab68 100644
 +      std::optional<int> window_id,
 +      std::optional<int> index,
 +      std::unique_ptr<protocol::Browser::TabGroupInfo>* out_group) override;
++
++  // Tab events
++  protocol::Response EnableTabEvents(int* out_sequence) override;
++  protocol::Response DisableTabEvents() override;
++
++  // BrowserOS server
++  protocol::Response GetServerStartupTimeline(
++      std::unique_ptr<protocol::Array<protocol::Browser::ServerStartupPhase>>*
++          out_phases,
++      std::optional<double>* out_total_ms) override;
 +
   private:
++  void OnTabEvent(const TabEventStream::Event& event);
++
    base::flat_set<std::string> contexts_with_overridden_permissions_;
    std::string target_id_;
 +  std::unique_ptr<HiddenTabManager> hidden_tab_manager_;
++  std::unique_ptr<protocol::Browser::Frontend> frontend_;
++  // Sequence number of the last tab event sent in this session.
++  int tab_event_sequence_ = 0;
++  // Declared after |hidden_tab_manager_| so it stops observing hidden tabs
++  // before they are destroyed.
++  std::unique_ptr<TabEventStream> tab_event_stream_;
  };
  
  #endif  // CHROME_BROWSER_DEVTOOLS_PROTOCOL_BROWSER_HANDLER_H_
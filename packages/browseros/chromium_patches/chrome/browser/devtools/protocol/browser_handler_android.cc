@@ -70,7 +70,7 @@ index 82199c6e2e93b..628cc138aa267 100644
  Response BrowserHandlerAndroid::GetWindowBounds(
      int window_id,
      std::unique_ptr<protocol::Browser::Bounds>* out_bounds) {
-@@ -92,3 +146,184 @@ protocol::Response BrowserHandlerAndroid::AddPrivacySandboxEnrollmentOverride(
+@@ -92,3 +146,195 @@ protocol::Response BrowserHandlerAndroid::AddPrivacySandboxEnrollmentOverride(
      const std::string& in_url) {
    return Response::MethodNotFound(kNotImplemented);
  }
@@ -119,7 +119,8 @@ index 82199c6e2e93b..628cc138aa267 100644
 +Response BrowserHandlerAndroid::GetTabs(
 +    std::optional<int> window_id,
 +    std::optional<bool> include_hidden,
-+    std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs) {
++    std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs,
++    std::optional<int>* out_sequence) {
 +  return Response::MethodNotFound(kNotImplemented);
 +}
 +
@@ -255,3 +256,13 @@ index 82199c6e2e93b..628cc138aa267 100644
 +    std::unique_ptr<protocol::Browser::TabGroupInfo>* out_group) {
 +  return Response::MethodNotFound(kNotImplemented);
 +}
++
++// --- Tab Events (stubs) ---
++
++Response BrowserHandlerAndroid::EnableTabEvents(int* out_sequence) {
++  return Response::MethodNotFound(kNotImplemented);
++}
++
++Response BrowserHandlerAndroid::DisableTabEvents() {
++  return Response::MethodNotFound(kNotImplemented);
++}
@@ -17,7 +17,7 @@ index a80686d439110..52b7344ac56a9 100644
    protocol::Response GetWindowBounds(
        int window_id,
        std::unique_ptr<protocol::Browser::Bounds>* out_bounds) override;
-@@ -40,6 +48,108 @@ class BrowserHandlerAndroid : public protocol::Browser::Backend {
+@@ -40,6 +48,112 @@ class BrowserHandlerAndroid : public protocol::Browser::Backend {
    protocol::Response AddPrivacySandboxEnrollmentOverride(
        const std::string& in_url) override;
  
@@ -43,8 +43,8 @@ index a80686d439110..52b7344ac56a9 100644
 +  protocol::Response GetTabs(
 +      std::optional<int> window_id,
 +      std::optional<bool> include_hidden,
-+      std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs)
-+      override;
++      std::unique_ptr<protocol::Array<protocol::Browser::TabInfo>>* out_tabs,
++      std::optional<int>* out_sequence) override;
 +  protocol::Response GetActiveTab(
 +      std::optional<int> window_id,
 +      std::unique_ptr<protocol::Browser::TabInfo>* out_tab) override;
@@ -122,6 +122,10 @@ index a80686d439110..52b7344ac56a9 100644
 +      std::optional<int> window_id,
 +      std::optional<int> index,
 +      std::unique_ptr<protocol::Browser::TabGroupInfo>* out_group) override;
++
++  // Tab events
++  protocol::Response EnableTabEvents(int* out_sequence) override;
++  protocol::Response DisableTabEvents() override;
 +
   private:
    const std::string target_id_;
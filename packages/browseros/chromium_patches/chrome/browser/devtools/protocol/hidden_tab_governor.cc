@@ -0,0 +1,388 @@
+diff --git a/chrome/browser/devtools/protocol/hidden_tab_governor.cc b/chrome/browser/devtools/protocol/hidden_tab_governor.cc
+new file mode 100644
+index 0000000000000..9b5a712f897fa
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/hidden_tab_governor.cc
+@@ -0,0 +1,382 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/devtools/protocol/hidden_tab_governor.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/containers/flat_set.h"
++#include "base/feature_list.h"
++#include "base/functional/bind.h"
++#include "base/functional/callback_helpers.h"
++#include "base/logging.h"
++#include "base/memory/raw_ptr.h"
++#include "base/metrics/field_trial_params.h"
++#include "base/process/process_handle.h"
++#include "base/strings/string_number_conversions.h"
++#include "chrome/browser/browser_features.h"
++#include "content/public/browser/browser_context.h"
++#include "content/public/browser/browser_thread.h"
++#include "content/public/browser/devtools_agent_host.h"
++#include "content/public/browser/navigation_controller.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_process_host.h"
++#include "content/public/browser/visibility.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
++
++namespace {
++
++const base::FeatureParam<int> kMaxTabs{&features::kBrowserOsHiddenTabBudget,
++                                       "max_tabs", 20};
++const base::FeatureParam<int> kMaxMemoryMb{
++    &features::kBrowserOsHiddenTabBudget, "max_memory_mb", 2048};
++const base::FeatureParam<int> kFreezeAfterSeconds{
++    &features::kBrowserOsHiddenTabBudget, "freeze_after_seconds", 120};
++const base::FeatureParam<int> kDiscardAfterSeconds{
++    &features::kBrowserOsHiddenTabBudget, "discard_after_seconds", 900};
++
++constexpr base::TimeDelta kSweepInterval = base::Seconds(30);
++
++bool IsAttached(content::WebContents* web_contents) {
++  return content::DevToolsAgentHost::HasFor(web_contents) &&
++         content::DevToolsAgentHost::GetOrCreateFor(web_contents)
++             ->IsAttached();
++}
++
++}  // namespace
++
++// One governed hidden tab. Watches its WebContents so the entry never
++// outlives it, whoever destroys it.
++class HiddenTabGovernor::Entry : public content::WebContentsObserver {
++ public:
++  Entry(HiddenTabGovernor* governor, content::WebContents* web_contents)
++      : content::WebContentsObserver(web_contents),
++        governor_(governor),
++        last_used_(base::TimeTicks::Now()) {}
++
++  State state() const { return state_; }
++  void set_state(State state) { state_ = state; }
++
++  base::TimeTicks last_used() const { return last_used_; }
++  void MarkUsed() { last_used_ = base::TimeTicks::Now(); }
++
++  base::ProcessId pid() const { return pid_; }
++  const std::optional<size_t>& private_memory_kb() const {
++    return private_memory_kb_;
++  }
++  void SetMemory(base::ProcessId pid, std::optional<size_t> kb) {
++    pid_ = pid;
++    private_memory_kb_ = kb;
++  }
++
++  // content::WebContentsObserver:
++  void WebContentsDestroyed() override {
++    // Deletes |this|.
++    governor_->entries_.erase(web_contents());
++  }
++
++ private:
++  raw_ptr<HiddenTabGovernor> governor_;
++  State state_ = State::kActive;
++  base::TimeTicks last_used_;
++  base::ProcessId pid_ = base::kNullProcessId;
++  std::optional<size_t> private_memory_kb_;
++};
++
++// static
++HiddenTabGovernor* HiddenTabGovernor::GetInstance() {
++  static base::NoDestructor<HiddenTabGovernor> instance;
++  return instance.get();
++}
++
++HiddenTabGovernor::HiddenTabGovernor()
++    : enforce_(
++          base::FeatureList::IsEnabled(features::kBrowserOsHiddenTabBudget)),
++      max_tabs_(std::max(1, kMaxTabs.Get())),
++      max_memory_kb_(static_cast<size_t>(std::max(0, kMaxMemoryMb.Get())) *
++                     1024),
++      freeze_after_(base::Seconds(kFreezeAfterSeconds.Get())),
++      discard_after_(base::Seconds(kDiscardAfterSeconds.Get())) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  content::DevToolsAgentHost::AddObserver(this);
++}
++
++HiddenTabGovernor::~HiddenTabGovernor() {
++  content::DevToolsAgentHost::RemoveObserver(this);
++}
++
++bool HiddenTabGovernor::HasBudgetFor(content::BrowserContext* browser_context,
++                                     std::string* reason) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  if (!enforce_) {
++    return true;
++  }
++  if (CountTabs(browser_context) >= max_tabs_) {
++    *reason = "Hidden tab limit reached (" +
++              base::NumberToString(max_tabs_) + " per profile)";
++    return false;
++  }
++  if (max_memory_kb_) {
++    // The new tab is not sampled until the next sweep.
++    size_t new_tab_kb = EstimateUnsampledKb();
++    EnforceMemoryBudget(browser_context, new_tab_kb);
++    if (!FitsMemoryBudget(browser_context, new_tab_kb)) {
++      *reason = "Hidden tabs are over their memory budget (" +
++                base::NumberToString(max_memory_kb_ / 1024) +
++                " MB per profile)";
++      return false;
++    }
++  }
++  return true;
++}
++
++void HiddenTabGovernor::AddTab(content::WebContents* web_contents) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  if (FindEntry(web_contents)) {
++    return;
++  }
++  // Tabs hidden from a window may still be marked visible.
++  if (web_contents->GetVisibility() != content::Visibility::HIDDEN) {
++    web_contents->WasHidden();
++  }
++  entries_[web_contents] = std::make_unique<Entry>(this, web_contents);
++  if (!sweep_timer_.IsRunning()) {
++    sweep_timer_.Start(FROM_HERE, kSweepInterval,
++                       base::BindRepeating(&HiddenTabGovernor::Sweep,
++                                           base::Unretained(this)));
++  }
++}
++
++void HiddenTabGovernor::RemoveTab(content::WebContents* web_contents) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  auto it = entries_.find(web_contents);
++  if (it == entries_.end()) {
++    return;
++  }
++  Wake(it->second.get());
++  entries_.erase(it);
++  if (entries_.empty()) {
++    sweep_timer_.Stop();
++  }
++}
++
++void HiddenTabGovernor::Touch(content::WebContents* web_contents) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  if (Entry* entry = FindEntry(web_contents)) {
++    Wake(entry);
++  }
++}
++
++std::optional<HiddenTabGovernor::Usage> HiddenTabGovernor::GetUsage(
++    content::WebContents* web_contents) const {
++  Entry* entry = FindEntry(web_contents);
++  if (!entry) {
++    return std::nullopt;
++  }
++  Usage usage;
++  usage.state = entry->state();
++  if (entry->state() != State::kDiscarded) {
++    usage.private_memory_kb = entry->private_memory_kb();
++  }
++  if (!IsAttached(web_contents)) {
++    usage.idle_time = base::TimeTicks::Now() - entry->last_used();
++  }
++  return usage;
++}
++
++void HiddenTabGovernor::DevToolsAgentHostAttached(
++    content::DevToolsAgentHost* agent_host) {
++  if (Entry* entry = FindEntry(agent_host->GetWebContents())) {
++    Wake(entry);
++  }
++}
++
++void HiddenTabGovernor::DevToolsAgentHostDetached(
++    content::DevToolsAgentHost* agent_host) {
++  if (Entry* entry = FindEntry(agent_host->GetWebContents())) {
++    entry->MarkUsed();
++  }
++}
++
++HiddenTabGovernor::Entry* HiddenTabGovernor::FindEntry(
++    content::WebContents* web_contents) const {
++  auto it = entries_.find(web_contents);
++  return it == entries_.end() ? nullptr : it->second.get();
++}
++
++size_t HiddenTabGovernor::CountTabs(
++    content::BrowserContext* browser_context) const {
++  return std::ranges::count_if(entries_, [browser_context](const auto& it) {
++    return it.first->GetBrowserContext() == browser_context;
++  });
++}
++
++size_t HiddenTabGovernor::GetMemoryKb(
++    content::BrowserContext* browser_context) const {
++  base::flat_map<base::ProcessId, size_t> processes;
++  size_t unsampled = 0;
++  for (const auto& [web_contents, entry] : entries_) {
++    if (web_contents->GetBrowserContext() != browser_context ||
++        entry->state() == State::kDiscarded) {
++      continue;
++    }
++    if (entry->private_memory_kb()) {
++      processes[entry->pid()] = *entry->private_memory_kb();
++    } else {
++      ++unsampled;
++    }
++  }
++  size_t total_kb = unsampled * EstimateUnsampledKb();
++  for (const auto& [pid, kb] : processes) {
++    total_kb += kb;
++  }
++  return total_kb;
++}
++
++size_t HiddenTabGovernor::EstimateUnsampledKb() const {
++  base::flat_map<base::ProcessId, size_t> processes;
++  for (const auto& [web_contents, entry] : entries_) {
++    if (entry->private_memory_kb()) {
++      processes[entry->pid()] = *entry->private_memory_kb();
++    }
++  }
++  if (processes.empty()) {
++    return 0;
++  }
++  size_t total_kb = 0;
++  for (const auto& [pid, kb] : processes) {
++    total_kb += kb;
++  }
++  return total_kb / processes.size();
++}
++
++bool HiddenTabGovernor::FitsMemoryBudget(
++    content::BrowserContext* browser_context,
++    size_t extra_kb) const {
++  return GetMemoryKb(browser_context) + extra_kb <= max_memory_kb_;
++}
++
++void HiddenTabGovernor::Wake(Entry* entry) {
++  entry->MarkUsed();
++  content::WebContents* web_contents = entry->web_contents();
++  switch (entry->state()) {
++    case State::kActive:
++      return;
++    case State::kFrozen:
++      web_contents->SetPageFrozen(false);
++      break;
++    case State::kDiscarded:
++      web_contents->GetController().SetNeedsReload();
++      web_contents->GetController().LoadIfNecessary();
++      break;
++  }
++  entry->set_state(State::kActive);
++}
++
++void HiddenTabGovernor::Freeze(Entry* entry) {
++  entry->web_contents()->SetPageFrozen(true);
++  entry->set_state(State::kFrozen);
++}
++
++void HiddenTabGovernor::Discard(Entry* entry) {
++  // Unloads the page and releases its renderer; the WebContents, its ids
++  // and its navigation history stay.
++  entry->web_contents()->Discard(base::DoNothing());
++  entry->set_state(State::kDiscarded);
++  entry->SetMemory(base::kNullProcessId, std::nullopt);
++}
++
++void HiddenTabGovernor::Sweep() {
++  if (entries_.empty()) {
++    sweep_timer_.Stop();
++    return;
++  }
++
++  if (enforce_) {
++    base::TimeTicks now = base::TimeTicks::Now();
++    for (const auto& [web_contents, entry] : entries_) {
++      if (IsAttached(web_contents)) {
++        entry->MarkUsed();
++        continue;
++      }
++      base::TimeDelta idle = now - entry->last_used();
++      if (entry->state() != State::kDiscarded && idle >= discard_after_) {
++        Discard(entry.get());
++      } else if (entry->state() == State::kActive && idle >= freeze_after_) {
++        Freeze(entry.get());
++      }
++    }
++  }
++
++  auto* instrumentation =
++      memory_instrumentation::MemoryInstrumentation::GetInstance();
++  if (instrumentation) {
++    instrumentation->RequestPrivateMemoryFootprint(
++        base::kNullProcessId,
++        base::BindOnce(&HiddenTabGovernor::OnMemoryDump,
++                       weak_factory_.GetWeakPtr()));
++  }
++}
++
++void HiddenTabGovernor::OnMemoryDump(
++    bool success,
++    std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump) {
++  if (!success || !dump) {
++    return;
++  }
++  base::flat_map<base::ProcessId, size_t> footprints;
++  for (const auto& process_dump : dump->process_dumps()) {
++    footprints[process_dump.pid()] =
++        process_dump.os_dump().private_footprint_kb;
++  }
++
++  base::flat_set<content::BrowserContext*> browser_contexts;
++  for (const auto& [web_contents, entry] : entries_) {
++    if (entry->state() == State::kDiscarded) {
++      continue;
++    }
++    base::ProcessId pid = web_contents->GetPrimaryMainFrame()
++                              ->GetProcess()
++                              ->GetProcess()
++                              .Pid();
++    auto it = footprints.find(pid);
++    entry->SetMemory(pid, it == footprints.end()
++                              ? std::nullopt
++                              : std::optional<size_t>(it->second));
++    browser_contexts.insert(web_contents->GetBrowserContext());
++  }
++
++  if (enforce_ && max_memory_kb_) {
++    for (content::BrowserContext* browser_context : browser_contexts) {
++      EnforceMemoryBudget(browser_context, /*extra_kb=*/0);
++    }
++  }
++}
++
++void HiddenTabGovernor::EnforceMemoryBudget(
++    content::BrowserContext* browser_context,
++    size_t extra_kb) {
++  while (!FitsMemoryBudget(browser_context, extra_kb)) {
++    Entry* oldest = nullptr;
++    for (const auto& [web_contents, entry] : entries_) {
++      if (web_contents->GetBrowserContext() != browser_context ||
++          entry->state() == State::kDiscarded || IsAttached(web_contents)) {
++        continue;
++      }
++      if (!oldest || entry->last_used() < oldest->last_used()) {
++        oldest = entry.get();
++      }
++    }
++    if (!oldest) {
++      LOG(INFO) << "browseros: Hidden tabs over memory budget with none "
++                   "left to discard, private_kb="
++                << GetMemoryKb(browser_context);
++      return;
++    }
++    Discard(oldest);
++  }
++}
@@ -0,0 +1,145 @@
+diff --git a/chrome/browser/devtools/protocol/hidden_tab_governor.h b/chrome/browser/devtools/protocol/hidden_tab_governor.h
+new file mode 100644
+index 0000000000000..42a02b9aa7ace
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/hidden_tab_governor.h
+@@ -0,0 +1,139 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_DEVTOOLS_PROTOCOL_HIDDEN_TAB_GOVERNOR_H_
++#define CHROME_BROWSER_DEVTOOLS_PROTOCOL_HIDDEN_TAB_GOVERNOR_H_
++
++#include <memory>
++#include <optional>
++#include <string>
++
++#include "base/containers/flat_map.h"
++#include "base/memory/weak_ptr.h"
++#include "base/no_destructor.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "content/public/browser/devtools_agent_host_observer.h"
++
++namespace content {
++class BrowserContext;
++class DevToolsAgentHost;
++class WebContents;
++}  // namespace content
++
++namespace memory_instrumentation {
++class GlobalMemoryDump;
++}  // namespace memory_instrumentation
++
++// Budgets and idle handling for hidden tabs, across all Browser CDP
++// sessions. HiddenTabManager registers every hidden tab it owns here.
++//
++// Per profile, at most "max_tabs" hidden tabs may exist and their renderers
++// may use at most "max_memory_mb" of private memory. Memory is sampled every
++// 30 seconds; until then a tab counts as the average sampled renderer. Over
++// budget, the least recently used hidden tabs are discarded until usage fits.
++// A new hidden tab is refused unless one more average renderer fits too.
++//
++// Hidden tabs are kept in the hidden visibility state, so Blink throttles
++// their timers and produces no frames. A hidden tab with no DevTools client
++// attached is frozen after "freeze_after_seconds" idle and discarded in
++// place after "discard_after_seconds" idle. It keeps its tab id, target id
++// and history either way, and is unfrozen or reloaded when a DevTools
++// client next attaches, it is shown, or it is Touch()ed. Tabs with a client
++// attached are in use as far as this class can tell, so they are never
++// frozen or discarded.
++//
++// The budgets and params come from the BrowserOsHiddenTabBudget feature.
++// Resource usage is tracked regardless of the feature.
++//
++// Threading: UI thread only.
++class HiddenTabGovernor : public content::DevToolsAgentHostObserver {
++ public:
++  enum class State { kActive, kFrozen, kDiscarded };
++
++  struct Usage {
++    State state = State::kActive;
++    // Private footprint of the tab's renderer process, which may be shared
++    // with other tabs of the same site. Unset until sampled or while
++    // discarded.
++    std::optional<size_t> private_memory_kb;
++    // Zero while a DevTools client is attached.
++    base::TimeDelta idle_time;
++  };
++
++  static HiddenTabGovernor* GetInstance();
++
++  HiddenTabGovernor(const HiddenTabGovernor&) = delete;
++  HiddenTabGovernor& operator=(const HiddenTabGovernor&) = delete;
++
++  // Returns false with a reason if another hidden tab in |browser_context|
++  // would exceed its budget. May discard idle hidden tabs to make room.
++  bool HasBudgetFor(content::BrowserContext* browser_context,
++                    std::string* reason);
++
++  // Starts governing a hidden tab. Stops on RemoveTab() or destruction.
++  void AddTab(content::WebContents* web_contents);
++  // Stops governing a tab that is being shown, waking it first.
++  void RemoveTab(content::WebContents* web_contents);
++
++  // Wakes a governed tab that is used without DevTools, e.g. by the
++  // browserOS extension API, and counts it as used now. No-op for other tabs.
++  void Touch(content::WebContents* web_contents);
++
++  // Returns nullopt for tabs not governed here.
++  std::optional<Usage> GetUsage(content::WebContents* web_contents) const;
++
++  // content::DevToolsAgentHostObserver:
++  void DevToolsAgentHostAttached(
++      content::DevToolsAgentHost* agent_host) override;
++  void DevToolsAgentHostDetached(
++      content::DevToolsAgentHost* agent_host) override;
++
++ private:
++  friend class base::NoDestructor<HiddenTabGovernor>;
++  friend class HiddenTabGovernorTest;
++
++  class Entry;
++
++  HiddenTabGovernor();
++  ~HiddenTabGovernor() override;
++
++  Entry* FindEntry(content::WebContents* web_contents) const;
++  size_t CountTabs(content::BrowserContext* browser_context) const;
++  // Sums the last sampled footprint of each renderer process hosting a
++  // non-discarded hidden tab of |browser_context|, counting tabs not sampled
++  // yet at EstimateUnsampledKb().
++  size_t GetMemoryKb(content::BrowserContext* browser_context) const;
++  // Returns the average sampled renderer footprint, or 0 before any sample.
++  size_t EstimateUnsampledKb() const;
++  bool FitsMemoryBudget(content::BrowserContext* browser_context,
++                        size_t extra_kb) const;
++
++  // Unfreezes or reloads the tab and marks it used.
++  void Wake(Entry* entry);
++  void Freeze(Entry* entry);
++  void Discard(Entry* entry);
++
++  void Sweep();
++  void OnMemoryDump(
++      bool success,
++      std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump);
++  // Discards least recently used, unattached hidden tabs of
++  // |browser_context| until its memory usage plus |extra_kb| fits the
++  // budget.
++  void EnforceMemoryBudget(content::BrowserContext* browser_context,
++                           size_t extra_kb);
++
++  const bool enforce_;
++  const size_t max_tabs_;
++  const size_t max_memory_kb_;
++  const base::TimeDelta freeze_after_;
++  const base::TimeDelta discard_after_;
++
++  base::flat_map<content::WebContents*, std::unique_ptr<Entry>> entries_;
++  base::RepeatingTimer sweep_timer_;
++  base::WeakPtrFactory<HiddenTabGovernor> weak_factory_{this};
++};
++
++#endif  // CHROME_BROWSER_DEVTOOLS_PROTOCOL_HIDDEN_TAB_GOVERNOR_H_
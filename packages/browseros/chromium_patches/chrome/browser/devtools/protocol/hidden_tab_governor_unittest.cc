@@ -0,0 +1,191 @@
+diff --git a/chrome/browser/devtools/protocol/hidden_tab_governor_unittest.cc b/chrome/browser/devtools/protocol/hidden_tab_governor_unittest.cc
+new file mode 100644
+index 0000000000000..79dae783667ee
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/hidden_tab_governor_unittest.cc
+@@ -0,0 +1,185 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/devtools/protocol/hidden_tab_governor.h"
++
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/memory/raw_ptr.h"
++#include "base/test/scoped_feature_list.h"
++#include "chrome/browser/browser_features.h"
++#include "chrome/test/base/testing_profile.h"
++#include "content/public/browser/devtools_agent_host.h"
++#include "content/public/browser/visibility.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/test/browser_task_environment.h"
++#include "content/public/test/test_renderer_host.h"
++#include "content/public/test/web_contents_tester.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++using State = HiddenTabGovernor::State;
++
++class HiddenTabGovernorTest : public testing::Test {
++ protected:
++  static constexpr base::TimeDelta kFreezeAfter = base::Seconds(120);
++  static constexpr base::TimeDelta kDiscardAfter = base::Seconds(900);
++
++  HiddenTabGovernorTest() {
++    feature_list_.InitAndEnableFeatureWithParameters(
++        features::kBrowserOsHiddenTabBudget,
++        {{"max_tabs", "3"},
++         {"max_memory_mb", "1"},
++         {"freeze_after_seconds", "120"},
++         {"discard_after_seconds", "900"}});
++  }
++
++  void SetUp() override { governor_ = new HiddenTabGovernor(); }
++
++  void TearDown() override {
++    delete governor_.ExtractAsDangling();
++    tabs_.clear();
++  }
++
++  HiddenTabGovernor* governor() { return governor_; }
++
++  content::WebContents* AddTab(Profile* profile) {
++    tabs_.push_back(
++        content::WebContentsTester::CreateTestWebContents(profile, nullptr));
++    governor_->AddTab(tabs_.back().get());
++    return tabs_.back().get();
++  }
++
++  State GetState(content::WebContents* web_contents) {
++    return governor_->GetUsage(web_contents)->state;
++  }
++
++  // Stands in for a memory sample of the tab's renderer.
++  void SetMemoryKb(content::WebContents* web_contents,
++                   base::ProcessId pid,
++                   size_t kb) {
++    governor_->FindEntry(web_contents)->SetMemory(pid, kb);
++  }
++
++  void SimulateAttach(content::WebContents* web_contents) {
++    governor_->DevToolsAgentHostAttached(
++        content::DevToolsAgentHost::GetOrCreateFor(web_contents).get());
++  }
++
++  base::test::ScopedFeatureList feature_list_;
++  content::BrowserTaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  content::RenderViewHostTestEnabler rvh_test_enabler_;
++  TestingProfile profile_;
++
++ private:
++  raw_ptr<HiddenTabGovernor> governor_ = nullptr;
++  std::vector<std::unique_ptr<content::WebContents>> tabs_;
++};
++
++TEST_F(HiddenTabGovernorTest, FreezesThenDiscardsIdleTab) {
++  content::WebContents* tab = AddTab(&profile_);
++  EXPECT_EQ(content::Visibility::HIDDEN, tab->GetVisibility());
++
++  task_environment_.FastForwardBy(kFreezeAfter - base::Seconds(30));
++  EXPECT_EQ(State::kActive, GetState(tab));
++  task_environment_.FastForwardBy(base::Seconds(30));
++  EXPECT_EQ(State::kFrozen, GetState(tab));
++
++  task_environment_.FastForwardBy(kDiscardAfter - kFreezeAfter);
++  EXPECT_EQ(State::kDiscarded, GetState(tab));
++  EXPECT_FALSE(governor()->GetUsage(tab)->private_memory_kb);
++}
++
++TEST_F(HiddenTabGovernorTest, AttachWakesFrozenTab) {
++  content::WebContents* tab = AddTab(&profile_);
++  task_environment_.FastForwardBy(kFreezeAfter);
++  ASSERT_EQ(State::kFrozen, GetState(tab));
++
++  SimulateAttach(tab);
++  EXPECT_EQ(State::kActive, GetState(tab));
++  EXPECT_TRUE(governor()->GetUsage(tab)->idle_time.is_zero());
++
++  // Idle time starts over from the attach.
++  task_environment_.FastForwardBy(kFreezeAfter - base::Seconds(30));
++  EXPECT_EQ(State::kActive, GetState(tab));
++}
++
++TEST_F(HiddenTabGovernorTest, TouchWakesDiscardedTab) {
++  content::WebContents* tab = AddTab(&profile_);
++  task_environment_.FastForwardBy(kDiscardAfter);
++  ASSERT_EQ(State::kDiscarded, GetState(tab));
++
++  governor()->Touch(tab);
++  EXPECT_EQ(State::kActive, GetState(tab));
++  EXPECT_TRUE(governor()->GetUsage(tab)->idle_time.is_zero());
++}
++
++TEST_F(HiddenTabGovernorTest, RefusesTabsOverCountBudget) {
++  std::string reason;
++  for (int i = 0; i < 3; ++i) {
++    EXPECT_TRUE(governor()->HasBudgetFor(&profile_, &reason));
++    AddTab(&profile_);
++  }
++  EXPECT_FALSE(governor()->HasBudgetFor(&profile_, &reason));
++  EXPECT_FALSE(reason.empty());
++
++  // The budget is per profile.
++  TestingProfile other;
++  std::string other_reason;
++  EXPECT_TRUE(governor()->HasBudgetFor(&other, &other_reason));
++}
++
++TEST_F(HiddenTabGovernorTest, DiscardsLeastRecentlyUsedOverMemoryBudget) {
++  content::WebContents* first = AddTab(&profile_);
++  task_environment_.FastForwardBy(base::Seconds(10));
++  content::WebContents* second = AddTab(&profile_);
++  task_environment_.FastForwardBy(base::Seconds(10));
++  // Used after |second|, which is now the least recently used.
++  governor()->Touch(first);
++
++  // 800 KB fits the 1 MB budget, but not with room for another 400 KB tab.
++  SetMemoryKb(first, 1, 400);
++  SetMemoryKb(second, 2, 400);
++  std::string reason;
++  EXPECT_TRUE(governor()->HasBudgetFor(&profile_, &reason));
++  EXPECT_EQ(State::kActive, GetState(first));
++  EXPECT_EQ(State::kDiscarded, GetState(second));
++}
++
++TEST_F(HiddenTabGovernorTest, AdmitsTabThatExactlyFitsMemoryBudget) {
++  content::WebContents* tab = AddTab(&profile_);
++  SetMemoryKb(tab, 1, 512);
++
++  std::string reason;
++  EXPECT_TRUE(governor()->HasBudgetFor(&profile_, &reason));
++  EXPECT_EQ(State::kActive, GetState(tab));
++}
++
++TEST_F(HiddenTabGovernorTest, DiscardsTabAtMemoryBudgetToMakeRoom) {
++  content::WebContents* tab = AddTab(&profile_);
++  SetMemoryKb(tab, 1, 1024);
++
++  std::string reason;
++  EXPECT_TRUE(governor()->HasBudgetFor(&profile_, &reason));
++  EXPECT_EQ(State::kDiscarded, GetState(tab));
++}
++
++TEST_F(HiddenTabGovernorTest, CountsUnsampledTabsAgainstMemoryBudget) {
++  content::WebContents* sampled = AddTab(&profile_);
++  SetMemoryKb(sampled, 1, 400);
++  task_environment_.FastForwardBy(base::Seconds(10));
++  content::WebContents* unsampled = AddTab(&profile_);
++  EXPECT_FALSE(governor()->GetUsage(unsampled)->private_memory_kb);
++  task_environment_.FastForwardBy(base::Seconds(10));
++  governor()->Touch(sampled);
++
++  // |unsampled| counts as another 400 KB renderer, so admitting a third tab
++  // means discarding it.
++  std::string reason;
++  EXPECT_TRUE(governor()->HasBudgetFor(&profile_, &reason));
++  EXPECT_EQ(State::kActive, GetState(sampled));
++  EXPECT_EQ(State::kDiscarded, GetState(unsampled));
++}
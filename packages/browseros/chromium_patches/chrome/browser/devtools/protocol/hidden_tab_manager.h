@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/devtools/protocol/hidden_tab_manager.h b/chrome/browser/devtools/protocol/hidden_tab_manager.h
 new file mode 100644
-index 0000000000000..52cb68e094c67
+index 0000000000000..d24b7c687369b
 --- /dev/null
 +++ b/chrome/browser/devtools/protocol/hidden_tab_manager.h
-@@ -0,0 +1,59 @@
+@@ -0,0 +1,61 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -26,6 +26,8 @@ index 0000000000000..52cb68e094c67
 +
 +// Manages hidden tab WebContents that are not attached to any browser window.
 +// Hidden tabs are first-class CDP targets and are destroyed on CDP disconnect.
++// Their WebContents come from HiddenTabPool when a warm one is available, and
++// HiddenTabGovernor applies resource budgets to them while they are hidden.
 +class HiddenTabManager : public content::WebContentsDelegate {
 + public:
 +  HiddenTabManager();
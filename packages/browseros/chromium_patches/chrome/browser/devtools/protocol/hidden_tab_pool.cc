@@ -0,0 +1,236 @@
+diff --git a/chrome/browser/devtools/protocol/hidden_tab_pool.cc b/chrome/browser/devtools/protocol/hidden_tab_pool.cc
+new file mode 100644
+index 0000000000000..85fe8a20bebe0
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/hidden_tab_pool.cc
+@@ -0,0 +1,230 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/devtools/protocol/hidden_tab_pool.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/containers/flat_set.h"
++#include "base/feature_list.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/metrics/field_trial_params.h"
++#include "base/process/process_handle.h"
++#include "chrome/browser/browser_features.h"
++#include "chrome/browser/sessions/session_tab_helper_factory.h"
++#include "content/public/browser/browser_task_traits.h"
++#include "content/public/browser/browser_thread.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_process_host.h"
++#include "content/public/browser/web_contents.h"
++#include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
++
++namespace {
++
++const base::FeatureParam<int> kPoolSize{&features::kBrowserOsHiddenTabPool,
++                                        "pool_size", 2};
++const base::FeatureParam<int> kMaxMemoryMb{
++    &features::kBrowserOsHiddenTabPool, "max_memory_mb", 512};
++
++// How long refills stay paused after a memory pressure signal.
++constexpr base::TimeDelta kPressureCooldown = base::Minutes(1);
++
++}  // namespace
++
++// static
++HiddenTabPool* HiddenTabPool::GetInstance() {
++  static base::NoDestructor<HiddenTabPool> instance;
++  return instance.get();
++}
++
++HiddenTabPool::HiddenTabPool()
++    : target_size_(std::max(0, kPoolSize.Get())),
++      max_memory_kb_(static_cast<size_t>(std::max(0, kMaxMemoryMb.Get())) *
++                     1024),
++      request_memory_dump_(
++          base::BindRepeating(&HiddenTabPool::RequestPrivateMemoryFootprint)),
++      memory_pressure_listener_(
++          FROM_HERE,
++          base::BindRepeating(&HiddenTabPool::OnMemoryPressure,
++                              base::Unretained(this))) {}
++
++HiddenTabPool::~HiddenTabPool() = default;
++
++void HiddenTabPool::Prewarm(content::BrowserContext* browser_context) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  if (!base::FeatureList::IsEnabled(features::kBrowserOsHiddenTabPool) ||
++      target_size_ == 0 || !browser_context) {
++    return;
++  }
++
++  if (!warm_.contains(browser_context)) {
++    warm_[browser_context];
++    profile_observations_.AddObservation(
++        Profile::FromBrowserContext(browser_context));
++  }
++  ScheduleRefill();
++}
++
++std::unique_ptr<content::WebContents> HiddenTabPool::Acquire(
++    content::BrowserContext* browser_context,
++    bool* from_pool) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  std::unique_ptr<content::WebContents> web_contents;
++  auto it = warm_.find(browser_context);
++  if (it != warm_.end() && !it->second.empty()) {
++    web_contents = std::move(it->second.back());
++    it->second.pop_back();
++  }
++  *from_pool = !!web_contents;
++  if (!web_contents) {
++    web_contents = CreateWebContents(browser_context);
++  }
++
++  Prewarm(browser_context);
++  return web_contents;
++}
++
++size_t HiddenTabPool::GetWarmCount(
++    content::BrowserContext* browser_context) const {
++  auto it = warm_.find(browser_context);
++  return it == warm_.end() ? 0 : it->second.size();
++}
++
++void HiddenTabPool::OnProfileWillBeDestroyed(Profile* profile) {
++  warm_.erase(profile);
++  profile_observations_.RemoveObservation(profile);
++}
++
++// static
++std::unique_ptr<content::WebContents> HiddenTabPool::CreateWebContents(
++    content::BrowserContext* browser_context) {
++  content::WebContents::CreateParams params(browser_context);
++  params.initially_hidden = true;
++  params.initialize_renderer = true;
++  auto web_contents = content::WebContents::Create(params);
++  CreateSessionServiceTabHelper(web_contents.get());
++  return web_contents;
++}
++
++// static
++void HiddenTabPool::RequestPrivateMemoryFootprint(
++    MemoryDumpCallback callback) {
++  auto* instrumentation =
++      memory_instrumentation::MemoryInstrumentation::GetInstance();
++  if (!instrumentation) {
++    std::move(callback).Run(false, nullptr);
++    return;
++  }
++  instrumentation->RequestPrivateMemoryFootprint(base::kNullProcessId,
++                                                 std::move(callback));
++}
++
++content::BrowserContext* HiddenTabPool::GetProfileToRefill() const {
++  content::BrowserContext* browser_context = nullptr;
++  size_t fewest = target_size_;
++  for (const auto& [context, warm] : warm_) {
++    if (warm.size() < fewest) {
++      browser_context = context;
++      fewest = warm.size();
++    }
++  }
++  return browser_context;
++}
++
++void HiddenTabPool::ScheduleRefill() {
++  if (refill_pending_ || !GetProfileToRefill()) {
++    return;
++  }
++  refill_pending_ = true;
++  base::TimeDelta delay = std::max(
++      base::TimeDelta(), refill_blocked_until_ - base::TimeTicks::Now());
++  // One WebContents per task so refills never hold up agent commands.
++  content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT})
++      ->PostDelayedTask(FROM_HERE,
++                        base::BindOnce(&HiddenTabPool::Refill,
++                                       weak_factory_.GetWeakPtr()),
++                        delay);
++}
++
++void HiddenTabPool::Refill() {
++  refill_pending_ = false;
++  if (!GetProfileToRefill()) {
++    return;
++  }
++  if (base::TimeTicks::Now() < refill_blocked_until_) {
++    ScheduleRefill();
++    return;
++  }
++
++  bool empty = std::ranges::all_of(
++      warm_, [](const auto& it) { return it.second.empty(); });
++  if (empty) {
++    OnMemoryDump(false, nullptr);
++    return;
++  }
++  refill_pending_ = true;
++  request_memory_dump_.Run(base::BindOnce(&HiddenTabPool::OnMemoryDump,
++                                          weak_factory_.GetWeakPtr()));
++}
++
++void HiddenTabPool::OnMemoryDump(
++    bool success,
++    std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump) {
++  refill_pending_ = false;
++  content::BrowserContext* browser_context = GetProfileToRefill();
++  if (!browser_context || base::TimeTicks::Now() < refill_blocked_until_) {
++    ScheduleRefill();
++    return;
++  }
++
++  if (success && dump) {
++    base::flat_set<base::ProcessId> pids;
++    size_t size = 0;
++    for (const auto& [context, warm] : warm_) {
++      size += warm.size();
++      for (const auto& web_contents : warm) {
++        content::RenderProcessHost* process =
++            web_contents->GetPrimaryMainFrame()->GetProcess();
++        pids.insert(process->GetProcess().Pid());
++      }
++    }
++    size_t pool_kb = 0;
++    for (const auto& process_dump : dump->process_dumps()) {
++      if (pids.contains(process_dump.pid())) {
++        pool_kb += process_dump.os_dump().private_footprint_kb;
++      }
++    }
++    if (pool_kb >= max_memory_kb_) {
++      LOG(INFO) << "browseros: Hidden tab pool at memory cap, size="
++                << size << " private_kb=" << pool_kb;
++      return;
++    }
++  }
++
++  warm_[browser_context].push_back(CreateWebContents(browser_context));
++  ScheduleRefill();
++}
++
++void HiddenTabPool::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level) {
++  switch (level) {
++    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
++      return;
++    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
++      for (auto& [browser_context, warm] : warm_) {
++        warm.resize(warm.size() / 2);
++      }
++      break;
++    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
++      for (auto& [browser_context, warm] : warm_) {
++        warm.clear();
++      }
++      break;
++  }
++  refill_blocked_until_ = base::TimeTicks::Now() + kPressureCooldown;
++  // Picks up again once the cooldown is over.
++  ScheduleRefill();
++}
@@ -0,0 +1,122 @@
+diff --git a/chrome/browser/devtools/protocol/hidden_tab_pool.h b/chrome/browser/devtools/protocol/hidden_tab_pool.h
+new file mode 100644
+index 0000000000000..b80a59a836bf6
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/hidden_tab_pool.h
+@@ -0,0 +1,116 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_DEVTOOLS_PROTOCOL_HIDDEN_TAB_POOL_H_
++#define CHROME_BROWSER_DEVTOOLS_PROTOCOL_HIDDEN_TAB_POOL_H_
++
++#include <memory>
++#include <vector>
++
++#include "base/containers/flat_map.h"
++#include "base/functional/callback.h"
++#include "base/memory/memory_pressure_listener.h"
++#include "base/memory/weak_ptr.h"
++#include "base/no_destructor.h"
++#include "base/scoped_multi_source_observation.h"
++#include "base/time/time.h"
++#include "chrome/browser/profiles/profile.h"
++#include "chrome/browser/profiles/profile_observer.h"
++
++namespace content {
++class BrowserContext;
++class WebContents;
++}  // namespace content
++
++namespace memory_instrumentation {
++class GlobalMemoryDump;
++}  // namespace memory_instrumentation
++
++// Keeps a few hidden-tab WebContents warm so that creating a hidden tab does
++// not pay for renderer process startup. A warm WebContents is hidden, has
++// its renderer started and a session tab helper, and has not navigated.
++//
++// The pool warms "pool_size" WebContents for each profile hidden tabs are
++// created in, and refills at best-effort priority after each Acquire(). A
++// profile's warm WebContents are released when it is destroyed.
++// Closed hidden tabs are destroyed rather than put back: a reused
++// WebContents would keep its tab id, target id, history and session
++// storage. Their slot is refilled with a fresh WebContents instead.
++//
++// Size and memory cap come from the BrowserOsHiddenTabPool feature params
++// "pool_size" and "max_memory_mb". The pool stops growing once the
++// renderers of all its WebContents use max_memory_mb, halves on moderate
++// memory pressure, empties on critical pressure, and does not refill for a
++// while after either.
++//
++// Threading: UI thread only.
++class HiddenTabPool : public ProfileObserver {
++ public:
++  static HiddenTabPool* GetInstance();
++
++  HiddenTabPool(const HiddenTabPool&) = delete;
++  HiddenTabPool& operator=(const HiddenTabPool&) = delete;
++
++  // Starts warming WebContents for |browser_context|.
++  void Prewarm(content::BrowserContext* browser_context);
++
++  // Returns a warm WebContents for |browser_context| if one is ready,
++  // otherwise a newly created one. Sets |*from_pool| accordingly.
++  std::unique_ptr<content::WebContents> Acquire(
++      content::BrowserContext* browser_context,
++      bool* from_pool);
++
++  // Returns the number of warm WebContents ready for |browser_context|.
++  size_t GetWarmCount(content::BrowserContext* browser_context) const;
++
++  // ProfileObserver:
++  void OnProfileWillBeDestroyed(Profile* profile) override;
++
++ private:
++  friend class base::NoDestructor<HiddenTabPool>;
++  friend class HiddenTabPoolTest;
++
++  using MemoryDumpCallback = base::OnceCallback<void(
++      bool success,
++      std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump)>;
++
++  HiddenTabPool();
++  ~HiddenTabPool() override;
++
++  static std::unique_ptr<content::WebContents> CreateWebContents(
++      content::BrowserContext* browser_context);
++  static void RequestPrivateMemoryFootprint(MemoryDumpCallback callback);
++
++  // Returns the profile with the fewest warm WebContents below
++  // |target_size_|, or null if all are full.
++  content::BrowserContext* GetProfileToRefill() const;
++
++  void ScheduleRefill();
++  void Refill();
++  void OnMemoryDump(
++      bool success,
++      std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump);
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level);
++
++  const size_t target_size_;
++  const size_t max_memory_kb_;
++
++  // Warm WebContents of each profile being warmed for.
++  base::flat_map<content::BrowserContext*,
++                 std::vector<std::unique_ptr<content::WebContents>>>
++      warm_;
++  bool refill_pending_ = false;
++  // Refills are paused until then after memory pressure.
++  base::TimeTicks refill_blocked_until_;
++  // Measures the pool's renderers before it grows. Replaced in tests.
++  base::RepeatingCallback<void(MemoryDumpCallback)> request_memory_dump_;
++
++  base::ScopedMultiSourceObservation<Profile, ProfileObserver>
++      profile_observations_{this};
++  base::MemoryPressureListener memory_pressure_listener_;
++  base::WeakPtrFactory<HiddenTabPool> weak_factory_{this};
++};
++
++#endif  // CHROME_BROWSER_DEVTOOLS_PROTOCOL_HIDDEN_TAB_POOL_H_
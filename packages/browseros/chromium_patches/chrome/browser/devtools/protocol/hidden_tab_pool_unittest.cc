@@ -0,0 +1,189 @@
+diff --git a/chrome/browser/devtools/protocol/hidden_tab_pool_unittest.cc b/chrome/browser/devtools/protocol/hidden_tab_pool_unittest.cc
+new file mode 100644
+index 0000000000000..f7685b6e5d351
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/hidden_tab_pool_unittest.cc
+@@ -0,0 +1,183 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/devtools/protocol/hidden_tab_pool.h"
++
++#include <memory>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/memory/raw_ptr.h"
++#include "base/test/scoped_feature_list.h"
++#include "chrome/browser/browser_features.h"
++#include "chrome/test/base/testing_profile.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_process_host.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/test/browser_task_environment.h"
++#include "content/public/test/test_renderer_host.h"
++#include "services/resource_coordinator/public/cpp/memory_instrumentation/global_memory_dump.h"
++#include "services/resource_coordinator/public/mojom/memory_instrumentation/memory_instrumentation.mojom.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++class HiddenTabPoolTest : public testing::Test {
++ protected:
++  static constexpr size_t kPoolSize = 4;
++
++  HiddenTabPoolTest() {
++    feature_list_.InitAndEnableFeatureWithParameters(
++        features::kBrowserOsHiddenTabPool,
++        {{"pool_size", "4"}, {"max_memory_mb", "1"}});
++  }
++
++  void SetUp() override {
++    pool_ = new HiddenTabPool();
++    pool_->request_memory_dump_ = base::BindRepeating(
++        &HiddenTabPoolTest::RequestMemoryDump, base::Unretained(this));
++  }
++
++  void TearDown() override { delete pool_.ExtractAsDangling(); }
++
++  HiddenTabPool* pool() { return pool_; }
++
++  void SimulateMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level) {
++    pool_->OnMemoryPressure(level);
++  }
++
++  // Number of profiles the pool warms for.
++  size_t profile_count() const { return pool_->warm_.size(); }
++
++  base::test::ScopedFeatureList feature_list_;
++  content::BrowserTaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  content::RenderViewHostTestEnabler rvh_test_enabler_;
++  TestingProfile profile_;
++  // Private footprint reported for each renderer of the pool.
++  size_t footprint_kb_ = 0;
++
++ private:
++  void RequestMemoryDump(HiddenTabPool::MemoryDumpCallback callback) {
++    auto dump = memory_instrumentation::mojom::GlobalMemoryDump::New();
++    for (const auto& [browser_context, warm] : pool_->warm_) {
++      for (const auto& web_contents : warm) {
++        auto process_dump =
++            memory_instrumentation::mojom::ProcessMemoryDump::New();
++        process_dump->pid = web_contents->GetPrimaryMainFrame()
++                                ->GetProcess()
++                                ->GetProcess()
++                                .Pid();
++        process_dump->os_dump = memory_instrumentation::mojom::OSMemDump::New();
++        process_dump->os_dump->private_footprint_kb = footprint_kb_;
++        dump->process_dumps.push_back(std::move(process_dump));
++      }
++    }
++    std::move(callback).Run(
++        true, memory_instrumentation::GlobalMemoryDump::MoveFrom(
++                  std::move(dump)));
++  }
++
++  raw_ptr<HiddenTabPool> pool_ = nullptr;
++};
++
++TEST_F(HiddenTabPoolTest, RefillsAfterAcquire) {
++  pool()->Prewarm(&profile_);
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++
++  bool from_pool = false;
++  auto web_contents = pool()->Acquire(&profile_, &from_pool);
++  ASSERT_TRUE(web_contents);
++  EXPECT_TRUE(from_pool);
++  EXPECT_EQ(&profile_, web_contents->GetBrowserContext());
++  EXPECT_EQ(kPoolSize - 1, pool()->GetWarmCount(&profile_));
++
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++}
++
++TEST_F(HiddenTabPoolTest, AcquireFromColdPoolCreatesAndWarms) {
++  bool from_pool = true;
++  auto web_contents = pool()->Acquire(&profile_, &from_pool);
++  ASSERT_TRUE(web_contents);
++  EXPECT_FALSE(from_pool);
++
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++}
++
++TEST_F(HiddenTabPoolTest, StopsGrowingAtMemoryCap) {
++  footprint_kb_ = 2048;
++  pool()->Prewarm(&profile_);
++  task_environment_.RunUntilIdle();
++  // The first one is created before there is anything to measure.
++  EXPECT_EQ(1u, pool()->GetWarmCount(&profile_));
++
++  footprint_kb_ = 512;
++  pool()->Prewarm(&profile_);
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++}
++
++TEST_F(HiddenTabPoolTest, ShrinksOnMemoryPressure) {
++  pool()->Prewarm(&profile_);
++  task_environment_.RunUntilIdle();
++
++  SimulateMemoryPressure(
++      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
++  EXPECT_EQ(kPoolSize / 2, pool()->GetWarmCount(&profile_));
++
++  SimulateMemoryPressure(
++      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL);
++  EXPECT_EQ(0u, pool()->GetWarmCount(&profile_));
++}
++
++TEST_F(HiddenTabPoolTest, PausesRefillAfterMemoryPressure) {
++  pool()->Prewarm(&profile_);
++  task_environment_.RunUntilIdle();
++  SimulateMemoryPressure(
++      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL);
++
++  bool from_pool = true;
++  auto web_contents = pool()->Acquire(&profile_, &from_pool);
++  EXPECT_FALSE(from_pool);
++  task_environment_.FastForwardBy(base::Seconds(59));
++  EXPECT_EQ(0u, pool()->GetWarmCount(&profile_));
++
++  // The cooldown is a minute.
++  task_environment_.FastForwardBy(base::Seconds(1));
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++}
++
++TEST_F(HiddenTabPoolTest, WarmsEachProfile) {
++  TestingProfile other;
++  pool()->Prewarm(&profile_);
++  pool()->Prewarm(&other);
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&other));
++
++  bool from_pool = false;
++  auto web_contents = pool()->Acquire(&other, &from_pool);
++  EXPECT_TRUE(from_pool);
++  EXPECT_EQ(&other, web_contents->GetBrowserContext());
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++  EXPECT_EQ(kPoolSize - 1, pool()->GetWarmCount(&other));
++}
++
++TEST_F(HiddenTabPoolTest, ReleasesDestroyedProfile) {
++  auto other = std::make_unique<TestingProfile>();
++  pool()->Prewarm(&profile_);
++  pool()->Prewarm(other.get());
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(2u, profile_count());
++
++  other.reset();
++  EXPECT_EQ(1u, profile_count());
++  EXPECT_EQ(kPoolSize, pool()->GetWarmCount(&profile_));
++
++  // Nothing is left to refill for the destroyed profile.
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(1u, profile_count());
++}
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/devtools/protocol/history_handler.cc b/chrome/browser/devtools/protocol/history_handler.cc
 new file mode 100644
-index 0000000000000..c23d0c63f9046
+index 0000000000000..bbd840b8dd9dd
 --- /dev/null
 +++ b/chrome/browser/devtools/protocol/history_handler.cc
-@@ -0,0 +1,183 @@
+@@ -0,0 +1,204 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,12 +11,14 @@ index 0000000000000..c23d0c63f9046
 +#include "chrome/browser/devtools/protocol/history_handler.h"
 +
 +#include <string>
++#include <string_view>
 +#include <vector>
 +
 +#include "base/functional/bind.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/time/time.h"
++#include "chrome/browser/browseros/metrics/browseros_perf_stats.h"
 +#include "chrome/browser/history/history_service_factory.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "components/history/core/browser/history_service.h"
@@ -24,10 +26,19 @@ index 0000000000000..c23d0c63f9046
 +#include "components/history/core/browser/url_row.h"
 +#include "content/public/browser/devtools_agent_host.h"
 +
++using browseros_metrics::ScopedPerfTimer;
 +using protocol::Response;
 +
 +namespace {
 +
++constexpr auto kCDP = browseros_metrics::BrowserOSPerfStats::Surface::kCDP;
++
++// Handlers that answer asynchronously record from their completion callback.
++void RecordLatency(std::string_view command, base::TimeTicks start) {
++  browseros_metrics::BrowserOSPerfStats::GetInstance()->Record(
++      kCDP, command, base::TimeTicks::Now() - start);
++}
++
 +std::unique_ptr<protocol::History::HistoryEntry> BuildHistoryEntry(
 +    const history::URLResult& result) {
 +  return protocol::History::HistoryEntry::Create()
@@ -70,6 +81,7 @@ index 0000000000000..c23d0c63f9046
 +                            std::optional<double> start_time,
 +                            std::optional<double> end_time,
 +                            std::unique_ptr<SearchCallback> callback) {
++  const base::TimeTicks start = base::TimeTicks::Now();
 +  history::HistoryService* service = GetHistoryService();
 +  if (!service) {
 +    std::move(callback)->sendFailure(
@@ -93,12 +105,13 @@ index 0000000000000..c23d0c63f9046
 +  service->QueryHistory(
 +      base::UTF8ToUTF16(query), options,
 +      base::BindOnce(&HistoryHandler::OnSearchComplete,
-+                     weak_factory_.GetWeakPtr(), std::move(callback)),
++                     weak_factory_.GetWeakPtr(), start, std::move(callback)),
 +      &task_tracker_);
 +}
 +
 +void HistoryHandler::GetRecent(std::optional<int> max_results,
 +                               std::unique_ptr<GetRecentCallback> callback) {
++  const base::TimeTicks start = base::TimeTicks::Now();
 +  history::HistoryService* service = GetHistoryService();
 +  if (!service) {
 +    std::move(callback)->sendFailure(
@@ -113,12 +126,13 @@ index 0000000000000..c23d0c63f9046
 +  service->QueryHistory(
 +      std::u16string(), options,
 +      base::BindOnce(&HistoryHandler::OnGetRecentComplete,
-+                     weak_factory_.GetWeakPtr(), std::move(callback)),
++                     weak_factory_.GetWeakPtr(), start, std::move(callback)),
 +      &task_tracker_);
 +}
 +
 +void HistoryHandler::DeleteUrl(const std::string& url,
 +                               std::unique_ptr<DeleteUrlCallback> callback) {
++  ScopedPerfTimer perf_timer(kCDP, "History.deleteUrl");
 +  history::HistoryService* service = GetHistoryService();
 +  if (!service) {
 +    std::move(callback)->sendFailure(
@@ -141,6 +155,7 @@ index 0000000000000..c23d0c63f9046
 +    double start_time,
 +    double end_time,
 +    std::unique_ptr<DeleteRangeCallback> callback) {
++  const base::TimeTicks start = base::TimeTicks::Now();
 +  history::HistoryService* service = GetHistoryService();
 +  if (!service) {
 +    std::move(callback)->sendFailure(
@@ -157,11 +172,12 @@ index 0000000000000..c23d0c63f9046
 +      /*restrict_app_id=*/std::nullopt, begin, end,
 +      /*user_initiated=*/true,
 +      base::BindOnce(&HistoryHandler::OnDeleteRangeComplete,
-+                     weak_factory_.GetWeakPtr(), std::move(callback)),
++                     weak_factory_.GetWeakPtr(), start, std::move(callback)),
 +      &task_tracker_);
 +}
 +
 +void HistoryHandler::OnSearchComplete(
++    base::TimeTicks start,
 +    std::unique_ptr<SearchCallback> callback,
 +    history::QueryResults results) {
 +  auto entries =
@@ -170,9 +186,11 @@ index 0000000000000..c23d0c63f9046
 +    entries->push_back(BuildHistoryEntry(result));
 +  }
 +  std::move(callback)->sendSuccess(std::move(entries));
++  RecordLatency("History.search", start);
 +}
 +
 +void HistoryHandler::OnGetRecentComplete(
++    base::TimeTicks start,
 +    std::unique_ptr<GetRecentCallback> callback,
 +    history::QueryResults results) {
 +  auto entries =
@@ -181,9 +199,12 @@ index 0000000000000..c23d0c63f9046
 +    entries->push_back(BuildHistoryEntry(result));
 +  }
 +  std::move(callback)->sendSuccess(std::move(entries));
++  RecordLatency("History.getRecent", start);
 +}
 +
 +void HistoryHandler::OnDeleteRangeComplete(
++    base::TimeTicks start,
 +    std::unique_ptr<DeleteRangeCallback> callback) {
 +  std::move(callback)->sendSuccess();
++  RecordLatency("History.deleteRange", start);
 +}
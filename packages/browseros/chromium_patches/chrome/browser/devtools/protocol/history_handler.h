@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/devtools/protocol/history_handler.h b/chrome/browser/devtools/protocol/history_handler.h
 new file mode 100644
-index 0000000000000..7cde94b91e242
+index 0000000000000..218596a1c34f3
 --- /dev/null
 +++ b/chrome/browser/devtools/protocol/history_handler.h
-@@ -0,0 +1,64 @@
+@@ -0,0 +1,69 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -16,6 +16,7 @@ index 0000000000000..7cde94b91e242
 +
 +#include "base/memory/weak_ptr.h"
 +#include "base/task/cancelable_task_tracker.h"
++#include "base/time/time.h"
 +#include "chrome/browser/devtools/protocol/history.h"
 +
 +class Profile;
@@ -53,13 +54,17 @@ index 0000000000000..7cde94b91e242
 +  Profile* GetProfile() const;
 +  history::HistoryService* GetHistoryService() const;
 +
++  // |start| is when the command arrived, for latency stats.
 +  void OnSearchComplete(
++      base::TimeTicks start,
 +      std::unique_ptr<SearchCallback> callback,
 +      history::QueryResults results);
 +  void OnGetRecentComplete(
++      base::TimeTicks start,
 +      std::unique_ptr<GetRecentCallback> callback,
 +      history::QueryResults results);
 +  void OnDeleteRangeComplete(
++      base::TimeTicks start,
 +      std::unique_ptr<DeleteRangeCallback> callback);
 +
 +  const std::string target_id_;
@@ -0,0 +1,326 @@
+diff --git a/chrome/browser/devtools/protocol/tab_event_stream.cc b/chrome/browser/devtools/protocol/tab_event_stream.cc
+new file mode 100644
+index 0000000000000..dfddfa48592b6
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/tab_event_stream.cc
+@@ -0,0 +1,320 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/devtools/protocol/tab_event_stream.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/memory/raw_ptr.h"
++#include "chrome/browser/ui/browser.h"
++#include "chrome/browser/ui/browser_list.h"
++#include "chrome/browser/ui/browser_window/public/browser_window_interface.h"
++#include "chrome/browser/ui/browser_window/public/browser_window_interface_iterator.h"
++#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "components/sessions/content/session_tab_helper.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_observer.h"
++
++namespace {
++
++int GetTabId(content::WebContents* contents) {
++  SessionID id = sessions::SessionTabHelper::IdForTab(contents);
++  return id.is_valid() ? id.id() : -1;
++}
++
++}  // namespace
++
++// Reports title, URL and loading changes of a hidden tab, which has no tab
++// strip to report them.
++class TabEventStream::HiddenTabObserver : public content::WebContentsObserver {
++ public:
++  HiddenTabObserver(TabEventStream* stream,
++                    content::WebContents* web_contents,
++                    int tab_id)
++      : content::WebContentsObserver(web_contents),
++        stream_(stream),
++        tab_id_(tab_id) {}
++
++  // content::WebContentsObserver:
++  void TitleWasSet(content::NavigationEntry* entry) override { OnChanged(); }
++  void PrimaryPageChanged(content::Page& page) override { OnChanged(); }
++  void DidStartLoading() override { OnChanged(); }
++  void DidStopLoading() override { OnChanged(); }
++  void WebContentsDestroyed() override {
++    // Deletes |this|.
++    stream_->OnHiddenTabDestroyed(tab_id_);
++  }
++
++ private:
++  void OnChanged() {
++    stream_->RecordTabChange(tab_id_, TabChange::kUpdated, -1);
++  }
++
++  raw_ptr<TabEventStream> stream_;
++  const int tab_id_;
++};
++
++TabEventStream::TabEventStream(EventCallback callback)
++    : callback_(std::move(callback)) {
++  BrowserList::AddObserver(this);
++  ForEachCurrentBrowserWindowInterfaceOrderedByActivation(
++      [this](BrowserWindowInterface* bwi) {
++        ObserveTabStrip(bwi->GetTabStripModel(), bwi->GetSessionID().id());
++        return true;
++      });
++}
++
++TabEventStream::~TabEventStream() {
++  BrowserList::RemoveObserver(this);
++  for (const auto& [tab_strip_model, window_id] : window_ids_) {
++    tab_strip_model->RemoveObserver(this);
++  }
++}
++
++void TabEventStream::ObserveHiddenTab(content::WebContents* web_contents) {
++  int tab_id = GetTabId(web_contents);
++  if (tab_id < 0) {
++    return;
++  }
++  hidden_tabs_[tab_id] =
++      std::make_unique<HiddenTabObserver>(this, web_contents, tab_id);
++  live_tabs_.insert(tab_id);
++}
++
++void TabEventStream::OnHiddenTabAdded(content::WebContents* web_contents) {
++  int tab_id = GetTabId(web_contents);
++  if (tab_id < 0) {
++    return;
++  }
++  bool created = !live_tabs_.contains(tab_id);
++  ObserveHiddenTab(web_contents);
++  RecordTabChange(tab_id, created ? TabChange::kCreated : TabChange::kUpdated,
++                  -1);
++}
++
++void TabEventStream::Flush() {
++  flush_timer_.Stop();
++
++  std::map<int, PendingTab> tabs;
++  tabs.swap(pending_tabs_);
++  base::flat_map<int, int> activations;
++  activations.swap(pending_activations_);
++  base::flat_set<int> windows;
++  windows.swap(pending_windows_);
++
++  for (const auto& [tab_id, pending] : tabs) {
++    EventType type = EventType::kTabUpdated;
++    if (pending.change == TabChange::kCreated) {
++      type = EventType::kTabCreated;
++    } else if (pending.change == TabChange::kRemoved) {
++      type = EventType::kTabRemoved;
++    }
++    callback_.Run({type, tab_id, pending.window_id});
++  }
++  for (const auto& [window_id, tab_id] : activations) {
++    // Skip tabs activated and closed within the same frame.
++    if (live_tabs_.contains(tab_id)) {
++      callback_.Run({EventType::kTabActivated, tab_id, window_id});
++    }
++  }
++  for (int window_id : windows) {
++    callback_.Run({EventType::kWindowChanged, -1, window_id});
++  }
++}
++
++void TabEventStream::ForgetTab(int tab_id) {
++  live_tabs_.erase(tab_id);
++}
++
++void TabEventStream::OnBrowserAdded(Browser* browser) {
++  ObserveTabStrip(browser->tab_strip_model(), browser->session_id().id());
++  RecordWindowChange(browser->session_id().id());
++}
++
++void TabEventStream::OnBrowserRemoved(Browser* browser) {
++  TabStripModel* tab_strip_model = browser->tab_strip_model();
++  if (window_ids_.erase(tab_strip_model)) {
++    tab_strip_model->RemoveObserver(this);
++  }
++  RecordWindowChange(browser->session_id().id());
++}
++
++void TabEventStream::OnBrowserSetLastActive(Browser* browser) {
++  RecordWindowChange(browser->session_id().id());
++}
++
++void TabEventStream::OnBrowserNoLongerActive(Browser* browser) {
++  RecordWindowChange(browser->session_id().id());
++}
++
++void TabEventStream::OnTabStripModelChanged(
++    TabStripModel* tab_strip_model,
++    const TabStripModelChange& change,
++    const TabStripSelectionChange& selection) {
++  auto it = window_ids_.find(tab_strip_model);
++  if (it == window_ids_.end()) {
++    return;
++  }
++  const int window_id = it->second;
++
++  switch (change.type()) {
++    case TabStripModelChange::kInserted:
++      for (const auto& inserted : change.GetInsert()->contents) {
++        OnTabInserted(inserted.contents, window_id);
++      }
++      RecordWindowChange(window_id);
++      break;
++    case TabStripModelChange::kRemoved:
++      for (const auto& removed : change.GetRemove()->contents) {
++        OnTabDetached(removed.contents, window_id,
++                      removed.remove_reason ==
++                          TabStripModelChange::RemoveReason::
++                              kInsertedIntoOtherTabStrip);
++      }
++      RecordWindowChange(window_id);
++      break;
++    case TabStripModelChange::kMoved: {
++      int tab_id = GetTabId(change.GetMove()->contents);
++      if (tab_id >= 0) {
++        RecordTabChange(tab_id, TabChange::kUpdated, window_id);
++      }
++      break;
++    }
++    case TabStripModelChange::kReplaced: {
++      int tab_id = GetTabId(change.GetReplace()->new_contents);
++      if (tab_id >= 0) {
++        RecordTabChange(tab_id, TabChange::kUpdated, window_id);
++      }
++      break;
++    }
++    case TabStripModelChange::kSelectionOnly:
++      break;
++  }
++
++  if (selection.active_tab_has_changed() && selection.new_contents) {
++    int tab_id = GetTabId(selection.new_contents);
++    if (tab_id >= 0) {
++      pending_activations_[window_id] = tab_id;
++      RecordWindowChange(window_id);
++    }
++  }
++}
++
++void TabEventStream::TabChangedAt(content::WebContents* contents,
++                                  int index,
++                                  TabChangeType change_type) {
++  int tab_id = GetTabId(contents);
++  if (tab_id >= 0) {
++    RecordTabChange(tab_id, TabChange::kUpdated, -1);
++  }
++}
++
++void TabEventStream::TabPinnedStateChanged(TabStripModel* tab_strip_model,
++                                           content::WebContents* contents,
++                                           int index) {
++  int tab_id = GetTabId(contents);
++  if (tab_id >= 0) {
++    RecordTabChange(tab_id, TabChange::kUpdated, -1);
++  }
++}
++
++void TabEventStream::OnTabStripModelDestroyed(
++    TabStripModel* tab_strip_model) {
++  window_ids_.erase(tab_strip_model);
++}
++
++void TabEventStream::ObserveTabStrip(TabStripModel* tab_strip_model,
++                                     int window_id) {
++  if (!window_ids_.emplace(tab_strip_model, window_id).second) {
++    return;
++  }
++  tab_strip_model->AddObserver(this);
++  for (int i = 0; i < tab_strip_model->count(); ++i) {
++    int tab_id = GetTabId(tab_strip_model->GetWebContentsAt(i));
++    if (tab_id >= 0) {
++      live_tabs_.insert(tab_id);
++    }
++  }
++}
++
++void TabEventStream::OnTabInserted(content::WebContents* contents,
++                                   int window_id) {
++  int tab_id = GetTabId(contents);
++  if (tab_id < 0) {
++    return;
++  }
++  // A shown hidden tab is reported by its tab strip from now on.
++  hidden_tabs_.erase(tab_id);
++  RecordTabChange(tab_id,
++                  live_tabs_.insert(tab_id).second ? TabChange::kCreated
++                                                   : TabChange::kUpdated,
++                  window_id);
++}
++
++void TabEventStream::OnTabDetached(content::WebContents* contents,
++                                   int window_id,
++                                   bool reinserted) {
++  int tab_id = GetTabId(contents);
++  if (tab_id < 0) {
++    return;
++  }
++  if (reinserted) {
++    // Moving to another window or becoming hidden; the insertion (or
++    // OnHiddenTabAdded) follows.
++    RecordTabChange(tab_id, TabChange::kUpdated, window_id);
++    return;
++  }
++  live_tabs_.erase(tab_id);
++  RecordTabChange(tab_id, TabChange::kRemoved, window_id);
++}
++
++void TabEventStream::OnHiddenTabDestroyed(int tab_id) {
++  live_tabs_.erase(tab_id);
++  RecordTabChange(tab_id, TabChange::kRemoved, -1);
++  hidden_tabs_.erase(tab_id);
++}
++
++void TabEventStream::RecordTabChange(int tab_id,
++                                     TabChange change,
++                                     int window_id) {
++  auto [it, inserted] =
++      pending_tabs_.try_emplace(tab_id, PendingTab{change, window_id});
++  if (!inserted) {
++    PendingTab& pending = it->second;
++    switch (change) {
++      case TabChange::kCreated:
++        // Closed and reopened within the frame: the client still has it.
++        if (pending.change == TabChange::kRemoved) {
++          pending = {TabChange::kUpdated, -1};
++        }
++        break;
++      case TabChange::kUpdated:
++        // A pending creation already carries the latest state.
++        break;
++      case TabChange::kRemoved:
++        if (pending.change == TabChange::kCreated) {
++          // The client never saw this tab.
++          pending_tabs_.erase(it);
++        } else {
++          pending = {TabChange::kRemoved, window_id};
++        }
++        break;
++    }
++  }
++  ScheduleFlush();
++}
++
++void TabEventStream::RecordWindowChange(int window_id) {
++  pending_windows_.insert(window_id);
++  ScheduleFlush();
++}
++
++void TabEventStream::ScheduleFlush() {
++  if (!flush_timer_.IsRunning()) {
++    flush_timer_.Start(FROM_HERE, kCoalescingInterval,
++                       base::BindOnce(&TabEventStream::Flush,
++                                      base::Unretained(this)));
++  }
++}
@@ -0,0 +1,144 @@
+diff --git a/chrome/browser/devtools/protocol/tab_event_stream.h b/chrome/browser/devtools/protocol/tab_event_stream.h
+new file mode 100644
+index 0000000000000..04c5a92bd201c
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/tab_event_stream.h
+@@ -0,0 +1,138 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_DEVTOOLS_PROTOCOL_TAB_EVENT_STREAM_H_
++#define CHROME_BROWSER_DEVTOOLS_PROTOCOL_TAB_EVENT_STREAM_H_
++
++#include <map>
++#include <memory>
++
++#include "base/containers/flat_map.h"
++#include "base/containers/flat_set.h"
++#include "base/functional/callback.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/ui/browser_list_observer.h"
++#include "chrome/browser/ui/tabs/tab_strip_model_observer.h"
++
++class Browser;
++class TabStripModel;
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++// Watches every tab strip, plus the hidden tabs handed to it, and reports
++// tab and window changes as coalesced events for the Browser CDP domain.
++//
++// Changes are collected for one frame (kCoalescingInterval) and then
++// reported in a batch, so a tab that is created and navigated within a
++// frame produces a single kTabCreated, and one created and closed within a
++// frame produces nothing. Callers that need the batch right away, e.g.
++// before answering getTabs, call Flush().
++//
++// Tabs moved between windows, hidden or shown keep their tab id and are
++// reported as kTabUpdated, not as removed and created again.
++class TabEventStream : public BrowserListObserver,
++                       public TabStripModelObserver {
++ public:
++  static constexpr base::TimeDelta kCoalescingInterval =
++      base::Milliseconds(16);
++
++  enum class EventType {
++    kTabCreated,
++    kTabUpdated,
++    kTabRemoved,
++    kTabActivated,
++    kWindowChanged,
++  };
++
++  struct Event {
++    EventType type;
++    // -1 for kWindowChanged.
++    int tab_id = -1;
++    // The window the tab was removed from or activated in, or the changed
++    // window. -1 when the tab was hidden or the event carries no window.
++    int window_id = -1;
++  };
++
++  using EventCallback = base::RepeatingCallback<void(const Event&)>;
++
++  explicit TabEventStream(EventCallback callback);
++  ~TabEventStream() override;
++  TabEventStream(const TabEventStream&) = delete;
++  TabEventStream& operator=(const TabEventStream&) = delete;
++
++  // Hidden tabs live outside any tab strip, so the owner hands them over.
++  // ObserveHiddenTab() starts watching a tab the client already knows about;
++  // OnHiddenTabAdded() also reports it, for tabs just created or hidden.
++  void ObserveHiddenTab(content::WebContents* web_contents);
++  void OnHiddenTabAdded(content::WebContents* web_contents);
++
++  // Reports pending changes now instead of at the end of the frame.
++  void Flush();
++
++  // Treats |tab_id| as unknown to the client, which was told it is gone, so
++  // that it is reported as created if it shows up again.
++  void ForgetTab(int tab_id);
++
++  // BrowserListObserver:
++  void OnBrowserAdded(Browser* browser) override;
++  void OnBrowserRemoved(Browser* browser) override;
++  void OnBrowserSetLastActive(Browser* browser) override;
++  void OnBrowserNoLongerActive(Browser* browser) override;
++
++  // TabStripModelObserver:
++  void OnTabStripModelChanged(
++      TabStripModel* tab_strip_model,
++      const TabStripModelChange& change,
++      const TabStripSelectionChange& selection) override;
++  void TabChangedAt(content::WebContents* contents,
++                    int index,
++                    TabChangeType change_type) override;
++  void TabPinnedStateChanged(TabStripModel* tab_strip_model,
++                             content::WebContents* contents,
++                             int index) override;
++  void OnTabStripModelDestroyed(TabStripModel* tab_strip_model) override;
++
++ private:
++  friend class TabEventStreamTest;
++
++  class HiddenTabObserver;
++
++  enum class TabChange { kCreated, kUpdated, kRemoved };
++
++  struct PendingTab {
++    TabChange change;
++    int window_id = -1;
++  };
++
++  void ObserveTabStrip(TabStripModel* tab_strip_model, int window_id);
++  void OnTabInserted(content::WebContents* contents, int window_id);
++  void OnTabDetached(content::WebContents* contents,
++                     int window_id,
++                     bool reinserted);
++  void OnHiddenTabDestroyed(int tab_id);
++
++  void RecordTabChange(int tab_id, TabChange change, int window_id);
++  void RecordWindowChange(int window_id);
++  void ScheduleFlush();
++
++  EventCallback callback_;
++
++  // Window id of every observed tab strip.
++  base::flat_map<TabStripModel*, int> window_ids_;
++  // Tabs the client already knows about, so reinsertion is not creation.
++  base::flat_set<int> live_tabs_;
++  std::map<int, std::unique_ptr<HiddenTabObserver>> hidden_tabs_;
++
++  // Ordered by tab id, so new tabs are reported in creation order.
++  std::map<int, PendingTab> pending_tabs_;
++  // Newly active tab per window.
++  base::flat_map<int, int> pending_activations_;
++  base::flat_set<int> pending_windows_;
++  base::OneShotTimer flush_timer_;
++};
++
++#endif  // CHROME_BROWSER_DEVTOOLS_PROTOCOL_TAB_EVENT_STREAM_H_
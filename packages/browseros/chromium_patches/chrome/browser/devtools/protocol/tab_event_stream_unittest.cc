@@ -0,0 +1,176 @@
+diff --git a/chrome/browser/devtools/protocol/tab_event_stream_unittest.cc b/chrome/browser/devtools/protocol/tab_event_stream_unittest.cc
+new file mode 100644
+index 0000000000000..c9f58a28706ff
+--- /dev/null
++++ b/chrome/browser/devtools/protocol/tab_event_stream_unittest.cc
+@@ -0,0 +1,170 @@
++// Copyright 2026 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/devtools/protocol/tab_event_stream.h"
++
++#include <memory>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "chrome/browser/ui/browser.h"
++#include "chrome/browser/ui/tabs/tab_enums.h"
++#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "chrome/test/base/browser_with_test_window_test.h"
++#include "components/sessions/content/session_tab_helper.h"
++#include "content/public/browser/web_contents.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "url/gurl.h"
++
++using EventType = TabEventStream::EventType;
++
++class TabEventStreamTest : public BrowserWithTestWindowTest {
++ protected:
++  TabEventStreamTest()
++      : BrowserWithTestWindowTest(
++            base::test::TaskEnvironment::TimeSource::MOCK_TIME) {}
++
++  void SetUp() override {
++    BrowserWithTestWindowTest::SetUp();
++    AddTab(browser(), GURL("about:blank"));
++    stream_ = std::make_unique<TabEventStream>(base::BindRepeating(
++        &TabEventStreamTest::OnEvent, base::Unretained(this)));
++  }
++
++  void TearDown() override {
++    stream_.reset();
++    BrowserWithTestWindowTest::TearDown();
++  }
++
++  TabEventStream* stream() { return stream_.get(); }
++
++  TabStripModel* tab_strip() { return browser()->tab_strip_model(); }
++
++  int window_id() { return browser()->session_id().id(); }
++
++  static int GetTabId(content::WebContents* web_contents) {
++    return sessions::SessionTabHelper::IdForTab(web_contents).id();
++  }
++
++  // Records changes the way the stream's observers would, for sequences no
++  // real tab goes through within one frame.
++  void RecordRemoved(int tab_id) {
++    stream_->RecordTabChange(tab_id, TabEventStream::TabChange::kRemoved,
++                             window_id());
++  }
++  void RecordCreated(int tab_id) {
++    stream_->RecordTabChange(tab_id, TabEventStream::TabChange::kCreated,
++                             window_id());
++  }
++
++  // Returns the tab events reported so far, leaving out window changes.
++  std::vector<TabEventStream::Event> TakeTabEvents() {
++    std::vector<TabEventStream::Event> events;
++    events.swap(events_);
++    return events;
++  }
++
++  std::vector<TabEventStream::Event> FlushTabEvents() {
++    stream_->Flush();
++    return TakeTabEvents();
++  }
++
++ private:
++  void OnEvent(const TabEventStream::Event& event) {
++    if (event.type != EventType::kWindowChanged) {
++      events_.push_back(event);
++    }
++  }
++
++  std::unique_ptr<TabEventStream> stream_;
++  std::vector<TabEventStream::Event> events_;
++};
++
++TEST_F(TabEventStreamTest, ReportsAtEndOfFrame) {
++  AddTab(browser(), GURL("about:blank"));
++  int tab_id = GetTabId(tab_strip()->GetWebContentsAt(0));
++  EXPECT_TRUE(TakeTabEvents().empty());
++
++  task_environment()->FastForwardBy(TabEventStream::kCoalescingInterval);
++  std::vector<TabEventStream::Event> events = TakeTabEvents();
++  ASSERT_EQ(2u, events.size());
++  EXPECT_EQ(EventType::kTabCreated, events[0].type);
++  EXPECT_EQ(tab_id, events[0].tab_id);
++  EXPECT_EQ(EventType::kTabActivated, events[1].type);
++  EXPECT_EQ(tab_id, events[1].tab_id);
++  EXPECT_EQ(window_id(), events[1].window_id);
++}
++
++TEST_F(TabEventStreamTest, CreatedAndClosedWithinFrameCancelOut) {
++  AddTab(browser(), GURL("about:blank"));
++  tab_strip()->CloseWebContentsAt(0, TabCloseTypes::CLOSE_NONE);
++
++  // Only the reactivation of the tab that was there before is left.
++  std::vector<TabEventStream::Event> events = FlushTabEvents();
++  ASSERT_EQ(1u, events.size());
++  EXPECT_EQ(EventType::kTabActivated, events[0].type);
++  EXPECT_EQ(GetTabId(tab_strip()->GetWebContentsAt(0)), events[0].tab_id);
++}
++
++TEST_F(TabEventStreamTest, ClosedAndReopenedWithinFrameIsUpdate) {
++  int tab_id = GetTabId(tab_strip()->GetWebContentsAt(0));
++  RecordRemoved(tab_id);
++  RecordCreated(tab_id);
++
++  std::vector<TabEventStream::Event> events = FlushTabEvents();
++  ASSERT_EQ(1u, events.size());
++  EXPECT_EQ(EventType::kTabUpdated, events[0].type);
++  EXPECT_EQ(tab_id, events[0].tab_id);
++}
++
++TEST_F(TabEventStreamTest, ActivationOfClosedTabIsDropped) {
++  AddTab(browser(), GURL("about:blank"));
++  FlushTabEvents();
++
++  // Each close activates the next tab, until the last one closes.
++  tab_strip()->ActivateTabAt(1);
++  tab_strip()->CloseAllTabs();
++
++  std::vector<TabEventStream::Event> events = FlushTabEvents();
++  ASSERT_EQ(2u, events.size());
++  for (const auto& event : events) {
++    EXPECT_EQ(EventType::kTabRemoved, event.type);
++    EXPECT_EQ(window_id(), event.window_id);
++  }
++}
++
++TEST_F(TabEventStreamTest, HiddenTabKeepsItsId) {
++  int tab_id = GetTabId(tab_strip()->GetWebContentsAt(0));
++  std::unique_ptr<content::WebContents> hidden =
++      tab_strip()->DetachWebContentsAtForInsertion(0);
++  stream()->OnHiddenTabAdded(hidden.get());
++
++  std::vector<TabEventStream::Event> events = FlushTabEvents();
++  ASSERT_EQ(1u, events.size());
++  EXPECT_EQ(EventType::kTabUpdated, events[0].type);
++  EXPECT_EQ(tab_id, events[0].tab_id);
++
++  hidden.reset();
++  events = FlushTabEvents();
++  ASSERT_EQ(1u, events.size());
++  EXPECT_EQ(EventType::kTabRemoved, events[0].type);
++  EXPECT_EQ(tab_id, events[0].tab_id);
++  EXPECT_EQ(-1, events[0].window_id);
++}
++
++TEST_F(TabEventStreamTest, ForgottenTabIsCreatedWhenShown) {
++  int tab_id = GetTabId(tab_strip()->GetWebContentsAt(0));
++  // Hidden by another session, which keeps it to itself.
++  std::unique_ptr<content::WebContents> hidden =
++      tab_strip()->DetachWebContentsAtForInsertion(0);
++  FlushTabEvents();
++  stream()->ForgetTab(tab_id);
++
++  tab_strip()->InsertWebContentsAt(0, std::move(hidden),
++                                   AddTabTypes::ADD_ACTIVE);
++  std::vector<TabEventStream::Event> events = FlushTabEvents();
++  ASSERT_FALSE(events.empty());
++  EXPECT_EQ(EventType::kTabCreated, events[0].type);
++  EXPECT_EQ(tab_id, events[0].tab_id);
++}
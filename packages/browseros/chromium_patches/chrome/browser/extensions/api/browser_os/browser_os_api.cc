@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.cc b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
 new file mode 100644
-index 0000000000000..832e8d5471a78
+index 0000000000000..415c9ab59b78a
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
-@@ -0,0 +1,1445 @@
+@@ -0,0 +1,1556 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -32,9 +32,11 @@ index 0000000000000..832e8d5471a78
 +#include "base/strings/string_number_conversions.h"
 +#include "base/base64.h"
 +#include "base/time/time.h"
++#include "base/trace_event/trace_event.h"
 +#include "base/values.h"
 +#include "base/version_info/version_info.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/browseros/metrics/browseros_perf_stats.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
@@ -273,6 +275,36 @@ index 0000000000000..832e8d5471a78
 +
 +}  // namespace
 +
++// BrowserOSExtensionFunction
++BrowserOSExtensionFunction::BrowserOSExtensionFunction() = default;
++
++BrowserOSExtensionFunction::~BrowserOSExtensionFunction() = default;
++
++void BrowserOSExtensionFunction::SetRequestId(
++    const std::optional<std::string>& request_id) {
++  request_id_ = request_id;
++  if (request_id_) {
++    VLOG(1) << "[browseros] " << name() << " for request " << *request_id_;
++  }
++}
++
++void BrowserOSExtensionFunction::OnResponded() {
++  ExtensionFunction::OnResponded();
++  const base::TimeDelta latency = base::TimeTicks::Now() - start_;
++  // One slice per call, from dispatch to response, on its own track.
++  const auto track = perfetto::Track::FromPointer(this);
++  TRACE_EVENT_BEGIN("browseros", perfetto::DynamicString(name()), track,
++                    start_, "request_id", request_id_.value_or(""));
++  TRACE_EVENT_END("browseros", track);
++  browseros_metrics::BrowserOSPerfStats::GetInstance()->Record(
++      browseros_metrics::BrowserOSPerfStats::Surface::kExtensionFunction,
++      name(), latency);
++  if (request_id_) {
++    VLOG(1) << "[browseros] " << name() << " for request " << *request_id_
++            << " responded in " << latency.InMilliseconds() << " ms";
++  }
++}
++
 +// Static member initialization
 +uint32_t BrowserOSGetInteractiveSnapshotFunction::next_snapshot_id_ = 1;
 +
@@ -304,6 +336,8 @@ index 0000000000000..832e8d5471a78
 +
 +  // Request accessibility tree snapshot
 +  // Use WebContents with extended properties to get a full tree
++  TRACE_EVENT_INSTANT("browseros", "RequestAXTreeSnapshot",
++                      perfetto::Flow::FromPointer(this));
 +  web_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(
 +          &BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeReceived,
@@ -319,6 +353,11 @@ index 0000000000000..832e8d5471a78
 +
 +void BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeReceived(
 +    ui::AXTreeUpdate& tree_update) {
++  TRACE_EVENT("browseros",
++              "BrowserOSGetAccessibilityTreeFunction::"
++              "OnAccessibilityTreeReceived",
++              perfetto::TerminatingFlow::FromPointer(this), "nodes",
++              tree_update.nodes.size());
 +  browser_os::AccessibilityTree result;
 +  result.root_id = tree_update.root_id;
 +
@@ -345,6 +384,9 @@ index 0000000000000..832e8d5471a78
 +  std::optional<browser_os::GetInteractiveSnapshot::Params> params =
 +      browser_os::GetInteractiveSnapshot::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSGetInteractiveSnapshotFunction::Run",
++              "request_id", request_id().value_or(""));
 +
 +  // Get the target tab
 +  std::string error_message;
@@ -374,11 +416,14 @@ index 0000000000000..832e8d5471a78
 +    empty_snapshot.snapshot_id = next_snapshot_id_++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
++    empty_snapshot.request_id = request_id();
 +    return RespondNow(ArgumentList(
 +        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
 +  }
 +  
 +  // Request accessibility tree snapshot
++  TRACE_EVENT_INSTANT("browseros", "RequestAXTreeSnapshot",
++                      perfetto::Flow::FromPointer(this));
 +  web_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnAccessibilityTreeReceived,
@@ -395,6 +440,12 @@ index 0000000000000..832e8d5471a78
 +
 +void BrowserOSGetInteractiveSnapshotFunction::OnAccessibilityTreeReceived(
 +    ui::AXTreeUpdate& tree_update) {
++  // The flow continues through SnapshotProcessor to OnSnapshotProcessed.
++  TRACE_EVENT("browseros",
++              "BrowserOSGetInteractiveSnapshotFunction::"
++              "OnAccessibilityTreeReceived",
++              perfetto::Flow::FromPointer(this), "nodes",
++              tree_update.nodes.size());
 +  // Double-check frame is still valid before processing
 +  if (!web_contents_) {
 +    LOG(WARNING) << "[browseros] WebContents gone during AX snapshot callback";
@@ -402,6 +453,7 @@ index 0000000000000..832e8d5471a78
 +    empty_snapshot.snapshot_id = next_snapshot_id_++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
++    empty_snapshot.request_id = request_id();
 +    Respond(ArgumentList(
 +        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
 +    return;
@@ -414,6 +466,7 @@ index 0000000000000..832e8d5471a78
 +    empty_snapshot.snapshot_id = next_snapshot_id_++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
++    empty_snapshot.request_id = request_id();
 +    Respond(ArgumentList(
 +        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
 +    return;
@@ -432,6 +485,10 @@ index 0000000000000..832e8d5471a78
 +
 +void BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed(
 +    SnapshotProcessingResult result) {
++  TRACE_EVENT("browseros",
++              "BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed",
++              perfetto::TerminatingFlow::FromPointer(this));
++  result.snapshot.request_id = request_id();
 +  Respond(ArgumentList(
 +      browser_os::GetInteractiveSnapshot::Results::Create(result.snapshot)));
 +}
@@ -442,6 +499,9 @@ index 0000000000000..832e8d5471a78
 +  std::optional<browser_os::Click::Params> params =
 +      browser_os::Click::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSClickFunction::Run", "request_id",
++              request_id().value_or(""));
 +
 +  // Get the target tab
 +  std::string error_message;
@@ -474,6 +534,7 @@ index 0000000000000..832e8d5471a78
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
 +  response.success = change_detected;
++  response.request_id = request_id();
 +  
 +  return RespondNow(ArgumentList(
 +      browser_os::Click::Results::Create(response)));
@@ -485,6 +546,9 @@ index 0000000000000..832e8d5471a78
 +  std::optional<browser_os::InputText::Params> params =
 +      browser_os::InputText::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSInputTextFunction::Run", "request_id",
++              request_id().value_or(""));
 +
 +  // Get the target tab
 +  std::string error_message;
@@ -523,6 +587,7 @@ index 0000000000000..832e8d5471a78
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
 +  response.success = change_detected;
++  response.request_id = request_id();
 +  
 +  return RespondNow(ArgumentList(
 +      browser_os::InputText::Results::Create(response)));
@@ -534,6 +599,9 @@ index 0000000000000..832e8d5471a78
 +  std::optional<browser_os::Clear::Params> params =
 +      browser_os::Clear::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSClearFunction::Run", "request_id",
++              request_id().value_or(""));
 +
 +  // Get the target tab
 +  std::string error_message;
@@ -572,6 +640,7 @@ index 0000000000000..832e8d5471a78
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
 +  response.success = change_detected;
++  response.request_id = request_id();
 +  
 +  return RespondNow(ArgumentList(
 +      browser_os::Clear::Results::Create(response)));
@@ -787,6 +856,9 @@ index 0000000000000..832e8d5471a78
 +  std::optional<browser_os::SendKeys::Params> params =
 +      browser_os::SendKeys::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSSendKeysFunction::Run", "request_id",
++              request_id().value_or(""));
 +
 +  // Get the target tab
 +  std::string error_message;
@@ -822,6 +894,7 @@ index 0000000000000..832e8d5471a78
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
 +  response.success = change_detected;
++  response.request_id = request_id();
 +  
 +  return RespondNow(ArgumentList(
 +      browser_os::SendKeys::Results::Create(response)));
@@ -1026,6 +1099,9 @@ index 0000000000000..832e8d5471a78
 +ExtensionFunction::ResponseAction BrowserOSGetSnapshotFunction::Run() {
 +  auto params = browser_os::GetSnapshot::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSGetSnapshotFunction::Run", "request_id",
++              request_id().value_or(""));
 +  
 +  // Get the target tab
 +  std::string error_message;
@@ -1039,6 +1115,8 @@ index 0000000000000..832e8d5471a78
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  
 +  // Request accessibility tree snapshot
++  TRACE_EVENT_INSTANT("browseros", "RequestAXTreeSnapshot",
++                      perfetto::Flow::FromPointer(this));
 +  web_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(&BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived,
 +                     this),
@@ -1052,6 +1130,10 @@ index 0000000000000..832e8d5471a78
 +
 +void BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived(
 +    ui::AXTreeUpdate& tree_update) {
++  TRACE_EVENT("browseros",
++              "BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived",
++              perfetto::TerminatingFlow::FromPointer(this), "nodes",
++              tree_update.nodes.size());
 +  if (!has_callback()) {
 +    return;
 +  }
@@ -1066,6 +1148,7 @@ index 0000000000000..832e8d5471a78
 +  result.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +  result.processing_time_ms =
 +      (base::Time::Now() - start_time).InMilliseconds();
++  result.request_id = request_id();
 +
 +  Respond(ArgumentList(browser_os::GetSnapshot::Results::Create(result)));
 +}
@@ -1271,6 +1354,9 @@ index 0000000000000..832e8d5471a78
 +  std::optional<browser_os::ClickCoordinates::Params> params =
 +      browser_os::ClickCoordinates::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSClickCoordinatesFunction::Run",
++              "request_id", request_id().value_or(""));
 +
 +  // Get the target tab
 +  std::string error_message;
@@ -1281,6 +1367,7 @@ index 0000000000000..832e8d5471a78
 +    LOG(ERROR) << "[browseros] ClickCoordinates: " << error_message;
 +    browser_os::InteractionResponse response;
 +    response.success = false;
++    response.request_id = request_id();
 +    return RespondNow(ArgumentList(
 +        browser_os::ClickCoordinates::Results::Create(response)));
 +  }
@@ -1299,6 +1386,7 @@ index 0000000000000..832e8d5471a78
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
 +  response.success = success;
++  response.request_id = request_id();
 +  
 +  LOG(INFO) << "[browseros] ClickCoordinates: Result = " 
 +            << (success ? "success" : "no change detected");
@@ -1312,6 +1400,9 @@ index 0000000000000..832e8d5471a78
 +  std::optional<browser_os::TypeAtCoordinates::Params> params =
 +      browser_os::TypeAtCoordinates::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
++  SetRequestId(params->request_id);
++  TRACE_EVENT("browseros", "BrowserOSTypeAtCoordinatesFunction::Run",
++              "request_id", request_id().value_or(""));
 +
 +  // Get the target tab
 +  std::string error_message;
@@ -1322,6 +1413,7 @@ index 0000000000000..832e8d5471a78
 +    LOG(ERROR) << "[browseros] TypeAtCoordinates: " << error_message;
 +    browser_os::InteractionResponse response;
 +    response.success = false;
++    response.request_id = request_id();
 +    return RespondNow(ArgumentList(
 +        browser_os::TypeAtCoordinates::Results::Create(response)));
 +  }
@@ -1340,6 +1432,7 @@ index 0000000000000..832e8d5471a78
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
 +  response.success = success;
++  response.request_id = request_id();
 +  
 +  LOG(INFO) << "[browseros] TypeAtCoordinates: Result = " 
 +            << (success ? "success" : "failed");
@@ -1447,5 +1540,23 @@ index 0000000000000..832e8d5471a78
 +  Release();
 +}
 +
++// BrowserOSGetPerfStatsFunction
++ExtensionFunction::ResponseAction BrowserOSGetPerfStatsFunction::Run() {
++  std::vector<browser_os::PerfStat> stats;
++  for (const auto& call :
++       browseros_metrics::BrowserOSPerfStats::GetInstance()->GetCallStats()) {
++    browser_os::PerfStat stat;
++    stat.name = call.name;
++    stat.count = static_cast<double>(call.count);
++    stat.p50_ms = call.p50.InMillisecondsF();
++    stat.p95_ms = call.p95.InMillisecondsF();
++    stat.p99_ms = call.p99.InMillisecondsF();
++    stat.max_ms = call.max.InMillisecondsF();
++    stats.push_back(std::move(stat));
++  }
++  return RespondNow(
++      ArgumentList(browser_os::GetPerfStats::Results::Create(stats)));
++}
++
 +}  // namespace api
 +}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.h b/chrome/browser/extensions/api/browser_os/browser_os_api.h
 new file mode 100644
-index 0000000000000..53ece24723da0
+index 0000000000000..263d9b2ac28a9
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.h
-@@ -0,0 +1,371 @@
+@@ -0,0 +1,417 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,8 +12,11 @@ index 0000000000000..53ece24723da0
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_H_
 +
 +#include <cstdint>
++#include <optional>
++#include <string>
 +
 +#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
 +#include "base/values.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
@@ -35,8 +38,30 @@ index 0000000000000..53ece24723da0
 +namespace extensions {
 +namespace api {
 +
++// Base for browserOS.* functions. Records each call's latency, from dispatch
++// to response, with browseros_metrics::BrowserOSPerfStats.
++class BrowserOSExtensionFunction : public ExtensionFunction {
++ protected:
++  BrowserOSExtensionFunction();
++  ~BrowserOSExtensionFunction() override;
++
++  // ExtensionFunction:
++  void OnResponded() override;
 +
-+class BrowserOSGetAccessibilityTreeFunction : public ExtensionFunction {
++  // Records the correlation id of the MCP request behind this call, which
++  // the sidecar passes along from the proxy. It is echoed in results and
++  // attached to the call's logs and trace events.
++  void SetRequestId(const std::optional<std::string>& request_id);
++  const std::optional<std::string>& request_id() const { return request_id_; }
++
++ private:
++  // The dispatcher creates a function just before running it.
++  const base::TimeTicks start_ = base::TimeTicks::Now();
++  std::optional<std::string> request_id_;
++};
++
++class BrowserOSGetAccessibilityTreeFunction
++    : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.getAccessibilityTree",
 +                             BROWSER_OS_GETACCESSIBILITYTREE)
@@ -53,7 +78,8 @@ index 0000000000000..53ece24723da0
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
 +};
 +
-+class BrowserOSGetInteractiveSnapshotFunction : public ExtensionFunction {
++class BrowserOSGetInteractiveSnapshotFunction
++    : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.getInteractiveSnapshot",
 +                             BROWSER_OS_GETINTERACTIVESNAPSHOT)
@@ -69,18 +95,18 @@ index 0000000000000..53ece24723da0
 + private:
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
 +  void OnSnapshotProcessed(SnapshotProcessingResult result);
-+  
++
 +  // Counter for snapshot IDs
 +  static uint32_t next_snapshot_id_;
-+  
++
 +  // Tab ID for storing mappings
 +  int tab_id_ = -1;
-+  
++
 +  // Web contents for processing and drawing
 +  base::WeakPtr<content::WebContents> web_contents_;
 +};
 +
-+class BrowserOSClickFunction : public ExtensionFunction {
++class BrowserOSClickFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.click", BROWSER_OS_CLICK)
 +
@@ -93,7 +119,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSInputTextFunction : public ExtensionFunction {
++class BrowserOSInputTextFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.inputText", BROWSER_OS_INPUTTEXT)
 +
@@ -106,7 +132,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSClearFunction : public ExtensionFunction {
++class BrowserOSClearFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.clear", BROWSER_OS_CLEAR)
 +
@@ -119,9 +145,9 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSGetPageLoadStatusFunction : public ExtensionFunction {
++class BrowserOSGetPageLoadStatusFunction : public BrowserOSExtensionFunction {
 + public:
-+  DECLARE_EXTENSION_FUNCTION("browserOS.getPageLoadStatus", 
++  DECLARE_EXTENSION_FUNCTION("browserOS.getPageLoadStatus",
 +                             BROWSER_OS_GETPAGELOADSTATUS)
 +
 +  BrowserOSGetPageLoadStatusFunction() = default;
@@ -133,7 +159,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSScrollUpFunction : public ExtensionFunction {
++class BrowserOSScrollUpFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.scrollUp", BROWSER_OS_SCROLLUP)
 +
@@ -146,7 +172,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSScrollDownFunction : public ExtensionFunction {
++class BrowserOSScrollDownFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.scrollDown", BROWSER_OS_SCROLLDOWN)
 +
@@ -159,7 +185,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSScrollToNodeFunction : public ExtensionFunction {
++class BrowserOSScrollToNodeFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.scrollToNode", BROWSER_OS_SCROLLTONODE)
 +
@@ -172,7 +198,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSSendKeysFunction : public ExtensionFunction {
++class BrowserOSSendKeysFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.sendKeys", BROWSER_OS_SENDKEYS)
 +
@@ -185,9 +211,10 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSCaptureScreenshotFunction : public ExtensionFunction {
++class BrowserOSCaptureScreenshotFunction : public BrowserOSExtensionFunction {
 + public:
-+  DECLARE_EXTENSION_FUNCTION("browserOS.captureScreenshot", BROWSER_OS_CAPTURESCREENSHOT)
++  DECLARE_EXTENSION_FUNCTION("browserOS.captureScreenshot",
++                             BROWSER_OS_CAPTURESCREENSHOT)
 +
 +  BrowserOSCaptureScreenshotFunction();
 +
@@ -196,12 +223,12 @@ index 0000000000000..53ece24723da0
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
-+  
++
 + private:
 +  void DrawHighlightsAndCapture();
 +  void CaptureScreenshotNow();
 +  void OnScreenshotCaptured(const content::CopyFromSurfaceResult& result);
-+  
++
 +  // Store web contents and tab id for highlight operations
 +  base::WeakPtr<content::WebContents> web_contents_;
 +  int tab_id_ = -1;
@@ -210,7 +237,7 @@ index 0000000000000..53ece24723da0
 +  bool use_exact_dimensions_ = false;
 +};
 +
-+class BrowserOSGetSnapshotFunction : public ExtensionFunction {
++class BrowserOSGetSnapshotFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.getSnapshot", BROWSER_OS_GETSNAPSHOT)
 +
@@ -227,7 +254,7 @@ index 0000000000000..53ece24723da0
 +};
 +
 +// Settings API functions
-+class BrowserOSGetPrefFunction : public ExtensionFunction {
++class BrowserOSGetPrefFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.getPref", BROWSER_OS_GETPREF)
 +
@@ -240,7 +267,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSSetPrefFunction : public ExtensionFunction {
++class BrowserOSSetPrefFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.setPref", BROWSER_OS_SETPREF)
 +
@@ -253,7 +280,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSGetAllPrefsFunction : public ExtensionFunction {
++class BrowserOSGetAllPrefsFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.getAllPrefs", BROWSER_OS_GETALLPREFS)
 +
@@ -266,7 +293,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSLogMetricFunction : public ExtensionFunction {
++class BrowserOSLogMetricFunction : public BrowserOSExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.logMetric", BROWSER_OS_LOGMETRIC)
 +
@@ -279,9 +306,10 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSGetVersionNumberFunction : public ExtensionFunction {
++class BrowserOSGetVersionNumberFunction : public BrowserOSExtensionFunction {
 + public:
-+  DECLARE_EXTENSION_FUNCTION("browserOS.getVersionNumber", BROWSER_OS_GETVERSIONNUMBER)
++  DECLARE_EXTENSION_FUNCTION("browserOS.getVersionNumber",
++                             BROWSER_OS_GETVERSIONNUMBER)
 +
 +  BrowserOSGetVersionNumberFunction() = default;
 +
@@ -292,9 +320,11 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSGetBrowserosVersionNumberFunction : public ExtensionFunction {
++class BrowserOSGetBrowserosVersionNumberFunction
++    : public BrowserOSExtensionFunction {
 + public:
-+  DECLARE_EXTENSION_FUNCTION("browserOS.getBrowserosVersionNumber", BROWSER_OS_GETBROWSEROSVERSIONNUMBER)
++  DECLARE_EXTENSION_FUNCTION("browserOS.getBrowserosVersionNumber",
++                             BROWSER_OS_GETBROWSEROSVERSIONNUMBER)
 +
 +  BrowserOSGetBrowserosVersionNumberFunction() = default;
 +
@@ -305,9 +335,10 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSExecuteJavaScriptFunction : public ExtensionFunction {
++class BrowserOSExecuteJavaScriptFunction : public BrowserOSExtensionFunction {
 + public:
-+  DECLARE_EXTENSION_FUNCTION("browserOS.executeJavaScript", BROWSER_OS_EXECUTEJAVASCRIPT)
++  DECLARE_EXTENSION_FUNCTION("browserOS.executeJavaScript",
++                             BROWSER_OS_EXECUTEJAVASCRIPT)
 +
 +  BrowserOSExecuteJavaScriptFunction() = default;
 +
@@ -316,14 +347,15 @@ index 0000000000000..53ece24723da0
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
-+  
++
 + private:
 +  void OnJavaScriptExecuted(base::Value result);
 +};
 +
-+class BrowserOSClickCoordinatesFunction : public ExtensionFunction {
++class BrowserOSClickCoordinatesFunction : public BrowserOSExtensionFunction {
 + public:
-+  DECLARE_EXTENSION_FUNCTION("browserOS.clickCoordinates", BROWSER_OS_CLICKCOORDINATES)
++  DECLARE_EXTENSION_FUNCTION("browserOS.clickCoordinates",
++                             BROWSER_OS_CLICKCOORDINATES)
 +
 +  BrowserOSClickCoordinatesFunction() = default;
 +
@@ -334,9 +366,10 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSTypeAtCoordinatesFunction : public ExtensionFunction {
++class BrowserOSTypeAtCoordinatesFunction : public BrowserOSExtensionFunction {
 + public:
-+  DECLARE_EXTENSION_FUNCTION("browserOS.typeAtCoordinates", BROWSER_OS_TYPEATCOORDINATES)
++  DECLARE_EXTENSION_FUNCTION("browserOS.typeAtCoordinates",
++                             BROWSER_OS_TYPEATCOORDINATES)
 +
 +  BrowserOSTypeAtCoordinatesFunction() = default;
 +
@@ -347,7 +380,7 @@ index 0000000000000..53ece24723da0
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSChoosePathFunction : public ExtensionFunction,
++class BrowserOSChoosePathFunction : public BrowserOSExtensionFunction,
 +                                    public ui::SelectFileDialog::Listener {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.choosePath", BROWSER_OS_CHOOSEPATH)
@@ -371,6 +404,19 @@ index 0000000000000..53ece24723da0
 +  scoped_refptr<ui::SelectFileDialog> select_file_dialog_;
 +};
 +
++class BrowserOSGetPerfStatsFunction : public BrowserOSExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getPerfStats", BROWSER_OS_GETPERFSTATS)
++
++  BrowserOSGetPerfStatsFunction() = default;
++
++ protected:
++  ~BrowserOSGetPerfStatsFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
 +}  // namespace api
 +}  // namespace extensions
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
 new file mode 100644
-index 0000000000000..f40a2424641e1
+index 0000000000000..402965115bc63
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
-@@ -0,0 +1,1073 @@
+@@ -0,0 +1,1083 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,6 +14,7 @@ index 0000000000000..f40a2424641e1
 +#include "base/strings/stringprintf.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/task/sequenced_task_runner.h"
++#include "base/trace_event/trace_event.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
 +#include "components/input/native_web_keyboard_event.h"
@@ -622,6 +623,8 @@ index 0000000000000..f40a2424641e1
 +// Helper to perform a click with change detection and retrying
 +bool ClickWithDetection(content::WebContents* web_contents,
 +                        const NodeInfo& node_info) {
++  TRACE_EVENT("browseros", "ClickWithDetection", "ax_node_id",
++              node_info.ax_node_id);
 +  // Check if node is out of viewport and needs scrolling
 +  auto viewport_it = node_info.attributes.find("in_viewport");
 +  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
@@ -710,6 +713,8 @@ index 0000000000000..f40a2424641e1
 +bool TypeWithDetection(content::WebContents* web_contents,
 +                      const NodeInfo& node_info,
 +                      const std::string& text) {
++  TRACE_EVENT("browseros", "TypeWithDetection", "ax_node_id",
++              node_info.ax_node_id);
 +  // Check if node is out of viewport and needs scrolling
 +  auto viewport_it = node_info.attributes.find("in_viewport");
 +  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
@@ -764,6 +769,8 @@ index 0000000000000..f40a2424641e1
 +// Helper to clear an input field with change detection
 +bool ClearWithDetection(content::WebContents* web_contents,
 +                       const NodeInfo& node_info) {
++  TRACE_EVENT("browseros", "ClearWithDetection", "ax_node_id",
++              node_info.ax_node_id);
 +  // Use change detection with JavaScript clear
 +  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
 +      web_contents,
@@ -801,6 +808,7 @@ index 0000000000000..f40a2424641e1
 +// Helper to send a key press with change detection
 +bool KeyPressWithDetection(content::WebContents* web_contents,
 +                          const std::string& key) {
++  TRACE_EVENT("browseros", "KeyPressWithDetection", "key", key);
 +  // Use change detection with key press
 +  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
 +      web_contents,
@@ -995,6 +1003,7 @@ index 0000000000000..f40a2424641e1
 +// Helper to click at specific coordinates with change detection
 +bool ClickCoordinatesWithDetection(content::WebContents* web_contents,
 +                                   const gfx::PointF& point) {
++  TRACE_EVENT("browseros", "ClickCoordinatesWithDetection");
 +  LOG(INFO) << "[browseros] ClickCoordinatesWithDetection at (" 
 +            << point.x() << ", " << point.y() << ")";
 +  
@@ -1015,6 +1024,7 @@ index 0000000000000..f40a2424641e1
 +bool TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
 +                                    const gfx::PointF& point,
 +                                    const std::string& text) {
++  TRACE_EVENT("browseros", "TypeAtCoordinatesWithDetection");
 +  LOG(INFO) << "[browseros] TypeAtCoordinatesWithDetection at (" 
 +            << point.x() << ", " << point.y() << ") with text: " << text;
 +  
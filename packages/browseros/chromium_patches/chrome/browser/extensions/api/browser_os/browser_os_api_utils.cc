@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
 new file mode 100644
-index 0000000000000..0c3a060fc70de
+index 0000000000000..23d279aa0d5ca
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
-@@ -0,0 +1,167 @@
+@@ -0,0 +1,178 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,8 +14,10 @@ index 0000000000000..0c3a060fc70de
 +#include "base/no_destructor.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/browseros/core/browseros_tab_registry.h"
++#include "chrome/browser/devtools/protocol/hidden_tab_governor.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
-+#include "chrome/browser/extensions/window_controller.h"
++#include "chrome/browser/profiles/profile.h"
 +#include "chrome/browser/ui/browser.h"
 +#include "chrome/browser/ui/browser_finder.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
@@ -51,18 +53,27 @@ index 0000000000000..0c3a060fc70de
 +  int tab_id = -1;
 +  
 +  if (tab_id_param) {
-+    // Get specific tab by ID
-+    WindowController* controller = nullptr;
-+    int tab_index = -1;
-+    if (!ExtensionTabUtil::GetTabById(*tab_id_param, browser_context,
-+                                      include_incognito_information,
-+                                      &controller, &web_contents,
-+                                      &tab_index)) {
++    // Get specific tab by ID. The registry also covers hidden tabs, so apply
++    // the same profile rules as ExtensionTabUtil::GetTabById.
++    web_contents = browseros::BrowserOSTabRegistry::GetInstance()->FindByTabId(
++        *tab_id_param);
++    Profile* profile = Profile::FromBrowserContext(browser_context);
++    Profile* tab_profile =
++        web_contents
++            ? Profile::FromBrowserContext(web_contents->GetBrowserContext())
++            : nullptr;
++    if (!tab_profile ||
++        (tab_profile != profile &&
++         !(include_incognito_information &&
++           profile->IsSameOrParent(tab_profile)))) {
 +      if (error_message) {
 +        *error_message = "Tab not found";
 +      }
 +      return std::nullopt;
 +    }
++    // Agents drive hidden tabs through this API too; that is use, and a
++    // frozen or discarded tab has to come back before it can be acted on.
++    HiddenTabGovernor::GetInstance()->Touch(web_contents);
 +    tab_id = *tab_id_param;
 +  } else {
 +    // Get active tab
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
 new file mode 100644
-index 0000000000000..ea45bebcce461
+index 0000000000000..c39ef2688b943
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
-@@ -0,0 +1,205 @@
+@@ -0,0 +1,215 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,6 +13,7 @@ index 0000000000000..ea45bebcce461
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/run_loop.h"
++#include "base/trace_event/trace_event.h"
 +#include "content/public/browser/focused_node_details.h"
 +#include "content/public/browser/navigation_handle.h"
 +#include "content/public/browser/render_frame_host.h"
@@ -57,10 +58,14 @@ index 0000000000000..ea45bebcce461
 +
 +bool BrowserOSChangeDetector::ExecuteAndWait(std::function<void()> action,
 +                                             base::TimeDelta timeout) {
++  TRACE_EVENT("browseros", "BrowserOSChangeDetector::ExecuteAndWait");
 +  StartMonitoring();
 +  
 +  // Execute the action
-+  action();
++  {
++    TRACE_EVENT("browseros", "BrowserOSChangeDetector::Action");
++    action();
++  }
 +  
 +  // If change already detected (synchronously), return immediately
 +  if (change_detected_) {
@@ -86,6 +91,8 @@ index 0000000000000..ea45bebcce461
 +  monitoring_ = false;
 +  
 +  VLOG(1) << "[browseros] Change detection result: " << change_detected_;
++  TRACE_EVENT_INSTANT("browseros", "BrowserOSChangeDetector::Result",
++                      "changed", change_detected_);
 +  return change_detected_;
 +}
 +
@@ -93,6 +100,7 @@ index 0000000000000..ea45bebcce461
 +    std::function<void()> action,
 +    base::OnceCallback<void(bool)> callback,
 +    base::TimeDelta timeout) {
++  TRACE_EVENT("browseros", "BrowserOSChangeDetector::ExecuteAndNotify");
 +  StartMonitoring();
 +  result_callback_ = std::move(callback);
 +  
@@ -123,6 +131,7 @@ index 0000000000000..ea45bebcce461
 +  monitoring_ = false;
 +  
 +  VLOG(1) << "[browseros] Change detected";
++  TRACE_EVENT_INSTANT("browseros", "BrowserOSChangeDetector::ChangeDetected");
 +  
 +  // Stop the timeout timer
 +  timeout_timer_.Stop();
@@ -141,6 +150,7 @@ index 0000000000000..ea45bebcce461
 +
 +void BrowserOSChangeDetector::OnTimeout() {
 +  VLOG(1) << "[browseros] Change detection timeout";
++  TRACE_EVENT_INSTANT("browseros", "BrowserOSChangeDetector::Timeout");
 +  monitoring_ = false;
 +  
 +  // If synchronous wait, quit the run loop
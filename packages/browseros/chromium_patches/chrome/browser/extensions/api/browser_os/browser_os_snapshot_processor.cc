@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
 new file mode 100644
-index 0000000000000..885942336dcd6
+index 0000000000000..7204fb857a34b
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
-@@ -0,0 +1,648 @@
+@@ -0,0 +1,661 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -28,6 +28,7 @@ index 0000000000000..885942336dcd6
 +#include "base/strings/string_util.h"
 +#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
++#include "base/trace_event/trace_event.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "content/public/browser/browser_thread.h"
 +#include "content/public/browser/render_widget_host_view.h"
@@ -330,6 +331,8 @@ index 0000000000000..885942336dcd6
 +    ui::AXTree* ax_tree,
 +    uint32_t start_node_id,
 +    float device_scale_factor) {
++  TRACE_EVENT("browseros", "SnapshotProcessor::ProcessNodeBatch", "nodes",
++              nodes_to_process.size());
 +  std::vector<ProcessedNode> results;
 +  results.reserve(nodes_to_process.size());
 +  
@@ -424,6 +427,8 @@ index 0000000000000..885942336dcd6
 +void SnapshotProcessor::OnBatchProcessed(
 +    scoped_refptr<ProcessingContext> context,
 +    std::vector<ProcessedNode> batch_results) {
++  TRACE_EVENT("browseros", "SnapshotProcessor::OnBatchProcessed",
++              perfetto::Flow::FromPointer(context.get()));
 +  // Process batch results
 +  for (const auto& node_data : batch_results) {
 +    // Store mapping from our nodeId to AX node ID, bounds, and attributes
@@ -491,6 +496,9 @@ index 0000000000000..885942336dcd6
 +    LOG(INFO) << "[PERF] Interactive snapshot processed in " 
 +              << processing_time.InMilliseconds() << " ms"
 +              << " (nodes: " << context->snapshot.elements.size() << ")";
++    TRACE_EVENT_INSTANT("browseros", "SnapshotProcessor::Done",
++                        perfetto::TerminatingFlow::FromPointer(context.get()),
++                        "elements", context->snapshot.elements.size());
 +
 +    // Set processing time in the snapshot
 +    context->snapshot.processing_time_ms = processing_time.InMilliseconds();
@@ -537,6 +545,8 @@ index 0000000000000..885942336dcd6
 +    uint32_t snapshot_id,
 +    content::WebContents* web_contents,
 +    base::OnceCallback<void(SnapshotProcessingResult)> callback) {
++  TRACE_EVENT("browseros", "SnapshotProcessor::ProcessAccessibilityTree",
++              "tab_id", tab_id, "nodes", tree_update.nodes.size());
 +  base::TimeTicks start_time = base::TimeTicks::Now();
 +  
 +  // Extract viewport info from WebContents on UI thread
@@ -627,6 +637,9 @@ index 0000000000000..885942336dcd6
 +  size_t num_batches = (nodes_to_process.size() + batch_size - 1) / batch_size;
 +  context->total_batches = num_batches;
 +  
++  TRACE_EVENT_INSTANT("browseros", "SnapshotProcessor::PostBatches",
++                      perfetto::Flow::FromPointer(context.get()), "batches",
++                      num_batches);
 +  for (size_t i = 0; i < nodes_to_process.size(); i += batch_size) {
 +    size_t end = std::min(i + batch_size, nodes_to_process.size());
 +    std::vector<ui::AXNodeData> batch(
@@ -29,13 +29,15 @@ index 79c4eb8fc905c..dd7f36f954fb1 100644
  #if BUILDFLAG(IS_CHROMEOS)
    // Accounts / Users / People.
    (*s_allowlist)[ash::kAccountsPrefAllowGuest] =
-@@ -1180,6 +1193,10 @@ const PrefsUtil::TypedPrefMap& PrefsUtil::GetAllowlistedKeys() {
+@@ -1180,6 +1193,12 @@ const PrefsUtil::TypedPrefMap& PrefsUtil::GetAllowlistedKeys() {
        settings_api::PrefType::kBoolean;
    (*s_allowlist)[::prefs::kImportDialogSearchEngine] =
        settings_api::PrefType::kBoolean;
 +  (*s_allowlist)[::prefs::kImportDialogExtensions] =
 +      settings_api::PrefType::kBoolean;
 +  (*s_allowlist)[::prefs::kImportDialogCookies] =
++      settings_api::PrefType::kBoolean;
++  (*s_allowlist)[::prefs::kImportDialogSinceLastImport] =
 +      settings_api::PrefType::kBoolean;
  #endif  // BUILDFLAG(IS_CHROMEOS)
  
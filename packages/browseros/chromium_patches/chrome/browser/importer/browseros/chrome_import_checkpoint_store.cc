@@ -0,0 +1,151 @@
+diff --git a/chrome/browser/importer/browseros/chrome_import_checkpoint_store.cc b/chrome/browser/importer/browseros/chrome_import_checkpoint_store.cc
+new file mode 100644
+index 0000000000000..0207dc3f10e89
+--- /dev/null
++++ b/chrome/browser/importer/browseros/chrome_import_checkpoint_store.cc
+@@ -0,0 +1,145 @@
++// Copyright 2024 AKW Technology Inc
++// Browser-side store of Chrome importer checkpoints
++
++#include "chrome/browser/importer/browseros/chrome_import_checkpoint_store.h"
++
++#include <optional>
++
++#include "base/files/file_util.h"
++#include "base/files/important_file_writer.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/json/values_util.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "base/path_service.h"
++#include "base/task/thread_pool.h"
++#include "base/values.h"
++#include "chrome/common/chrome_paths.h"
++
++namespace browseros_importer {
++
++namespace {
++
++constexpr char kCheckpointsFilename[] = "import_checkpoints.json";
++
++constexpr char kHistoryVisitTimeKey[] = "history_visit_time";
++constexpr char kCookieLastUpdateKey[] = "cookie_last_update_utc";
++constexpr char kPasswordLastUsedKey[] = "password_date_last_used";
++constexpr char kBookmarksHashKey[] = "bookmarks_hash";
++constexpr char kBookmarkKeysKey[] = "bookmark_keys";
++
++base::FilePath GetCheckpointsPath() {
++  base::FilePath user_data_dir;
++  if (!base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir)) {
++    LOG(WARNING) << "browseros: Failed to resolve DIR_USER_DATA path";
++    return base::FilePath();
++  }
++  return user_data_dir.Append(FILE_PATH_LITERAL(".browseros"))
++      .AppendASCII(kCheckpointsFilename);
++}
++
++base::Value::Dict ReadCheckpoints(const base::FilePath& path) {
++  std::string contents;
++  if (path.empty() || !base::ReadFileToString(path, &contents)) {
++    return base::Value::Dict();
++  }
++
++  std::optional<base::Value> value = base::JSONReader::Read(contents);
++  if (!value || !value->is_dict()) {
++    LOG(WARNING) << "browseros: Ignoring malformed import checkpoints";
++    return base::Value::Dict();
++  }
++  return std::move(*value).TakeDict();
++}
++
++base::Time FindTime(const base::Value::Dict& dict, const char* key) {
++  const base::Value* value = dict.Find(key);
++  if (!value) {
++    return base::Time();
++  }
++  return base::ValueToTime(*value).value_or(base::Time());
++}
++
++}  // namespace
++
++scoped_refptr<base::SequencedTaskRunner> GetImportCheckpointTaskRunner() {
++  static base::NoDestructor<scoped_refptr<base::SequencedTaskRunner>>
++      task_runner(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
++           base::TaskShutdownBehavior::BLOCK_SHUTDOWN}));
++  return *task_runner;
++}
++
++ImportCheckpoint LoadImportCheckpoint(const base::FilePath& profile_path) {
++  ImportCheckpoint checkpoint;
++
++  base::Value::Dict checkpoints = ReadCheckpoints(GetCheckpointsPath());
++  const base::Value::Dict* entry =
++      checkpoints.FindDict(profile_path.AsUTF8Unsafe());
++  if (!entry) {
++    return checkpoint;
++  }
++
++  checkpoint.history_visit_time = FindTime(*entry, kHistoryVisitTimeKey);
++  checkpoint.cookie_last_update = FindTime(*entry, kCookieLastUpdateKey);
++  checkpoint.password_last_used = FindTime(*entry, kPasswordLastUsedKey);
++  if (const std::string* hash = entry->FindString(kBookmarksHashKey)) {
++    checkpoint.bookmarks_hash = *hash;
++  }
++  if (const base::Value::List* keys = entry->FindList(kBookmarkKeysKey)) {
++    for (const base::Value& key : *keys) {
++      if (key.is_string()) {
++        checkpoint.bookmark_keys.insert(key.GetString());
++      }
++    }
++  }
++
++  return checkpoint;
++}
++
++bool SaveImportCheckpoint(const base::FilePath& profile_path,
++                          const ImportCheckpoint& checkpoint) {
++  base::FilePath path = GetCheckpointsPath();
++  if (path.empty()) {
++    return false;
++  }
++
++  if (!base::CreateDirectory(path.DirName())) {
++    LOG(WARNING) << "browseros: Failed to create " << path.DirName();
++    return false;
++  }
++
++  base::Value::Dict entry;
++  entry.Set(kHistoryVisitTimeKey,
++            base::TimeToValue(checkpoint.history_visit_time));
++  entry.Set(kCookieLastUpdateKey,
++            base::TimeToValue(checkpoint.cookie_last_update));
++  entry.Set(kPasswordLastUsedKey,
++            base::TimeToValue(checkpoint.password_last_used));
++  entry.Set(kBookmarksHashKey, checkpoint.bookmarks_hash);
++  base::Value::List bookmark_keys;
++  for (const std::string& key : checkpoint.bookmark_keys) {
++    bookmark_keys.Append(key);
++  }
++  entry.Set(kBookmarkKeysKey, std::move(bookmark_keys));
++
++  base::Value::Dict checkpoints = ReadCheckpoints(path);
++  checkpoints.Set(profile_path.AsUTF8Unsafe(), std::move(entry));
++
++  std::string json;
++  if (!base::JSONWriter::WriteWithOptions(
++          checkpoints, base::JSONWriter::OPTIONS_PRETTY_PRINT, &json)) {
++    return false;
++  }
++
++  // Written atomically so an interrupted import never leaves a torn file.
++  if (!base::ImportantFileWriter::WriteFileAtomically(path, json)) {
++    LOG(WARNING) << "browseros: Failed to write import checkpoints";
++    return false;
++  }
++
++  return true;
++}
++
++}  // namespace browseros_importer
@@ -0,0 +1,40 @@
+diff --git a/chrome/browser/importer/browseros/chrome_import_checkpoint_store.h b/chrome/browser/importer/browseros/chrome_import_checkpoint_store.h
+new file mode 100644
+index 0000000000000..a94ec3ec7fea0
+--- /dev/null
++++ b/chrome/browser/importer/browseros/chrome_import_checkpoint_store.h
+@@ -0,0 +1,34 @@
++// Copyright 2024 AKW Technology Inc
++// Browser-side store of Chrome importer checkpoints
++
++#ifndef CHROME_BROWSER_IMPORTER_BROWSEROS_CHROME_IMPORT_CHECKPOINT_STORE_H_
++#define CHROME_BROWSER_IMPORTER_BROWSEROS_CHROME_IMPORT_CHECKPOINT_STORE_H_
++
++#include "base/files/file_path.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/task/sequenced_task_runner.h"
++#include "chrome/utility/importer/browseros/chrome_import_checkpoint.h"
++
++namespace browseros_importer {
++
++// The browser process owns the user data dir, so it keeps the checkpoints.
++// The importer process is handed the checkpoint and reports its progress over
++// ImporterBridge.
++
++// Sequence on which the store is read and written, so that checkpoints
++// reported during one import are saved in order.
++scoped_refptr<base::SequencedTaskRunner> GetImportCheckpointTaskRunner();
++
++// Loads the checkpoint recorded for the Chrome profile at |profile_path|.
++// Returns an empty checkpoint if none was recorded or the store is unreadable.
++ImportCheckpoint LoadImportCheckpoint(const base::FilePath& profile_path);
++
++// Records |checkpoint| for the Chrome profile at |profile_path|.
++// Checkpoints live in <user-data-dir>/.browseros/import_checkpoints.json,
++// keyed by source profile path. Returns false on failure.
++bool SaveImportCheckpoint(const base::FilePath& profile_path,
++                          const ImportCheckpoint& checkpoint);
++
++}  // namespace browseros_importer
++
++#endif  // CHROME_BROWSER_IMPORTER_BROWSEROS_CHROME_IMPORT_CHECKPOINT_STORE_H_
@@ -0,0 +1,141 @@
+diff --git a/chrome/browser/importer/browseros/chrome_import_checkpoint_store_unittest.cc b/chrome/browser/importer/browseros/chrome_import_checkpoint_store_unittest.cc
+new file mode 100644
+index 0000000000000..d66708617907e
+--- /dev/null
++++ b/chrome/browser/importer/browseros/chrome_import_checkpoint_store_unittest.cc
+@@ -0,0 +1,135 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome importer checkpoint store tests
++
++#include "chrome/browser/importer/browseros/chrome_import_checkpoint_store.h"
++
++#include <optional>
++
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/test/scoped_path_override.h"
++#include "base/time/time.h"
++#include "chrome/common/chrome_paths.h"
++#include "chrome/common/importer/profile_import.mojom.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros_importer {
++
++namespace {
++
++class ChromeImportCheckpointStoreTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(user_data_dir_.CreateUniqueTempDir());
++    user_data_override_.emplace(chrome::DIR_USER_DATA,
++                                user_data_dir_.GetPath());
++  }
++
++  base::FilePath GetStorePath() const {
++    return user_data_dir_.GetPath()
++        .Append(FILE_PATH_LITERAL(".browseros"))
++        .AppendASCII("import_checkpoints.json");
++  }
++
++  base::ScopedTempDir user_data_dir_;
++  std::optional<base::ScopedPathOverride> user_data_override_;
++};
++
++ImportCheckpoint CreateCheckpoint() {
++  ImportCheckpoint checkpoint;
++  checkpoint.history_visit_time = base::Time::Now() - base::Days(3);
++  checkpoint.cookie_last_update = base::Time::Now() - base::Days(2);
++  checkpoint.password_last_used = base::Time::Now() - base::Days(1);
++  checkpoint.bookmarks_hash = "0123abcd";
++  checkpoint.bookmark_keys = {"00112233aabbccdd", "8899aabbccddeeff"};
++  return checkpoint;
++}
++
++TEST_F(ChromeImportCheckpointStoreTest, MissingStoreLoadsEmptyCheckpoint) {
++  const base::FilePath profile(FILE_PATH_LITERAL("/chrome/Default"));
++  ImportCheckpoint checkpoint = LoadImportCheckpoint(profile);
++
++  EXPECT_TRUE(checkpoint.history_visit_time.is_null());
++  EXPECT_TRUE(checkpoint.cookie_last_update.is_null());
++  EXPECT_TRUE(checkpoint.password_last_used.is_null());
++  EXPECT_TRUE(checkpoint.bookmarks_hash.empty());
++  EXPECT_TRUE(checkpoint.bookmark_keys.empty());
++}
++
++TEST_F(ChromeImportCheckpointStoreTest, SaveLoadRoundTrip) {
++  const base::FilePath profile(FILE_PATH_LITERAL("/chrome/Default"));
++  const ImportCheckpoint saved = CreateCheckpoint();
++
++  ASSERT_TRUE(SaveImportCheckpoint(profile, saved));
++  EXPECT_TRUE(base::PathExists(GetStorePath()));
++
++  ImportCheckpoint loaded = LoadImportCheckpoint(profile);
++  EXPECT_EQ(saved.history_visit_time, loaded.history_visit_time);
++  EXPECT_EQ(saved.cookie_last_update, loaded.cookie_last_update);
++  EXPECT_EQ(saved.password_last_used, loaded.password_last_used);
++  EXPECT_EQ(saved.bookmarks_hash, loaded.bookmarks_hash);
++  EXPECT_EQ(saved.bookmark_keys, loaded.bookmark_keys);
++}
++
++TEST_F(ChromeImportCheckpointStoreTest, CheckpointsAreKeyedBySourceProfile) {
++  const base::FilePath first(FILE_PATH_LITERAL("/chrome/Default"));
++  const base::FilePath second(FILE_PATH_LITERAL("/chrome/Profile 1"));
++
++  ASSERT_TRUE(SaveImportCheckpoint(first, CreateCheckpoint()));
++  ImportCheckpoint other;
++  other.bookmarks_hash = "ffff";
++  ASSERT_TRUE(SaveImportCheckpoint(second, other));
++
++  EXPECT_EQ("0123abcd", LoadImportCheckpoint(first).bookmarks_hash);
++  EXPECT_EQ("ffff", LoadImportCheckpoint(second).bookmarks_hash);
++  EXPECT_TRUE(LoadImportCheckpoint(second).bookmark_keys.empty());
++}
++
++TEST_F(ChromeImportCheckpointStoreTest, SaveReplacesPreviousCheckpoint) {
++  const base::FilePath profile(FILE_PATH_LITERAL("/chrome/Default"));
++  ASSERT_TRUE(SaveImportCheckpoint(profile, CreateCheckpoint()));
++
++  ImportCheckpoint advanced = CreateCheckpoint();
++  advanced.history_visit_time = base::Time::Now();
++  advanced.bookmark_keys.insert("0000000000000001");
++  ASSERT_TRUE(SaveImportCheckpoint(profile, advanced));
++
++  ImportCheckpoint loaded = LoadImportCheckpoint(profile);
++  EXPECT_EQ(advanced.history_visit_time, loaded.history_visit_time);
++  EXPECT_EQ(3u, loaded.bookmark_keys.size());
++}
++
++TEST_F(ChromeImportCheckpointStoreTest, MalformedStoreLoadsEmptyCheckpoint) {
++  ASSERT_TRUE(base::CreateDirectory(GetStorePath().DirName()));
++  ASSERT_TRUE(base::WriteFile(GetStorePath(), "{not json"));
++
++  const base::FilePath profile(FILE_PATH_LITERAL("/chrome/Default"));
++  EXPECT_TRUE(LoadImportCheckpoint(profile).bookmarks_hash.empty());
++
++  // Saving over a malformed store starts a fresh one.
++  ASSERT_TRUE(SaveImportCheckpoint(profile, CreateCheckpoint()));
++  EXPECT_EQ("0123abcd", LoadImportCheckpoint(profile).bookmarks_hash);
++}
++
++TEST(ChromeImportCheckpointTest, MojoRoundTrip) {
++  const ImportCheckpoint checkpoint = CreateCheckpoint();
++  ImportCheckpoint converted =
++      FromMojoImportCheckpoint(*ToMojoImportCheckpoint(checkpoint));
++
++  EXPECT_EQ(checkpoint.history_visit_time, converted.history_visit_time);
++  EXPECT_EQ(checkpoint.cookie_last_update, converted.cookie_last_update);
++  EXPECT_EQ(checkpoint.password_last_used, converted.password_last_used);
++  EXPECT_EQ(checkpoint.bookmarks_hash, converted.bookmarks_hash);
++  EXPECT_EQ(checkpoint.bookmark_keys, converted.bookmark_keys);
++}
++
++TEST(ChromeImportCheckpointTest, NullTimesSurviveMojo) {
++  ImportCheckpoint converted =
++      FromMojoImportCheckpoint(*ToMojoImportCheckpoint(ImportCheckpoint()));
++  EXPECT_TRUE(converted.history_visit_time.is_null());
++  EXPECT_TRUE(converted.password_last_used.is_null());
++}
++
++}  // namespace
++
++}  // namespace browseros_importer
@@ -2,10 +2,11 @@ diff --git a/chrome/browser/importer/external_process_importer_client.cc b/chrom
 index 6ee7a959fde3e..e60d680b1a99b 100644
 --- a/chrome/browser/importer/external_process_importer_client.cc
 +++ b/chrome/browser/importer/external_process_importer_client.cc
-@@ -14,10 +14,12 @@
+@@ -14,10 +14,24 @@
  #include "chrome/common/importer/firefox_importer_utils.h"
  #include "chrome/common/importer/profile_import.mojom.h"
  #include "chrome/grit/generated_resources.h"
++#include "chrome/browser/importer/browseros/chrome_import_checkpoint_store.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
  #include "components/strings/grit/components_strings.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
@@ -14,8 +15,19 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
 +#include "net/cookies/cookie_constants.h"
  #include "ui/base/l10n/l10n_util.h"
  
++namespace {
++
++void SaveCheckpoint(const base::FilePath& profile_path,
++                    const browseros_importer::ImportCheckpoint& checkpoint) {
++  if (!browseros_importer::SaveImportCheckpoint(profile_path, checkpoint)) {
++    LOG(WARNING) << "browseros: Failed to save import checkpoint";
++  }
++}
++
++}  // namespace
++
  ExternalProcessImporterClient::ExternalProcessImporterClient(
-@@ -221,6 +223,72 @@ void ExternalProcessImporterClient::OnPasswordFormImportReady(
+@@ -221,6 +235,80 @@ void ExternalProcessImporterClient::OnPasswordFormImportReady(
    bridge_->SetPasswordForm(form);
  }
  
@@ -84,11 +96,19 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
 +
 +  bridge_->SetCookie(cookie);
 +}
++
++void ExternalProcessImporterClient::OnFaviconsChunkReady(
++    const favicon_base::FaviconUsageDataList& favicons) {
++  if (cancelled_)
++    return;
++
++  bridge_->SetFavicons(favicons);
++}
 +
  void ExternalProcessImporterClient::OnKeywordsImportReady(
      const std::vector<user_data_importer::SearchEngineInfo>& search_engines,
      bool unique_on_host_and_path) {
-@@ -251,6 +319,14 @@ void ExternalProcessImporterClient::OnAutofillFormDataImportGroup(
+@@ -251,6 +339,41 @@ void ExternalProcessImporterClient::OnAutofillFormDataImportGroup(
      bridge_->SetAutofillFormData(autofill_form_data_);
  }
  
@@ -99,6 +119,33 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
 +
 +  bridge_->SetExtensions(extension_ids);
 +}
++
++void ExternalProcessImporterClient::GetImportCheckpoint(
++    GetImportCheckpointCallback callback) {
++  // The importer process blocks on this reply, so it is answered even after
++  // cancellation.
++  browseros_importer::GetImportCheckpointTaskRunner()
++      ->PostTaskAndReplyWithResult(
++          FROM_HERE,
++          base::BindOnce(&browseros_importer::LoadImportCheckpoint,
++                         source_profile_.source_path),
++          base::BindOnce(&browseros_importer::ToMojoImportCheckpoint)
++              .Then(std::move(callback)));
++}
++
++void ExternalProcessImporterClient::OnImportCheckpointReady(
++    chrome::mojom::ImportCheckpointPtr mojo_checkpoint) {
++  if (cancelled_)
++    return;
++
++  // Saved on the checkpoint sequence so that checkpoints reported one after
++  // another are written in order.
++  browseros_importer::GetImportCheckpointTaskRunner()->PostTask(
++      FROM_HERE,
++      base::BindOnce(
++          &SaveCheckpoint, source_profile_.source_path,
++          browseros_importer::FromMojoImportCheckpoint(*mojo_checkpoint)));
++}
 +
  ExternalProcessImporterClient::~ExternalProcessImporterClient() = default;
  
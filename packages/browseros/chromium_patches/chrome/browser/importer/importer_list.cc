@@ -26,7 +26,7 @@ index 62546b572bab8..3f4082edf8aa9 100644
  
  #if BUILDFLAG(IS_MAC)
  #include "base/apple/foundation_util.h"
-@@ -29,6 +35,200 @@
+@@ -29,6 +35,203 @@
  
  namespace {
  
@@ -218,7 +218,10 @@ index 62546b572bab8..3f4082edf8aa9 100644
 +                            u" - " + base::UTF8ToUTF16(*name);
 +    }
 +    chrome.importer_type = user_data_importer::TYPE_CHROME;
-+    chrome.services_supported = services;
++    // Chrome sources support incremental re-import on top of their data
++    // types.
++    chrome.services_supported =
++        services | user_data_importer::SINCE_LAST_IMPORT;
 +    chrome.source_path = profile_folder;
 +    profiles->push_back(chrome);
 +  }
@@ -227,7 +230,7 @@ index 62546b572bab8..3f4082edf8aa9 100644
  #if BUILDFLAG(IS_WIN)
  void DetectIEProfiles(
      std::vector<user_data_importer::SourceProfile>* profiles) {
-@@ -71,6 +271,21 @@ void DetectBuiltinWindowsProfiles(
+@@ -71,6 +274,21 @@ void DetectBuiltinWindowsProfiles(
  
  #endif  // BUILDFLAG(IS_WIN)
  
@@ -249,7 +252,7 @@ index 62546b572bab8..3f4082edf8aa9 100644
  #if BUILDFLAG(IS_MAC)
  void DetectSafariProfiles(
      std::vector<user_data_importer::SourceProfile>* profiles) {
-@@ -88,8 +303,30 @@ void DetectSafariProfiles(
+@@ -88,8 +306,30 @@ void DetectSafariProfiles(
    safari.services_supported = items;
    profiles->push_back(safari);
  }
@@ -280,7 +283,7 @@ index 62546b572bab8..3f4082edf8aa9 100644
  // |locale|: The application locale used for lookups in Firefox's
  // locale-specific search engines feature (see firefox_importer.cc for
  // details).
-@@ -170,8 +407,10 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
+@@ -170,8 +410,10 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
  #if BUILDFLAG(IS_WIN)
    if (shell_integration::IsFirefoxDefaultBrowser()) {
      DetectFirefoxProfiles(locale, &profiles);
@@ -291,7 +294,7 @@ index 62546b572bab8..3f4082edf8aa9 100644
      DetectBuiltinWindowsProfiles(&profiles);
      DetectFirefoxProfiles(locale, &profiles);
    }
-@@ -179,11 +418,15 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
+@@ -179,11 +421,15 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
    if (shell_integration::IsFirefoxDefaultBrowser()) {
      DetectFirefoxProfiles(locale, &profiles);
      DetectSafariProfiles(&profiles);
@@ -2,11 +2,12 @@ diff --git a/chrome/browser/importer/in_process_importer_bridge.cc b/chrome/brow
 index fbb20f1ae0668..2ae55dd11704a 100644
 --- a/chrome/browser/importer/in_process_importer_bridge.cc
 +++ b/chrome/browser/importer/in_process_importer_bridge.cc
-@@ -21,11 +21,16 @@
+@@ -21,11 +21,17 @@
  #include "components/search_engines/template_url.h"
  #include "components/search_engines/template_url_parser.h"
  #include "components/search_engines/template_url_prepopulate_data.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_checkpoint.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
  #include "ui/base/l10n/l10n_util.h"
  
@@ -19,7 +20,7 @@ index fbb20f1ae0668..2ae55dd11704a 100644
  history::URLRows ConvertImporterURLRowsToHistoryURLRows(
      const std::vector<user_data_importer::ImporterURLRow>& rows) {
    history::URLRows converted;
-@@ -53,6 +58,8 @@ history::VisitSource ConvertImporterVisitSourceToHistoryVisitSource(
+@@ -53,6 +59,8 @@ history::VisitSource ConvertImporterVisitSourceToHistoryVisitSource(
        return history::SOURCE_IE_IMPORTED;
      case user_data_importer::VISIT_SOURCE_SAFARI_IMPORTED:
        return history::SOURCE_SAFARI_IMPORTED;
@@ -28,7 +29,7 @@ index fbb20f1ae0668..2ae55dd11704a 100644
    }
    NOTREACHED();
  }
-@@ -151,6 +158,11 @@ void InProcessImporterBridge::SetPasswordForm(
+@@ -151,6 +159,16 @@ void InProcessImporterBridge::SetPasswordForm(
    writer_->AddPasswordForm(ConvertImportedPasswordForm(form));
  }
  
@@ -36,11 +37,16 @@ index fbb20f1ae0668..2ae55dd11704a 100644
 +    const browseros_importer::ImportedCookieEntry& cookie) {
 +  writer_->AddCookie(cookie);
 +}
++
++void InProcessImporterBridge::SetFaviconsChunk(
++    const favicon_base::FaviconUsageDataList& favicons) {
++  SetFavicons(favicons);
++}
 +
  void InProcessImporterBridge::SetAutofillFormData(
      const std::vector<ImporterAutofillFormDataEntry>& entries) {
    std::vector<autofill::AutocompleteEntry> autocomplete_entries;
-@@ -168,6 +180,15 @@ void InProcessImporterBridge::SetAutofillFormData(
+@@ -168,6 +186,25 @@ void InProcessImporterBridge::SetAutofillFormData(
    writer_->AddAutocompleteFormDataEntries(autocomplete_entries);
  }
  
@@ -52,6 +58,16 @@ index fbb20f1ae0668..2ae55dd11704a 100644
 +  // Pass the extension IDs to the profile writer to handle installation
 +  writer_->AddExtensions(extension_ids);
 +}
++
++browseros_importer::ImportCheckpoint
++InProcessImporterBridge::GetImportCheckpoint() {
++  // Only the Chrome importer keeps checkpoints, and it always runs out of
++  // process; ExternalProcessImporterClient serves and saves them.
++  return browseros_importer::ImportCheckpoint();
++}
++
++void InProcessImporterBridge::SetImportCheckpoint(
++    const browseros_importer::ImportCheckpoint& checkpoint) {}
 +
  void InProcessImporterBridge::NotifyStarted() {
    host_->NotifyImportStarted();
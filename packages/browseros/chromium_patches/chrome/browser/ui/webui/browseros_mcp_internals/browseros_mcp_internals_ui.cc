@@ -0,0 +1,216 @@
+diff --git a/chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.cc b/chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.cc
+new file mode 100644
+index 0000000000000..cedbdc573d5ee
+--- /dev/null
++++ b/chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.cc
+@@ -0,0 +1,210 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.h"
++
++#include <memory>
++#include <string>
++
++#include "base/functional/bind.h"
++#include "base/json/json_writer.h"
++#include "base/memory/ref_counted_memory.h"
++#include "chrome/browser/browseros/server/browseros_server_manager.h"
++#include "chrome/common/webui_url_constants.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_ui.h"
++#include "content/public/browser/web_ui_data_source.h"
++#include "services/network/public/mojom/content_security_policy.mojom.h"
++
++namespace {
++
++constexpr char kMetricsJsonPath[] = "metrics.json";
++
++constexpr char kHtmlContent[] = R"(
++<!DOCTYPE html>
++<html>
++<head>
++  <meta charset="utf-8">
++  <title>BrowserOS MCP Internals</title>
++  <style>
++    body { font-family: system-ui, sans-serif; margin: 16px; }
++    table { border-collapse: collapse; font-size: 13px; }
++    th, td { border: 1px solid #ddd; padding: 4px 8px; text-align: right; }
++    th:first-child, td:first-child { text-align: left; }
++    th { background: #f5f5f5; cursor: pointer; }
++    .summary { margin-bottom: 12px; color: #444; }
++    .bar { background: #4285f4; height: 10px; }
++  </style>
++</head>
++<body>
++  <h2>MCP proxy</h2>
++  <div class="summary" id="summary">Loading...</div>
++  <table>
++    <thead><tr>
++      <th data-key="method">Method</th>
++      <th data-key="requests">Requests</th>
++      <th data-key="in_flight">In flight</th>
++      <th data-key="errors">Errors</th>
++      <th data-key="mean_ms">Mean ms</th>
++      <th data-key="p95_ms">p95 ms</th>
++      <th data-key="max_ms">Max ms</th>
++      <th data-key="request_bytes">Req bytes</th>
++      <th data-key="response_bytes">Resp bytes</th>
++      <th>Status codes</th>
++    </tr></thead>
++    <tbody id="rows"></tbody>
++  </table>
++  <h2>Server startup</h2>
++  <div class="summary" id="startup-summary"></div>
++  <table>
++    <thead><tr>
++      <th>Phase</th><th>Start ms</th><th>Duration ms</th><th></th>
++    </tr></thead>
++    <tbody id="startup-rows"></tbody>
++  </table>
++  <script>
++    let sortKey = 'requests';
++    document.querySelectorAll('th[data-key]').forEach(th => {
++      th.onclick = () => { sortKey = th.dataset.key; refresh(); };
++    });
++
++    // Upper bound of the bucket holding the 95th percentile.
++    function p95(buckets, bounds) {
++      const total = buckets.reduce((a, b) => a + b, 0);
++      let seen = 0;
++      for (let i = 0; i < buckets.length; i++) {
++        seen += buckets[i];
++        if (total && seen >= total * 0.95) {
++          return i < bounds.length ? bounds[i] : Infinity;
++        }
++      }
++      return 0;
++    }
++
++    function renderStartup(startup) {
++      const phases = (startup && startup.phases) || [];
++      document.getElementById('startup-summary').textContent =
++          !startup || !startup.phases ? 'Server was not started.' :
++          startup.total_ms === undefined ? 'Waiting for the server to be ready.' :
++          `Ready after ${startup.total_ms.toFixed(1)} ms`;
++      const end = Math.max(1, startup && startup.total_ms || 0,
++          ...phases.map(p => p.start_ms + p.duration_ms));
++      document.getElementById('startup-rows').replaceChildren(
++          ...phases.map(p => {
++            const tr = document.createElement('tr');
++            for (const value of [p.name, p.start_ms.toFixed(1),
++                                 p.duration_ms.toFixed(1)]) {
++              const td = document.createElement('td');
++              td.textContent = value;
++              tr.appendChild(td);
++            }
++            const td = document.createElement('td');
++            td.style.width = '300px';
++            const bar = document.createElement('div');
++            bar.className = 'bar';
++            bar.style.marginLeft = `${100 * p.start_ms / end}%`;
++            bar.style.width = `${Math.max(0.5, 100 * p.duration_ms / end)}%`;
++            td.appendChild(bar);
++            tr.appendChild(td);
++            return tr;
++          }));
++    }
++
++    async function refresh() {
++      const data = await (await fetch('metrics.json')).json();
++      renderStartup(data.startup);
++      if (!data.methods) {
++        document.getElementById('summary').textContent =
++            'MCP proxy is not running.';
++        return;
++      }
++      document.getElementById('summary').textContent =
++          `backend port ${data.backend_port}, in flight ${data.in_flight}` +
++          ` (peak ${data.peak_in_flight}, limit ${data.max_in_flight}),` +
++          ` queued ${data.queued}, backend connections opened` +
++          ` ${data.backend_connections_opened},` +
++          ` uptime ${Math.round(data.uptime_s)}s`;
++      const methods = data.methods.map(m => Object.assign(m, {
++        p95_ms: p95(m.latency_buckets, data.latency_bucket_bounds_ms),
++      }));
++      methods.sort((a, b) => sortKey === 'method' ?
++          a.method.localeCompare(b.method) : b[sortKey] - a[sortKey]);
++      const rows = document.getElementById('rows');
++      rows.replaceChildren(...methods.map(m => {
++        const tr = document.createElement('tr');
++        const codes = Object.entries(m.status_codes)
++            .map(([code, n]) => `${code}: ${n}`).join(', ');
++        for (const value of [m.method, m.requests, m.in_flight, m.errors,
++                             m.mean_ms.toFixed(1), m.p95_ms, m.max_ms.toFixed(1),
++                             m.request_bytes, m.response_bytes, codes]) {
++          const td = document.createElement('td');
++          td.textContent = value;
++          tr.appendChild(td);
++        }
++        return tr;
++      }));
++    }
++
++    refresh();
++    setInterval(refresh, 2000);
++  </script>
++</body>
++</html>
++)";
++
++void SendString(content::WebUIDataSource::GotDataCallback callback,
++                std::string data) {
++  std::move(callback).Run(
++      base::MakeRefCounted<base::RefCountedString>(std::move(data)));
++}
++
++void OnProxyMetrics(content::WebUIDataSource::GotDataCallback callback,
++                    base::Value::Dict metrics) {
++  metrics.Set(
++      "startup",
++      browseros::BrowserOSServerManager::GetInstance()->GetStartupTimeline());
++  SendString(std::move(callback), base::WriteJson(metrics).value_or("{}"));
++}
++
++}  // namespace
++
++BrowserOSMcpInternalsUIConfig::BrowserOSMcpInternalsUIConfig()
++    : content::WebUIConfig(content::kChromeUIScheme,
++                           chrome::kChromeUIBrowserOSMcpInternalsHost) {}
++
++BrowserOSMcpInternalsUIConfig::~BrowserOSMcpInternalsUIConfig() = default;
++
++std::unique_ptr<content::WebUIController>
++BrowserOSMcpInternalsUIConfig::CreateWebUIController(content::WebUI* web_ui,
++                                                     const GURL& url) {
++  return std::make_unique<BrowserOSMcpInternalsUI>(web_ui);
++}
++
++BrowserOSMcpInternalsUI::BrowserOSMcpInternalsUI(content::WebUI* web_ui)
++    : content::WebUIController(web_ui) {
++  content::WebUIDataSource* source = content::WebUIDataSource::CreateAndAdd(
++      web_ui->GetWebContents()->GetBrowserContext(),
++      chrome::kChromeUIBrowserOSMcpInternalsHost);
++
++  source->SetRequestFilter(
++      base::BindRepeating([](const std::string& path) {
++        return path.empty() || path == "/" || path == kMetricsJsonPath;
++      }),
++      base::BindRepeating(
++          [](const std::string& path,
++             content::WebUIDataSource::GotDataCallback callback) {
++            if (path != kMetricsJsonPath) {
++              SendString(std::move(callback), kHtmlContent);
++              return;
++            }
++            browseros::BrowserOSServerManager::GetInstance()->GetProxyMetrics(
++                base::BindOnce(&OnProxyMetrics, std::move(callback)));
++          }));
++
++  source->OverrideContentSecurityPolicy(
++      network::mojom::CSPDirectiveName::ScriptSrc,
++      "script-src 'self' 'unsafe-inline';");
++}
++
++BrowserOSMcpInternalsUI::~BrowserOSMcpInternalsUI() = default;
@@ -0,0 +1,40 @@
+diff --git a/chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.h b/chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.h
+new file mode 100644
+index 0000000000000..dc3914e268770
+--- /dev/null
++++ b/chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.h
+@@ -0,0 +1,34 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_WEBUI_BROWSEROS_MCP_INTERNALS_BROWSEROS_MCP_INTERNALS_UI_H_
++#define CHROME_BROWSER_UI_WEBUI_BROWSEROS_MCP_INTERNALS_BROWSEROS_MCP_INTERNALS_UI_H_
++
++#include "content/public/browser/web_ui_controller.h"
++#include "content/public/browser/webui_config.h"
++
++// WebUI config for chrome://browseros-mcp-internals
++class BrowserOSMcpInternalsUIConfig : public content::WebUIConfig {
++ public:
++  BrowserOSMcpInternalsUIConfig();
++  ~BrowserOSMcpInternalsUIConfig() override;
++
++  // content::WebUIConfig:
++  std::unique_ptr<content::WebUIController> CreateWebUIController(
++      content::WebUI* web_ui,
++      const GURL& url) override;
++};
++
++// WebUI controller for chrome://browseros-mcp-internals. Shows the MCP
++// proxy's per-method request metrics; the page polls metrics.json.
++class BrowserOSMcpInternalsUI : public content::WebUIController {
++ public:
++  explicit BrowserOSMcpInternalsUI(content::WebUI* web_ui);
++  ~BrowserOSMcpInternalsUI() override;
++
++  BrowserOSMcpInternalsUI(const BrowserOSMcpInternalsUI&) = delete;
++  BrowserOSMcpInternalsUI& operator=(const BrowserOSMcpInternalsUI&) = delete;
++};
++
++#endif  // CHROME_BROWSER_UI_WEBUI_BROWSEROS_MCP_INTERNALS_BROWSEROS_MCP_INTERNALS_UI_H_
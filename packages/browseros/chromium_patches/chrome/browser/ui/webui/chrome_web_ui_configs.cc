@@ -10,15 +10,16 @@ index 746ec07198b15..f08d5356a8e44 100644
  #include "chrome/browser/ui/webui/usb_internals/usb_internals_ui.h"
  #include "chrome/browser/ui/webui/user_actions/user_actions_ui.h"
  #include "chrome/browser/ui/webui/version/version_ui.h"
-@@ -82,6 +83,7 @@
+@@ -82,6 +83,8 @@
  #include "chrome/browser/ui/webui/app_service_internals/app_service_internals_ui.h"
  #include "chrome/browser/ui/webui/autofill_ml_internals/autofill_ml_internals_ui.h"
  #include "chrome/browser/ui/webui/bookmarks/bookmarks_ui.h"
++#include "chrome/browser/ui/webui/browseros_mcp_internals/browseros_mcp_internals_ui.h"
 +#include "chrome/browser/ui/webui/clash_of_gpts/clash_of_gpts_ui.h"
  #include "chrome/browser/ui/webui/color_pipeline_internals/color_pipeline_internals_ui.h"
  #include "chrome/browser/ui/webui/commerce/product_specifications_ui.h"
  #include "chrome/browser/ui/webui/commerce/shopping_insights_side_panel_ui.h"
-@@ -268,6 +270,7 @@ void RegisterChromeWebUIConfigs() {
+@@ -268,6 +271,7 @@ void RegisterChromeWebUIConfigs() {
    map.AddWebUIConfig(std::make_unique<SiteEngagementUIConfig>());
    map.AddWebUIConfig(std::make_unique<SyncInternalsUIConfig>());
    map.AddWebUIConfig(std::make_unique<TranslateInternalsUIConfig>());
@@ -26,10 +27,11 @@ index 746ec07198b15..f08d5356a8e44 100644
    map.AddWebUIConfig(std::make_unique<UsbInternalsUIConfig>());
    map.AddWebUIConfig(std::make_unique<UserActionsUIConfig>());
    map.AddWebUIConfig(std::make_unique<VersionUIConfig>());
-@@ -302,6 +305,7 @@ void RegisterChromeWebUIConfigs() {
+@@ -302,6 +306,8 @@ void RegisterChromeWebUIConfigs() {
    map.AddWebUIConfig(std::make_unique<media_router::AccessCodeCastUIConfig>());
    map.AddWebUIConfig(std::make_unique<BookmarksSidePanelUIConfig>());
    map.AddWebUIConfig(std::make_unique<BookmarksUIConfig>());
++  map.AddWebUIConfig(std::make_unique<BrowserOSMcpInternalsUIConfig>());
 +  map.AddWebUIConfig(std::make_unique<ClashOfGptsUIConfig>());
    map.AddWebUIConfig(std::make_unique<ColorPipelineInternalsUIConfig>());
    map.AddWebUIConfig(std::make_unique<CommentsSidePanelUIConfig>());
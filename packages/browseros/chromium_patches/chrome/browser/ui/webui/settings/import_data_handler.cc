@@ -2,7 +2,7 @@ diff --git a/chrome/browser/ui/webui/settings/import_data_handler.cc b/chrome/br
 index 1e4ecb4f71569..b1752309fecca 100644
 --- a/chrome/browser/ui/webui/settings/import_data_handler.cc
 +++ b/chrome/browser/ui/webui/settings/import_data_handler.cc
-@@ -146,6 +146,12 @@ void ImportDataHandler::HandleImportData(const base::Value::List& args) {
+@@ -146,6 +146,21 @@ void ImportDataHandler::HandleImportData(const base::Value::List& args) {
    if (*type_dict.FindBool(prefs::kImportDialogSearchEngine)) {
      selected_items |= user_data_importer::SEARCH_ENGINES;
    }
@@ -11,11 +11,20 @@ index 1e4ecb4f71569..b1752309fecca 100644
 +  }
 +  if (*type_dict.FindBool(prefs::kImportDialogCookies)) {
 +    selected_items |= user_data_importer::COOKIES;
++  }
++  // SINCE_LAST_IMPORT only narrows the data types it comes with. Checked on
++  // its own, or with only types the source cannot provide, it must not start
++  // an import of nothing.
++  const uint16_t source_items =
++      importer_list_->GetSourceProfileAt(browser_index).services_supported;
++  if (type_dict.FindBool(prefs::kImportDialogSinceLastImport).value_or(false) &&
++      (selected_items & source_items & user_data_importer::ALL)) {
++    selected_items |= user_data_importer::SINCE_LAST_IMPORT;
 +  }
  
    const user_data_importer::SourceProfile& source_profile =
        importer_list_->GetSourceProfileAt(browser_index);
-@@ -225,6 +231,10 @@ void ImportDataHandler::SendBrowserProfileData(const std::string& callback_id) {
+@@ -225,6 +240,13 @@ void ImportDataHandler::SendBrowserProfileData(const std::string& callback_id) {
      browser_profile.Set(
          "autofillFormData",
          (browser_services & user_data_importer::AUTOFILL_FORM_DATA) != 0);
@@ -23,6 +32,9 @@ index 1e4ecb4f71569..b1752309fecca 100644
 +        "extensions", (browser_services & user_data_importer::EXTENSIONS) != 0);
 +    browser_profile.Set(
 +        "cookies", (browser_services & user_data_importer::COOKIES) != 0);
++    browser_profile.Set(
++        "sinceLastImport",
++        (browser_services & user_data_importer::SINCE_LAST_IMPORT) != 0);
  
      browser_profiles.Append(std::move(browser_profile));
    }
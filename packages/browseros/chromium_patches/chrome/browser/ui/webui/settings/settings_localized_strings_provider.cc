@@ -21,12 +21,14 @@ index 0490e6c682dfd..6060a47048cac 100644
    html_source->AddString(
        "aboutProductCopyright",
        base::i18n::MessageFormatter::FormatWithNumberedArgs(
-@@ -908,6 +913,8 @@ void AddImportDataStrings(content::WebUIDataSource* html_source) {
+@@ -908,6 +913,10 @@ void AddImportDataStrings(content::WebUIDataSource* html_source) {
        {"importCommit", IDS_SETTINGS_IMPORT_COMMIT},
        {"noProfileFound", IDS_SETTINGS_IMPORT_NO_PROFILE_FOUND},
        {"importSuccess", IDS_SETTINGS_IMPORT_SUCCESS},
 +      {"importDialogExtensions", IDS_SETTINGS_IMPORT_EXTENSIONS_CHECKBOX},
 +      {"importDialogCookies", IDS_SETTINGS_IMPORT_COOKIES_CHECKBOX},
++      {"importDialogSinceLastImport",
++       IDS_SETTINGS_IMPORT_SINCE_LAST_IMPORT_CHECKBOX},
    };
    html_source->AddLocalizedStrings(kLocalizedStrings);
  }
@@ -2,28 +2,42 @@ diff --git a/chrome/common/importer/importer_bridge.h b/chrome/common/importer/i
 index 1738a3baff3e4..5f62d61cc7d08 100644
 --- a/chrome/common/importer/importer_bridge.h
 +++ b/chrome/common/importer/importer_bridge.h
-@@ -17,6 +17,10 @@
+@@ -17,6 +17,11 @@
  class GURL;
  struct ImporterAutofillFormDataEntry;
  
 +namespace browseros_importer {
++struct ImportCheckpoint;
 +struct ImportedCookieEntry;
 +}  // namespace browseros_importer
 +
  namespace user_data_importer {
  struct ImportedBookmarkEntry;
  }  // namespace user_data_importer
-@@ -48,9 +52,14 @@ class ImporterBridge : public base::RefCountedThreadSafe<ImporterBridge> {
+@@ -48,9 +53,27 @@ class ImporterBridge : public base::RefCountedThreadSafe<ImporterBridge> {
    virtual void SetPasswordForm(
        const user_data_importer::ImportedPasswordForm& form) = 0;
  
 +  virtual void SetCookie(
 +      const browseros_importer::ImportedCookieEntry& cookie) = 0;
++
++  // Sends one chunk of a favicon import. Unlike SetFavicons(), may be called
++  // repeatedly; each chunk is written as soon as it arrives.
++  virtual void SetFaviconsChunk(
++      const favicon_base::FaviconUsageDataList& favicons) = 0;
 +
    virtual void SetAutofillFormData(
        const std::vector<ImporterAutofillFormDataEntry>& entries) = 0;
  
 +  virtual void SetExtensions(const std::vector<std::string>& extension_ids) = 0;
++
++  // Returns the checkpoint of the last import from the source profile, as
++  // saved by the browser. Blocks until the browser has read it.
++  virtual browseros_importer::ImportCheckpoint GetImportCheckpoint() = 0;
++
++  // Hands an advanced checkpoint to the browser, which saves it.
++  virtual void SetImportCheckpoint(
++      const browseros_importer::ImportCheckpoint& checkpoint) = 0;
 +
    // Notifies the coordinator that the import operation has begun.
    virtual void NotifyStarted() = 0;
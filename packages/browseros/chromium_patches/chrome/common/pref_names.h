@@ -2,17 +2,19 @@ diff --git a/chrome/common/pref_names.h b/chrome/common/pref_names.h
 index 898e1c48db1e1..3f88b936ccd63 100644
 --- a/chrome/common/pref_names.h
 +++ b/chrome/common/pref_names.h
-@@ -1594,6 +1594,9 @@ inline constexpr char kImportDialogSavedPasswords[] =
+@@ -1594,6 +1594,11 @@ inline constexpr char kImportDialogSavedPasswords[] =
      "import_dialog_saved_passwords";
  inline constexpr char kImportDialogSearchEngine[] =
      "import_dialog_search_engine";
 +inline constexpr char kImportDialogExtensions[] =
 +    "import_dialog_extensions";
 +inline constexpr char kImportDialogCookies[] = "import_dialog_cookies";
++inline constexpr char kImportDialogSinceLastImport[] =
++    "import_dialog_since_last_import";
  
  // Profile avatar and name
  inline constexpr char kProfileAvatarIndex[] = "profile.avatar_index";
-@@ -4336,6 +4339,18 @@ inline constexpr char kAndroidTipNotificationShownBottomOmnibox[] =
+@@ -4336,6 +4341,18 @@ inline constexpr char kAndroidTipNotificationShownBottomOmnibox[] =
  // LINT.ThenChange(//chrome/android/java/src/org/chromium/chrome/browser/notifications/tips/TipsUtils.java:TipsShownPrefs)
  #endif  // BUILDFLAG(IS_ANDROID)
  
@@ -1,24 +1,29 @@
 diff --git a/chrome/utility/importer/browseros/chrome_bookmarks_importer.cc b/chrome/utility/importer/browseros/chrome_bookmarks_importer.cc
 new file mode 100644
-index 0000000000000..e631448aa5137
+index 0000000000000..561261b5283ea
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_bookmarks_importer.cc
-@@ -0,0 +1,248 @@
+@@ -0,0 +1,364 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome bookmarks importer implementation
 +
 +#include "chrome/utility/importer/browseros/chrome_bookmarks_importer.h"
 +
 +#include <map>
++#include <optional>
 +#include <set>
++#include <utility>
 +
++#include "base/containers/span.h"
 +#include "base/files/file_util.h"
 +#include "base/json/json_reader.h"
 +#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "chrome/utility/importer/browseros/chrome_importer_utils.h"
 +#include "components/user_data_importer/content/favicon_reencode.h"
++#include "crypto/sha2.h"
 +#include "sql/database.h"
 +#include "sql/statement.h"
 +#include "url/gurl.h"
@@ -37,9 +42,6 @@ index 0000000000000..e631448aa5137
 +constexpr char kBookmarksFilename[] = "Bookmarks";
 +constexpr char kFaviconsFilename[] = "Favicons";
 +
-+// Map of favicon ID to URLs that use that favicon.
-+using FaviconMap = std::map<int64_t, std::set<GURL>>;
-+
 +void RecursiveReadBookmarksFolder(
 +    const base::Value::Dict* folder,
 +    const std::vector<std::u16string>& parent_path,
@@ -115,67 +117,138 @@ index 0000000000000..e631448aa5137
 +  }
 +}
 +
-+void LoadFaviconURLMappings(sql::Database* db, FaviconMap* favicon_map) {
-+  const char kQuery[] = "SELECT icon_id, page_url FROM icon_mapping";
++// Icons whose bitmaps are byte-identical. Bitmaps are referenced by icon ID
++// only, so collecting favicons does not hold image data.
++struct FaviconGroup {
++  // Icon ID -> bookmarked pages using it. Each icon keeps its own favicon
++  // URL; only the image payload is shared.
++  std::map<int64_t, std::set<GURL>> icon_pages;
++};
++
++// Maps each bookmarked page URL to its icon via the page_url index on
++// icon_mapping, so only icons of bookmarked pages are ever touched.
++std::map<int64_t, std::set<GURL>> LoadBookmarkedIconMappings(
++    sql::Database* db,
++    const std::set<GURL>& page_urls) {
++  std::map<int64_t, std::set<GURL>> icon_pages;
++
++  const char kQuery[] = "SELECT icon_id FROM icon_mapping WHERE page_url = ?";
 +  sql::Statement statement(db->GetUniqueStatement(kQuery));
++  if (!statement.is_valid()) {
++    return icon_pages;
++  }
 +
-+  while (statement.Step()) {
-+    int64_t icon_id = statement.ColumnInt64(0);
-+    GURL url(statement.ColumnString(1));
-+    if (url.is_valid()) {
-+      (*favicon_map)[icon_id].insert(url);
++  for (const GURL& page_url : page_urls) {
++    statement.BindString(0, page_url.spec());
++    while (statement.Step()) {
++      icon_pages[statement.ColumnInt64(0)].insert(page_url);
 +    }
++    statement.Reset(true);
 +  }
++
++  return icon_pages;
 +}
 +
-+void LoadFaviconData(sql::Database* db,
-+                     const FaviconMap& favicon_map,
-+                     favicon_base::FaviconUsageDataList* favicons) {
-+  const char kQuery[] =
-+      "SELECT f.url, fb.image_data "
-+      "FROM favicons f "
-+      "JOIN favicon_bitmaps fb ON f.id = fb.icon_id "
-+      "WHERE f.id = ?";
++// Groups icons whose bitmaps are byte-identical, so each distinct image is
++// decoded and re-encoded once no matter how many sites use it.
++std::vector<FaviconGroup> DeduplicateByBitmap(
++    sql::Database* db,
++    std::map<int64_t, std::set<GURL>> icon_pages) {
++  std::vector<FaviconGroup> groups;
 +
++  const char kQuery[] =
++      "SELECT image_data FROM favicon_bitmaps WHERE icon_id = ? LIMIT 1";
 +  sql::Statement statement(db->GetUniqueStatement(kQuery));
 +  if (!statement.is_valid()) {
-+    return;
++    return groups;
 +  }
 +
-+  for (const auto& [icon_id, urls] : favicon_map) {
++  // Bitmap content hash -> index into |groups|.
++  std::map<std::string, size_t> hash_to_group;
++  for (auto& [icon_id, pages] : icon_pages) {
 +    statement.BindInt64(0, icon_id);
 +    if (statement.Step()) {
-+      GURL favicon_url(statement.ColumnString(0));
-+      if (!favicon_url.is_valid()) {
-+        statement.Reset(true);
-+        continue;
++      base::span<const uint8_t> data = statement.ColumnBlob(0);
++      if (!data.empty()) {
++        std::string hash = crypto::SHA256HashString(base::as_string_view(data));
++        auto [it, inserted] = hash_to_group.emplace(hash, groups.size());
++        if (inserted) {
++          groups.emplace_back();
++        }
++        groups[it->second].icon_pages.emplace(icon_id, std::move(pages));
 +      }
++    }
++    statement.Reset(true);
++  }
 +
-+      std::vector<uint8_t> data = statement.ColumnBlobAsVector(1);
-+      if (data.empty()) {
-+        statement.Reset(true);
-+        continue;
++  return groups;
++}
++
++// Re-encodes the bitmap of each group once and emits one favicon per icon of
++// the group, invoking |on_chunk| every |chunk_size| favicons. Returns false if
++// |on_chunk| asked to stop.
++bool StreamFaviconData(
++    sql::Database* db,
++    std::vector<FaviconGroup> groups,
++    size_t chunk_size,
++    base::FunctionRef<bool(favicon_base::FaviconUsageDataList)> on_chunk) {
++  sql::Statement bitmap_statement(db->GetUniqueStatement(
++      "SELECT image_data FROM favicon_bitmaps WHERE icon_id = ? LIMIT 1"));
++  sql::Statement url_statement(
++      db->GetUniqueStatement("SELECT url FROM favicons WHERE id = ?"));
++  if (!bitmap_statement.is_valid() || !url_statement.is_valid()) {
++    return true;
++  }
++
++  favicon_base::FaviconUsageDataList chunk;
++  for (FaviconGroup& group : groups) {
++    // Every icon of the group has the same bitmap, so the first one's does.
++    std::optional<std::vector<uint8_t>> png_data;
++    bitmap_statement.BindInt64(0, group.icon_pages.begin()->first);
++    if (bitmap_statement.Step()) {
++      std::vector<uint8_t> data = bitmap_statement.ColumnBlobAsVector(0);
++      if (!data.empty()) {
++        png_data = importer::ReencodeFavicon(base::span(data));
 +      }
++    }
++    bitmap_statement.Reset(true);
++    if (!png_data) {
++      continue;
++    }
 +
-+      auto decoded = importer::ReencodeFavicon(base::span(data));
-+      if (!decoded) {
-+        statement.Reset(true);
-+        continue;
++    for (auto& [icon_id, pages] : group.icon_pages) {
++      url_statement.BindInt64(0, icon_id);
++      if (url_statement.Step()) {
++        GURL favicon_url(url_statement.ColumnString(0));
++        if (favicon_url.is_valid()) {
++          favicon_base::FaviconUsageData usage;
++          usage.favicon_url = favicon_url;
++          usage.urls = std::move(pages);
++          usage.png_data = *png_data;
++          chunk.push_back(std::move(usage));
++        }
 +      }
++      url_statement.Reset(true);
 +
-+      favicon_base::FaviconUsageData usage;
-+      usage.favicon_url = favicon_url;
-+      usage.urls = urls;
-+      usage.png_data = std::move(*decoded);
-+      favicons->push_back(std::move(usage));
++      if (chunk.size() >= chunk_size) {
++        if (!on_chunk(std::move(chunk))) {
++          return false;
++        }
++        chunk = favicon_base::FaviconUsageDataList();
++      }
 +    }
-+    statement.Reset(true);
 +  }
++
++  if (!chunk.empty()) {
++    return on_chunk(std::move(chunk));
++  }
++  return true;
 +}
 +
 +}  // namespace
 +
-+ChromeBookmarksResult ImportChromeBookmarks(const base::FilePath& profile_path) {
++ChromeBookmarksResult ImportChromeBookmarks(const base::FilePath& profile_path,
++                                            const std::string& previous_hash) {
 +  ChromeBookmarksResult result;
 +
 +  // Read bookmarks JSON file
@@ -191,6 +264,13 @@ index 0000000000000..e631448aa5137
 +    return result;
 +  }
 +
++  result.file_hash = base::ToLowerASCII(
++      base::HexEncode(crypto::SHA256HashString(bookmarks_content)));
++  if (!previous_hash.empty() && result.file_hash == previous_hash) {
++    LOG(INFO) << "browseros: Bookmarks unchanged since last import";
++    return result;
++  }
++
 +  std::optional<base::Value> bookmarks_value =
 +      base::JSONReader::Read(bookmarks_content, base::JSON_PARSE_RFC);
 +  if (!bookmarks_value || !bookmarks_value->is_dict()) {
@@ -224,7 +304,37 @@ index 0000000000000..e631448aa5137
 +                                 &result.bookmarks);
 +  }
 +
-+  // Import favicons from Favicons database
++  return result;
++}
++
++std::string GetImportedBookmarkKey(
++    const user_data_importer::ImportedBookmarkEntry& bookmark) {
++  // Fields are separated by a byte that cannot occur in titles or URLs.
++  std::string key = bookmark.in_toolbar ? "1" : "0";
++  for (const std::u16string& folder : bookmark.path) {
++    key += '\x1f';
++    key += base::UTF16ToUTF8(folder);
++  }
++  key += '\x1e';
++  key += base::UTF16ToUTF8(bookmark.title);
++  key += '\x1e';
++  key += bookmark.url.spec();
++
++  // 64 bits of the hash keep the checkpoint small for large bookmark sets.
++  std::string hash = crypto::SHA256HashString(key);
++  return base::ToLowerASCII(
++      base::HexEncode(base::as_byte_span(hash).first<8>()));
++}
++
++void ImportChromeFavicons(
++    const base::FilePath& profile_path,
++    const std::set<GURL>& page_urls,
++    size_t chunk_size,
++    base::FunctionRef<bool(favicon_base::FaviconUsageDataList)> on_chunk) {
++  if (page_urls.empty()) {
++    return;
++  }
++
 +  // Original code uses DirName() - try that first, then profile directory
 +  base::FilePath favicons_path =
 +      profile_path.DirName().AppendASCII(kFaviconsFilename);
@@ -232,23 +342,29 @@ index 0000000000000..e631448aa5137
 +    favicons_path = profile_path.AppendASCII(kFaviconsFilename);
 +  }
 +
-+  if (base::PathExists(favicons_path)) {
-+    base::FilePath temp_favicons = CopyToTempFile(favicons_path);
-+    if (!temp_favicons.empty()) {
-+      sql::Database db(kDatabaseTag);
-+      if (db.Open(temp_favicons)) {
-+        FaviconMap favicon_map;
-+        LoadFaviconURLMappings(&db, &favicon_map);
-+        if (!favicon_map.empty()) {
-+          LoadFaviconData(&db, favicon_map, &result.favicons);
-+        }
-+        db.Close();
-+      }
-+      base::DeleteFile(temp_favicons);
++  if (!base::PathExists(favicons_path)) {
++    return;
++  }
++
++  base::FilePath temp_favicons = CopyToTempFile(favicons_path);
++  if (temp_favicons.empty()) {
++    return;
++  }
++
++  {
++    sql::Database db(kDatabaseTag);
++    if (db.Open(temp_favicons)) {
++      std::vector<FaviconGroup> groups = DeduplicateByBitmap(
++          &db, LoadBookmarkedIconMappings(&db, page_urls));
++      LOG(INFO) << "browseros: " << groups.size()
++                << " distinct favicon bitmaps for " << page_urls.size()
++                << " bookmarked URLs";
++      StreamFaviconData(&db, std::move(groups), chunk_size, on_chunk);
++      db.Close();
 +    }
 +  }
 +
-+  return result;
++  base::DeleteFile(temp_favicons);
 +}
 +
 +}  // namespace browseros_importer
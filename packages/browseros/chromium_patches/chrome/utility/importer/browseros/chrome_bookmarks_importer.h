@@ -1,24 +1,28 @@
 diff --git a/chrome/utility/importer/browseros/chrome_bookmarks_importer.h b/chrome/utility/importer/browseros/chrome_bookmarks_importer.h
 new file mode 100644
-index 0000000000000..40dfcc2ce8af8
+index 0000000000000..9347ca5f48b56
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_bookmarks_importer.h
-@@ -0,0 +1,33 @@
+@@ -0,0 +1,59 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome bookmarks importer
 +
 +#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_BOOKMARKS_IMPORTER_H_
 +#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_BOOKMARKS_IMPORTER_H_
 +
++#include <set>
++#include <string>
 +#include <vector>
 +
 +#include "base/files/file_path.h"
++#include "base/functional/function_ref.h"
 +#include "components/favicon_base/favicon_usage_data.h"
 +#include "components/user_data_importer/common/imported_bookmark_entry.h"
++#include "url/gurl.h"
 +
 +namespace browseros_importer {
 +
-+// Result of bookmark import operation containing both bookmarks and favicons.
++// Result of bookmark import operation.
 +struct ChromeBookmarksResult {
 +  ChromeBookmarksResult();
 +  ~ChromeBookmarksResult();
@@ -26,13 +30,35 @@ index 0000000000000..40dfcc2ce8af8
 +  ChromeBookmarksResult& operator=(ChromeBookmarksResult&&);
 +
 +  std::vector<user_data_importer::ImportedBookmarkEntry> bookmarks;
-+  favicon_base::FaviconUsageDataList favicons;
++  // Hex SHA-256 of the Bookmarks file that was read.
++  std::string file_hash;
 +};
 +
-+// Imports bookmarks and favicons from Chrome.
++// Imports bookmarks from Chrome.
 +// |profile_path| should be the Chrome profile directory (e.g., .../Default)
-+// Returns bookmarks and associated favicons. Returns empty result on failure.
-+ChromeBookmarksResult ImportChromeBookmarks(const base::FilePath& profile_path);
++// If the Bookmarks file hashes to |previous_hash|, parsing is skipped and only
++// |file_hash| is set in the result.
++// Returns bookmarks. Returns empty result on failure.
++ChromeBookmarksResult ImportChromeBookmarks(const base::FilePath& profile_path,
++                                            const std::string& previous_hash);
++
++// Returns a stable key for |bookmark| derived from its folder path, title and
++// URL. Import checkpoints record the keys of imported bookmarks so a changed
++// Bookmarks file only brings over the bookmarks that are new.
++std::string GetImportedBookmarkKey(
++    const user_data_importer::ImportedBookmarkEntry& bookmark);
++
++// Imports favicons for |page_urls| (the bookmarked URLs) from Chrome's
++// Favicons database. Each page keeps its own favicon URL; icons with identical
++// bitmaps are re-encoded once and share the result. Favicons are handed to
++// |on_chunk| at most |chunk_size| at a time, so only one chunk of image data
++// is held in memory; |on_chunk| returns false to stop early (e.g. on
++// cancellation).
++void ImportChromeFavicons(
++    const base::FilePath& profile_path,
++    const std::set<GURL>& page_urls,
++    size_t chunk_size,
++    base::FunctionRef<bool(favicon_base::FaviconUsageDataList)> on_chunk);
 +
 +}  // namespace browseros_importer
 +
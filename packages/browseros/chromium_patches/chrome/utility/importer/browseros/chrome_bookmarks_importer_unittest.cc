@@ -0,0 +1,149 @@
+diff --git a/chrome/utility/importer/browseros/chrome_bookmarks_importer_unittest.cc b/chrome/utility/importer/browseros/chrome_bookmarks_importer_unittest.cc
+new file mode 100644
+index 0000000000000..0eb70f6d6701e
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_bookmarks_importer_unittest.cc
+@@ -0,0 +1,143 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome favicon import tests
++
++#include "chrome/utility/importer/browseros/chrome_bookmarks_importer.h"
++
++#include <stddef.h>
++
++#include <set>
++#include <string>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/strings/stringprintf.h"
++#include "chrome/utility/importer/browseros/test/synthetic_chrome_profile.h"
++#include "components/favicon_base/favicon_usage_data.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "url/gurl.h"
++
++namespace browseros_importer {
++
++namespace {
++
++// Bookmarked sites, each with its own favicon URL.
++constexpr size_t kSites = 12;
++// Sites share bitmaps, so every bitmap is used by kSites / kBitmaps sites.
++constexpr size_t kBitmaps = 3;
++
++GURL PageUrl(size_t site) {
++  return GURL(
++      base::StringPrintf("https://site%zu.example.com/page/%zu", site, site));
++}
++
++GURL FaviconUrl(size_t site) {
++  return GURL(
++      base::StringPrintf("https://site%zu.example.com/favicon.ico", site));
++}
++
++class ChromeFaviconImportTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    profile_dir_ = temp_dir_.GetPath().AppendASCII("Default");
++    test::SyntheticProfileSpec spec;
++    spec.bookmarks = kSites;
++    // Every other mapping is for a bookmarked page.
++    spec.favicon_mappings = kSites * 2;
++    spec.distinct_favicon_bitmaps = kBitmaps;
++    ASSERT_TRUE(test::WriteSyntheticChromeProfile(profile_dir_, spec));
++
++    for (size_t site = 0; site < kSites; ++site) {
++      page_urls_.insert(PageUrl(site));
++    }
++  }
++
++  // Imports the favicons of all bookmarked pages, |chunk_size| at a time.
++  std::vector<favicon_base::FaviconUsageDataList> ImportChunks(
++      size_t chunk_size) {
++    std::vector<favicon_base::FaviconUsageDataList> chunks;
++    ImportChromeFavicons(profile_dir_, page_urls_, chunk_size,
++                         [&](favicon_base::FaviconUsageDataList chunk) {
++                           chunks.push_back(std::move(chunk));
++                           return true;
++                         });
++    return chunks;
++  }
++
++  base::ScopedTempDir temp_dir_;
++  base::FilePath profile_dir_;
++  std::set<GURL> page_urls_;
++};
++
++TEST_F(ChromeFaviconImportTest, PagesKeepTheirOwnFaviconUrl) {
++  std::vector<favicon_base::FaviconUsageDataList> chunks = ImportChunks(100);
++  ASSERT_EQ(1u, chunks.size());
++  ASSERT_EQ(kSites, chunks[0].size());
++
++  std::set<GURL> favicon_urls;
++  for (const favicon_base::FaviconUsageData& usage : chunks[0]) {
++    favicon_urls.insert(usage.favicon_url);
++    ASSERT_EQ(1u, usage.urls.size());
++    // The page is on the favicon's site, not on one sharing its bitmap.
++    EXPECT_EQ(usage.favicon_url.host(), usage.urls.begin()->host());
++    EXPECT_FALSE(usage.png_data.empty());
++  }
++  EXPECT_EQ(kSites, favicon_urls.size());
++}
++
++TEST_F(ChromeFaviconImportTest, IdenticalBitmapsShareThePayload) {
++  std::vector<favicon_base::FaviconUsageDataList> chunks = ImportChunks(100);
++  ASSERT_EQ(1u, chunks.size());
++
++  std::set<std::vector<unsigned char>> payloads;
++  for (const favicon_base::FaviconUsageData& usage : chunks[0]) {
++    payloads.insert(usage.png_data);
++  }
++  EXPECT_EQ(kBitmaps, payloads.size());
++
++  // Sites kBitmaps apart use the same bitmap.
++  const favicon_base::FaviconUsageData* first = nullptr;
++  const favicon_base::FaviconUsageData* same_bitmap = nullptr;
++  for (const favicon_base::FaviconUsageData& usage : chunks[0]) {
++    if (usage.favicon_url == FaviconUrl(0)) {
++      first = &usage;
++    } else if (usage.favicon_url == FaviconUrl(kBitmaps)) {
++      same_bitmap = &usage;
++    }
++  }
++  ASSERT_TRUE(first);
++  ASSERT_TRUE(same_bitmap);
++  EXPECT_EQ(first->png_data, same_bitmap->png_data);
++  EXPECT_EQ(std::set<GURL>{PageUrl(0)}, first->urls);
++  EXPECT_EQ(std::set<GURL>{PageUrl(kBitmaps)}, same_bitmap->urls);
++}
++
++TEST_F(ChromeFaviconImportTest, SendsBoundedChunks) {
++  constexpr size_t kChunkSize = 5;
++  std::vector<favicon_base::FaviconUsageDataList> chunks =
++      ImportChunks(kChunkSize);
++
++  // 12 favicons in chunks of 5, 5 and 2.
++  ASSERT_EQ(3u, chunks.size());
++  size_t total = 0;
++  for (const favicon_base::FaviconUsageDataList& chunk : chunks) {
++    EXPECT_LE(chunk.size(), kChunkSize);
++    total += chunk.size();
++  }
++  EXPECT_EQ(kSites, total);
++}
++
++TEST_F(ChromeFaviconImportTest, StopsWhenChunkIsRefused) {
++  size_t calls = 0;
++  ImportChromeFavicons(profile_dir_, page_urls_, /*chunk_size=*/2,
++                       [&](favicon_base::FaviconUsageDataList chunk) {
++                         ++calls;
++                         return false;
++                       });
++  EXPECT_EQ(1u, calls);
++}
++
++}  // namespace
++
++}  // namespace browseros_importer
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_cookie_importer.cc b/chrome/utility/importer/browseros/chrome_cookie_importer.cc
 new file mode 100644
-index 0000000000000..570f83ac1274c
+index 0000000000000..1dda677f58608
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_cookie_importer.cc
-@@ -0,0 +1,306 @@
+@@ -0,0 +1,299 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome cookie importer implementation
 +
@@ -14,6 +14,7 @@ index 0000000000000..570f83ac1274c
 +#include "base/files/file_util.h"
 +#include "base/logging.h"
 +#include "chrome/utility/importer/browseros/chrome_decryptor.h"
++#include "chrome/utility/importer/browseros/chrome_importer_utils.h"
 +#include "sql/database.h"
 +#include "sql/statement.h"
 +
@@ -54,17 +55,6 @@ index 0000000000000..570f83ac1274c
 +  return temp_path;
 +}
 +
-+// Convert Chrome's microseconds since Windows epoch to base::Time
-+// Chrome stores times as microseconds since Jan 1, 1601 (Windows epoch)
-+base::Time ChromeTimeToBaseTime(int64_t chrome_time) {
-+  if (chrome_time == 0) {
-+    return base::Time();
-+  }
-+  // base::Time::FromDeltaSinceWindowsEpoch handles the conversion
-+  return base::Time::FromDeltaSinceWindowsEpoch(
-+      base::Microseconds(chrome_time));
-+}
-+
 +// Map Chrome's samesite integer to net::CookieSameSite
 +net::CookieSameSite IntToSameSite(int value) {
 +  switch (value) {
@@ -179,7 +169,8 @@ index 0000000000000..570f83ac1274c
 +}  // namespace
 +
 +std::vector<ImportedCookieEntry> ImportChromeCookies(
-+    const base::FilePath& profile_path) {
++    const base::FilePath& profile_path,
++    base::Time since) {
 +  std::vector<ImportedCookieEntry> cookies;
 +
 +  // Extract encryption key (same key used for passwords and cookies)
@@ -237,7 +228,7 @@ index 0000000000000..570f83ac1274c
 +        "is_secure, is_httponly, creation_utc, last_access_utc, "
 +        "samesite, priority, source_scheme, source_port, is_persistent, "
 +        "last_update_utc "
-+        "FROM cookies";
++        "FROM cookies WHERE last_update_utc > ?";
 +
 +    sql::Statement statement(db.GetUniqueStatement(kQuery));
 +    if (!statement.is_valid()) {
@@ -246,6 +237,8 @@ index 0000000000000..570f83ac1274c
 +      return cookies;
 +    }
 +
++    statement.BindInt64(0, BaseTimeToChromeTime(since));
++
 +    while (statement.Step()) {
 +      ImportedCookieEntry entry;
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_cookie_importer.h b/chrome/utility/importer/browseros/chrome_cookie_importer.h
 new file mode 100644
-index 0000000000000..edfd9f068250b
+index 0000000000000..1c3127b18d15b
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_cookie_importer.h
-@@ -0,0 +1,52 @@
+@@ -0,0 +1,54 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome cookie importer interface
 +
@@ -49,9 +49,11 @@ index 0000000000000..edfd9f068250b
 +// Imports cookies from Chrome's Cookies database.
 +// Returns a vector of ImportedCookieEntry with decrypted values.
 +// profile_path should point to the Chrome profile directory containing
-+// the "Cookies" database file.
++// the "Cookies" database file. Only cookies whose last_update_utc is newer
++// than |since| are returned; pass a null time to import all cookies.
 +std::vector<ImportedCookieEntry> ImportChromeCookies(
-+    const base::FilePath& profile_path);
++    const base::FilePath& profile_path,
++    base::Time since);
 +
 +}  // namespace browseros_importer
 +
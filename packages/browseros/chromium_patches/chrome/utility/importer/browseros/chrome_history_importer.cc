@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_history_importer.cc b/chrome/utility/importer/browseros/chrome_history_importer.cc
 new file mode 100644
-index 0000000000000..ec7b96bb6b854
+index 0000000000000..9fdf8a5eaeabc
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_history_importer.cc
-@@ -0,0 +1,92 @@
+@@ -0,0 +1,96 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome history importer implementation
 +
@@ -27,7 +27,8 @@ index 0000000000000..ec7b96bb6b854
 +}  // namespace
 +
 +std::vector<user_data_importer::ImporterURLRow> ImportChromeHistory(
-+    const base::FilePath& profile_path) {
++    const base::FilePath& profile_path,
++    base::Time since) {
 +  std::vector<user_data_importer::ImporterURLRow> rows;
 +
 +  base::FilePath history_path = profile_path.AppendASCII(kHistoryFilename);
@@ -51,6 +52,7 @@ index 0000000000000..ec7b96bb6b854
 +  // Query URLs with visit information, filtering out internal navigation types
 +  // - CHAIN_END: Only get final URLs in redirect chains
 +  // - Exclude SUBFRAME and KEYWORD_GENERATED transitions
++  // - Only visits newer than |since| (0 for a full import)
 +  // Use scope block to ensure statement is destroyed before db.Close()
 +  {
 +    const char kQuery[] =
@@ -58,7 +60,8 @@ index 0000000000000..ec7b96bb6b854
 +        "FROM urls u JOIN visits v ON u.id = v.url "
 +        "WHERE hidden = 0 "
 +        "AND (transition & ?) != 0 "
-+        "AND (transition & ?) NOT IN (?, ?, ?)";
++        "AND (transition & ?) NOT IN (?, ?, ?) "
++        "AND v.visit_time > ?";
 +
 +    sql::Statement statement(db.GetUniqueStatement(kQuery));
 +    if (!statement.is_valid()) {
@@ -72,6 +75,7 @@ index 0000000000000..ec7b96bb6b854
 +    statement.BindInt64(2, ui::PAGE_TRANSITION_AUTO_SUBFRAME);
 +    statement.BindInt64(3, ui::PAGE_TRANSITION_MANUAL_SUBFRAME);
 +    statement.BindInt64(4, ui::PAGE_TRANSITION_KEYWORD_GENERATED);
++    statement.BindInt64(5, BaseTimeToChromeTime(since));
 +
 +    while (statement.Step()) {
 +      GURL url(statement.ColumnString(0));
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_history_importer.h b/chrome/utility/importer/browseros/chrome_history_importer.h
 new file mode 100644
-index 0000000000000..3de1c03c501a9
+index 0000000000000..1917c7a3e1a3c
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_history_importer.h
-@@ -0,0 +1,22 @@
+@@ -0,0 +1,26 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome history importer
 +
@@ -13,15 +13,19 @@ index 0000000000000..3de1c03c501a9
 +#include <vector>
 +
 +#include "base/files/file_path.h"
++#include "base/time/time.h"
 +#include "components/user_data_importer/common/importer_url_row.h"
 +
 +namespace browseros_importer {
 +
 +// Imports browsing history from Chrome's History database.
 +// |profile_path| should be the Chrome profile directory (e.g., .../Default)
++// Only visits newer than |since| are returned; pass a null time to import
++// the full history.
 +// Returns a vector of ImporterURLRow. Returns empty vector on failure.
 +std::vector<user_data_importer::ImporterURLRow> ImportChromeHistory(
-+    const base::FilePath& profile_path);
++    const base::FilePath& profile_path,
++    base::Time since);
 +
 +}  // namespace browseros_importer
 +
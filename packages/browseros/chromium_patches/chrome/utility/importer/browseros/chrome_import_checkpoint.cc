@@ -0,0 +1,65 @@
+diff --git a/chrome/utility/importer/browseros/chrome_import_checkpoint.cc b/chrome/utility/importer/browseros/chrome_import_checkpoint.cc
+new file mode 100644
+index 0000000000000..eceac0ebd4ea2
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_import_checkpoint.cc
+@@ -0,0 +1,59 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome importer checkpoints implementation
++
++#include "chrome/utility/importer/browseros/chrome_import_checkpoint.h"
++
++#include "chrome/common/importer/profile_import.mojom.h"
++
++namespace browseros_importer {
++
++namespace {
++
++// Times cross the mojo boundary as microseconds since the Windows epoch.
++int64_t ToMojoTime(base::Time time) {
++  return time.ToDeltaSinceWindowsEpoch().InMicroseconds();
++}
++
++base::Time FromMojoTime(int64_t time) {
++  return base::Time::FromDeltaSinceWindowsEpoch(base::Microseconds(time));
++}
++
++}  // namespace
++
++ImportCheckpoint::ImportCheckpoint() = default;
++ImportCheckpoint::ImportCheckpoint(const ImportCheckpoint& other) = default;
++ImportCheckpoint& ImportCheckpoint::operator=(const ImportCheckpoint& other) =
++    default;
++ImportCheckpoint::~ImportCheckpoint() = default;
++
++chrome::mojom::ImportCheckpointPtr ToMojoImportCheckpoint(
++    const ImportCheckpoint& checkpoint) {
++  auto mojo_checkpoint = chrome::mojom::ImportCheckpoint::New();
++  mojo_checkpoint->history_visit_time =
++      ToMojoTime(checkpoint.history_visit_time);
++  mojo_checkpoint->cookie_last_update =
++      ToMojoTime(checkpoint.cookie_last_update);
++  mojo_checkpoint->password_last_used =
++      ToMojoTime(checkpoint.password_last_used);
++  mojo_checkpoint->bookmarks_hash = checkpoint.bookmarks_hash;
++  mojo_checkpoint->bookmark_keys.assign(checkpoint.bookmark_keys.begin(),
++                                        checkpoint.bookmark_keys.end());
++  return mojo_checkpoint;
++}
++
++ImportCheckpoint FromMojoImportCheckpoint(
++    const chrome::mojom::ImportCheckpoint& mojo_checkpoint) {
++  ImportCheckpoint checkpoint;
++  checkpoint.history_visit_time =
++      FromMojoTime(mojo_checkpoint.history_visit_time);
++  checkpoint.cookie_last_update =
++      FromMojoTime(mojo_checkpoint.cookie_last_update);
++  checkpoint.password_last_used =
++      FromMojoTime(mojo_checkpoint.password_last_used);
++  checkpoint.bookmarks_hash = mojo_checkpoint.bookmarks_hash;
++  checkpoint.bookmark_keys.insert(mojo_checkpoint.bookmark_keys.begin(),
++                                  mojo_checkpoint.bookmark_keys.end());
++  return checkpoint;
++}
++
++}  // namespace browseros_importer
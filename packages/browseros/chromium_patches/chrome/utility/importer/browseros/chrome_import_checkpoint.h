@@ -0,0 +1,58 @@
+diff --git a/chrome/utility/importer/browseros/chrome_import_checkpoint.h b/chrome/utility/importer/browseros/chrome_import_checkpoint.h
+new file mode 100644
+index 0000000000000..a36ed7f0fbfcb
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_import_checkpoint.h
+@@ -0,0 +1,52 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome importer checkpoints for incremental re-import
++
++#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_CHECKPOINT_H_
++#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_CHECKPOINT_H_
++
++#include <set>
++#include <string>
++
++#include "base/time/time.h"
++#include "chrome/common/importer/profile_import.mojom-forward.h"
++
++namespace browseros_importer {
++
++// High-water marks recorded per data type after importing from a Chrome
++// profile. An incremental import only transfers rows newer than these.
++// Null times / empty hash mean "import everything". The browser keeps them in
++// chrome/browser/importer/browseros/chrome_import_checkpoint_store.h.
++struct ImportCheckpoint {
++  ImportCheckpoint();
++  ImportCheckpoint(const ImportCheckpoint& other);
++  ImportCheckpoint& operator=(const ImportCheckpoint& other);
++  ~ImportCheckpoint();
++
++  // Newest visits.visit_time imported from History.
++  base::Time history_visit_time;
++  // Newest cookies.last_update_utc imported from Cookies.
++  base::Time cookie_last_update;
++  // Newest of logins.date_last_used, date_password_modified and date_created
++  // imported from Login Data.
++  base::Time password_last_used;
++  // Hex SHA-256 of the Bookmarks file at the last import.
++  std::string bookmarks_hash;
++  // GetImportedBookmarkKey() of the bookmarks in the Bookmarks file at the
++  // last import, at most kMaxImportCheckpointBookmarkKeys of them. Bookmarks
++  // with a recorded key are not imported again.
++  std::set<std::string> bookmark_keys;
++};
++
++// Bounds the checkpoint sent to the importer process on every import.
++inline constexpr size_t kMaxImportCheckpointBookmarkKeys = 50000;
++
++// Converts between ImportCheckpoint and the mojo struct it travels in between
++// the browser and the importer process.
++chrome::mojom::ImportCheckpointPtr ToMojoImportCheckpoint(
++    const ImportCheckpoint& checkpoint);
++ImportCheckpoint FromMojoImportCheckpoint(
++    const chrome::mojom::ImportCheckpoint& mojo_checkpoint);
++
++}  // namespace browseros_importer
++
++#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_CHECKPOINT_H_
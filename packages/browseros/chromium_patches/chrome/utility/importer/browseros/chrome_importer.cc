@@ -1,16 +1,23 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer.cc b/chrome/utility/importer/browseros/chrome_importer.cc
 new file mode 100644
-index 0000000000000..41dce65dacf4f
+index 0000000000000..f202456822348
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer.cc
-@@ -0,0 +1,202 @@
+@@ -0,0 +1,316 @@
 +// Copyright 2023 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/utility/importer/browseros/chrome_importer.h"
 +
++#include <algorithm>
++#include <set>
++#include <string>
++#include <utility>
++#include <vector>
++
 +#include "base/logging.h"
++#include "base/trace_event/trace_event.h"
 +#include "chrome/common/importer/importer_bridge.h"
 +#include "chrome/grit/generated_resources.h"
 +#include "chrome/utility/importer/browseros/chrome_autofill_importer.h"
@@ -21,6 +28,14 @@ index 0000000000000..41dce65dacf4f
 +#include "chrome/utility/importer/browseros/chrome_password_importer.h"
 +#include "components/user_data_importer/common/importer_data_types.h"
 +#include "ui/base/l10n/l10n_util.h"
++#include "url/gurl.h"
++
++namespace {
++
++// Number of favicons re-encoded and sent to the browser at a time.
++constexpr size_t kFaviconChunkSize = 100;
++
++}  // namespace
 +
 +ChromeImporter::ChromeImporter() = default;
 +
@@ -30,8 +45,15 @@ index 0000000000000..41dce65dacf4f
 +    const user_data_importer::SourceProfile& source_profile,
 +    uint16_t items,
 +    ImporterBridge* bridge) {
++  TRACE_EVENT("browseros", "ChromeImporter::StartImport", "items", items);
 +  bridge_ = bridge;
 +  source_path_ = source_profile.source_path;
++  incremental_ = (items & user_data_importer::SINCE_LAST_IMPORT) != 0;
++  checkpoint_ = bridge_->GetImportCheckpoint();
++
++  if (incremental_) {
++    LOG(INFO) << "browseros: Importing changes since last import";
++  }
 +
 +  bridge_->NotifyStarted();
 +
@@ -75,10 +97,13 @@ index 0000000000000..41dce65dacf4f
 +}
 +
 +void ChromeImporter::ImportHistory() {
++  TRACE_EVENT("browseros", "ChromeImporter::ImportHistory");
 +  LOG(INFO) << "browseros: Starting history import";
 +
 +  std::vector<user_data_importer::ImporterURLRow> rows =
-+      browseros_importer::ImportChromeHistory(source_path_);
++      browseros_importer::ImportChromeHistory(
++          source_path_,
++          incremental_ ? checkpoint_.history_visit_time : base::Time());
 +
 +  if (rows.empty()) {
 +    LOG(INFO) << "browseros: No history to import";
@@ -87,19 +112,46 @@ index 0000000000000..41dce65dacf4f
 +
 +  LOG(INFO) << "browseros: Importing " << rows.size() << " history items";
 +
-+  if (!cancelled()) {
-+    bridge_->SetHistoryItems(rows,
-+                             user_data_importer::VISIT_SOURCE_CHROME_IMPORTED);
++  if (cancelled()) {
++    return;
 +  }
 +
++  bridge_->SetHistoryItems(rows,
++                           user_data_importer::VISIT_SOURCE_CHROME_IMPORTED);
++
++  for (const auto& row : rows) {
++    checkpoint_.history_visit_time =
++        std::max(checkpoint_.history_visit_time, row.last_visit);
++  }
++  SaveCheckpoint();
++
 +  LOG(INFO) << "browseros: History import complete";
 +}
 +
 +void ChromeImporter::ImportBookmarks() {
++  TRACE_EVENT("browseros", "ChromeImporter::ImportBookmarks");
 +  LOG(INFO) << "browseros: Starting bookmarks import";
 +
 +  browseros_importer::ChromeBookmarksResult result =
-+      browseros_importer::ImportChromeBookmarks(source_path_);
++      browseros_importer::ImportChromeBookmarks(
++          source_path_, incremental_ ? checkpoint_.bookmarks_hash : "");
++
++  // A changed Bookmarks file still holds everything imported before; only
++  // send the bookmarks that are new since then.
++  std::vector<std::string> keys;
++  keys.reserve(result.bookmarks.size());
++  for (const auto& bookmark : result.bookmarks) {
++    keys.push_back(browseros_importer::GetImportedBookmarkKey(bookmark));
++  }
++  if (incremental_) {
++    std::vector<user_data_importer::ImportedBookmarkEntry> new_bookmarks;
++    for (size_t i = 0; i < keys.size(); ++i) {
++      if (!checkpoint_.bookmark_keys.contains(keys[i])) {
++        new_bookmarks.push_back(std::move(result.bookmarks[i]));
++      }
++    }
++    result.bookmarks = std::move(new_bookmarks);
++  }
 +
 +  if (!result.bookmarks.empty() && !cancelled()) {
 +    LOG(INFO) << "browseros: Importing " << result.bookmarks.size()
@@ -110,20 +162,59 @@ index 0000000000000..41dce65dacf4f
 +    LOG(INFO) << "browseros: No bookmarks to import";
 +  }
 +
-+  if (!result.favicons.empty() && !cancelled()) {
-+    LOG(INFO) << "browseros: Importing " << result.favicons.size()
-+              << " favicons";
-+    bridge_->SetFavicons(result.favicons);
++  if (!result.bookmarks.empty() && !cancelled()) {
++    std::set<GURL> bookmarked_urls;
++    for (const auto& bookmark : result.bookmarks) {
++      if (!bookmark.is_folder) {
++        bookmarked_urls.insert(bookmark.url);
++      }
++    }
++
++    size_t favicon_count = 0;
++    browseros_importer::ImportChromeFavicons(
++        source_path_, bookmarked_urls, kFaviconChunkSize,
++        [&](favicon_base::FaviconUsageDataList chunk) {
++          if (cancelled()) {
++            return false;
++          }
++          favicon_count += chunk.size();
++          bridge_->SetFaviconsChunk(chunk);
++          return true;
++        });
++    LOG(INFO) << "browseros: Imported " << favicon_count << " favicons";
++  }
++
++  if (!result.file_hash.empty() && !cancelled()) {
++    // An unchanged file is not parsed and keeps the keys it had. A parsed one
++    // records only the bookmarks it still holds, so the keys stay bounded by
++    // the source instead of growing with every import.
++    if (result.file_hash != checkpoint_.bookmarks_hash || !incremental_) {
++      if (keys.size() > browseros_importer::kMaxImportCheckpointBookmarkKeys) {
++        LOG(WARNING) << "browseros: Recording only the first "
++                     << browseros_importer::kMaxImportCheckpointBookmarkKeys
++                     << " of " << keys.size() << " bookmarks in checkpoint";
++        keys.resize(browseros_importer::kMaxImportCheckpointBookmarkKeys);
++      }
++      checkpoint_.bookmark_keys =
++          std::set<std::string>(keys.begin(), keys.end());
++    }
++    checkpoint_.bookmarks_hash = result.file_hash;
++    SaveCheckpoint();
 +  }
 +
 +  LOG(INFO) << "browseros: Bookmarks import complete";
 +}
 +
 +void ChromeImporter::ImportPasswords() {
++  TRACE_EVENT("browseros", "ChromeImporter::ImportPasswords");
 +  LOG(INFO) << "browseros: Starting password import";
 +
++  base::Time newest_use;
 +  std::vector<user_data_importer::ImportedPasswordForm> passwords =
-+      browseros_importer::ImportChromePasswords(source_path_);
++      browseros_importer::ImportChromePasswords(
++          source_path_,
++          incremental_ ? checkpoint_.password_last_used : base::Time(),
++          &newest_use);
 +
 +  if (passwords.empty()) {
 +    LOG(INFO) << "browseros: No passwords to import";
@@ -139,14 +230,23 @@ index 0000000000000..41dce65dacf4f
 +    bridge_->SetPasswordForm(password);
 +  }
 +
++  if (!cancelled()) {
++    checkpoint_.password_last_used =
++        std::max(checkpoint_.password_last_used, newest_use);
++    SaveCheckpoint();
++  }
++
 +  LOG(INFO) << "browseros: Password import complete";
 +}
 +
 +void ChromeImporter::ImportCookies() {
++  TRACE_EVENT("browseros", "ChromeImporter::ImportCookies");
 +  LOG(INFO) << "browseros: Starting cookie import";
 +
 +  std::vector<browseros_importer::ImportedCookieEntry> cookies =
-+      browseros_importer::ImportChromeCookies(source_path_);
++      browseros_importer::ImportChromeCookies(
++          source_path_,
++          incremental_ ? checkpoint_.cookie_last_update : base::Time());
 +
 +  if (cookies.empty()) {
 +    LOG(INFO) << "browseros: No cookies to import";
@@ -162,10 +262,19 @@ index 0000000000000..41dce65dacf4f
 +    bridge_->SetCookie(cookie);
 +  }
 +
++  if (!cancelled()) {
++    for (const auto& cookie : cookies) {
++      checkpoint_.cookie_last_update =
++          std::max(checkpoint_.cookie_last_update, cookie.last_update_utc);
++    }
++    SaveCheckpoint();
++  }
++
 +  LOG(INFO) << "browseros: Cookie import complete";
 +}
 +
 +void ChromeImporter::ImportAutofillFormData() {
++  TRACE_EVENT("browseros", "ChromeImporter::ImportAutofillFormData");
 +  LOG(INFO) << "browseros: Starting autofill import";
 +
 +  std::vector<ImporterAutofillFormDataEntry> entries =
@@ -187,6 +296,7 @@ index 0000000000000..41dce65dacf4f
 +}
 +
 +void ChromeImporter::ImportExtensions() {
++  TRACE_EVENT("browseros", "ChromeImporter::ImportExtensions");
 +  LOG(INFO) << "browseros: Starting extensions import";
 +
 +  std::vector<std::string> extension_ids =
@@ -206,3 +316,7 @@ index 0000000000000..41dce65dacf4f
 +
 +  LOG(INFO) << "browseros: Extensions import complete";
 +}
++
++void ChromeImporter::SaveCheckpoint() {
++  bridge_->SetImportCheckpoint(checkpoint_);
++}
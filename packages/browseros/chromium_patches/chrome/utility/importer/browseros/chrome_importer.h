@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer.h b/chrome/utility/importer/browseros/chrome_importer.h
 new file mode 100644
-index 0000000000000..da685413cee76
+index 0000000000000..ed41b446d02cb
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer.h
-@@ -0,0 +1,45 @@
+@@ -0,0 +1,65 @@
 +// Copyright 2023 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,6 +14,7 @@ index 0000000000000..da685413cee76
 +#include <stdint.h>
 +
 +#include "base/files/file_path.h"
++#include "chrome/utility/importer/browseros/chrome_import_checkpoint.h"
 +#include "chrome/utility/importer/importer.h"
 +
 +// ChromeImporter orchestrates importing user data from Chrome/Chromium browsers.
@@ -24,6 +25,14 @@ index 0000000000000..da685413cee76
 +// - chrome_cookie_importer: cookies
 +// - chrome_autofill_importer: autofill form data
 +// - chrome_extensions_importer: extension IDs
++//
++// The browser hands over the checkpoint of the last import (see
++// chrome_import_checkpoint.h) and saves the advanced checkpoint this importer
++// reports through ImporterBridge after each data type completes. When |items|
++// carries SINCE_LAST_IMPORT, only data newer than the checkpoint and
++// bookmarks not imported before are transferred, and an unchanged Bookmarks
++// file is skipped entirely. Because checkpoints advance per type, an
++// interrupted import resumes where it left off on the next incremental run.
 +class ChromeImporter : public Importer {
 + public:
 +  ChromeImporter();
@@ -45,7 +54,18 @@ index 0000000000000..da685413cee76
 +  void ImportAutofillFormData();
 +  void ImportExtensions();
 +
++  // Reports |checkpoint_| to the browser after a data type finished without
++  // cancellation.
++  void SaveCheckpoint();
++
 +  base::FilePath source_path_;
++
++  // True when only data newer than |checkpoint_| should be imported.
++  bool incremental_ = false;
++
++  // Checkpoint loaded at the start of the import and advanced as each data
++  // type completes.
++  browseros_importer::ImportCheckpoint checkpoint_;
 +};
 +
 +#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORTER_H_
@@ -0,0 +1,398 @@
+diff --git a/chrome/utility/importer/browseros/chrome_importer_perftest.cc b/chrome/utility/importer/browseros/chrome_importer_perftest.cc
+new file mode 100644
+index 0000000000000..48e7da29b133c
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_importer_perftest.cc
+@@ -0,0 +1,392 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome importer benchmarks against synthetic Chrome profiles.
++//
++// Run with --browseros-import-rows=N (default 10000) to pick the fixture
++// scale, e.g. 1000 .. 1000000. Peak RSS is reset once the fixture is
++// written, so it only covers the import; it is reported where the platform
++// can reset the high-water mark (Linux, ChromeOS, Android). IPC messages are
++// counted on the receiving end of a real ExternalProcessImporterBridge.
++//
++// Build with the browseros_perftests group.
++
++#include <stddef.h>
++#include <stdint.h>
++
++#include <algorithm>
++#include <optional>
++#include <set>
++#include <string>
++#include <vector>
++
++#include "base/command_line.h"
++#include "base/containers/flat_map.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/functional/bind.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/run_loop.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_split.h"
++#include "base/strings/string_util.h"
++#include "base/task/bind_post_task.h"
++#include "base/task/thread_pool.h"
++#include "base/test/scoped_path_override.h"
++#include "base/test/task_environment.h"
++#include "base/threading/sequence_bound.h"
++#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
++#include "build/build_config.h"
++#include "chrome/common/chrome_paths.h"
++#include "chrome/common/importer/importer_autofill_form_data_entry.h"
++#include "chrome/common/importer/profile_import.mojom.h"
++#include "chrome/utility/importer/browseros/chrome_autofill_importer.h"
++#include "chrome/utility/importer/browseros/chrome_bookmarks_importer.h"
++#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_extensions_importer.h"
++#include "chrome/utility/importer/browseros/chrome_history_importer.h"
++#include "chrome/utility/importer/browseros/chrome_importer.h"
++#include "chrome/utility/importer/browseros/chrome_password_importer.h"
++#include "chrome/utility/importer/browseros/test/synthetic_chrome_profile.h"
++#include "chrome/utility/importer/external_process_importer_bridge.h"
++#include "components/user_data_importer/common/imported_bookmark_entry.h"
++#include "components/user_data_importer/common/importer_data_types.h"
++#include "components/user_data_importer/common/importer_url_row.h"
++#include "mojo/public/cpp/bindings/pending_receiver.h"
++#include "mojo/public/cpp/bindings/pending_remote.h"
++#include "mojo/public/cpp/bindings/receiver.h"
++#include "mojo/public/cpp/bindings/shared_remote.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "url/gurl.h"
++
++namespace browseros_importer {
++
++namespace {
++
++constexpr char kRowsSwitch[] = "browseros-import-rows";
++constexpr size_t kDefaultRows = 10000;
++
++constexpr size_t kFaviconChunkSize = 100;
++
++size_t GetRows() {
++  size_t rows = kDefaultRows;
++  std::string value =
++      base::CommandLine::ForCurrentProcess()->GetSwitchValueASCII(kRowsSwitch);
++  if (!value.empty() && base::StringToSizeT(value, &rows) && rows > 0) {
++    return rows;
++  }
++  return kDefaultRows;
++}
++
++// Resets the process's peak RSS so later readings exclude fixture setup.
++// Returns false where the high-water mark cannot be reset.
++bool ResetPeakRss() {
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS) || BUILDFLAG(IS_ANDROID)
++  // "5" resets VmHWM to the current RSS; see proc(5).
++  return base::WriteFile(base::FilePath("/proc/self/clear_refs"), "5");
++#else
++  return false;
++#endif
++}
++
++// Peak RSS since the last ResetPeakRss().
++std::optional<int64_t> GetPeakRssBytes() {
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS) || BUILDFLAG(IS_ANDROID)
++  std::string status;
++  if (!base::ReadFileToString(base::FilePath("/proc/self/status"), &status)) {
++    return std::nullopt;
++  }
++  for (std::string_view line : base::SplitStringPiece(
++           status, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
++    if (!base::StartsWith(line, "VmHWM:")) {
++      continue;
++    }
++    // "VmHWM:    123456 kB"
++    std::vector<std::string_view> parts = base::SplitStringPiece(
++        line.substr(6), " ", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
++    int64_t kb = 0;
++    if (!parts.empty() && base::StringToInt64(parts[0], &kb)) {
++      return kb * 1024;
++    }
++  }
++#endif
++  return std::nullopt;
++}
++
++// Per-data-type rows and IPC messages that reached the browser side.
++struct ImportCounts {
++  size_t bookmarks = 0;
++  size_t history = 0;
++  size_t favicons = 0;
++  size_t passwords = 0;
++  size_t cookies = 0;
++  size_t autofill = 0;
++  size_t extensions = 0;
++  size_t ipc_messages = 0;
++};
++
++// Stands in for ExternalProcessImporterClient: counts every message an
++// ExternalProcessImporterBridge sends, and reports the counts when the
++// import finishes. Lives on its own sequence so the bridge's sync checkpoint
++// request is answered while the importer waits.
++class CountingObserver : public chrome::mojom::ProfileImportObserver {
++ public:
++  CountingObserver(
++      mojo::PendingReceiver<chrome::mojom::ProfileImportObserver> receiver,
++      base::OnceCallback<void(ImportCounts)> on_finished)
++      : receiver_(this, std::move(receiver)),
++        on_finished_(std::move(on_finished)) {}
++
++  // chrome::mojom::ProfileImportObserver:
++  void OnImportStart() override { Count(); }
++  void OnImportFinished(bool succeeded, const std::string& error) override {
++    Count();
++    std::move(on_finished_).Run(counts_);
++  }
++  void OnImportItemStart(user_data_importer::ImportItem item) override {
++    Count();
++  }
++  void OnImportItemFinished(user_data_importer::ImportItem item) override {
++    Count();
++  }
++  void OnHistoryImportStart(uint32_t total_history_rows_count) override {
++    Count();
++  }
++  void OnHistoryImportGroup(
++      const std::vector<user_data_importer::ImporterURLRow>& group,
++      int visit_source) override {
++    Count();
++    counts_.history += group.size();
++  }
++  void OnHomePageImportReady(const GURL& home_page) override { Count(); }
++  void OnBookmarksImportStart(const std::u16string& first_folder_name,
++                              uint32_t total_bookmarks_count) override {
++    Count();
++  }
++  void OnBookmarksImportGroup(
++      const std::vector<user_data_importer::ImportedBookmarkEntry>& group)
++      override {
++    Count();
++    counts_.bookmarks += group.size();
++  }
++  void OnFaviconsImportStart(uint32_t total_favicons_count) override {
++    Count();
++  }
++  void OnFaviconsImportGroup(
++      const favicon_base::FaviconUsageDataList& group) override {
++    Count();
++    counts_.favicons += group.size();
++  }
++  void OnPasswordFormImportReady(
++      const user_data_importer::ImportedPasswordForm& form) override {
++    Count();
++    counts_.passwords++;
++  }
++  void OnCookieImportReady(
++      chrome::mojom::ImportedCookieEntryPtr cookie) override {
++    Count();
++    counts_.cookies++;
++  }
++  void OnFaviconsChunkReady(
++      const favicon_base::FaviconUsageDataList& favicons) override {
++    Count();
++    counts_.favicons += favicons.size();
++  }
++  void OnKeywordsImportReady(
++      const std::vector<user_data_importer::SearchEngineInfo>& search_engines,
++      bool unique_on_host_and_path) override {
++    Count();
++  }
++  void OnAutofillFormDataImportStart(
++      uint32_t total_autofill_form_data_entry_count) override {
++    Count();
++  }
++  void OnAutofillFormDataImportGroup(
++      const std::vector<ImporterAutofillFormDataEntry>& group) override {
++    Count();
++    counts_.autofill += group.size();
++  }
++  void OnExtensionsImportReady(
++      const std::vector<std::string>& extension_ids) override {
++    Count();
++    counts_.extensions += extension_ids.size();
++  }
++  void GetImportCheckpoint(GetImportCheckpointCallback callback) override {
++    Count();
++    std::move(callback).Run(chrome::mojom::ImportCheckpoint::New());
++  }
++  void OnImportCheckpointReady(
++      chrome::mojom::ImportCheckpointPtr checkpoint) override {
++    Count();
++  }
++
++ private:
++  void Count() { counts_.ipc_messages++; }
++
++  mojo::Receiver<chrome::mojom::ProfileImportObserver> receiver_;
++  base::OnceCallback<void(ImportCounts)> on_finished_;
++  ImportCounts counts_;
++};
++
++class ChromeImporterPerfTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    rows_ = GetRows();
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    profile_dir_ = temp_dir_.GetPath().AppendASCII("Default");
++    // Nothing in the benchmark may touch the real user data dir.
++    user_data_override_.emplace(chrome::DIR_USER_DATA,
++                                temp_dir_.GetPath().AppendASCII("UserData"));
++
++    base::ElapsedTimer timer;
++    ASSERT_TRUE(test::WriteSyntheticChromeProfile(
++        profile_dir_, test::SyntheticProfileSpec::ForRows(rows_)));
++    LOG(INFO) << "browseros: Generated " << rows_ << "-row profile in "
++              << timer.Elapsed().InMilliseconds() << " ms";
++
++    peak_rss_reset_ = ResetPeakRss();
++  }
++
++  void Report(const std::string& data_type,
++              size_t rows,
++              base::TimeDelta elapsed,
++              std::optional<size_t> ipc_messages = std::nullopt) {
++    perf_test::PerfResultReporter reporter(
++        "BrowserOSImporter." + data_type,
++        "rows_" + base::NumberToString(rows_));
++    reporter.RegisterImportantMetric(".rows", "count");
++    reporter.RegisterImportantMetric(".time", "ms");
++    reporter.RegisterImportantMetric(".rows_per_second", "count");
++
++    const double seconds = std::max(elapsed.InSecondsF(), 1e-6);
++    reporter.AddResult(".rows", rows);
++    reporter.AddResult(".time", elapsed);
++    reporter.AddResult(".rows_per_second", rows / seconds);
++
++    std::optional<int64_t> peak_rss = GetPeakRssBytes();
++    if (peak_rss_reset_ && peak_rss) {
++      reporter.RegisterImportantMetric(".peak_rss", "bytes");
++      reporter.AddResult(".peak_rss", *peak_rss);
++    }
++    if (ipc_messages) {
++      reporter.RegisterImportantMetric(".ipc_messages", "count");
++      reporter.AddResult(".ipc_messages", *ipc_messages);
++    }
++  }
++
++  base::test::TaskEnvironment task_environment_;
++  size_t rows_ = 0;
++  base::ScopedTempDir temp_dir_;
++  base::FilePath profile_dir_;
++  std::optional<base::ScopedPathOverride> user_data_override_;
++  bool peak_rss_reset_ = false;
++};
++
++TEST_F(ChromeImporterPerfTest, History) {
++  base::ElapsedTimer timer;
++  auto rows = ImportChromeHistory(profile_dir_, base::Time());
++  Report("History", rows.size(), timer.Elapsed());
++  EXPECT_EQ(rows_, rows.size());
++}
++
++TEST_F(ChromeImporterPerfTest, Bookmarks) {
++  base::ElapsedTimer timer;
++  ChromeBookmarksResult result = ImportChromeBookmarks(profile_dir_, "");
++  Report("Bookmarks", result.bookmarks.size(), timer.Elapsed());
++  EXPECT_EQ(rows_, result.bookmarks.size());
++}
++
++TEST_F(ChromeImporterPerfTest, Favicons) {
++  ChromeBookmarksResult result = ImportChromeBookmarks(profile_dir_, "");
++  std::set<GURL> urls;
++  for (const auto& bookmark : result.bookmarks) {
++    urls.insert(bookmark.url);
++  }
++
++  size_t favicons = 0;
++  base::ElapsedTimer timer;
++  ImportChromeFavicons(profile_dir_, urls, kFaviconChunkSize,
++                       [&](favicon_base::FaviconUsageDataList chunk) {
++                         favicons += chunk.size();
++                         return true;
++                       });
++  Report("Favicons", favicons, timer.Elapsed());
++  EXPECT_GT(favicons, 0u);
++}
++
++TEST_F(ChromeImporterPerfTest, Passwords) {
++  // Returns nothing where Chrome's key cannot be extracted (e.g. Linux);
++  // the numbers then only cover key lookup.
++  base::ElapsedTimer timer;
++  auto passwords = ImportChromePasswords(profile_dir_, base::Time(), nullptr);
++  Report("Passwords", passwords.size(), timer.Elapsed());
++}
++
++TEST_F(ChromeImporterPerfTest, Cookies) {
++  // See Passwords: requires key extraction support on this platform.
++  base::ElapsedTimer timer;
++  auto cookies = ImportChromeCookies(profile_dir_, base::Time());
++  Report("Cookies", cookies.size(), timer.Elapsed());
++}
++
++TEST_F(ChromeImporterPerfTest, Autofill) {
++  base::ElapsedTimer timer;
++  auto entries = ImportChromeAutofill(profile_dir_);
++  Report("Autofill", entries.size(), timer.Elapsed());
++  EXPECT_EQ(rows_, entries.size());
++}
++
++TEST_F(ChromeImporterPerfTest, Extensions) {
++  base::ElapsedTimer timer;
++  auto extension_ids = ImportChromeExtensions(profile_dir_);
++  Report("Extensions", extension_ids.size(), timer.Elapsed());
++}
++
++TEST_F(ChromeImporterPerfTest, EndToEnd) {
++  // The importer sends through the same bridge as in the importer process;
++  // the observer plays the browser side.
++  mojo::PendingRemote<chrome::mojom::ProfileImportObserver> observer_remote;
++  std::optional<ImportCounts> counts;
++  base::RunLoop run_loop;
++  base::SequenceBound<CountingObserver> observer(
++      base::ThreadPool::CreateSequencedTaskRunner({}),
++      observer_remote.InitWithNewPipeAndPassReceiver(),
++      base::BindPostTaskToCurrentDefault(
++          base::BindOnce(
++              [](std::optional<ImportCounts>* counts, ImportCounts result) {
++                *counts = result;
++              },
++              &counts)
++              .Then(run_loop.QuitClosure())));
++  auto bridge = base::MakeRefCounted<ExternalProcessImporterBridge>(
++      base::flat_map<uint32_t, std::string>(),
++      mojo::SharedRemote<chrome::mojom::ProfileImportObserver>(
++          std::move(observer_remote)));
++  auto importer = base::MakeRefCounted<ChromeImporter>();
++
++  user_data_importer::SourceProfile source_profile;
++  source_profile.importer_type = user_data_importer::TYPE_CHROME;
++  source_profile.source_path = profile_dir_;
++
++  base::ElapsedTimer timer;
++  importer->StartImport(source_profile, user_data_importer::ALL, bridge.get());
++  const base::TimeDelta elapsed = timer.Elapsed();
++
++  // The import finished message is the last one sent; once it arrives every
++  // message has been counted.
++  run_loop.Run();
++  ASSERT_TRUE(counts);
++
++  const size_t total = counts->bookmarks + counts->history +
++                       counts->favicons + counts->passwords +
++                       counts->cookies + counts->autofill +
++                       counts->extensions;
++  Report("EndToEnd", total, elapsed, counts->ipc_messages);
++
++  EXPECT_EQ(rows_, counts->bookmarks);
++  EXPECT_EQ(rows_, counts->history);
++}
++
++}  // namespace
++
++}  // namespace browseros_importer
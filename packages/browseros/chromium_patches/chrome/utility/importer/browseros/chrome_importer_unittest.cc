@@ -0,0 +1,254 @@
+diff --git a/chrome/utility/importer/browseros/chrome_importer_unittest.cc b/chrome/utility/importer/browseros/chrome_importer_unittest.cc
+new file mode 100644
+index 0000000000000..f38a09880bebb
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_importer_unittest.cc
+@@ -0,0 +1,248 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome importer incremental import tests
++
++#include "chrome/utility/importer/browseros/chrome_importer.h"
++
++#include <stddef.h>
++#include <stdint.h>
++
++#include <set>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/time/time.h"
++#include "chrome/common/importer/mock_importer_bridge.h"
++#include "chrome/utility/importer/browseros/chrome_import_checkpoint.h"
++#include "chrome/utility/importer/browseros/test/synthetic_chrome_profile.h"
++#include "components/favicon_base/favicon_usage_data.h"
++#include "components/user_data_importer/common/imported_bookmark_entry.h"
++#include "components/user_data_importer/common/importer_data_types.h"
++#include "components/user_data_importer/common/importer_url_row.h"
++#include "sql/database.h"
++#include "sql/statement.h"
++#include "testing/gmock/include/gmock/gmock.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/base/page_transition_types.h"
++#include "url/gurl.h"
++
++namespace browseros_importer {
++
++namespace {
++
++using ::testing::_;
++using ::testing::AnyNumber;
++using ::testing::Return;
++using ::testing::SaveArg;
++
++inline constexpr sql::Database::Tag kDatabaseTag{"ChromeImporter"};
++
++constexpr size_t kRows = 60;
++
++// What one import sent through the bridge.
++struct ImportResult {
++  std::vector<user_data_importer::ImportedBookmarkEntry> bookmarks;
++  std::vector<user_data_importer::ImporterURLRow> history;
++  favicon_base::FaviconUsageDataList favicons;
++  ImportCheckpoint checkpoint;
++  bool checkpoint_reported = false;
++};
++
++class ChromeImporterTest : public testing::Test {
++ protected:
++  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
++
++  base::FilePath WriteProfile(const char* name, size_t bookmarks) {
++    base::FilePath profile_dir = temp_dir_.GetPath().AppendASCII(name);
++    test::SyntheticProfileSpec spec;
++    spec.bookmarks = bookmarks;
++    spec.history_urls = kRows;
++    // Every bookmarked page has a favicon; sites share a few bitmaps.
++    spec.favicon_mappings = bookmarks * 2;
++    spec.distinct_favicon_bitmaps = 4;
++    EXPECT_TRUE(test::WriteSyntheticChromeProfile(profile_dir, spec));
++    return profile_dir;
++  }
++
++  // Runs a Chrome import of |items| from |profile_dir|, starting from
++  // |checkpoint| as the browser would hand it over.
++  ImportResult Import(const base::FilePath& profile_dir,
++                      uint16_t items,
++                      const ImportCheckpoint& checkpoint) {
++    ImportResult result;
++    auto bridge = base::MakeRefCounted<MockImporterBridge>();
++    EXPECT_CALL(*bridge, GetImportCheckpoint()).WillOnce(Return(checkpoint));
++    EXPECT_CALL(*bridge, SetImportCheckpoint(_))
++        .Times(AnyNumber())
++        .WillRepeatedly([&result](const ImportCheckpoint& reported) {
++          result.checkpoint = reported;
++          result.checkpoint_reported = true;
++        });
++    EXPECT_CALL(*bridge, AddBookmarks(_, _))
++        .Times(AnyNumber())
++        .WillRepeatedly([&result](const auto& bookmarks, const auto&) {
++          result.bookmarks.insert(result.bookmarks.end(), bookmarks.begin(),
++                                  bookmarks.end());
++        });
++    EXPECT_CALL(*bridge, SetHistoryItems(_, _))
++        .Times(AnyNumber())
++        .WillRepeatedly([&result](const auto& rows, auto) {
++          result.history.insert(result.history.end(), rows.begin(),
++                                rows.end());
++        });
++    EXPECT_CALL(*bridge, SetFaviconsChunk(_))
++        .Times(AnyNumber())
++        .WillRepeatedly([&result](const auto& favicons) {
++          result.favicons.insert(result.favicons.end(), favicons.begin(),
++                                 favicons.end());
++        });
++    EXPECT_CALL(*bridge, NotifyStarted()).Times(AnyNumber());
++    EXPECT_CALL(*bridge, NotifyItemStarted(_)).Times(AnyNumber());
++    EXPECT_CALL(*bridge, NotifyItemEnded(_)).Times(AnyNumber());
++    EXPECT_CALL(*bridge, NotifyEnded()).Times(AnyNumber());
++
++    user_data_importer::SourceProfile source_profile;
++    source_profile.importer_type = user_data_importer::TYPE_CHROME;
++    source_profile.source_path = profile_dir;
++
++    auto importer = base::MakeRefCounted<ChromeImporter>();
++    importer->StartImport(source_profile, items, bridge.get());
++    return result;
++  }
++
++  base::ScopedTempDir temp_dir_;
++};
++
++constexpr uint16_t kIncrementalHistory =
++    user_data_importer::HISTORY | user_data_importer::SINCE_LAST_IMPORT;
++constexpr uint16_t kIncrementalBookmarks =
++    user_data_importer::FAVORITES | user_data_importer::SINCE_LAST_IMPORT;
++
++TEST_F(ChromeImporterTest, ReportsCheckpointInsteadOfWritingIt) {
++  base::FilePath profile_dir = WriteProfile("Default", kRows);
++
++  ImportResult result = Import(
++      profile_dir, user_data_importer::HISTORY | user_data_importer::FAVORITES,
++      ImportCheckpoint());
++
++  ASSERT_TRUE(result.checkpoint_reported);
++  EXPECT_EQ(kRows, result.history.size());
++  EXPECT_EQ(kRows, result.bookmarks.size());
++  EXPECT_FALSE(result.checkpoint.history_visit_time.is_null());
++  EXPECT_FALSE(result.checkpoint.bookmarks_hash.empty());
++  EXPECT_EQ(kRows, result.checkpoint.bookmark_keys.size());
++  EXPECT_EQ(kRows, result.favicons.size());
++}
++
++TEST_F(ChromeImporterTest, IncrementalHistoryOnlySendsNewVisits) {
++  base::FilePath profile_dir = WriteProfile("Default", 0);
++  ImportResult full =
++      Import(profile_dir, user_data_importer::HISTORY, ImportCheckpoint());
++  ASSERT_EQ(kRows, full.history.size());
++
++  // Nothing visited since: nothing to send.
++  ImportResult unchanged =
++      Import(profile_dir, kIncrementalHistory, full.checkpoint);
++  EXPECT_TRUE(unchanged.history.empty());
++
++  // Visit one new page.
++  const base::Time visit_time =
++      full.checkpoint.history_visit_time + base::Minutes(1);
++  {
++    sql::Database db(kDatabaseTag);
++    ASSERT_TRUE(db.Open(profile_dir.AppendASCII("History")));
++    const int64_t chrome_time =
++        visit_time.ToDeltaSinceWindowsEpoch().InMicroseconds();
++    sql::Statement url(db.GetUniqueStatement(
++        "INSERT INTO urls (id, url, title, visit_count, typed_count, "
++        "last_visit_time, hidden) VALUES (?, ?, ?, 1, 0, ?, 0)"));
++    url.BindInt64(0, kRows + 1);
++    url.BindString(1, "https://new.example.com/");
++    url.BindString(2, "New page");
++    url.BindInt64(3, chrome_time);
++    ASSERT_TRUE(url.Run());
++    sql::Statement visit(db.GetUniqueStatement(
++        "INSERT INTO visits (url, visit_time, transition) VALUES (?, ?, ?)"));
++    visit.BindInt64(0, kRows + 1);
++    visit.BindInt64(1, chrome_time);
++    visit.BindInt64(2,
++                    ui::PAGE_TRANSITION_LINK | ui::PAGE_TRANSITION_CHAIN_END);
++    ASSERT_TRUE(visit.Run());
++  }
++
++  ImportResult incremental =
++      Import(profile_dir, kIncrementalHistory, full.checkpoint);
++  ASSERT_EQ(1u, incremental.history.size());
++  EXPECT_EQ("https://new.example.com/", incremental.history[0].url.spec());
++  EXPECT_EQ(visit_time, incremental.checkpoint.history_visit_time);
++
++  // Without SINCE_LAST_IMPORT the checkpoint is ignored.
++  ImportResult again =
++      Import(profile_dir, user_data_importer::HISTORY, incremental.checkpoint);
++  EXPECT_EQ(kRows + 1, again.history.size());
++}
++
++TEST_F(ChromeImporterTest, IncrementalBookmarksSkipUnchangedFile) {
++  base::FilePath profile_dir = WriteProfile("Default", kRows);
++  ImportResult full =
++      Import(profile_dir, user_data_importer::FAVORITES, ImportCheckpoint());
++  ASSERT_EQ(kRows, full.bookmarks.size());
++
++  ImportResult incremental =
++      Import(profile_dir, kIncrementalBookmarks, full.checkpoint);
++  EXPECT_TRUE(incremental.bookmarks.empty());
++  EXPECT_EQ(full.checkpoint.bookmarks_hash,
++            incremental.checkpoint.bookmarks_hash);
++  // The file was not parsed, so its keys are kept.
++  EXPECT_EQ(full.checkpoint.bookmark_keys,
++            incremental.checkpoint.bookmark_keys);
++}
++
++TEST_F(ChromeImporterTest, IncrementalBookmarksOnlySendNewBookmarks) {
++  // The same bookmarks plus one more, as after the user added a bookmark.
++  base::FilePath before = WriteProfile("Before", kRows);
++  base::FilePath after = WriteProfile("After", kRows + 1);
++
++  ImportResult full =
++      Import(before, user_data_importer::FAVORITES, ImportCheckpoint());
++  ASSERT_EQ(kRows, full.bookmarks.size());
++
++  ImportResult incremental =
++      Import(after, kIncrementalBookmarks, full.checkpoint);
++  ASSERT_EQ(1u, incremental.bookmarks.size());
++  EXPECT_EQ(u"Bookmark 60", incremental.bookmarks[0].title);
++  // Only the new bookmark's favicon is sent.
++  ASSERT_EQ(1u, incremental.favicons.size());
++  EXPECT_EQ(std::set<GURL>{incremental.bookmarks[0].url},
++            incremental.favicons[0].urls);
++  EXPECT_NE(full.checkpoint.bookmarks_hash,
++            incremental.checkpoint.bookmarks_hash);
++  EXPECT_EQ(kRows + 1, incremental.checkpoint.bookmark_keys.size());
++
++  // A repeated incremental import of the same file sends nothing.
++  ImportResult repeated =
++      Import(after, kIncrementalBookmarks, incremental.checkpoint);
++  EXPECT_TRUE(repeated.bookmarks.empty());
++}
++
++TEST_F(ChromeImporterTest, IncrementalBookmarksForgetRemovedBookmarks) {
++  // One bookmark fewer, as after the user deleted a bookmark.
++  base::FilePath before = WriteProfile("Before", kRows + 1);
++  base::FilePath after = WriteProfile("After", kRows);
++
++  ImportResult full =
++      Import(before, user_data_importer::FAVORITES, ImportCheckpoint());
++  ASSERT_EQ(kRows + 1, full.checkpoint.bookmark_keys.size());
++
++  // Keys only cover the bookmarks the file still holds, so they do not grow
++  // with every import.
++  ImportResult incremental =
++      Import(after, kIncrementalBookmarks, full.checkpoint);
++  EXPECT_TRUE(incremental.bookmarks.empty());
++  EXPECT_EQ(kRows, incremental.checkpoint.bookmark_keys.size());
++}
++
++}  // namespace
++
++}  // namespace browseros_importer
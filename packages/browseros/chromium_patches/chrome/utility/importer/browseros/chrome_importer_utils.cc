@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer_utils.cc b/chrome/utility/importer/browseros/chrome_importer_utils.cc
 new file mode 100644
-index 0000000000000..8b0401a695e20
+index 0000000000000..2d09751936800
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer_utils.cc
-@@ -0,0 +1,37 @@
+@@ -0,0 +1,44 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome importer shared utilities
 +
@@ -22,6 +22,13 @@ index 0000000000000..8b0401a695e20
 +      base::Microseconds(chrome_time));
 +}
 +
++int64_t BaseTimeToChromeTime(base::Time time) {
++  if (time.is_null()) {
++    return 0;
++  }
++  return time.ToDeltaSinceWindowsEpoch().InMicroseconds();
++}
++
 +base::FilePath CopyToTempFile(const base::FilePath& source_path) {
 +  base::FilePath temp_path;
 +  if (!base::CreateTemporaryFile(&temp_path)) {
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer_utils.h b/chrome/utility/importer/browseros/chrome_importer_utils.h
 new file mode 100644
-index 0000000000000..1a144725d2e89
+index 0000000000000..57f374ce686ca
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer_utils.h
-@@ -0,0 +1,23 @@
+@@ -0,0 +1,26 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome importer shared utilities
 +
@@ -19,6 +19,9 @@ index 0000000000000..1a144725d2e89
 +// to base::Time. Returns null time for zero input.
 +base::Time ChromeTimeToBaseTime(int64_t chrome_time);
 +
++// Inverse of ChromeTimeToBaseTime(). Returns 0 for a null time.
++int64_t BaseTimeToChromeTime(base::Time time);
++
 +// Copies a file to a temporary location to avoid locking issues when the
 +// source browser is running. Returns empty path on failure.
 +// Caller is responsible for deleting the temp file when done.
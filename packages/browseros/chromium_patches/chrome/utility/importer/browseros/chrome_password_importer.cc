@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_password_importer.cc b/chrome/utility/importer/browseros/chrome_password_importer.cc
 new file mode 100644
-index 0000000000000..1a01e3951aa3f
+index 0000000000000..9d7f947082360
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_password_importer.cc
-@@ -0,0 +1,150 @@
+@@ -0,0 +1,165 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome password importer implementation
 +
@@ -13,6 +13,7 @@ index 0000000000000..1a01e3951aa3f
 +#include "base/logging.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "chrome/utility/importer/browseros/chrome_decryptor.h"
++#include "chrome/utility/importer/browseros/chrome_importer_utils.h"
 +#include "sql/database.h"
 +#include "sql/statement.h"
 +#include "url/gurl.h"
@@ -46,7 +47,9 @@ index 0000000000000..1a01e3951aa3f
 +}  // namespace
 +
 +std::vector<user_data_importer::ImportedPasswordForm> ImportChromePasswords(
-+    const base::FilePath& profile_path) {
++    const base::FilePath& profile_path,
++    base::Time since,
++    base::Time* newest_use) {
 +  std::vector<user_data_importer::ImportedPasswordForm> passwords;
 +
 +  // Extract encryption key
@@ -84,10 +87,15 @@ index 0000000000000..1a01e3951aa3f
 +  // Query logins table - use scope block to ensure statement is destroyed before
 +  // db.Close() to avoid DCHECK failure
 +  {
++    // Never-used logins have date_last_used = 0, so fall back to
++    // date_created, and logins edited since their last use count from
++    // date_password_modified when comparing against the checkpoint.
 +    const char kQuery[] =
 +        "SELECT origin_url, action_url, username_element, username_value, "
 +        "password_element, password_value, signon_realm, blacklisted_by_user, "
-+        "scheme FROM logins";
++        "scheme, MAX(date_last_used, date_created, date_password_modified) "
++        "AS last_used "
++        "FROM logins WHERE last_used > ?";
 +
 +    sql::Statement statement(db.GetUniqueStatement(kQuery));
 +    if (!statement.is_valid()) {
@@ -96,6 +104,8 @@ index 0000000000000..1a01e3951aa3f
 +      return passwords;
 +    }
 +
++    statement.BindInt64(0, BaseTimeToChromeTime(since));
++
 +    while (statement.Step()) {
 +      std::string origin_url = statement.ColumnString(0);
 +      std::string action_url = statement.ColumnString(1);
@@ -109,6 +119,7 @@ index 0000000000000..1a01e3951aa3f
 +      std::string signon_realm = statement.ColumnString(6);
 +      bool blacklisted = statement.ColumnBool(7);
 +      int scheme = statement.ColumnInt(8);
++      base::Time last_used = ChromeTimeToBaseTime(statement.ColumnInt64(9));
 +
 +      // Decrypt password
 +      std::string decrypted_password;
@@ -140,6 +151,10 @@ index 0000000000000..1a01e3951aa3f
 +      form.password_value = base::UTF8ToUTF16(decrypted_password);
 +      form.blocked_by_user = blacklisted;
 +
++      if (newest_use && last_used > *newest_use) {
++        *newest_use = last_used;
++      }
++
 +      passwords.push_back(std::move(form));
 +    }
 +  }  // statement destroyed here
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_password_importer.h b/chrome/utility/importer/browseros/chrome_password_importer.h
 new file mode 100644
-index 0000000000000..e0cb4ec631e39
+index 0000000000000..e8cc362e7bc37
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_password_importer.h
-@@ -0,0 +1,23 @@
+@@ -0,0 +1,30 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome password importer interface
 +
@@ -13,16 +13,23 @@ index 0000000000000..e0cb4ec631e39
 +#include <vector>
 +
 +#include "base/files/file_path.h"
++#include "base/time/time.h"
 +#include "components/user_data_importer/common/importer_data_types.h"
 +
 +namespace browseros_importer {
 +
 +// Import passwords from Chrome's Login Data database.
 +// |profile_path| should be the Chrome profile directory (e.g., .../Default)
++// Only logins created, used or edited after |since| are returned; pass a null
++// time to import all of them. |newest_use| (optional) receives the newest
++// date_last_used/date_created/date_password_modified among the returned
++// logins.
 +// Returns a vector of ImportedPasswordForm structs.
 +// On failure, returns an empty vector.
 +std::vector<user_data_importer::ImportedPasswordForm> ImportChromePasswords(
-+    const base::FilePath& profile_path);
++    const base::FilePath& profile_path,
++    base::Time since,
++    base::Time* newest_use);
 +
 +}  // namespace browseros_importer
 +
@@ -0,0 +1,461 @@
+diff --git a/chrome/utility/importer/browseros/test/synthetic_chrome_profile.cc b/chrome/utility/importer/browseros/test/synthetic_chrome_profile.cc
+new file mode 100644
+index 0000000000000..c356beacbb5ea
+--- /dev/null
++++ b/chrome/utility/importer/browseros/test/synthetic_chrome_profile.cc
+@@ -0,0 +1,455 @@
++// Copyright 2024 AKW Technology Inc
++// Synthetic Chrome profile fixtures implementation
++
++#include "chrome/utility/importer/browseros/test/synthetic_chrome_profile.h"
++
++#include <stdint.h>
++
++#include <algorithm>
++#include <initializer_list>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/files/file_util.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/stringprintf.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "sql/database.h"
++#include "sql/statement.h"
++#include "sql/transaction.h"
++#include "third_party/skia/include/core/SkBitmap.h"
++#include "third_party/skia/include/core/SkColor.h"
++#include "ui/base/page_transition_types.h"
++#include "ui/gfx/codec/png_codec.h"
++
++namespace browseros_importer::test {
++
++namespace {
++
++inline constexpr sql::Database::Tag kDatabaseTag{"ChromeImporter"};
++
++// Spacing between generated timestamps, so incremental imports can pick a
++// checkpoint in the middle of a fixture.
++constexpr int64_t kRowSpacingMicros = 1000;
++
++int64_t ChromeTime(size_t row) {
++  static const int64_t base_time =
++      (base::Time::Now() - base::Days(365)).ToDeltaSinceWindowsEpoch()
++          .InMicroseconds();
++  return base_time + static_cast<int64_t>(row) * kRowSpacingMicros;
++}
++
++std::string PageUrl(size_t index) {
++  return base::StringPrintf("https://site%zu.example.com/page/%zu",
++                            index % 5000, index);
++}
++
++// Opens (creating) |name| in |profile_dir| and runs |schema| statements.
++bool OpenDatabase(sql::Database* db,
++                  const base::FilePath& profile_dir,
++                  const char* name,
++                  std::initializer_list<const char*> schema) {
++  if (!db->Open(profile_dir.AppendASCII(name))) {
++    LOG(ERROR) << "browseros: Failed to create " << name;
++    return false;
++  }
++  for (const char* statement : schema) {
++    if (!db->Execute(statement)) {
++      LOG(ERROR) << "browseros: Failed to create schema for " << name;
++      return false;
++    }
++  }
++  return true;
++}
++
++bool WriteBookmarks(const base::FilePath& profile_dir,
++                    const SyntheticProfileSpec& spec) {
++  base::Value::List bar_children;
++  base::Value::List folder_children;
++  size_t folder_index = 0;
++
++  auto flush_folder = [&]() {
++    if (folder_children.empty()) {
++      return;
++    }
++    bar_children.Append(
++        base::Value::Dict()
++            .Set("type", "folder")
++            .Set("name", base::StringPrintf("Folder %zu", folder_index++))
++            .Set("date_added", base::NumberToString(ChromeTime(0)))
++            .Set("children", std::move(folder_children)));
++    folder_children = base::Value::List();
++  };
++
++  for (size_t i = 0; i < spec.bookmarks; ++i) {
++    folder_children.Append(
++        base::Value::Dict()
++            .Set("type", "url")
++            .Set("name", base::StringPrintf("Bookmark %zu", i))
++            .Set("url", PageUrl(i))
++            .Set("date_added", base::NumberToString(ChromeTime(i))));
++    if (folder_children.size() >= spec.bookmarks_per_folder) {
++      flush_folder();
++    }
++  }
++  flush_folder();
++
++  base::Value::Dict roots;
++  roots.Set("bookmark_bar", base::Value::Dict()
++                                .Set("type", "folder")
++                                .Set("name", "Bookmarks bar")
++                                .Set("children", std::move(bar_children)));
++  roots.Set("other", base::Value::Dict()
++                         .Set("type", "folder")
++                         .Set("name", "Other bookmarks")
++                         .Set("children", base::Value::List()));
++
++  base::Value::Dict file;
++  file.Set("roots", std::move(roots));
++  file.Set("version", 1);
++
++  std::string json;
++  return base::JSONWriter::Write(file, &json) &&
++         base::WriteFile(profile_dir.AppendASCII("Bookmarks"), json);
++}
++
++bool WriteHistory(const base::FilePath& profile_dir,
++                  const SyntheticProfileSpec& spec) {
++  sql::Database db(kDatabaseTag);
++  if (!OpenDatabase(
++          &db, profile_dir, "History",
++          {"CREATE TABLE urls(id INTEGER PRIMARY KEY AUTOINCREMENT,"
++           "url LONGVARCHAR,title LONGVARCHAR,"
++           "visit_count INTEGER DEFAULT 0 NOT NULL,"
++           "typed_count INTEGER DEFAULT 0 NOT NULL,"
++           "last_visit_time INTEGER NOT NULL,"
++           "hidden INTEGER DEFAULT 0 NOT NULL)",
++           "CREATE TABLE visits(id INTEGER PRIMARY KEY AUTOINCREMENT,"
++           "url INTEGER NOT NULL,visit_time INTEGER NOT NULL,"
++           "from_visit INTEGER,transition INTEGER DEFAULT 0 NOT NULL,"
++           "segment_id INTEGER,visit_duration INTEGER DEFAULT 0 NOT NULL)",
++           "CREATE INDEX visits_url_index ON visits (url)"})) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin()) {
++    return false;
++  }
++
++  sql::Statement url_statement(db.GetUniqueStatement(
++      "INSERT INTO urls (id, url, title, visit_count, typed_count, "
++      "last_visit_time, hidden) VALUES (?, ?, ?, ?, ?, ?, 0)"));
++  sql::Statement visit_statement(db.GetUniqueStatement(
++      "INSERT INTO visits (url, visit_time, transition) VALUES (?, ?, ?)"));
++
++  const int64_t transition =
++      ui::PAGE_TRANSITION_LINK | ui::PAGE_TRANSITION_CHAIN_END;
++  size_t visit_row = 0;
++  for (size_t i = 0; i < spec.history_urls; ++i) {
++    const int64_t url_id = static_cast<int64_t>(i) + 1;
++    url_statement.BindInt64(0, url_id);
++    url_statement.BindString(1, PageUrl(i));
++    url_statement.BindString(2, base::StringPrintf("Page %zu", i));
++    url_statement.BindInt64(3, spec.visits_per_url);
++    url_statement.BindInt64(4, i % 3);
++    url_statement.BindInt64(5, ChromeTime(visit_row + spec.visits_per_url));
++    if (!url_statement.Run()) {
++      return false;
++    }
++    url_statement.Reset(true);
++
++    for (size_t v = 0; v < spec.visits_per_url; ++v) {
++      visit_statement.BindInt64(0, url_id);
++      visit_statement.BindInt64(1, ChromeTime(visit_row++));
++      visit_statement.BindInt64(2, transition);
++      if (!visit_statement.Run()) {
++        return false;
++      }
++      visit_statement.Reset(true);
++    }
++  }
++
++  return transaction.Commit();
++}
++
++bool WriteCookies(const base::FilePath& profile_dir,
++                  const SyntheticProfileSpec& spec) {
++  sql::Database db(kDatabaseTag);
++  if (!OpenDatabase(
++          &db, profile_dir, "Cookies",
++          {"CREATE TABLE meta(key LONGVARCHAR NOT NULL UNIQUE PRIMARY KEY,"
++           "value LONGVARCHAR)",
++           "INSERT INTO meta (key, value) VALUES ('version', '24')",
++           "CREATE TABLE cookies(creation_utc INTEGER NOT NULL,"
++           "host_key TEXT NOT NULL,top_frame_site_key TEXT NOT NULL,"
++           "name TEXT NOT NULL,value TEXT NOT NULL,"
++           "encrypted_value BLOB NOT NULL,path TEXT NOT NULL,"
++           "expires_utc INTEGER NOT NULL,is_secure INTEGER NOT NULL,"
++           "is_httponly INTEGER NOT NULL,last_access_utc INTEGER NOT NULL,"
++           "has_expires INTEGER NOT NULL,is_persistent INTEGER NOT NULL,"
++           "priority INTEGER NOT NULL,samesite INTEGER NOT NULL,"
++           "source_scheme INTEGER NOT NULL,source_port INTEGER NOT NULL,"
++           "last_update_utc INTEGER NOT NULL)"})) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin()) {
++    return false;
++  }
++
++  sql::Statement statement(db.GetUniqueStatement(
++      "INSERT INTO cookies (creation_utc, host_key, top_frame_site_key, name, "
++      "value, encrypted_value, path, expires_utc, is_secure, is_httponly, "
++      "last_access_utc, has_expires, is_persistent, priority, samesite, "
++      "source_scheme, source_port, last_update_utc) "
++      "VALUES (?, ?, '', ?, ?, X'', '/', ?, 1, ?, ?, 1, 1, 1, ?, 2, 443, ?)"));
++
++  const int64_t expires =
++      (base::Time::Now() + base::Days(180)).ToDeltaSinceWindowsEpoch()
++          .InMicroseconds();
++  for (size_t i = 0; i < spec.cookies; ++i) {
++    statement.BindInt64(0, ChromeTime(i));
++    statement.BindString(1,
++                         base::StringPrintf(".site%zu.example.com", i % 5000));
++    statement.BindString(2, base::StringPrintf("cookie_%zu", i));
++    statement.BindString(3, std::string(64, static_cast<char>('a' + i % 26)));
++    statement.BindInt64(4, expires);
++    statement.BindBool(5, i % 2 == 0);
++    statement.BindInt64(6, ChromeTime(i));
++    statement.BindInt(7, static_cast<int>(i % 3));
++    statement.BindInt64(8, ChromeTime(i));
++    if (!statement.Run()) {
++      return false;
++    }
++    statement.Reset(true);
++  }
++
++  return transaction.Commit();
++}
++
++bool WriteLoginData(const base::FilePath& profile_dir,
++                    const SyntheticProfileSpec& spec) {
++  sql::Database db(kDatabaseTag);
++  if (!OpenDatabase(
++          &db, profile_dir, "Login Data",
++          {"CREATE TABLE logins(origin_url VARCHAR NOT NULL,"
++           "action_url VARCHAR,username_element VARCHAR,"
++           "username_value VARCHAR,password_element VARCHAR,"
++           "password_value BLOB,submit_element VARCHAR,"
++           "signon_realm VARCHAR NOT NULL,date_created INTEGER NOT NULL,"
++           "blacklisted_by_user INTEGER NOT NULL,scheme INTEGER NOT NULL,"
++           "date_last_used INTEGER NOT NULL DEFAULT 0,"
++           "date_password_modified INTEGER NOT NULL DEFAULT 0)"})) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin()) {
++    return false;
++  }
++
++  sql::Statement statement(db.GetUniqueStatement(
++      "INSERT INTO logins (origin_url, action_url, username_element, "
++      "username_value, password_element, password_value, signon_realm, "
++      "date_created, blacklisted_by_user, scheme, date_last_used) "
++      "VALUES (?, ?, 'username', ?, 'password', X'', ?, ?, 0, 0, ?)"));
++
++  for (size_t i = 0; i < spec.logins; ++i) {
++    std::string origin = base::StringPrintf("https://login%zu.example.com/", i);
++    statement.BindString(0, origin);
++    statement.BindString(1, origin + "submit");
++    statement.BindString(2, base::StringPrintf("user%zu@example.com", i));
++    statement.BindString(3, origin);
++    statement.BindInt64(4, ChromeTime(i));
++    // Every other login has never been used.
++    statement.BindInt64(5, i % 2 ? ChromeTime(i + spec.logins) : 0);
++    if (!statement.Run()) {
++      return false;
++    }
++    statement.Reset(true);
++  }
++
++  return transaction.Commit();
++}
++
++bool WriteWebData(const base::FilePath& profile_dir,
++                  const SyntheticProfileSpec& spec) {
++  sql::Database db(kDatabaseTag);
++  if (!OpenDatabase(
++          &db, profile_dir, "Web Data",
++          {"CREATE TABLE autofill(name VARCHAR,value VARCHAR,"
++           "value_lower VARCHAR,date_created INTEGER DEFAULT 0,"
++           "date_last_used INTEGER DEFAULT 0,count INTEGER DEFAULT 1,"
++           "PRIMARY KEY (name, value))"})) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin()) {
++    return false;
++  }
++
++  sql::Statement statement(db.GetUniqueStatement(
++      "INSERT INTO autofill (name, value, value_lower, date_created, "
++      "date_last_used, count) VALUES (?, ?, ?, ?, ?, ?)"));
++
++  for (size_t i = 0; i < spec.autofill_entries; ++i) {
++    std::string value = base::StringPrintf("value %zu", i);
++    statement.BindString(0, base::StringPrintf("field%zu", i % 50));
++    statement.BindString(1, value);
++    statement.BindString(2, value);
++    statement.BindInt64(3, ChromeTime(i));
++    statement.BindInt64(4, ChromeTime(i + spec.autofill_entries));
++    statement.BindInt64(5, 1 + i % 10);
++    if (!statement.Run()) {
++      return false;
++    }
++    statement.Reset(true);
++  }
++
++  return transaction.Commit();
++}
++
++std::optional<std::vector<uint8_t>> MakeFaviconPng(size_t variant) {
++  SkBitmap bitmap;
++  bitmap.allocN32Pixels(16, 16);
++  bitmap.eraseColor(SkColorSetRGB(static_cast<U8CPU>(variant & 0xff),
++                                  static_cast<U8CPU>((variant >> 8) & 0xff),
++                                  static_cast<U8CPU>((variant >> 16) & 0xff)));
++  return gfx::PNGCodec::EncodeBGRASkBitmap(bitmap,
++                                           /*discard_transparency=*/false);
++}
++
++bool WriteFavicons(const base::FilePath& profile_dir,
++                   const SyntheticProfileSpec& spec) {
++  sql::Database db(kDatabaseTag);
++  if (!OpenDatabase(
++          &db, profile_dir, "Favicons",
++          {"CREATE TABLE favicons(id INTEGER PRIMARY KEY,"
++           "url LONGVARCHAR NOT NULL,icon_type INTEGER DEFAULT 1)",
++           "CREATE TABLE favicon_bitmaps(id INTEGER PRIMARY KEY,"
++           "icon_id INTEGER NOT NULL,last_updated INTEGER DEFAULT 0,"
++           "image_data BLOB,width INTEGER DEFAULT 0,height INTEGER DEFAULT 0,"
++           "last_requested INTEGER NOT NULL DEFAULT 0)",
++           "CREATE TABLE icon_mapping(id INTEGER PRIMARY KEY,"
++           "page_url LONGVARCHAR NOT NULL,icon_id INTEGER)",
++           "CREATE INDEX favicon_bitmaps_icon_id ON favicon_bitmaps(icon_id)",
++           "CREATE INDEX icon_mapping_page_url_idx ON icon_mapping(page_url)",
++           "CREATE INDEX icon_mapping_icon_id_idx ON icon_mapping(icon_id)"})) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin()) {
++    return false;
++  }
++
++  sql::Statement icon_statement(db.GetUniqueStatement(
++      "INSERT INTO favicons (id, url, icon_type) VALUES (?, ?, 1)"));
++  sql::Statement bitmap_statement(db.GetUniqueStatement(
++      "INSERT INTO favicon_bitmaps (icon_id, image_data, width, height) "
++      "VALUES (?, ?, 16, 16)"));
++  sql::Statement mapping_statement(db.GetUniqueStatement(
++      "INSERT INTO icon_mapping (page_url, icon_id) VALUES (?, ?)"));
++
++  // One icon per site; bitmaps repeat every |distinct_favicon_bitmaps| icons.
++  const size_t distinct = std::max<size_t>(spec.distinct_favicon_bitmaps, 1);
++  std::vector<std::vector<uint8_t>> bitmaps;
++  for (size_t i = 0; i < distinct; ++i) {
++    std::optional<std::vector<uint8_t>> png = MakeFaviconPng(i);
++    if (!png) {
++      return false;
++    }
++    bitmaps.push_back(std::move(*png));
++  }
++
++  std::vector<bool> icon_written(5000, false);
++  for (size_t i = 0; i < spec.favicon_mappings; ++i) {
++    // Alternate bookmarked and non-bookmarked pages.
++    const size_t page = i % 2 ? spec.bookmarks + i : i / 2;
++    const size_t site = page % icon_written.size();
++    const int64_t icon_id = static_cast<int64_t>(site) + 1;
++
++    if (!icon_written[site]) {
++      icon_written[site] = true;
++      icon_statement.BindInt64(0, icon_id);
++      icon_statement.BindString(
++          1, base::StringPrintf("https://site%zu.example.com/favicon.ico",
++                                site));
++      bitmap_statement.BindInt64(0, icon_id);
++      bitmap_statement.BindBlob(1, bitmaps[site % distinct]);
++      if (!icon_statement.Run() || !bitmap_statement.Run()) {
++        return false;
++      }
++      icon_statement.Reset(true);
++      bitmap_statement.Reset(true);
++    }
++
++    mapping_statement.BindString(0, PageUrl(page));
++    mapping_statement.BindInt64(1, icon_id);
++    if (!mapping_statement.Run()) {
++      return false;
++    }
++    mapping_statement.Reset(true);
++  }
++
++  return transaction.Commit();
++}
++
++bool WritePreferences(const base::FilePath& profile_dir,
++                      const SyntheticProfileSpec& spec) {
++  base::Value::Dict settings;
++  for (size_t i = 0; i < spec.extensions; ++i) {
++    // Extension IDs are 32 characters in the range a-p.
++    std::string id(32, 'a');
++    for (size_t n = i, pos = 31; n; n /= 16, --pos) {
++      id[pos] = static_cast<char>('a' + n % 16);
++    }
++    settings.Set(id, base::Value::Dict()
++                         .Set("from_webstore", true)
++                         .Set("was_installed_by_default", false));
++  }
++
++  base::Value::Dict preferences;
++  preferences.SetByDottedPath("extensions.settings", std::move(settings));
++
++  std::string json;
++  return base::JSONWriter::Write(preferences, &json) &&
++         base::WriteFile(profile_dir.AppendASCII("Preferences"), json);
++}
++
++}  // namespace
++
++// static
++SyntheticProfileSpec SyntheticProfileSpec::ForRows(size_t rows) {
++  SyntheticProfileSpec spec;
++  spec.bookmarks = rows;
++  spec.history_urls = rows;
++  spec.cookies = rows;
++  spec.logins = rows;
++  spec.autofill_entries = rows;
++  spec.extensions = std::min<size_t>(rows, 100);
++  spec.favicon_mappings = rows;
++  spec.distinct_favicon_bitmaps = std::max<size_t>(rows / 100, 1);
++  return spec;
++}
++
++bool WriteSyntheticChromeProfile(const base::FilePath& profile_dir,
++                                 const SyntheticProfileSpec& spec) {
++  if (!base::CreateDirectory(profile_dir)) {
++    return false;
++  }
++
++  return WriteBookmarks(profile_dir, spec) && WriteHistory(profile_dir, spec) &&
++         WriteCookies(profile_dir, spec) && WriteLoginData(profile_dir, spec) &&
++         WriteWebData(profile_dir, spec) && WriteFavicons(profile_dir, spec) &&
++         WritePreferences(profile_dir, spec);
++}
++
++}  // namespace browseros_importer::test
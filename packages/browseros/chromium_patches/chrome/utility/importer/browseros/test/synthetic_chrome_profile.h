@@ -0,0 +1,50 @@
+diff --git a/chrome/utility/importer/browseros/test/synthetic_chrome_profile.h b/chrome/utility/importer/browseros/test/synthetic_chrome_profile.h
+new file mode 100644
+index 0000000000000..0015698bf9d06
+--- /dev/null
++++ b/chrome/utility/importer/browseros/test/synthetic_chrome_profile.h
+@@ -0,0 +1,44 @@
++// Copyright 2024 AKW Technology Inc
++// Synthetic Chrome profile fixtures for importer benchmarks
++
++#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_TEST_SYNTHETIC_CHROME_PROFILE_H_
++#define CHROME_UTILITY_IMPORTER_BROWSEROS_TEST_SYNTHETIC_CHROME_PROFILE_H_
++
++#include <stddef.h>
++
++#include "base/files/file_path.h"
++
++namespace browseros_importer::test {
++
++// Row counts for each data file written by WriteSyntheticChromeProfile().
++struct SyntheticProfileSpec {
++  // Scales every data type to |rows| entries (1k .. 1M in benchmarks).
++  static SyntheticProfileSpec ForRows(size_t rows);
++
++  size_t bookmarks = 0;
++  // Bookmarks per folder; folders nest one level below the bookmark bar.
++  size_t bookmarks_per_folder = 50;
++  size_t history_urls = 0;
++  size_t visits_per_url = 1;
++  size_t cookies = 0;
++  size_t logins = 0;
++  size_t autofill_entries = 0;
++  size_t extensions = 0;
++  // Number of icon_mapping rows; every page URL gets one mapping, half of
++  // them for bookmarked pages.
++  size_t favicon_mappings = 0;
++  // Number of distinct bitmaps. Icons beyond this repeat earlier bitmaps so
++  // content deduplication is exercised.
++  size_t distinct_favicon_bitmaps = 0;
++};
++
++// Writes a realistic Chrome profile into |profile_dir|: Bookmarks JSON,
++// History, Cookies, Login Data, Web Data, Favicons and Preferences, using
++// the table layouts the browseros importers read. Cookie and password values
++// are stored unencrypted. Returns false if any file could not be written.
++bool WriteSyntheticChromeProfile(const base::FilePath& profile_dir,
++                                 const SyntheticProfileSpec& spec);
++
++}  // namespace browseros_importer::test
++
++#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_TEST_SYNTHETIC_CHROME_PROFILE_H_
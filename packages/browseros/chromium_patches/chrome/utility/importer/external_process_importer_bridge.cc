@@ -2,19 +2,20 @@ diff --git a/chrome/utility/importer/external_process_importer_bridge.cc b/chrom
 index 67092331c3801..df9cfc2576fd8 100644
 --- a/chrome/utility/importer/external_process_importer_bridge.cc
 +++ b/chrome/utility/importer/external_process_importer_bridge.cc
-@@ -15,8 +15,11 @@
+@@ -15,8 +15,12 @@
  #include "base/task/task_runner.h"
  #include "build/build_config.h"
  #include "chrome/common/importer/importer_autofill_form_data_entry.h"
 +#include "chrome/common/importer/profile_import.mojom.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_checkpoint.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
  #include "components/user_data_importer/common/importer_data_types.h"
 +#include "net/cookies/cookie_constants.h"
  
  namespace {
  
-@@ -113,6 +116,79 @@ void ExternalProcessImporterBridge::SetPasswordForm(
+@@ -113,6 +117,86 @@ void ExternalProcessImporterBridge::SetPasswordForm(
    observer_->OnPasswordFormImportReady(form);
  }
  
@@ -90,11 +91,18 @@ index 67092331c3801..df9cfc2576fd8 100644
 +
 +  observer_->OnCookieImportReady(std::move(mojo_cookie));
 +}
++
++void ExternalProcessImporterBridge::SetFaviconsChunk(
++    const favicon_base::FaviconUsageDataList& favicons) {
++  // The caller already bounds the chunk size, so send it as a single message
++  // instead of the start/group handshake used by SetFavicons().
++  observer_->OnFaviconsChunkReady(favicons);
++}
 +
  void ExternalProcessImporterBridge::SetAutofillFormData(
      const std::vector<ImporterAutofillFormDataEntry>& entries) {
    observer_->OnAutofillFormDataImportStart(entries.size());
-@@ -135,6 +211,13 @@ void ExternalProcessImporterBridge::SetAutofillFormData(
+@@ -135,6 +219,29 @@ void ExternalProcessImporterBridge::SetAutofillFormData(
    DCHECK_EQ(0, autofill_form_data_entries_left);
  }
  
@@ -104,6 +112,22 @@ index 67092331c3801..df9cfc2576fd8 100644
 +  // we'll just pass this information through
 +  observer_->OnExtensionsImportReady(extension_ids);
 +}
++
++browseros_importer::ImportCheckpoint
++ExternalProcessImporterBridge::GetImportCheckpoint() {
++  chrome::mojom::ImportCheckpointPtr mojo_checkpoint;
++  if (!observer_->GetImportCheckpoint(&mojo_checkpoint) || !mojo_checkpoint) {
++    // Without a checkpoint everything is imported.
++    return browseros_importer::ImportCheckpoint();
++  }
++  return browseros_importer::FromMojoImportCheckpoint(*mojo_checkpoint);
++}
++
++void ExternalProcessImporterBridge::SetImportCheckpoint(
++    const browseros_importer::ImportCheckpoint& checkpoint) {
++  observer_->OnImportCheckpointReady(
++      browseros_importer::ToMojoImportCheckpoint(checkpoint));
++}
 +
  void ExternalProcessImporterBridge::NotifyStarted() {
    observer_->OnImportStart();
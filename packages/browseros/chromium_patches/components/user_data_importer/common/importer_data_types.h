@@ -2,7 +2,7 @@ diff --git a/components/user_data_importer/common/importer_data_types.h b/compon
 index 3cac91f8d5838..8d5937f653020 100644
 --- a/components/user_data_importer/common/importer_data_types.h
 +++ b/components/user_data_importer/common/importer_data_types.h
-@@ -24,12 +24,13 @@ enum ImportItem {
+@@ -24,12 +24,16 @@ enum ImportItem {
    NONE = 0,
    HISTORY = 1 << 0,
    FAVORITES = 1 << 1,
@@ -14,11 +14,14 @@ index 3cac91f8d5838..8d5937f653020 100644
    AUTOFILL_FORM_DATA = 1 << 6,
 -  ALL = (1 << 7) - 1  // All the bits should be 1, hence the -1.
 +  EXTENSIONS = 1 << 7,
-+  ALL = (1 << 8) - 1  // All the bits should be 1, hence the -1.
++  ALL = (1 << 8) - 1,  // All the bits should be 1, hence the -1.
++  // Modifier, not an item: only import data that changed since the last
++  // import from the same source profile. Honored by the Chrome importer.
++  SINCE_LAST_IMPORT = 1 << 8,
  };
  
  // Information about a profile needed by an importer to do import work.
-@@ -111,6 +112,7 @@ enum VisitSource {
+@@ -111,6 +115,7 @@ enum VisitSource {
    VISIT_SOURCE_FIREFOX_IMPORTED = 1,
    VISIT_SOURCE_IE_IMPORTED = 2,
    VISIT_SOURCE_SAFARI_IMPORTED = 3,
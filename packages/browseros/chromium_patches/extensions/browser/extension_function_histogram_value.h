@@ -2,7 +2,7 @@ diff --git a/extensions/browser/extension_function_histogram_value.h b/extension
 index ef1e808e09269..0d8e46d362f80 100644
 --- a/extensions/browser/extension_function_histogram_value.h
 +++ b/extensions/browser/extension_function_histogram_value.h
-@@ -2017,6 +2017,32 @@ enum HistogramValue {
+@@ -2017,6 +2017,33 @@ enum HistogramValue {
    WEBSTOREPRIVATE_SHOULDSHOWENTERPRISEPROMOTIONBANNER = 1954,
    WEBSTOREPRIVATE_LOGENTERPRISEPROMOSHOWN = 1955,
    WEBSTOREPRIVATE_ONENTERPRISEPROMOCLICK = 1956,
@@ -32,6 +32,7 @@ index ef1e808e09269..0d8e46d362f80 100644
 +  SIDEPANEL_BROWSEROSISOPEN = 1979,
 +  BROWSER_OS_GETBROWSEROSVERSIONNUMBER = 1980,
 +  BROWSER_OS_CHOOSEPATH = 1981,
++  BROWSER_OS_GETPERFSTATS = 1982,
    // Last entry: Add new entries above, then run:
    // tools/metrics/histograms/update_extension_histograms.py
    ENUM_BOUNDARY